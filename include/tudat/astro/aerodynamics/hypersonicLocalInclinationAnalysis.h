@@ -67,6 +67,12 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ *
+ * The coefficients at the (Mach number, angle of attack, angle of sideslip) grid points are independent of one another,
+ * and can be generated concurrently on multiple threads (with the grid partitioned by attitude, such that the panel
+ * inclinations are computed only once per attitude). Optionally, the resulting coefficient tables are stored in a
+ * binary cache file, keyed on the vehicle mesh and the analysis settings, from which they are reloaded when an analysis
+ * with identical geometry and settings is created.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -100,6 +106,11 @@ public:
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
      *  \param savePressureCoefficients Boolean denoting whether to save the pressure coefficients that are computed to files
+     *  \param numberOfThreads Number of threads to use for the generation of the coefficients (0 to use all available
+     *  hardware threads). Results do not depend on the number of threads that is used.
+     *  \param coefficientCacheDirectory Directory in which the generated coefficient tables are cached (no caching if
+     *  empty). If a cache file for the current geometry and settings exists in this directory, the coefficients are read
+     *  from it, instead of being generated. Not used if savePressureCoefficients is true.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -111,7 +122,9 @@ public:
             const double referenceArea,
             const double referenceLength,
             const Eigen::Vector3d& momentReferencePoint,
-            const bool savePressureCoefficients = false );
+            const bool savePressureCoefficients = false,
+            const unsigned int numberOfThreads = 1,
+            const std::string& coefficientCacheDirectory = "" );
 
     //! Default destructor.
     /*!
@@ -227,18 +240,11 @@ public:
 
         isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
 
-        for( unsigned int i = 0; i < inclination_.size( ); i++ )
-        {
-            for( unsigned int j = 0; j < inclination_.at( i ).size( ); j++ )
-            {
-                inclination_.at( i ).at( j ).clear( );
-                pressureCoefficient_.at( i ).at( j ).clear( );
-            }
-            inclination_.at( i ).clear( );
-            pressureCoefficient_.at( i ).clear( );
-        }
         inclination_.clear( );
         pressureCoefficient_.clear( );
+        panelSurfaceNormals_.clear( );
+        panelAreas_.clear( );
+        panelMomentArmsCrossNormals_.clear( );
 
         for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
         {
@@ -258,7 +264,9 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     * should have been set previously.
+     * should have been set previously. The grid of independent variables is partitioned by attitude (angle of attack
+     * and sideslip), and the coefficients at all Mach numbers for a single attitude are computed by a single task.
+     * These tasks are distributed over numberOfThreads_ threads.
      */
     void generateCoefficients( );
 
@@ -271,35 +279,42 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
+    //! Determine inclination angles of the panels of all parts.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
+     * Determines panel inclinations for all panels on all parts for given attitude, without modifying any member
+     * variables (so that it may be called concurrently). Outward pointing surface-normals are assumed!
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param panelInclinations Inclination angles of panels, per vehicle part (returned by reference).
      */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+    void computePanelInclinations( const double angleOfAttack,
+                                   const double angleOfSideslip,
+                                   std::vector< Eigen::VectorXd >& panelInclinations ) const;
 
-    //! Determine pressure coefficients on a given part.
+    //! Determine aerodynamic coefficients of the full vehicle.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * Determines aerodynamic coefficients of the full vehicle at given Mach number and panel inclinations, without
+     * modifying any member variables (so that it may be called concurrently).
+     * \param machNumber Mach number at which to perform analysis.
+     * \param panelInclinations Inclination angles of panels, per vehicle part.
+     * \param panelPressureCoefficients Pressure coefficients of panels, per vehicle part (returned by reference).
+     * \return Force and moment coefficients of vehicle.
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber,
+            const std::vector< Eigen::VectorXd >& panelInclinations,
+            std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const;
 
     //! Determine force coefficients of a part.
     /*!
      * Sums the pressure coefficients of given part and determines force coefficients from it by
      * non-dimensionalization with reference area.
      * \param partNumber Index from vehicleParts_ array for which determine coefficients.
+     * \param panelPressureCoefficients Pressure coefficients of panels on part.
      * \return Force coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    Eigen::Vector3d calculateForceCoefficients( const int partNumber,
+                                                const Eigen::VectorXd& panelPressureCoefficients ) const;
 
     //! Determine moment coefficients of a part.
     /*!
@@ -307,27 +322,72 @@ private:
      * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
      * dimensionalization is performed by product of referenceLength and referenceArea.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
+     * \param panelPressureCoefficients Pressure coefficients of panels on part.
      * \return Moment coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector3d calculateMomentCoefficients( const int partNumber,
+                                                 const Eigen::VectorXd& panelPressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of the pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Inclination angles of panels on part.
+     * \param panelPressureCoefficients Pressure coefficients of panels on part (modified by reference).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& panelInclinations,
+                                     Eigen::VectorXd& panelPressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of the pressure coefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Inclination angles of panels on part.
+     * \param panelPressureCoefficients Pressure coefficients of panels on part (modified by reference).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& panelInclinations,
+                                   Eigen::VectorXd& panelPressureCoefficients ) const;
+
+    //! Function to convert the pressure coefficients of all panels to a per-part, per-line, per-point list
+    /*!
+     * Function to convert the pressure coefficients of all panels to a per-part, per-line, per-point list, as returned
+     * by getPressureCoefficientList
+     * \param panelPressureCoefficients Pressure coefficients of panels, per vehicle part.
+     * \return Pressure coefficients with indices part-line-point.
+     */
+    std::vector< std::vector< std::vector< double > > > getPressureCoefficientGrid(
+            const std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const;
+
+    //! Function to retrieve the name of the cache file for the current geometry and settings
+    /*!
+     * Function to retrieve the name of the cache file for the current geometry and settings, which contains a hash of
+     * the panel geometry, independent variable data points, selected methods and reference quantities.
+     * \return Name of cache file (including coefficientCacheDirectory_)
+     */
+    std::string getCoefficientCacheFileName( ) const;
+
+    //! Function to read the aerodynamic coefficients from a cache file
+    /*!
+     * Function to read the aerodynamic coefficients from a cache file, if it exists and is consistent with the
+     * current geometry and settings.
+     * \param fileName Name of cache file
+     * \return True if the coefficients were successfully read, false otherwise.
+     */
+    bool readCoefficientsFromCacheFile( const std::string& fileName );
+
+    //! Function to write the aerodynamic coefficients to a cache file
+    /*!
+     * Function to write the aerodynamic coefficients to a cache file. The file is first written under a temporary
+     * name, and then renamed, so that analyses running concurrently never read a partially written file.
+     * \param fileName Name of cache file
+     */
+    void writeCoefficientsToCacheFile( const std::string& fileName ) const;
 
     //! Array of vehicle parts.
     /*!
@@ -335,6 +395,20 @@ private:
      */
     std::vector< std::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
 
+    //! Surface normals of the panels, per vehicle part.
+    /*!
+     * Surface normals of the panels, per vehicle part, stored contiguously (one column per panel). Panel index
+     * i * ( numberOfPoints - 1 ) + j contains the panel at line i and point j.
+     */
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
+
+    //! Areas of the panels, per vehicle part (with same panel indices as panelSurfaceNormals_).
+    std::vector< Eigen::VectorXd > panelAreas_;
+
+    //! Cross product of moment arm (from momentReferencePoint_ to panel centroid) and surface normal of the panels,
+    //! per vehicle part (with same panel indices as panelSurfaceNormals_).
+    std::vector< Eigen::Matrix3Xd > panelMomentArmsCrossNormals_;
+
     //! Multi-array as which indicates which coefficients have been calculated already.
     /*!
      * Multi-array as which indicates which coefficients have been calculated already. Indices of
@@ -342,42 +416,34 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Panel inclination angles.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Panel inclination angles at current values of independent variables, per vehicle part (with same panel
+     * indices as panelSurfaceNormals_).
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< Eigen::VectorXd > inclination_;
 
     //! Map of angle of attack and -sideslip pair and associated panel inclinations.
     /*!
      * Map of angle of attack and -sideslip pair and associated panel inclinations.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
+    std::map< std::pair< double, double >, std::vector< Eigen::VectorXd > > previouslyComputedInclinations_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Panel pressure coefficients.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Panel pressure coefficients at current values of independent variables, per vehicle part (with same panel
+     * indices as panelSurfaceNormals_).
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< Eigen::VectorXd > pressureCoefficient_;
 
     std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
 
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
-
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-    \
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
@@ -386,6 +452,12 @@ private:
     std::vector< std::vector< int > > selectedMethods_;
 
     bool savePressureCoefficients_;
+
+    //! Number of threads to use for the generation of the coefficients (0 to use all available hardware threads).
+    unsigned int numberOfThreads_;
+
+    //! Directory in which the generated coefficient tables are cached (no caching if empty).
+    std::string coefficientCacheDirectory_;
 };
 
 
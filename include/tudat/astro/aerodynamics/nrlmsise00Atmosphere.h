@@ -17,7 +17,8 @@
 #include <algorithm>
 
 #include <functional>
-#include <boost/functional/hash.hpp>
+#include <memory>
+#include <stdexcept>
 
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/astro/aerodynamics/atmosphereModel.h"
@@ -106,6 +107,59 @@ struct GasComponentProperties
     double molarMassAtomicOxygen;
 };
 
+//! Settings for the tabulated approximation of the NRLMSISE00 atmosphere model
+/*!
+ *  Settings for the tabulated approximation of the NRLMSISE00 atmosphere model (see
+ *  NRLMSISE00Atmosphere::setTabulationSettings). The model output is tabulated on a grid in altitude, local solar time
+ *  and latitude (for the solar activity of the current day), and interpolated linearly (logarithmically for the
+ *  densities) in between. The maximum relative density error that is allowed by the approximation is checked for each
+ *  grid cell, by comparing the interpolated density to the full model density at the center of the cell, when the cell
+ *  is first used. Cells for which this error is exceeded, as well as altitudes outside of the tabulated range, are
+ *  evaluated using the full model.
+ */
+struct NRLMSISE00TabulationSettings
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param minimumAltitude Minimum altitude of the table [m]
+     *  \param maximumAltitude Maximum altitude of the table [m]
+     *  \param altitudeStep Altitude step of the table [m]
+     *  \param localSolarTimeStep (Maximum) local solar time step of the table [hours]
+     *  \param latitudeStep (Maximum) latitude step of the table [rad]
+     *  \param maximumRelativeDensityError Maximum relative density error at the center of a cell for which the cell is
+     *  interpolated, instead of evaluated with the full model.
+     */
+    NRLMSISE00TabulationSettings(
+            const double minimumAltitude = 100.0E3,
+            const double maximumAltitude = 1000.0E3,
+            const double altitudeStep = 5.0E3,
+            const double localSolarTimeStep = 1.0,
+            const double latitudeStep = 5.0 * mathematical_constants::PI / 180.0,
+            const double maximumRelativeDensityError = 1.0E-2 ):
+        minimumAltitude_( minimumAltitude ), maximumAltitude_( maximumAltitude ), altitudeStep_( altitudeStep ),
+        localSolarTimeStep_( localSolarTimeStep ), latitudeStep_( latitudeStep ),
+        maximumRelativeDensityError_( maximumRelativeDensityError ){ }
+
+    //! Minimum altitude of the table [m]
+    double minimumAltitude_;
+
+    //! Maximum altitude of the table [m]
+    double maximumAltitude_;
+
+    //! Altitude step of the table [m]
+    double altitudeStep_;
+
+    //! (Maximum) local solar time step of the table [hours]
+    double localSolarTimeStep_;
+
+    //! (Maximum) latitude step of the table [rad]
+    double latitudeStep_;
+
+    //! Maximum relative density error at the center of a cell for which the cell is interpolated.
+    double maximumRelativeDensityError_;
+};
+
 
 //! NRLMSISE-00 atmosphere model class.
 /*!
@@ -137,7 +191,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const bool useIdealGasLaw = true )
         :nrlmsise00InputFunction_(nrlmsise00InputFunction)
     {
-        resetHashKey( );
+        setNumberOfStoredStates( 16 );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = 1.4;
         GasComponentProperties gasProperties;
@@ -145,16 +199,18 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         useIdealGasLaw_ = useIdealGasLaw;
     }
 
+    //! Constructor
+    /*!
+     * Constructor, from which the NRLMSISE00 model input is computed from solar activity data.
+     * \param solarActivityData Solar activity data, with the Julian day (at 0h) as key
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
     NRLMSISE00Atmosphere( const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
                           const bool useIdealGasLaw = true )
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
+        setSolarActivityData( solarActivityData );
 
-        resetHashKey( );
+        setNumberOfStoredStates( 16 );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = 1.4;
         GasComponentProperties gasProperties;
@@ -176,13 +232,9 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const GasComponentProperties gasProperties,
                          const bool useIdealGasLaw = true)
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
+        setSolarActivityData( solarActivityData );
 
-        resetHashKey( );
+        setNumberOfStoredStates( 16 );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = specificHeatRatio;
         gasComponentProperties_ = gasProperties;
@@ -198,6 +250,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void setGasComponentProperties( const GasComponentProperties gasComponentProperties)
     {
         gasComponentProperties_ = gasComponentProperties;
+        resetHashKey( );
     }
 
     //! Get local density.
@@ -213,7 +266,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                        const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return density_;
+        return getCurrentProperties( ).density;
     }
 
     //! Get local pressure.
@@ -237,7 +290,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         {
             throw std::runtime_error( "Error, non-ideal gas-law pressure-computation not yet implemented in NRLMSISE00Atmosphere." );
         }
-        return pressure_;
+        return getCurrentProperties( ).pressure;
     }
 
     //! Get local temperature.
@@ -253,7 +306,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                            const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return temperature_;
+        return getCurrentProperties( ).temperature;
     }
 
     //! Get local speed of sound.
@@ -269,7 +322,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return speedOfSound_;
+        return getCurrentProperties( ).speedOfSound;
     }
 
     //! Get local mean free path.
@@ -285,7 +338,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                             const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return meanFreePath_;
+        return getCurrentProperties( ).meanFreePath;
     }
 
     //! Get local mean molar mass.
@@ -301,7 +354,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return meanMolarMass_;
+        return getCurrentProperties( ).meanMolarMass;
     }
 
     //! get local number density of the gas components.
@@ -317,7 +370,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                                            const double latitude, const double time )
     {
         computeProperties( altitude, longitude, latitude, time );
-        return numberDensities_;
+        return getCurrentProperties( ).numberDensities;
     }
 
     //! Get local average number density.
@@ -333,7 +386,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return averageNumberDensity_;
+        return getCurrentProperties( ).averageNumberDensity;
     }
 
     //! Get local weighted average collision diameter.
@@ -349,7 +402,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                           const double latitude, const double time )
     {
         computeProperties(altitude, longitude, latitude, time );
-        return weightedAverageCollisionDiameter_;
+        return getCurrentProperties( ).weightedAverageCollisionDiameter;
     }
 
     //! Get the full model output
@@ -369,13 +422,58 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
 
     //! Reset the hash key
     /*!
-     * Resets the hash key, this allows re-computation even if the
-     * independent parameters haven't changed. Such as in the case of
-     * changes to the model.
+     * Resets the hash key, and clears the stored properties of all previously computed states. This allows
+     * re-computation even if the independent parameters haven't changed. Such as in the case of changes to the model.
      */
     void resetHashKey( )
     {
-        hashKey_ = 0;
+        currentStateIndex_ = -1;
+        nextStateIndex_ = 0;
+        numberOfValidStates_ = 0;
+        tabulatedYear_ = -1;
+        tabulatedDayOfTheYear_ = -1;
+    }
+
+    //! Function to set the number of most recently computed states for which the properties are stored
+    /*!
+     * Function to set the number of most recently computed states (altitude, longitude, latitude, time) for which the
+     * atmospheric properties are stored. Properties requested for any of these states are retrieved without
+     * re-evaluating the model, as is the case when evaluating the aerodynamic acceleration partials by central
+     * differences (for which the velocity perturbations, and the subsequent nominal evaluation, do not change the
+     * state of the atmosphere). Note that this assumes that the model input function returns the same input for
+     * the same independent variables, if not, resetHashKey must be called when its output changes.
+     * \param numberOfStoredStates Number of states for which properties are stored (at least 1)
+     */
+    void setNumberOfStoredStates( const unsigned int numberOfStoredStates )
+    {
+        if( numberOfStoredStates == 0 )
+        {
+            throw std::runtime_error( "Error in NRLMSISE00 atmosphere, the number of stored states must be at least 1" );
+        }
+        computedProperties_.resize( numberOfStoredStates );
+        resetHashKey( );
+    }
+
+    //! Function to set (or remove) the tabulated approximation of the model
+    /*!
+     * Function to set (or remove) the tabulated approximation of the model (see NRLMSISE00TabulationSettings). The
+     * table is filled as the model is evaluated, and cleared whenever the day of the model input changes. The
+     * approximation assumes that the model input (other than local solar time) is constant over each day, as is the
+     * case when the input is computed from solar activity data. It does not use the 3-hourly magnetic indices, nor
+     * the longitude and universal time dependence of the model at constant local solar time, and should therefore only
+     * be used when these terms are switched off (switches[ 10 ] set to 0), or their effect is negligible.
+     * \param tabulationSettings Settings for the tabulated approximation (nullptr to remove the approximation)
+     */
+    void setTabulationSettings( const std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings );
+
+    //! Function to retrieve the settings for the tabulated approximation of the model
+    /*!
+     * Function to retrieve the settings for the tabulated approximation of the model
+     * \return Settings for the tabulated approximation of the model (nullptr if the full model is used)
+     */
+    std::shared_ptr< NRLMSISE00TabulationSettings > getTabulationSettings( )
+    {
+        return tabulationSettings_;
     }
 
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > getSolarActivityContainer( )
@@ -390,7 +488,21 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
      */
     NRLMSISE00Input getNRLMSISE00Input( )
     {
-        return inputData_;
+        if( currentStateIndex_ < 0 )
+        {
+            return NRLMSISE00Input( );
+        }
+        return getCurrentProperties( ).inputData;
+    }
+
+    //! Function to get the table with the solar activity input to the model
+    /*!
+     *  Function to get the table with the solar activity input to the model
+     *  \return Table with the solar activity input to the model (nullptr if a custom input function is used)
+     */
+    std::shared_ptr< NRLMSISE00SolarActivityTable > getSolarActivityTable( )
+    {
+        return solarActivityTable_;
     }
 
  private:
@@ -401,45 +513,80 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     //! Use the ideal gas law for the computation of the pressure.
     bool useIdealGasLaw_;
 
-    //! Current key hash
-    size_t hashKey_;
+    //! Atmospheric properties computed by the model for a single state (altitude, longitude, latitude, time)
+    struct NRLMSISE00StateProperties
+    {
+        //! Altitude [m], longitude [rad], latitude [rad] and time (seconds since J2000) of state
+        double altitude;
+        double longitude;
+        double latitude;
+        double time;
+
+        //! Input data to NRLMSISE00 atmosphere model
+        NRLMSISE00Input inputData;
+
+        //! Output of NRLMSISE00 atmosphere model (see output_)
+        nrlmsise_output output;
+
+        //!  Local density (kg/m3)
+        double density;
 
-    //!  Current local density (kg/m3)
-    double density_;
+        //! Local temperature (K)
+        double temperature;
 
-    //! Current local temperature (K)
-    double temperature_;
+        //! Local pressure (Implemented with ideal gass law only!)
+        double pressure;
 
-    //! Current local pressure (Implemented with ideal gass law only!)
-    double pressure_;
+        //! Speed of sound (m/s)
+        double speedOfSound;
 
-    //! Current speed of sound (m/s)
-    double speedOfSound_;
+        //! Mean free path (m)
+        double meanFreePath;
 
-    //! Current mean free path (m)
-    double meanFreePath_;
+        /*!
+         *  Number densities of gas components
+         *      numberDensities[0] - HE NUMBER DENSITY     (M-3)
+         *      numberDensities[1] - O NUMBER DENSITY      (M-3)
+         *      numberDensities[2] - N2 NUMBER DENSITY     (M-3)
+         *      numberDensities[3] - O2 NUMBER DENSITY     (M-3)
+         *      numberDensities[4] - AR NUMBER DENSITY     (M-3)
+         *      numberDensities[5] - H NUMBER DENSITY      (M-3)
+         *      numberDensities[6] - N NUMBER DENSITY      (M-3)
+         *      numberDensities[7] - Anomalous oxygen NUMBER DENSITY   (M-3)
+         */
+        std::vector< double > numberDensities;
 
+        //! Average number density (M-3)
+        double averageNumberDensity;
+
+        //! Weighted average of the collision diameter using the number density as weights in (M)
+        double weightedAverageCollisionDiameter;
+
+        //! mean molar mass (kg/mole)
+        double meanMolarMass;
+    };
+
+    //! Function to retrieve the properties of the most recently requested state
     /*!
-     *  Current number densities of gas components
-     *      numberDensities_[0] - HE NUMBER DENSITY     (M-3)
-     *      numberDensities_[1] - O NUMBER DENSITY      (M-3)
-     *      numberDensities_[2] - N2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[3] - O2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[4] - AR NUMBER DENSITY     (M-3)
-     *      numberDensities_[5] - H NUMBER DENSITY      (M-3)
-     *      numberDensities_[6] - N NUMBER DENSITY      (M-3)
-     *      numberDensities_[7] - Anomalous oxygen NUMBER DENSITY   (M-3)
+     * Function to retrieve the properties of the most recently requested state
+     * \return Properties of the most recently requested state
      */
-    std::vector< double > numberDensities_;
+    const NRLMSISE00StateProperties& getCurrentProperties( )
+    {
+        return computedProperties_[ currentStateIndex_ ];
+    }
 
-    //! Current average number density (M-3)
-    double averageNumberDensity_;
+    //! Properties of the most recently computed states (used as a circular buffer)
+    std::vector< NRLMSISE00StateProperties > computedProperties_;
 
-    //! Current weighted average of the collision diameter using the number density as weights in (M)
-    double weightedAverageCollisionDiameter_;
+    //! Index in computedProperties_ of most recently requested state (-1 if none)
+    int currentStateIndex_;
 
-    //! mean molar mass (kg/mole)
-    double meanMolarMass_;
+    //! Index in computedProperties_ in which the next newly computed state is to be stored
+    unsigned int nextStateIndex_;
+
+    //! Number of entries of computedProperties_ that contain a computed state
+    unsigned int numberOfValidStates_;
 
     //! Data structure that contains the colision diameter
     GasComponentProperties gasComponentProperties_;
@@ -521,26 +668,6 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
      */
     nrlmsise_output output_;
 
-    //! Get Hash Key.
-    /*!
-     * Returns hash key value based on a vector of keys
-     * \param altitude Altitude [m].
-     * \param longitude Longitude [rad].
-     * \param latitude Latitude [rad].
-     * \param time time.
-     * \return hash key value.
-     */
-    size_t hashFunc( const double altitude, const double longitude,
-                     const double latitude, const double time )
-    {
-        size_t seed = 0;
-        boost::hash_combine( seed, boost::hash< double >( )( altitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( longitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( latitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( time ) );
-        return seed;
-    }
-
     //! Compute the local atmospheric properties.
     /*!
      * Computes the local atmospheric density, pressure and temperature.
@@ -552,10 +679,105 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void computeProperties( const double altitude, const double longitude,
                             const double latitude, const double time );
 
-    //! Input data to NRLMSISE00 atmosphere model
-    NRLMSISE00Input inputData_;
+    //! Function to evaluate the full NRLMSISE00 model at a given position
+    /*!
+     * Function to evaluate the full NRLMSISE00 model at a given position (setting input_, aph_ and flags_).
+     * \param inputData Input data to NRLMSISE00 atmosphere model
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param secondOfTheDay Number of seconds into the current day (overriding value in inputData).
+     * \param localSolarTime Local solar time at the computation position (overriding value in inputData).
+     * \param output Output of the model (returned by reference)
+     */
+    void evaluateModel( const NRLMSISE00Input& inputData,
+                        const double altitude, const double longitude, const double latitude,
+                        const double secondOfTheDay, const double localSolarTime,
+                        nrlmsise_output& output );
+
+    //! Function to compute the output of the model from the tabulated approximation (if possible)
+    /*!
+     * Function to compute the output of the model from the tabulated approximation, if the state is inside the table,
+     * and the approximation error of the associated grid cell is within the tolerance. Any grid nodes that are required,
+     * but not yet computed, are computed by this function, as is the error check of the grid cell, if it is not yet
+     * performed.
+     * \param inputData Input data to NRLMSISE00 atmosphere model at current state
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param output Output of the model (returned by reference)
+     * \return True if the output is computed from the tabulated approximation, false if the full model is to be used.
+     */
+    bool computeTabulatedOutput( const NRLMSISE00Input& inputData,
+                                 const double altitude, const double latitude,
+                                 nrlmsise_output& output );
+
+    //! Function to interpolate the tabulated model output in a single grid cell
+    /*!
+     * Function to interpolate the tabulated model output in a single grid cell, computing any nodes of the cell that are
+     * not yet computed.
+     * \param inputData Input data to NRLMSISE00 atmosphere model for current day
+     * \param cellIndices Indices of the cell (lowest altitude, local solar time and latitude indices of its nodes)
+     * \param fractions Fractional position in the cell, in altitude, local solar time and latitude (between 0 and 1)
+     * \param output Interpolated output of the model (returned by reference)
+     */
+    void interpolateTabulatedOutput( const NRLMSISE00Input& inputData,
+                                     const unsigned int cellIndices[ 3 ], const double fractions[ 3 ],
+                                     nrlmsise_output& output );
+
+    //! Function to retrieve the index of the first entry of a node in tabulatedOutputs_, computing the node if needed
+    /*!
+     * Function to retrieve the index of the first entry of a node in tabulatedOutputs_, computing the model output at
+     * the node if this has not yet been done.
+     * \param inputData Input data to NRLMSISE00 atmosphere model for current day
+     * \param altitudeIndex Altitude index of the node
+     * \param localSolarTimeIndex Local solar time index of the node
+     * \param latitudeIndex Latitude index of the node
+     * \return Index of the first entry of the node in tabulatedOutputs_
+     */
+    unsigned int getTabulatedNodeIndex( const NRLMSISE00Input& inputData,
+                                        const unsigned int altitudeIndex,
+                                        const unsigned int localSolarTimeIndex,
+                                        const unsigned int latitudeIndex );
+
+    //! Function to set the solar activity data from which the model input is computed
+    /*!
+     * Function to set the solar activity data from which the model input is computed
+     * \param solarActivityData Solar activity data, with the Julian day (at 0h) as key
+     */
+    void setSolarActivityData( const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityData )
+    {
+        solarActivityTable_ = std::make_shared< NRLMSISE00SolarActivityTable >( solarActivityData );
+        nrlmsise00InputFunction_ = std::bind( &NRLMSISE00SolarActivityTable::getNRLMSISE00Input, solarActivityTable_,
+                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
+                   false, TUDAT_NAN );
+        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
+                    solarActivityData );
+    }
+
+    //! Table with the solar activity input to the model (nullptr if a custom input function is used)
+    std::shared_ptr< NRLMSISE00SolarActivityTable > solarActivityTable_;
 
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer_;
+
+    //! Settings for the tabulated approximation of the model (nullptr if the full model is used)
+    std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings_;
+
+    //! Number of nodes in the table, in altitude, local solar time and latitude.
+    unsigned int numberOfTabulatedNodes_[ 3 ];
+
+    //! Step size of the table, in altitude [km], local solar time [hours] and latitude [deg].
+    double tabulationSteps_[ 3 ];
+
+    //! Year and day of the year for which the table is filled (-1 if the table is empty).
+    int tabulatedYear_;
+    int tabulatedDayOfTheYear_;
+
+    //! Tabulated model output for each node (logarithms of d[0]-d[8], and t[0], t[1] of nrlmsise_output), NaN for
+    //! nodes that are not yet computed.
+    std::vector< double > tabulatedOutputs_;
+
+    //! Status of each grid cell of the table (0: not yet checked; 1: interpolated; 2: evaluated with full model)
+    std::vector< unsigned char > tabulatedCellStatus_;
 };
 
 }  // namespace aerodynamics
@@ -109,6 +109,117 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! Class containing the solar activity input to the NRLMSISE00 model, precomputed for each day.
+/*!
+ *  Class containing the solar activity input to the NRLMSISE00 model (year, fluxes and magnetic indices), precomputed
+ *  for each day covered by a solar activity data map. The data for a given day is retrieved by direct indexing (from
+ *  the Julian day), instead of a lookup in the solar activity data map, and the NRLMSISE00 input is updated in place,
+ *  so that no memory is allocated when updating the input for a new time/position. The input that is produced is
+ *  identical to that of the nrlmsiseInputFunction function (for days on which no solar activity data is available, the
+ *  data of the first subsequent day with data is used).
+ */
+class NRLMSISE00SolarActivityTable
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, precomputes the NRLMSISE00 solar activity input for each day between the first and last entry
+     *  of the solar activity data map.
+     *  \param solarActivityMap Solar activity data, with the Julian day (at 0h) as key
+     */
+    NRLMSISE00SolarActivityTable(
+            const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap );
+
+    //! Function to update the NRLMSISE00 input for a given time and position
+    /*!
+     *  Function to update the NRLMSISE00 input for a given time and position, identical to the output of the
+     *  nrlmsiseInputFunction function. The switches of the input are not modified.
+     *  \param nrlmsiseInputData NRLMSISE00 input that is to be updated (returned by reference)
+     *  \param longitude Longitude at which output is to be computed [rad].
+     *  \param time Time at which output is to be computed (seconds since J2000).
+     *  \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with
+     *  localSolarTime input.
+     *  \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+     */
+    void updateNRLMSISE00Input( NRLMSISE00Input& nrlmsiseInputData,
+                                const double longitude, const double time,
+                                const bool adjustSolarTime = false, const double localSolarTime = 0.0 ) const;
+
+    //! Function to retrieve the NRLMSISE00 input for a given time and position
+    /*!
+     *  Function to retrieve the NRLMSISE00 input for a given time and position, identical to the output of the
+     *  nrlmsiseInputFunction function. The first and third input (altitude and latitude) are not used, but are
+     *  retained so that this function has the same signature as nrlmsiseInputFunction.
+     *  \param longitude Longitude at which output is to be computed [rad].
+     *  \param time Time at which output is to be computed (seconds since J2000).
+     *  \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with
+     *  localSolarTime input.
+     *  \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+     *  \return NRLMSISE00 input at given time and position
+     */
+    NRLMSISE00Input getNRLMSISE00Input( const double, const double longitude,
+                                        const double, const double time,
+                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 ) const
+    {
+        NRLMSISE00Input nrlmsiseInputData;
+        updateNRLMSISE00Input( nrlmsiseInputData, longitude, time, adjustSolarTime, localSolarTime );
+        return nrlmsiseInputData;
+    }
+
+    //! Function to retrieve the Julian day (at 0h) of the first day in the table
+    /*!
+     *  Function to retrieve the Julian day (at 0h) of the first day in the table
+     *  \return Julian day (at 0h) of the first day in the table
+     */
+    double getFirstJulianDay( ) const
+    {
+        return firstJulianDay_;
+    }
+
+    //! Function to retrieve the number of days in the table
+    /*!
+     *  Function to retrieve the number of days in the table
+     *  \return Number of days in the table
+     */
+    unsigned int getNumberOfDays( ) const
+    {
+        return years_.size( );
+    }
+
+private:
+
+    //! Function to retrieve the index in the table of a given day
+    /*!
+     *  Function to retrieve the index in the table of a given day. Days before the first day in the table are
+     *  mapped to the first day. An exception is thrown if the day is after the last day in the table.
+     *  \param julianDay Julian day (at 0h) for which the index is to be retrieved
+     *  \return Index in the table of the given day
+     */
+    unsigned int getDayIndex( const double julianDay ) const;
+
+    //! Julian day (at 0h) of the first day in the table
+    double firstJulianDay_;
+
+    //! Year of the solar activity data used for each day
+    std::vector< int > years_;
+
+    //! Julian day (at 0h) of the first of January of the year in years_, for each day
+    std::vector< double > julianDaysOnFirstOfJanuary_;
+
+    //! Daily F10.7 flux for previous day, for each day
+    std::vector< double > f107_;
+
+    //! 81 day average of F10.7 flux, for each day
+    std::vector< double > f107a_;
+
+    //! Daily magnetic index, for each day
+    std::vector< double > apDaily_;
+
+    //! Magnetic index data vector, for each day
+    std::vector< std::vector< double > > apVectors_;
+};
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
@@ -20,7 +20,9 @@
 #include "tudat/astro/basic_astro/bodyShapeModel.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
+#include <atomic>
 #include <iostream>
+#include <vector>
 
 namespace tudat
 {
@@ -53,15 +55,20 @@ public:
         verticesDefiningEachFacet_( verticesDefiningEachFacet ),
         computeAltitudeWithSign_( computeAltitudeWithSign ),
         justComputeDistanceToVertices_( justComputeDistanceToVertices ),
-        averageRadius_( TUDAT_NAN )
+        averageRadius_( TUDAT_NAN ),
+        previousClosestVertexId_( -1 )
     {
         // Check if provided settings are valid
         basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
 
-        // If necessary, get list with vertices defining each edge
+        // Create search tree used to find the closest vertex
+        buildVertexSearchTree( );
+
+        // If necessary, get list with vertices defining each edge, and the features connected to each vertex
         if ( !justComputeDistanceToVertices_ )
         {
             computeVerticesDefiningEachEdge();
+            computeFeaturesConnectedToEachVertex();
         }
     }
 
@@ -73,6 +80,9 @@ public:
      *  Function to calculate the altitude above the polyhedron from a body fixed position.
      *  Function computes the minimum distance to each of the polyhedron features (vertices, edges and facets); the
      *  distance is only computed wrt to the edges and facets around the closest vertex. See Avillez (2022).
+     *  The closest vertex is found using a k-d tree of the vertices (built at construction), using the closest vertex of
+     *  the previous call as initial guess, and the edges and facets around it are retrieved from precomputed lists, so
+     *  that the cost of the computation without sign scales with the logarithm of the number of vertices.
      *  \param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
      *  \return Altitude above the polyhedron.
@@ -130,6 +140,25 @@ private:
     double computeDistanceToClosestVertex( const Eigen::Vector3d& bodyFixedPosition,
                                            unsigned int& closestVertexId);
 
+    /*! Searches the part of the vertex search tree with the given bounds for a vertex closer than the current closest one.
+     *
+     * Searches the part of the vertex search tree with the given bounds (and median vertex as root) for a vertex closer
+     * to the field point than the current closest vertex, and updates the closest vertex if found. In case of equal
+     * distance, the vertex with the lowest index is selected.
+     * @param bodyFixedPosition Cartesian, body-fixed position of the field point.
+     * @param startIndex Index of the first entry of vertexSearchTree_ in the part of the tree that is to be searched.
+     * @param endIndex Index after the last entry of vertexSearchTree_ in the part of the tree that is to be searched.
+     * @param splitDimension Coordinate (0, 1 or 2) along which the part of the tree is split at its root.
+     * @param closestSquaredDistance Squared distance to closest vertex (updated by function).
+     * @param closestVertexId Index of closest vertex (updated by function).
+     */
+    void searchClosestVertexInTree( const Eigen::Vector3d& bodyFixedPosition,
+                                    const unsigned int startIndex,
+                                    const unsigned int endIndex,
+                                    const unsigned int splitDimension,
+                                    double& closestSquaredDistance,
+                                    unsigned int& closestVertexId );
+
     /*! Computes the distance to the facet closest to the field point.
      *
      * Computes the distance to the facet closest to the field point, according to Avillez (2022). The distance is
@@ -137,11 +166,11 @@ private:
      * function returns NAN. The returned distance is unsigned.
      * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
-     * @param verticesDefiningEachFacetToEvaluate Facets wrt which the distance is to be computed.
+     * @param facetsToEvaluate Indices of the facets wrt which the distance is to be computed.
      * @return Distance to closest facet.
      */
     double computeDistanceToClosestFacet ( const Eigen::Vector3d& bodyFixedPosition,
-                                           const Eigen::MatrixXi& verticesDefiningEachFacetToEvaluate );
+                                           const std::vector< unsigned int >& facetsToEvaluate );
 
     /*! Computes the distance to the edge closest to the field point.
      *
@@ -150,11 +179,11 @@ private:
      * function returns NAN. The returned distance is unsigned.
      * @param bodyFixedPosition Cartesian, body-fixed position of the point at which the altitude
      *  is to be determined.
-     * @param verticesDefiningEachEdgeToEvaluate Edges wrt which the distance is to be computed.
+     * @param edgesToEvaluate Indices of the edges wrt which the distance is to be computed.
      * @return Distance to closest edge.
      */
     double computeDistanceToClosestEdge ( const Eigen::Vector3d& bodyFixedPosition,
-                                          const Eigen::MatrixXi& verticesDefiningEachEdgeToEvaluate );
+                                          const std::vector< unsigned int >& edgesToEvaluate );
 
     /*! Computes the matrix with the indices of the vertices defining each edge.
      *
@@ -162,6 +191,19 @@ private:
      */
     void computeVerticesDefiningEachEdge( );
 
+    /*! Builds the k-d tree used to search for the vertex closest to the field point.
+     *
+     * Builds the k-d tree used to search for the vertex closest to the field point; saves the tree to vertexSearchTree_.
+     */
+    void buildVertexSearchTree( );
+
+    /*! Computes the lists with the vertices, edges and facets connected to each vertex.
+     *
+     * Computes the lists with the vertices, edges and facets connected to each vertex; saves the lists to
+     * verticesConnectedToEachVertex_, edgesContainingEachVertex_ and facetsContainingEachVertex_.
+     */
+    void computeFeaturesConnectedToEachVertex( );
+
 
     // Matrix with coordinates of the polyhedron vertices.
     Eigen::MatrixXd verticesCoordinates_;
@@ -183,6 +225,23 @@ private:
     // Average radius of the polyhedron
     double averageRadius_;
 
+    // Indices of the vertices, ordered as an implicit k-d tree: the root of each (sub)tree is the median entry of its
+    // range, with the split dimension cycling through x, y and z with the depth in the tree.
+    std::vector< unsigned int > vertexSearchTree_;
+
+    // List of vertices connected to each vertex by an edge.
+    std::vector< std::vector< unsigned int > > verticesConnectedToEachVertex_;
+
+    // List of edges containing each vertex.
+    std::vector< std::vector< unsigned int > > edgesContainingEachVertex_;
+
+    // List of facets containing each vertex.
+    std::vector< std::vector< unsigned int > > facetsContainingEachVertex_;
+
+    // Index of the closest vertex found in the previous call to getAltitude (-1 if none), used as initial guess. Atomic
+    // as the shape model may be used by multiple threads (only used as a guess, so no further synchronization needed).
+    std::atomic< int > previousClosestVertexId_;
+
 };
 
 } // namespace basic_astrodynamics
@@ -11,6 +11,8 @@
  *      A. Dobrovolskis (1996), "Inertia of Any Polyhedron", Icarus, 124 (243), 698-704
  *      D.J. Scheeres (2012), "Orbital Motion in Strongly Perturbed Environments: Applications to Asteroid, Comet and
  *          Planetary Satellite Orbiters", Springer-Praxis.
+ *      A. Grundmann, H.M. Moller (1978), "Invariant Integration Formulas for the N-Simplex by Combinatorial Methods",
+ *          SIAM Journal on Numerical Analysis, 15 (2), 282-290
  */
 
 #ifndef TUDAT_POLYHEDRONFUNTIONS_H
@@ -116,6 +118,41 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
                                                 const double gravitationalParameter,
                                                 const double gravitationalConstant );
 
+/*! Computes the radius of the Brillouin sphere of a polyhedron.
+ *
+ * Computes the radius of the Brillouin sphere of a polyhedron, i.e. the smallest sphere centered at the origin of the
+ * frame in which the vertices are defined that encloses the polyhedron. A spherical harmonic expansion of the gravity
+ * field of the polyhedron (with that same origin) is only guaranteed to converge outside of this sphere.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @return Radius of the Brillouin sphere.
+ */
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates );
+
+/*! Computes the spherical harmonic coefficients of the gravity field of a constant-density polyhedron.
+ *
+ * Computes the geodesy-normalized spherical harmonic coefficients of the gravity field of a constant-density
+ * polyhedron, with the coefficients normalized by the mass of the polyhedron (such that the degree 0 coefficient is
+ * 1). The volume integrals defining the coefficients are evaluated over the tetrahedra formed by each facet and the
+ * origin, using a Grundmann-Moller quadrature rule (Grundmann and Moller, 1978) that is exact for the polynomials that
+ * define the solid harmonics up to the maximum degree. The coefficients are therefore exact up to round-off errors.
+ *
+ * @param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ * @param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ * @param maximumDegree Maximum degree (and order) of the coefficients.
+ * @param referenceRadius Reference radius of the spherical harmonic expansion.
+ * @param cosineCoefficients Geodesy-normalized cosine coefficients, with the row and column index denoting the degree
+ * and order (output).
+ * @param sineCoefficients Geodesy-normalized sine coefficients, with the row and column index denoting the degree
+ * and order (output).
+ */
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients );
+
 } // namespace basic_astrodynamics
 } // namespace tudat
 
@@ -12,6 +12,10 @@
 #ifndef TUDAT_EARTHORIENTATIONCALCULATOR_H
 #define TUDAT_EARTHORIENTATIONCALCULATOR_H
 
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
@@ -357,6 +361,110 @@ createInterpolatorsForItrsToGcrsAngles(
 
 }
 
+//! Class that provides the Earth orientation angles and UT1 by interpolation of lazily tabulated values.
+/*!
+ *  Class that provides the Earth orientation angles and UT1 by interpolation of lazily tabulated values, to reduce the
+ *  computation time of Earth rotation during orbit propagation/estimation. The values computed by an
+ *  EarthOrientationAnglesCalculator are tabulated on a fixed grid (t = i * timeStep), and evaluated using Lagrange
+ *  interpolation, centered on the requested time. The grid is extended (in blocks) whenever a time outside of the
+ *  current grid is requested, so that no time interval needs to be provided in advance. UT1 is tabulated as the
+ *  difference w.r.t. the input time, which is continuous and slowly varying. The object may be evaluated concurrently
+ *  from multiple threads: the tabulated data is read under a shared lock, and only extended under an exclusive lock.
+ *
+ *  With the default settings (time step of 1 hour, 8 interpolation points), the interpolation error of the (sub-)diurnal
+ *  corrections is negligible. The error is dominated by the kinks in the linearly interpolated daily IERS values used by
+ *  the underlying calculator, and is of order 1E-10 rad in the resulting rotation (below 1 mm on the Earth's surface).
+ */
+class TabulatedEarthOrientationAnglesCalculator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param anglesCalculator Object from which Earth orientation data is to be retrieved at the grid points.
+     *  \param inputTimeScale Time scale in which input times are provided.
+     *  \param timeStep Time step between grid points at which rotation data is tabulated.
+     *  \param numberOfInterpolationPoints Number of grid points used for the Lagrange interpolation (must be even).
+     */
+    TabulatedEarthOrientationAnglesCalculator(
+            const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+            const basic_astrodynamics::TimeScales inputTimeScale = basic_astrodynamics::tdb_scale,
+            const double timeStep = 3600.0,
+            const int numberOfInterpolationPoints = 8 );
+
+    //! Function to compute the rotation angles from ITRS to GCRS at a given time, by interpolation
+    /*!
+     *  Function to compute the rotation angles from ITRS to GCRS at a given time, by interpolation of tabulated data.
+     *  Grid points are computed when first needed.
+     *  \param timeValue Time (in input time scale) at which rotation angles are to be computed.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p.
+     *  Second defines UT1.
+     */
+    std::pair< Eigen::Vector5d, double > getRotationAnglesFromItrsToGcrs( const double timeValue );
+
+    //! Function to get object from which Earth orientation data is computed at the grid points.
+    std::shared_ptr< EarthOrientationAnglesCalculator > getAnglesCalculator( )
+    { return anglesCalculator_; }
+
+    //! Function to get time step between grid points.
+    double getTimeStep( )
+    { return timeStep_; }
+
+    //! Function to get number of grid points used for the Lagrange interpolation.
+    int getNumberOfInterpolationPoints( )
+    { return numberOfInterpolationPoints_; }
+
+    //! Function to get number of grid points at which rotation data has been computed.
+    int getNumberOfTabulatedPoints( )
+    {
+        std::shared_lock< std::shared_mutex > readLock( tabulationMutex_ );
+        return static_cast< int >( tabulatedValues_.size( ) );
+    }
+
+private:
+
+    //! Function to ensure that rotation data is tabulated on all grid points in the given interval of indices.
+    void extendTabulatedValues( const long firstRequiredIndex, const long lastRequiredIndex );
+
+    //! Function to check whether rotation data is tabulated on all grid points in the given interval of indices.
+    bool areValuesTabulated( const long firstRequiredIndex, const long lastRequiredIndex )
+    {
+        return ( firstRequiredIndex >= firstTabulatedIndex_ &&
+                 lastRequiredIndex < firstTabulatedIndex_ + static_cast< long >( tabulatedValues_.size( ) ) );
+    }
+
+    //! Function to interpolate the tabulated data, starting at the given grid index (data must be tabulated).
+    Eigen::Matrix< double, 6, 1 > interpolateTabulatedValues( const double scaledTime, const long firstIndex );
+
+    //! Function to compute the rotation data at a given grid point.
+    Eigen::Matrix< double, 6, 1 > computeTabulatedValue( const long gridIndex );
+
+    //! Object from which Earth orientation data is computed at the grid points.
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator_;
+
+    //! Time scale in which input times are provided.
+    basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Time step between grid points.
+    double timeStep_;
+
+    //! Number of grid points used for the Lagrange interpolation.
+    int numberOfInterpolationPoints_;
+
+    //! Denominators of the Lagrange polynomials on a uniform grid with unit spacing.
+    std::vector< double > lagrangeDenominators_;
+
+    //! Grid index of first entry of tabulatedValues_.
+    long firstTabulatedIndex_;
+
+    //! Tabulated data at subsequent grid points: X, Y, s, x_p, y_p, UT1 minus input time.
+    std::deque< Eigen::Matrix< double, 6, 1 > > tabulatedValues_;
+
+    //! Mutex protecting tabulatedValues_ and firstTabulatedIndex_ (exclusively locked only when extending the grid).
+    std::shared_mutex tabulationMutex_;
+};
+
 }
 
 }
@@ -13,6 +13,7 @@
 #define TUDAT_TERRESTRIALTIMESCALECONVERTER_H
 
 #include <functional>
+#include <mutex>
 
 #include "tudat/math/interpolators/oneDimensionalInterpolator.h"
 #include "tudat/basics/timeType.h"
@@ -130,7 +131,8 @@ public:
         }
         else
         {
-            // Check if update is required
+            // Check if update is required (current times are shared between threads, and protected by mutex)
+            std::lock_guard< std::recursive_mutex > timesLock( currentTimesMutex_ );
             if( !( static_cast< TimeType >( getCurrentTimeList< TimeType >( ).getTimeValue( inputScale ) ) ==
                    static_cast< TimeType >( inputTimeValue ) ) ||
                     !( getPreviousGroundStationPosition< TimeType >( ) == earthFixedPosition ) )
@@ -146,6 +148,7 @@ public:
     template< typename TimeType >
     void resetTimes( )
     {
+        std::lock_guard< std::recursive_mutex > timesLock( currentTimesMutex_ );
         CurrentTimes< TimeType >& timesToUpdate = getCurrentTimeList< TimeType >( );
         timesToUpdate.tai = TUDAT_NAN;
         timesToUpdate.tt = TUDAT_NAN;
@@ -166,6 +169,7 @@ public:
                       const Eigen::Vector3d& earthFixedPosition )
     {
         // Retrieve CurrentTimes object that is to be updated
+        std::lock_guard< std::recursive_mutex > timesLock( currentTimesMutex_ );
         CurrentTimes< TimeType >& timesToUpdate = getCurrentTimeList< TimeType >( );
 
         // Convert position to SOFA input valies
@@ -337,6 +341,9 @@ private:
 
     //! Value of ground station position used on last call to updateTimes< Time > function
     Eigen::Vector3d previousEarthFixedPositionSplit_;
+
+    //! Mutex protecting the current times and ground station positions, so that conversions may be run concurrently
+    std::recursive_mutex currentTimesMutex_;
 };
 
 //! Function to create the default Earth time scales conversion object
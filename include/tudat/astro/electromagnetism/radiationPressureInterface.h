@@ -192,6 +192,16 @@ public:
         return radiationPressureCoefficient_;
     }
 
+    //! Function to return the function returning the radiation pressure coefficient of the target body.
+    /*!
+     *  Function to return the function returning the radiation pressure coefficient of the target body.
+     *  \return Function returning the radiation pressure coefficient of the target body, as a function of time.
+     */
+    std::function< double( const double ) > getRadiationPressureCoefficientFunction( ) const
+    {
+        return radiationPressureCoefficientFunction_;
+    }
+
     //! Function to reset a constant radiation pressure coefficient of the target body.
     /*!
      *  Function to reset a constant radiation pressure coefficient of the target body.
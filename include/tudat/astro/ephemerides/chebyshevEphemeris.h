@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Ephemeris derived class that evaluates piecewise Chebyshev polynomials, fitted to an arbitrary state function.
+/*!
+ *  Ephemeris derived class that evaluates piecewise Chebyshev polynomials, fitted to an arbitrary state function
+ *  (typically a Spice kernel). Upon construction, the time interval is divided into segments of at most a user-defined
+ *  duration. On each segment, the position and velocity are fitted by Chebyshev polynomials of a given degree, using the
+ *  values at the Chebyshev nodes. The fit is verified at the extrema of the highest-degree Chebyshev polynomial, and
+ *  the segment is bisected until the fit error is below the user-defined tolerances. After construction, no
+ *  member is modified, so that the state can be retrieved concurrently from any number of threads.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Class constructor, fits the Chebyshev polynomials to the state function.
+    /*!
+     *  Class constructor, fits the Chebyshev polynomials to the state function.
+     *  \param stateFunction Function returning the Cartesian state that is to be approximated, as a function of time.
+     *  \param initialTime Start of time interval on which the ephemeris is valid.
+     *  \param finalTime End of time interval on which the ephemeris is valid.
+     *  \param positionTolerance Maximum position error of the fit (in m) at the verification points.
+     *  \param velocityTolerance Maximum velocity error of the fit (in m/s) at the verification points.
+     *  \param polynomialDegree Degree of the Chebyshev polynomials on each segment.
+     *  \param maximumSegmentDuration Maximum duration of a single segment.
+     *  \param referenceFrameOrigin Origin of reference frame (string identifier).
+     *  \param referenceFrameOrientation Orientation of reference frame (string identifier).
+     *  \param maximumNumberOfBisections Maximum number of times a single segment may be bisected to meet the
+     *  tolerances, an exception is thrown if this number is exceeded.
+     */
+    ChebyshevEphemeris( const std::function< Eigen::Vector6d( const double ) > stateFunction,
+                        const double initialTime,
+                        const double finalTime,
+                        const double positionTolerance,
+                        const double velocityTolerance,
+                        const int polynomialDegree,
+                        const double maximumSegmentDuration,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000",
+                        const int maximumNumberOfBisections = 30 );
+
+    //! Function to get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time, by evaluating the Chebyshev polynomials of the segment in which
+     *  the time lies. An exception is thrown if the time is outside the interval on which the polynomials were fitted.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Cartesian state at given time.
+     */
+    Eigen::Vector6d getCartesianState(
+            const double secondsSinceEpoch );
+
+    //! Function to get the start of time interval on which the ephemeris is valid.
+    /*!
+     *  Function to get the start of time interval on which the ephemeris is valid.
+     *  \return Start of time interval on which the ephemeris is valid.
+     */
+    double getInitialTime( ) const
+    {
+        return segmentBoundaries_.front( );
+    }
+
+    //! Function to get the end of time interval on which the ephemeris is valid.
+    /*!
+     *  Function to get the end of time interval on which the ephemeris is valid.
+     *  \return End of time interval on which the ephemeris is valid.
+     */
+    double getFinalTime( ) const
+    {
+        return segmentBoundaries_.back( );
+    }
+
+    //! Function to get the number of segments into which the time interval was divided.
+    /*!
+     *  Function to get the number of segments into which the time interval was divided.
+     *  \return Number of segments into which the time interval was divided.
+     */
+    unsigned int getNumberOfSegments( ) const
+    {
+        return segmentCoefficients_.size( );
+    }
+
+    //! Function to get the boundaries of the segments (one more entry than the number of segments).
+    /*!
+     *  Function to get the boundaries of the segments (one more entry than the number of segments).
+     *  \return Boundaries of the segments.
+     */
+    const std::vector< double >& getSegmentBoundaries( ) const
+    {
+        return segmentBoundaries_;
+    }
+
+private:
+
+    //! Function to fit the Chebyshev polynomials on a single segment.
+    /*!
+     *  Function to fit the Chebyshev polynomials on a single segment, and verify the fit against the state function.
+     *  \param segmentStartTime Start time of segment.
+     *  \param segmentEndTime End time of segment.
+     *  \param coefficients Chebyshev coefficients of the segment (returned by reference), with the coefficients of
+     *  the j-th polynomial in column j.
+     *  \return True if the fit meets the position and velocity tolerances, false otherwise.
+     */
+    bool fitSegment( const double segmentStartTime,
+                     const double segmentEndTime,
+                     Eigen::Matrix< double, 6, Eigen::Dynamic >& coefficients );
+
+    //! Function to evaluate the Chebyshev polynomials of a segment, using Clenshaw's recurrence.
+    /*!
+     *  Function to evaluate the Chebyshev polynomials of a segment, using Clenshaw's recurrence.
+     *  \param coefficients Chebyshev coefficients of the segment.
+     *  \param scaledTime Time, scaled to the interval [-1,1] of the segment.
+     *  \return Cartesian state at the given time.
+     */
+    static Eigen::Vector6d evaluateChebyshevSeries(
+            const Eigen::Matrix< double, 6, Eigen::Dynamic >& coefficients,
+            const double scaledTime );
+
+    //! Function returning the Cartesian state that is approximated (only used during construction).
+    std::function< Eigen::Vector6d( const double ) > stateFunction_;
+
+    //! Maximum position error of the fit (in m) at the verification points.
+    double positionTolerance_;
+
+    //! Maximum velocity error of the fit (in m/s) at the verification points.
+    double velocityTolerance_;
+
+    //! Degree of the Chebyshev polynomials on each segment.
+    int polynomialDegree_;
+
+    //! Boundaries of the segments, in increasing order (one more entry than the number of segments).
+    std::vector< double > segmentBoundaries_;
+
+    //! Chebyshev coefficients of each of the segments, with the coefficients of the j-th polynomial in column j.
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > segmentCoefficients_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
@@ -17,6 +17,7 @@
 #include <boost/bind/bind.hpp>
 
 #include "tudat/math/basic/linearAlgebra.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/math/interpolators/interpolator.h"
 #include "tudat/astro/ephemerides/rotationalEphemeris.h"
 #include "tudat/astro/earth_orientation/earthOrientationCalculator.h"
@@ -66,17 +67,36 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationToBaseFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Name of base frame (GCRS or J2000)
+     *  \param anglesInterpolationTimeStep Time step with which the Earth orientation angles are tabulated, and subsequently
+     *  interpolated, when evaluating the rotation with double precision time input (see
+     *  TabulatedEarthOrientationAnglesCalculator). If NaN (default), the angles are computed directly at each evaluation.
+     *  \param numberOfAnglesInterpolationPoints Number of points used for the interpolation of the Earth orientation angles
+     *  (ignored if anglesInterpolationTimeStep is NaN).
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
+                             const std::string& baseFrame = "GCRS",
+                             const double anglesInterpolationTimeStep = TUDAT_NAN,
+                             const int numberOfAnglesInterpolationPoints = 8 ):
         RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
         frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
-        functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+        if( anglesInterpolationTimeStep == anglesInterpolationTimeStep )
+        {
+            tabulatedAnglesCalculator_ = std::make_shared< earth_orientation::TabulatedEarthOrientationAnglesCalculator >(
+                        anglesCalculator, inputTimeScale, anglesInterpolationTimeStep, numberOfAnglesInterpolationPoints );
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::TabulatedEarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs,
+                        tabulatedAnglesCalculator_, std::placeholders::_1 );
+        }
+        else
+        {
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
+                        anglesCalculator, std::placeholders::_1, inputTimeScale );
+        }
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -97,8 +117,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    functionToGetRotationAngles( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -184,6 +203,16 @@ public:
         return inputTimeScale_;
     }
 
+    //! Function to retrieve object interpolating the Earth orientation angles (nullptr if angles are computed directly)
+    /*!
+     * Function to retrieve object interpolating the Earth orientation angles (nullptr if angles are computed directly)
+     * \return Object interpolating the Earth orientation angles
+     */
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator > getTabulatedAnglesCalculator( )
+    {
+        return tabulatedAnglesCalculator_;
+    }
+
 
 private:
 
@@ -202,6 +231,9 @@ private:
      */
     std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
+    //! Object interpolating the Earth orientation angles, computed by anglesCalculator_ (nullptr if not used)
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAnglesCalculator > tabulatedAnglesCalculator_;
+
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
@@ -73,6 +73,16 @@ public:
     }
 
 
+    //! Function to retrieve the function that is called to update the inertia tensor
+    /*!
+     * Function to retrieve the function that is called to update the inertia tensor when the gravity field changes
+     * \return Function that is called to update the inertia tensor (empty if none)
+     */
+    std::function< void( ) > getUpdateInertiaTensorFunction( )
+    {
+        return updateInertiaTensor_;
+    }
+
     //! Get the gravitational potential at given body-fixed position.
     /*!
      * Return the gravitational potential at given body-fixed position.
@@ -0,0 +1,423 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Pines, S. Uniform representation of the gravitational potential and its derivatives, AIAA Journal, 11(11),
+ *          1508-1511, 1973.
+ *      Lundberg, J.B., Schutz, B.E. Recursion formulas of Legendre functions for use with nonsingular geopotential
+ *          models, Journal of Guidance, Control, and Dynamics, 11(1), 31-38, 1988.
+ *
+ */
+
+#ifndef TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
+#define TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class containing the position-independent coefficients of the recursions used in the Pines formulation.
+/*!
+ *  Class containing the position-independent coefficients of the recursions for the geodesy-normalized derived
+ *  Legendre functions of Lundberg and Schutz (1988), as well as the ratios of the normalization factors required in
+ *  the Pines (1973) formulation of the potential gradient. All coefficients are computed once upon creation of the
+ *  object, and stored in flat arrays (see getCoefficientIndex), up to one degree beyond the given maximum degree.
+ */
+class PinesRecursionCoefficients
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, computes all recursion coefficients up to the given degree (plus one).
+     *  \param maximumDegree Maximum degree of the gravity fields for which the coefficients are to be used
+     */
+    PinesRecursionCoefficients( const int maximumDegree );
+
+    //! Function to retrieve the index in the flat coefficient arrays for a given degree and order.
+    static int getCoefficientIndex( const int degree, const int order )
+    {
+        return degree * ( degree + 1 ) / 2 + order;
+    }
+
+    //! Function to retrieve the maximum degree of the gravity fields for which the coefficients can be used
+    int getMaximumDegree( ) const
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve the diagonal values of the derived Legendre functions
+    const std::vector< double >& getDiagonalLegendreFunctions( ) const
+    {
+        return diagonalLegendreFunctions_;
+    }
+
+    //! Function to retrieve the coefficients to compute sub-diagonal derived Legendre functions
+    const std::vector< double >& getSubDiagonalRecursionCoefficients( ) const
+    {
+        return subDiagonalRecursionCoefficients_;
+    }
+
+    //! Function to retrieve the coefficients of the function at degree n-1 in the column-wise recursion (flat array)
+    const std::vector< double >& getFirstColumnRecursionCoefficients( ) const
+    {
+        return firstColumnRecursionCoefficients_;
+    }
+
+    //! Function to retrieve the coefficients of the function at degree n-2 in the column-wise recursion (flat array)
+    const std::vector< double >& getSecondColumnRecursionCoefficients( ) const
+    {
+        return secondColumnRecursionCoefficients_;
+    }
+
+    //! Function to retrieve the normalization ratios at order m and m+1, for the same degree (flat array)
+    const std::vector< double >& getSameDegreeNormalizationRatios( ) const
+    {
+        return sameDegreeNormalizationRatios_;
+    }
+
+    //! Function to retrieve the normalization ratios at degree/order n,m and n+1,m+1 (flat array)
+    const std::vector< double >& getNextDegreeNormalizationRatios( ) const
+    {
+        return nextDegreeNormalizationRatios_;
+    }
+
+private:
+
+    //! Maximum degree of the gravity fields for which the coefficients can be used
+    int maximumDegree_;
+
+    //! Diagonal values of the (geodesy-normalized) derived Legendre functions, which are independent of position
+    std::vector< double > diagonalLegendreFunctions_;
+
+    //! Coefficients to compute sub-diagonal derived Legendre functions from diagonal functions, per degree
+    std::vector< double > subDiagonalRecursionCoefficients_;
+
+    //! Coefficients of the derived Legendre function at degree n-1 in the column-wise recursion (flat array)
+    std::vector< double > firstColumnRecursionCoefficients_;
+
+    //! Coefficients of the derived Legendre function at degree n-2 in the column-wise recursion (flat array)
+    std::vector< double > secondColumnRecursionCoefficients_;
+
+    //! Normalization ratios of derived Legendre functions at order m and m+1, for the same degree (flat array)
+    std::vector< double > sameDegreeNormalizationRatios_;
+
+    //! Normalization ratios of derived Legendre functions at degree/order n,m and n+1,m+1 (flat array)
+    std::vector< double > nextDegreeNormalizationRatios_;
+};
+
+//! Class to compute spherical harmonic gravitational accelerations at many positions, using the Pines formulation.
+/*!
+ *  Class to compute spherical harmonic gravitational accelerations at many positions, using the singularity-free
+ *  formulation of Pines (1973), with the geodesy-normalized (derived) Legendre functions of Lundberg and Schutz (1988).
+ *  All coefficients of the recursion relations, which depend only on degree and order, are computed once upon creation
+ *  of the object, and stored in flat arrays.
+ *
+ *  The positions are processed in blocks of a fixed number of positions (see blockSize), with all intermediate
+ *  quantities stored as packed arrays (position index varying fastest). The inner loops of the recursions are then over
+ *  the positions in a block, with the coefficients of the recursion shared between them, so that they are vectorized by
+ *  the compiler for the instruction set that is targeted.
+ *
+ *  The work arrays used in the computation are stored in this object, so that a single object should not be used from
+ *  multiple threads concurrently.
+ */
+class PinesSphericalHarmonicsGravityCalculator
+{
+public:
+
+    //! Number of positions that are processed simultaneously.
+    static constexpr int blockSize = 8;
+
+    //! Constructor
+    /*!
+     *  Constructor, computes all recursion coefficients up to the given degree and order.
+     *  \param maximumDegree Maximum degree of the gravity fields for which the object is to be used
+     *  \param maximumOrder Maximum order of the gravity fields for which the object is to be used
+     */
+    PinesSphericalHarmonicsGravityCalculator( const int maximumDegree, const int maximumOrder );
+
+    //! Function to compute the gravitational accelerations at a list of positions
+    /*!
+     *  Function to compute the gravitational accelerations at a list of positions, due to a spherical harmonic gravity
+     *  field. The acceleration is expressed in the same frame as the positions, which is the frame in which the
+     *  coefficients are defined.
+     *  \param bodyFixedPositions Positions (in the frame fixed to the body exerting the acceleration) at which the
+     *  accelerations are to be computed, with one position per column.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \param accelerations Gravitational accelerations at the given positions, with one acceleration per column
+     *  (returned by reference).
+     */
+    void computeAccelerations(
+            const Eigen::Matrix< double, 3, Eigen::Dynamic >& bodyFixedPositions,
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients,
+            Eigen::Matrix< double, 3, Eigen::Dynamic >& accelerations );
+
+    //! Function to compute the gravitational acceleration at a single position
+    /*!
+     *  Function to compute the gravitational acceleration at a single position, see computeAccelerations for details.
+     *  \param bodyFixedPosition Position (in the frame fixed to the body exerting the acceleration) at which the
+     *  acceleration is to be computed.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \return Gravitational acceleration at the given position
+     */
+    Eigen::Vector3d computeAcceleration(
+            const Eigen::Vector3d& bodyFixedPosition,
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients );
+
+    //! Function to retrieve the maximum degree of the gravity fields for which the object can be used
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve the maximum order of the gravity fields for which the object can be used
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+private:
+
+    //! Function to compute the accelerations for a single block of positions
+    /*!
+     *  Function to compute the accelerations for a single block of positions.
+     *  \param positions Pointer to the first entry of the (column-major, 3 x blockSize) positions in the block.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \param accelerations Pointer to the first entry of the (column-major, 3 x blockSize) accelerations in the block
+     *  (returned by reference).
+     */
+    void computeBlockAccelerations(
+            const double* positions,
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients,
+            double* accelerations );
+
+    //! Function to compute a single column (fixed order) of the derived Legendre functions, for all positions in a block.
+    /*!
+     *  Function to compute a single column (fixed order) of the derived Legendre functions, for all positions in a block,
+     *  from the given order up to the given degree.
+     *  \param order Order of the column
+     *  \param highestDegree Degree up to which the column is to be computed
+     *  \param column Values of the derived Legendre functions, with entry ( degree * blockSize + i ) for position i in the
+     *  block (returned by reference).
+     */
+    void computeLegendreFunctionColumn( const int order, const int highestDegree, double* column );
+
+    //! Maximum degree of the gravity fields for which the object can be used
+    int maximumDegree_;
+
+    //! Maximum order of the gravity fields for which the object can be used
+    int maximumOrder_;
+
+    //! Position-independent coefficients of the recursion relations
+    PinesRecursionCoefficients recursionCoefficients_;
+
+    //! Derived Legendre functions at current order, for all positions in current block
+    std::vector< double > currentOrderLegendreFunctions_;
+
+    //! Derived Legendre functions at next order, for all positions in current block
+    std::vector< double > nextOrderLegendreFunctions_;
+
+    //! Multiplication factors (mu/R^2)*(R/r)^(n+2) for each degree n, for all positions in current block
+    std::vector< double > degreeScalingFactors_;
+
+    //! Direction cosines (x/r, y/r, z/r) of all positions in current block
+    double directionCosines_[ 3 ][ blockSize ];
+};
+
+//! Cache object for the evaluation of the Pines formulation of a spherical harmonic gravity field at a single position
+/*!
+ *  Cache object for the evaluation of the Pines (1973) formulation of a spherical harmonic gravity field at a single
+ *  position. The update function computes all position-dependent quantities that are independent of the gravity field
+ *  coefficients (direction cosines, powers of the radius ratio, real/imaginary parts of (s + i t)^m and the
+ *  geodesy-normalized derived Legendre functions), from which the acceleration, potential, gradient of the acceleration
+ *  w.r.t. position, and partials w.r.t. the coefficients are subsequently computed. None of these quantities contain
+ *  the singularities at the poles of the formulation in spherical coordinates.
+ *
+ *  The derived Legendre functions are computed up to one order beyond the maximum order, plus one additional order
+ *  for the computation of the gradient of the acceleration.
+ */
+class PinesSphericalHarmonicsCache
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, computes all recursion coefficients up to the given degree and order.
+     *  \param maximumDegree Maximum degree of the gravity fields for which the object is to be used
+     *  \param maximumOrder Maximum order of the gravity fields for which the object is to be used
+     */
+    PinesSphericalHarmonicsCache( const int maximumDegree, const int maximumOrder );
+
+    //! Function to update the cache to a new position
+    /*!
+     *  Function to update the cache to a new position, computing all coefficient-independent quantities
+     *  \param bodyFixedPosition Position (in the frame fixed to the body exerting the acceleration)
+     *  \param referenceRadius Reference radius of the spherical harmonic expansion
+     */
+    void update( const Eigen::Vector3d& bodyFixedPosition, const double referenceRadius );
+
+    //! Function to compute the gravitational acceleration at the current position
+    /*!
+     *  Function to compute the gravitational acceleration at the position set by the last call to update, expressed
+     *  in the frame in which the coefficients are defined.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \return Gravitational acceleration at the current position
+     */
+    Eigen::Vector3d computeAcceleration(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients );
+
+    //! Function to compute the gravitational potential at the current position
+    /*!
+     *  Function to compute the gravitational potential at the position set by the last call to update.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \return Gravitational potential at the current position
+     */
+    double computePotential(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients );
+
+    //! Function to compute the partial derivative of the gravitational acceleration w.r.t. the position
+    /*!
+     *  Function to compute the partial derivative of the gravitational acceleration w.r.t. the position (e.g. gravity
+     *  gradient tensor) at the position set by the last call to update, both expressed in the frame in which the
+     *  coefficients are defined.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+     *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+     *  \return Partial derivative of the gravitational acceleration w.r.t. the position
+     */
+    Eigen::Matrix3d computeAccelerationPartialWrtPosition(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& cosineCoefficients,
+            const Eigen::MatrixXd& sineCoefficients );
+
+    //! Function to compute the partial derivative of the gravitational acceleration w.r.t. a single coefficient
+    /*!
+     *  Function to compute the partial derivative of the gravitational acceleration w.r.t. a single cosine or sine
+     *  coefficient (e.g. the acceleration due to a single term with unit coefficient) at the position set by the last
+     *  call to update, expressed in the frame in which the coefficients are defined.
+     *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+     *  \param degree Degree of the coefficient
+     *  \param order Order of the coefficient
+     *  \param isCosineCoefficient Boolean denoting whether the partial w.r.t. the cosine (if true) or sine (if false)
+     *  coefficient is to be computed
+     *  \return Partial derivative of the gravitational acceleration w.r.t. the coefficient
+     */
+    Eigen::Vector3d computeAccelerationPartialWrtCoefficient(
+            const double gravitationalParameter,
+            const int degree,
+            const int order,
+            const bool isCosineCoefficient );
+
+    //! Function to retrieve the maximum degree of the gravity fields for which the object can be used
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve the maximum order of the gravity fields for which the object can be used
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+private:
+
+    //! Function to retrieve a derived Legendre function at the current position (zero if order exceeds degree)
+    double getLegendreFunction( const int degree, const int order )
+    {
+        return ( order > degree ) ? 0.0 :
+                                    legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( degree, order ) ];
+    }
+
+    //! Maximum degree of the gravity fields for which the object can be used
+    int maximumDegree_;
+
+    //! Maximum order of the gravity fields for which the object can be used
+    int maximumOrder_;
+
+    //! Position-independent coefficients of the recursion relations
+    PinesRecursionCoefficients recursionCoefficients_;
+
+    //! Derived Legendre functions at the current position (flat array, see PinesRecursionCoefficients)
+    std::vector< double > legendreFunctions_;
+
+    //! Real parts of (s + i t)^m at the current position, for each order m
+    std::vector< double > realParts_;
+
+    //! Imaginary parts of (s + i t)^m at the current position, for each order m
+    std::vector< double > imaginaryParts_;
+
+    //! Factors (1/R^2)*(R/r)^(n+2) at the current position, for each degree n
+    std::vector< double > degreeScalingFactors_;
+
+    //! Direction cosines (x/r, y/r, z/r) of the current position
+    Eigen::Vector3d directionCosines_;
+
+    //! Distance of the current position from the origin
+    double currentDistance_;
+};
+
+//! Function to compute the spherical harmonic gravitational accelerations at a list of positions
+/*!
+ *  Function to compute the spherical harmonic gravitational accelerations at a list of positions, using the Pines
+ *  formulation (see PinesSphericalHarmonicsGravityCalculator). When repeatedly evaluating the same gravity field, the
+ *  PinesSphericalHarmonicsGravityCalculator should be used directly, to prevent the recomputation of the recursion
+ *  coefficients.
+ *  \param bodyFixedPositions Positions (in the frame fixed to the body exerting the acceleration) at which the
+ *  accelerations are to be computed, with one position per column.
+ *  \param gravitationalParameter Gravitational parameter of the body exerting the acceleration
+ *  \param referenceRadius Reference radius of the spherical harmonic expansion
+ *  \param cosineCoefficients Geodesy-normalized cosine coefficients, with row/column index denoting degree/order.
+ *  \param sineCoefficients Geodesy-normalized sine coefficients, with row/column index denoting degree/order.
+ *  \return Gravitational accelerations at the given positions, with one acceleration per column.
+ */
+Eigen::Matrix< double, 3, Eigen::Dynamic > computeGeodesyNormalizedGravitationalAccelerations(
+        const Eigen::Matrix< double, 3, Eigen::Dynamic >& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_PINES_SPHERICAL_HARMONICS_GRAVITY_H
@@ -23,6 +23,7 @@
 #include <vector>
 #include <iostream>
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/math/basic/polyhedron.h"
@@ -54,7 +55,8 @@ public:
             const Eigen::MatrixXi& verticesDefiningEachEdge)
             : verticesCoordinates_( verticesCoordinates ),
               verticesDefiningEachFacet_( verticesDefiningEachFacet ),
-              verticesDefiningEachEdge_( verticesDefiningEachEdge )
+              verticesDefiningEachEdge_( verticesDefiningEachEdge ),
+              numberOfThreads_( 1 )
     {
         currentBodyFixedPosition_ = (Eigen::Vector3d() << TUDAT_NAN, TUDAT_NAN, TUDAT_NAN).finished();
     }
@@ -90,6 +92,24 @@ public:
     Eigen::VectorXd& getPerEdgeFactor ( )
     { return currentPerEdgeFactor_; }
 
+    /*! Function to set the number of threads used to compute the per-facet and per-edge factors.
+     *
+     * Function to set the number of threads used to compute the per-facet and per-edge factors. If more than one thread
+     * is used, a set of worker threads is started by this function, and is reused for each update (the facets and edges
+     * are split into a few blocks per thread). Even so, using multiple threads is only beneficial for polyhedra with a
+     * large number of facets (typically more than 10^4).
+     * @param numberOfThreads Number of threads (0 to use all available hardware threads; 1 by default).
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads );
+
+    /*! Function to retrieve the number of threads used to compute the per-facet and per-edge factors.
+     *
+     * Function to retrieve the number of threads used to compute the per-facet and per-edge factors.
+     * @return Number of threads (0 to use all available hardware threads).
+     */
+    unsigned int getNumberOfThreads( )
+    { return numberOfThreads_; }
+
 
 protected:
 
@@ -115,6 +135,18 @@ private:
 
     // Current value of the per-edge factors.
     Eigen::VectorXd currentPerEdgeFactor_;
+
+    // Number of threads used to compute the per-facet and per-edge factors (0 to use all available hardware threads).
+    unsigned int numberOfThreads_;
+
+    // Worker threads used to compute the per-facet and per-edge factors (nullptr if a single thread is used).
+    std::shared_ptr< utilities::ParallelTaskPool > factorComputationThreads_;
+
+    // Number of blocks of facets (and of edges) into which the factor computation is split, if multiple threads are used.
+    unsigned int numberOfFactorComputationBlocks_;
+
+    // Function computing the per-facet or per-edge factors of a single block, if multiple threads are used.
+    std::function< void( const unsigned int ) > factorComputationBlockFunction_;
 };
 
 
@@ -14,6 +14,8 @@
 
 #include <memory>
 #include <cmath>
+#include <limits>
+#include <map>
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include <vector>
@@ -22,6 +24,7 @@
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 #include "tudat/math/basic/polyhedron.h"
+#include "tudat/math/basic/sphericalHarmonics.h"
 
 namespace tudat
 {
@@ -99,6 +102,12 @@ public:
           isMutualAttractionUsed_( isMutualAttractionUsed ),
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
                  aVerticesCoordinatesMatrix, aVerticesDefiningEachFacetMatrix, aVerticesDefiningEachEdgeMatrix) ),
+          verticesDefiningEachFacet_( aVerticesDefiningEachFacetMatrix ),
+          verticesDefiningEachEdge_( aVerticesDefiningEachEdgeMatrix ),
+          facetDyads_( aFacetDyadsVector ),
+          edgeDyads_( aEdgeDyadsVector ),
+          farFieldSwitchRadius_( std::numeric_limits< double >::infinity( ) ),
+          farFieldReferenceRadius_( TUDAT_NAN ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -160,6 +169,12 @@ public:
           polyhedronCache_( std::make_shared< PolyhedronGravityCache >(
                  verticesCoordinatesFunction(), verticesDefiningEachFacetFunction(),
                  verticesDefiningEachEdgeFunction() ) ),
+          verticesDefiningEachFacet_( verticesDefiningEachFacetFunction( ) ),
+          verticesDefiningEachEdge_( verticesDefiningEachEdgeFunction( ) ),
+          facetDyads_( facetDyadsFunction( ) ),
+          edgeDyads_( edgeDyadsFunction( ) ),
+          farFieldSwitchRadius_( std::numeric_limits< double >::infinity( ) ),
+          farFieldReferenceRadius_( TUDAT_NAN ),
           currentPotential_( TUDAT_NAN ),
           currentLaplacianOfPotential_( TUDAT_NAN ),
           updatePotential_( updateGravitationalPotential ),
@@ -169,11 +184,62 @@ public:
     //! Update class members.
     /*!
      * Updates all the base class members to their current values and also updates the class members of this class.
-     * The potential and laplacian of potential are only updated if the associated flags indicate so.
+     * The potential and laplacian of potential are only updated if the associated flags indicate so. If a far-field
+     * spherical harmonic expansion has been set (see setFarFieldSphericalHarmonicExpansion), it is used instead of the
+     * polyhedron model when the distance to the origin of the body-fixed frame exceeds the far-field switch radius.
      * \param currentTime Time at which acceleration model is to be updated.
      */
     void updateMembers( const double currentTime = TUDAT_NAN );
 
+    //! Function to set a spherical harmonic expansion of the polyhedron, to be used to compute the far field.
+    /*!
+     * Function to set a spherical harmonic expansion of the polyhedron, to be used to compute the far field. The
+     * coefficients of the expansion are computed (exactly) from the polyhedron geometry, assuming constant density, with
+     * the radius of the Brillouin sphere of the polyhedron as reference radius. The expansion is used instead of the
+     * polyhedron model for positions at a distance larger than switchRadiusRatio times the Brillouin sphere radius from
+     * the origin of the body-fixed frame; the truncation error at the switch radius decreases with the switch radius
+     * ratio to the power of -( maximumDegree + 2 ).
+     * \param maximumDegree Maximum degree (and order) of the spherical harmonic expansion.
+     * \param switchRadiusRatio Ratio of the far-field switch radius to the radius of the Brillouin sphere (must be larger
+     * than 1).
+     */
+    void setFarFieldSphericalHarmonicExpansion( const int maximumDegree, const double switchRadiusRatio );
+
+    //! Function to set the number of threads used to compute the per-facet and per-edge factors.
+    /*!
+     * Function to set the number of threads used to compute the per-facet and per-edge factors of the polyhedron (see
+     * PolyhedronGravityCache::setNumberOfThreads).
+     * \param numberOfThreads Number of threads (0 to use all available hardware threads; 1 by default).
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        polyhedronCache_->setNumberOfThreads( numberOfThreads );
+    }
+
+    //! Function to return the distance beyond which the far-field spherical harmonic expansion is used (infinite if none).
+    double getFarFieldSwitchRadius( )
+    {
+        return farFieldSwitchRadius_;
+    }
+
+    //! Function to return the geodesy-normalized cosine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd getFarFieldCosineCoefficients( )
+    {
+        return farFieldCosineCoefficients_;
+    }
+
+    //! Function to return the geodesy-normalized sine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd getFarFieldSineCoefficients( )
+    {
+        return farFieldSineCoefficients_;
+    }
+
+    //! Function to return the reference radius of the far-field spherical harmonic expansion.
+    double getFarFieldReferenceRadius( )
+    {
+        return farFieldReferenceRadius_;
+    }
+
     //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in frame
     //! fixed to body undergoing acceleration
     Eigen::Vector3d getCurrentRelativePosition( )
@@ -320,6 +386,36 @@ private:
     //!  Polyhedron cache for this acceleration
     std::shared_ptr< PolyhedronGravityCache > polyhedronCache_;
 
+    //! Vertices defining each facet (retrieved once from getVerticesDefiningEachFacet_)
+    const Eigen::MatrixXi verticesDefiningEachFacet_;
+
+    //! Vertices defining each edge (retrieved once from getVerticesDefiningEachEdge_)
+    const Eigen::MatrixXi verticesDefiningEachEdge_;
+
+    //! Facet dyads (retrieved once from getFacetDyads_)
+    const std::vector< Eigen::MatrixXd > facetDyads_;
+
+    //! Edge dyads (retrieved once from getEdgeDyads_)
+    const std::vector< Eigen::MatrixXd > edgeDyads_;
+
+    //! Distance beyond which the far-field spherical harmonic expansion is used (infinite if none is used).
+    double farFieldSwitchRadius_;
+
+    //! Reference radius of the far-field spherical harmonic expansion.
+    double farFieldReferenceRadius_;
+
+    //! Geodesy-normalized cosine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldCosineCoefficients_;
+
+    //! Geodesy-normalized sine coefficients of the far-field spherical harmonic expansion.
+    Eigen::MatrixXd farFieldSineCoefficients_;
+
+    //! Spherical harmonics cache used to evaluate the far-field expansion.
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > farFieldSphericalHarmonicsCache_;
+
+    //! Dummy list of acceleration terms, required to evaluate the far-field expansion.
+    std::map< std::pair< int, int >, Eigen::Vector3d > farFieldAccelerationPerTerm_;
+
     //! Current rotation from body-fixed frame to integration frame.
     Eigen::Quaterniond rotationToIntegrationFrame_;
 
@@ -197,15 +197,40 @@ public:
             const Eigen::MatrixXd& sineCoefficients = Eigen::MatrixXd::Zero( 1, 1 ),
             const std::string& fixedReferenceFrame = "",
             const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) )
+        : SphericalHarmonicsGravityField(
+              gravitationalParameter, referenceRadius, std::make_shared< Eigen::MatrixXd >( cosineCoefficients ),
+              std::make_shared< Eigen::MatrixXd >( sineCoefficients ), fixedReferenceFrame, updateInertiaTensor ){ }
+
+    //! Class constructor, with coefficients that may be shared with other gravity fields.
+    /*!
+     *  Class constructor, with coefficients that may be shared with other gravity fields (e.g. the fields of cloned
+     *  bodies), so that large coefficient matrices are not copied for each field. The shared coefficients are never
+     *  modified by this object: when the coefficients of this field are reset (e.g. because they are estimated
+     *  parameters), this field first creates its own copy of the coefficients.
+     *  \param gravitationalParameter Gravitational parameter of massive body
+     *  \param referenceRadius Reference radius of spherical harmonic field expansion
+     *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy normalized)
+     *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy normalized)
+     *  \param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional).
+     *  \param updateInertiaTensor Function that is to be called to update the inertia tensor (typicaly in Body class; default
+     *  empty)
+     */
+    SphericalHarmonicsGravityField(
+            const double gravitationalParameter,
+            const double referenceRadius,
+            const std::shared_ptr< Eigen::MatrixXd > cosineCoefficients,
+            const std::shared_ptr< Eigen::MatrixXd > sineCoefficients,
+            const std::string& fixedReferenceFrame = "",
+            const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) )
         : GravityFieldModel( gravitationalParameter, updateInertiaTensor ), referenceRadius_( referenceRadius ),
           cosineCoefficients_( cosineCoefficients ), sineCoefficients_( sineCoefficients ),
           fixedReferenceFrame_( fixedReferenceFrame ),
-          maximumDegree_( cosineCoefficients_.rows( ) - 1 ),
-          maximumOrder_( cosineCoefficients_.cols( ) - 1 )
+          maximumDegree_( cosineCoefficients_->rows( ) - 1 ),
+          maximumOrder_( cosineCoefficients_->cols( ) - 1 )
     {
 
-        if( ( cosineCoefficients.rows( ) != sineCoefficients.rows( ) ) ||
-              ( cosineCoefficients.cols( ) != sineCoefficients.cols( ) ) )
+        if( ( cosineCoefficients->rows( ) != sineCoefficients->rows( ) ) ||
+              ( cosineCoefficients->cols( ) != sineCoefficients->cols( ) ) )
         {
             throw std::runtime_error( "Error when creating spherical harmonics gravity field; sine and cosine sizes are incompatible" );
         }
@@ -238,7 +263,7 @@ public:
      */
     Eigen::MatrixXd getCosineCoefficients( )
     {
-        return cosineCoefficients_;
+        return *cosineCoefficients_;
     }
 
     //! Function to get the sine spherical harmonic coefficients (geodesy normalized)
@@ -247,6 +272,30 @@ public:
      *  \return Sine spherical harmonic coefficients (geodesy normalized)
      */
     Eigen::MatrixXd getSineCoefficients( )
+    {
+        return *sineCoefficients_;
+    }
+
+    //! Function to get the storage of the cosine spherical harmonic coefficients, for sharing with other gravity fields
+    /*!
+     *  Function to get the storage of the cosine spherical harmonic coefficients (geodesy normalized), for sharing with
+     *  other gravity fields. The coefficients should not be modified through the returned pointer; use
+     *  setCosineCoefficients instead.
+     *  \return Cosine spherical harmonic coefficients (geodesy normalized)
+     */
+    std::shared_ptr< Eigen::MatrixXd > getSharedCosineCoefficients( )
+    {
+        return cosineCoefficients_;
+    }
+
+    //! Function to get the storage of the sine spherical harmonic coefficients, for sharing with other gravity fields
+    /*!
+     *  Function to get the storage of the sine spherical harmonic coefficients (geodesy normalized), for sharing with
+     *  other gravity fields. The coefficients should not be modified through the returned pointer; use
+     *  setSineCoefficients instead.
+     *  \return Sine spherical harmonic coefficients (geodesy normalized)
+     */
+    std::shared_ptr< Eigen::MatrixXd > getSharedSineCoefficients( )
     {
         return sineCoefficients_;
     }
@@ -258,13 +307,21 @@ public:
      */
     void setCosineCoefficients( const Eigen::MatrixXd& cosineCoefficients )
     {
-        if( ( cosineCoefficients.rows( ) != cosineCoefficients_.rows( ) ) ||
-              ( cosineCoefficients.cols( ) != cosineCoefficients_.cols( ) ) )
+        if( ( cosineCoefficients.rows( ) != cosineCoefficients_->rows( ) ) ||
+              ( cosineCoefficients.cols( ) != cosineCoefficients_->cols( ) ) )
         {
             throw std::runtime_error( "Error when resettings spherical harmonics gravity field cosine coefficients; sizes are incompatible" );
         }
 
-        cosineCoefficients_ = cosineCoefficients;
+        // Do not modify coefficients that are shared with another gravity field
+        if( cosineCoefficients_.use_count( ) > 1 )
+        {
+            cosineCoefficients_ = std::make_shared< Eigen::MatrixXd >( cosineCoefficients );
+        }
+        else
+        {
+            *cosineCoefficients_ = cosineCoefficients;
+        }
         if( !( updateInertiaTensor_ == nullptr ) )
         {
             updateInertiaTensor_( );
@@ -278,13 +335,21 @@ public:
      */
     void setSineCoefficients( const Eigen::MatrixXd& sineCoefficients )
     {
-        if( ( sineCoefficients.rows( ) != sineCoefficients_.rows( ) ) ||
-              ( sineCoefficients.cols( ) != sineCoefficients_.cols( ) ) )
+        if( ( sineCoefficients.rows( ) != sineCoefficients_->rows( ) ) ||
+              ( sineCoefficients.cols( ) != sineCoefficients_->cols( ) ) )
         {
             throw std::runtime_error( "Error when resettings spherical harmonics gravity field cosine coefficients; sizes are incompatible" );
         }
 
-        sineCoefficients_ = sineCoefficients;
+        // Do not modify coefficients that are shared with another gravity field
+        if( sineCoefficients_.use_count( ) > 1 )
+        {
+            sineCoefficients_ = std::make_shared< Eigen::MatrixXd >( sineCoefficients );
+        }
+        else
+        {
+            *sineCoefficients_ = sineCoefficients;
+        }
 
         if( !( updateInertiaTensor_ == nullptr ) )
         {
@@ -311,7 +376,7 @@ public:
                                       std::to_string( maximumDegree_ ) + "/" + std::to_string( maximumOrder_ ) );
         }
 
-        return cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
+        return cosineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
     //! Function to get a sine spherical harmonic coefficient block (geodesy normalized)
@@ -333,7 +398,7 @@ public:
                                       std::to_string( maximumDegree_ ) + "/" + std::to_string( maximumOrder_ ) );
         }
 
-        return sineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
+        return sineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
     //! Get maximum degree of spherical harmonics gravity field expansion.
@@ -367,8 +432,8 @@ public:
      */
     virtual double getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        return getGravitationalPotential( bodyFixedPosition, cosineCoefficients_.rows( ) - 1,
-                                          sineCoefficients_.cols( ) - 1 );
+        return getGravitationalPotential( bodyFixedPosition, cosineCoefficients_->rows( ) - 1,
+                                          sineCoefficients_->cols( ) - 1 );
     }
 
     //! Function to calculate the gravitational potential due to terms up to given degree and
@@ -393,8 +458,8 @@ public:
     {
         return calculateSphericalHarmonicGravitationalPotential(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
-                    cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
-                    sineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
+                    cosineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
+                    sineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 ),
                     sphericalHarmonicsCache_,
                     minimumDegree, minimumOrder );
     }
@@ -409,8 +474,8 @@ public:
      */
     Eigen::Vector3d getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition )
     {
-        return getGradientOfPotential( bodyFixedPosition, cosineCoefficients_.rows( ),
-                                       sineCoefficients_.cols( ) );
+        return getGradientOfPotential( bodyFixedPosition, cosineCoefficients_->rows( ),
+                                       sineCoefficients_->cols( ) );
     }
 
     //! Get the gradient of the potential.
@@ -429,8 +494,8 @@ public:
 
         return computeGeodesyNormalizedGravitationalAccelerationSum(
                     bodyFixedPosition, gravitationalParameter_, referenceRadius_,
-                    cosineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ),
-                    sineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_, dummyMap );
+                    cosineCoefficients_->block( 0, 0, maximumDegree, maximumOrder ),
+                    sineCoefficients_->block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_, dummyMap );
     }
 
     //! Get the gradient of the laplacian of potential.
@@ -485,15 +550,15 @@ protected:
 
     //! Cosine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Cosine spherical harmonic coefficients (geodesy normalized)
+     *  Cosine spherical harmonic coefficients (geodesy normalized), possibly shared with other gravity fields.
      */
-    Eigen::MatrixXd cosineCoefficients_;
+    std::shared_ptr< Eigen::MatrixXd > cosineCoefficients_;
 
     //! Sine spherical harmonic coefficients (geodesy normalized)
     /*!
-     *  Sine spherical harmonic coefficients (geodesy normalized)
+     *  Sine spherical harmonic coefficients (geodesy normalized), possibly shared with other gravity fields.
      */
-    Eigen::MatrixXd sineCoefficients_;
+    std::shared_ptr< Eigen::MatrixXd > sineCoefficients_;
 
     //! Identifier for body-fixed reference frame
     /*!
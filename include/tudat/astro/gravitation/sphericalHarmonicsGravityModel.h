@@ -25,6 +25,7 @@
 #include <Eigen/Geometry>
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityModelBase.h"
 #include "tudat/math/basic/sphericalHarmonics.h"
 #include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
@@ -34,6 +35,18 @@ namespace tudat
 namespace gravitation
 {
 
+//! Enum denoting the formulation that is used to evaluate a spherical harmonic gravity field
+/*!
+ *  Enum denoting the formulation that is used to evaluate a spherical harmonic gravity field: the formulation in
+ *  spherical coordinates (using the LegendreCache and SphericalHarmonicsCache), or the singularity-free Cartesian
+ *  formulation of Pines (using the PinesSphericalHarmonicsCache).
+ */
+enum SphericalHarmonicsGravityFormulation
+{
+    spherical_coordinates_formulation,
+    pines_formulation
+};
+
 //! Template class for general spherical harmonics gravitational acceleration model.
 /*!
  * This templated class implements a general spherical harmonics gravitational acceleration model.
@@ -217,27 +230,49 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
-            currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
-
-            if ( this->updatePotential_ )
+            if( pinesSphericalHarmonicsCache_ != nullptr )
             {
-                this->currentPotential_ = gravitation::calculateSphericalHarmonicGravitationalPotential(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients,
-                        sphericalHarmonicsCache_ );
+                pinesSphericalHarmonicsCache_->update( currentRelativePosition_, equatorialRadius );
+                currentAccelerationInBodyFixedFrame_ = pinesSphericalHarmonicsCache_->computeAcceleration(
+                            gravitationalParameter, cosineHarmonicCoefficients, sineHarmonicCoefficients );
+                currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
+
+                if( saveSphericalHarmonicTermsSeparately_ )
+                {
+                    computePinesAccelerationPerTerm(
+                                cosineHarmonicCoefficients, sineHarmonicCoefficients, accelerationPerTerm_ );
+                }
+
+                if ( this->updatePotential_ )
+                {
+                    this->currentPotential_ = pinesSphericalHarmonicsCache_->computePotential(
+                                gravitationalParameter, cosineHarmonicCoefficients, sineHarmonicCoefficients );
+                }
+            }
+            else
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            accelerationPerTerm_,
+                            saveSphericalHarmonicTermsSeparately_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+                currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
+
+                if ( this->updatePotential_ )
+                {
+                    this->currentPotential_ = gravitation::calculateSphericalHarmonicGravitationalPotential(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients,
+                            sphericalHarmonicsCache_ );
+                }
             }
         }
     }
@@ -253,6 +288,12 @@ public:
     Eigen::VectorXd getAccelerationWithAlternativeCoefficients(
             const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients)
     {
+        if( pinesSphericalHarmonicsCache_ != nullptr )
+        {
+            return rotationToIntegrationFrame_ * pinesSphericalHarmonicsCache_->computeAcceleration(
+                        gravitationalParameter, cosineCoefficients, sineCoefficients );
+        }
+
         std::map< std::pair< int, int >, Eigen::Vector3d > dummy;
         return computeGeodesyNormalizedGravitationalAccelerationSum(
                     currentRelativePosition_,
@@ -280,15 +321,22 @@ public:
     {
         std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
 
-        computeGeodesyNormalizedGravitationalAccelerationSum(
-                    currentRelativePosition_,
-                    gravitationalParameter,
-                    equatorialRadius,
-                    cosineCoefficients,
-                    sineCoefficients, sphericalHarmonicsCache_,
-                    accelerationPerTerm,
-                    true,
-                    rotationToIntegrationFrame_.toRotationMatrix( ) );
+        if( pinesSphericalHarmonicsCache_ != nullptr )
+        {
+            computePinesAccelerationPerTerm( cosineCoefficients, sineCoefficients, accelerationPerTerm );
+        }
+        else
+        {
+            computeGeodesyNormalizedGravitationalAccelerationSum(
+                        currentRelativePosition_,
+                        gravitationalParameter,
+                        equatorialRadius,
+                        cosineCoefficients,
+                        sineCoefficients, sphericalHarmonicsCache_,
+                        accelerationPerTerm,
+                        true,
+                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+        }
 
 
         Eigen::VectorXd returnVector = Eigen::VectorXd( 3 * coefficientIndices.size( ) );
@@ -299,6 +347,36 @@ public:
         return returnVector;
    }
 
+    //! Function to compute the accelerations due to the current gravity field at a list of body-fixed positions
+    /*!
+     * Function to compute the accelerations due to the current gravity field (gravitational parameter and coefficients)
+     * of this acceleration model at a list of positions, expressed in the frame fixed to the body exerting the
+     * acceleration. The positions are processed simultaneously, using the PinesSphericalHarmonicsGravityCalculator,
+     * which is created upon first use. This function does not modify the current state of this acceleration model.
+     * \param bodyFixedPositions Body-fixed positions at which the accelerations are to be computed (one per column)
+     * \return Accelerations in the body-fixed frame at the given positions (one per column)
+     */
+    Eigen::Matrix< double, 3, Eigen::Dynamic > getBodyFixedAccelerationsAtPositions(
+            const Eigen::Matrix< double, 3, Eigen::Dynamic >& bodyFixedPositions )
+    {
+        Eigen::MatrixXd cosineCoefficients = getCosineHarmonicsCoefficients( );
+        Eigen::MatrixXd sineCoefficients = getSineHarmonicsCoefficients( );
+
+        if( batchGravityCalculator_ == nullptr ||
+                batchGravityCalculator_->getMaximumDegree( ) < cosineCoefficients.rows( ) - 1 ||
+                batchGravityCalculator_->getMaximumOrder( ) < cosineCoefficients.cols( ) - 1 )
+        {
+            batchGravityCalculator_ = std::make_shared< PinesSphericalHarmonicsGravityCalculator >(
+                        cosineCoefficients.rows( ) - 1, cosineCoefficients.cols( ) - 1 );
+        }
+
+        Eigen::Matrix< double, 3, Eigen::Dynamic > accelerations;
+        batchGravityCalculator_->computeAccelerations(
+                    bodyFixedPositions, this->gravitationalParameterFunction( ), equatorialRadius,
+                    cosineCoefficients, sineCoefficients, accelerations );
+        return accelerations;
+    }
+
     //! Function to retrieve the spherical harmonics cache for this acceleration.
     /*!
      *  Function to retrieve the spherical harmonics cache for this acceleration.
@@ -382,6 +460,46 @@ public:
         return rotationToIntegrationFrame_.toRotationMatrix( );
     }
 
+    //! Function to set the formulation that is used to evaluate the spherical harmonic gravity field
+    /*!
+     * Function to set the formulation that is used to evaluate the spherical harmonic gravity field. When selecting the
+     * Pines formulation, a PinesSphericalHarmonicsCache is created for the current size of the coefficient matrices.
+     * \param formulation Formulation that is to be used to evaluate the spherical harmonic gravity field
+     */
+    void setGravityFormulation( const SphericalHarmonicsGravityFormulation formulation )
+    {
+        if( formulation == pines_formulation )
+        {
+            pinesSphericalHarmonicsCache_ = std::make_shared< PinesSphericalHarmonicsCache >(
+                        maximumDegree_ - 1, maximumOrder_ - 1 );
+        }
+        else
+        {
+            pinesSphericalHarmonicsCache_ = nullptr;
+        }
+        this->resetCurrentTime( );
+    }
+
+    //! Function to retrieve the formulation that is used to evaluate the spherical harmonic gravity field
+    /*!
+     * Function to retrieve the formulation that is used to evaluate the spherical harmonic gravity field
+     * \return Formulation that is used to evaluate the spherical harmonic gravity field
+     */
+    SphericalHarmonicsGravityFormulation getGravityFormulation( )
+    {
+        return ( pinesSphericalHarmonicsCache_ == nullptr ) ? spherical_coordinates_formulation : pines_formulation;
+    }
+
+    //! Function to retrieve the cache for the Pines formulation (nullptr if this formulation is not used).
+    /*!
+     *  Function to retrieve the cache for the Pines formulation (nullptr if this formulation is not used).
+     *  \return Cache for the Pines formulation
+     */
+    std::shared_ptr< PinesSphericalHarmonicsCache > getPinesSphericalHarmonicsCache( )
+    {
+        return pinesSphericalHarmonicsCache_;
+    }
+
     //! Function to set whether each of the separate spherical harmonic terms should be saved
     /*!
      * Function to set whether each of the separate spherical harmonic terms should be saved (in accelerationPerTerm_ member
@@ -477,6 +595,33 @@ protected:
 
 private:
 
+    //! Function to compute the contributions of all separate degrees/orders to the acceleration, using the Pines cache
+    /*!
+     * Function to compute the contributions of all separate degrees/orders to the acceleration in the integration frame,
+     * using the Pines cache at its current position.
+     * \param cosineCoefficients Cosine coefficients to use
+     * \param sineCoefficients Sine coefficients to use
+     * \param accelerationPerTerm Contributions to the acceleration at given degrees/orders (returned by reference)
+     */
+    void computePinesAccelerationPerTerm(
+            const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+            std::map< std::pair< int, int >, Eigen::Vector3d >& accelerationPerTerm )
+    {
+        for( int degree = 0; degree < cosineCoefficients.rows( ); degree++ )
+        {
+            for( int order = 0; ( order <= degree ) && ( order < cosineCoefficients.cols( ) ); order++ )
+            {
+                accelerationPerTerm[ std::make_pair( degree, order ) ] = rotationToIntegrationFrame_ * (
+                            cosineCoefficients( degree, order ) *
+                            pinesSphericalHarmonicsCache_->computeAccelerationPartialWrtCoefficient(
+                                gravitationalParameter, degree, order, true ) +
+                            sineCoefficients( degree, order ) *
+                            pinesSphericalHarmonicsCache_->computeAccelerationPartialWrtCoefficient(
+                                gravitationalParameter, degree, order, false ) );
+            }
+        }
+    }
+
     //! Equatorial radius [m].
     /*!
      * Current value of equatorial (planetary) radius used for spherical harmonics expansion [m].
@@ -534,6 +679,12 @@ private:
     //! Boolean that denotes whether each of the separate spherical harmonic terms should be saved (in accelerationPerTerm_)
     bool saveSphericalHarmonicTermsSeparately_;
 
+    //! Cache for the evaluation of the gravity field using the Pines formulation (nullptr if this formulation is not used)
+    std::shared_ptr< PinesSphericalHarmonicsCache > pinesSphericalHarmonicsCache_;
+
+    //! Object to compute accelerations at multiple positions simultaneously (created upon first use)
+    std::shared_ptr< PinesSphericalHarmonicsGravityCalculator > batchGravityCalculator_;
+
     //! Maximum degree of gravity field expansion
     int maximumDegree_;
 
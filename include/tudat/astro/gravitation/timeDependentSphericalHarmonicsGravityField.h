@@ -186,7 +186,7 @@ public:
         }
 
 
-        return cosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ) -
+        return cosineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 ) -
                 nominalCosineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
@@ -202,7 +202,7 @@ public:
         }
 
 
-        return cosineCoefficients_( degree, order ) - nominalCosineCoefficients_( degree, order );
+        return ( *cosineCoefficients_ )( degree, order ) - nominalCosineCoefficients_( degree, order );
     }
 
     //! Get current total correction to sine coefficients
@@ -225,7 +225,7 @@ public:
         }
 
 
-        return sineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 ) -
+        return sineCoefficients_->block( 0, 0, maximumDegree + 1, maximumOrder + 1 ) -
                 nominalSineCoefficients_.block( 0, 0, maximumDegree + 1, maximumOrder + 1 );
     }
 
@@ -241,7 +241,7 @@ public:
         }
 
 
-        return sineCoefficients_( degree, order ) - nominalSineCoefficients_( degree, order );
+        return ( *sineCoefficients_ )( degree, order ) - nominalSineCoefficients_( degree, order );
     }
 
     //! Set nominal (i.e. with zero variations) cosine coefficients.
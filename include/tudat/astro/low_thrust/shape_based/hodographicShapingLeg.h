@@ -135,14 +135,6 @@ private:
     //! Satisfy boundary conditions in normal direction.
     void satisfyNormalBoundaryConditions( const Eigen::VectorXd& freeCoefficients );
 
-    //! Define angular velocity due to the third component of the composite function only.
-    double computeDerivativePolarAngleDueToThirdComponent(
-            const double timeSinceDeparture, const Eigen::Vector2d& matrixK );
-
-    //! Define the angular velocity due to all the other components of the composite function, once combined.
-    double computeDerivativePolarAngleDueToOtherComponents(
-            const double timeSinceDeparture, const Eigen::Vector2d& matrixL, const Eigen::VectorXd& freeCoefficients );
-
     //! Compute third fixed coefficient of the normal velocity composite function, so that the condition on the final polar angle
     //! is fulfilled.
     double computeThirdFixedCoefficientAxialVelocity ( const Eigen::VectorXd& freeCoefficients );
@@ -159,6 +151,35 @@ private:
     //! Compute thrust acceleration vector in cylindrical coordinates.
     Eigen::Vector3d computeThrustAccelerationInCylindricalCoordinates( const double timeSinceDeparture );
 
+    //! Values, derivatives and integrals of the components of a velocity function at the quadrature nodes.
+    struct TabulatedVelocityFunctionComponents
+    {
+        //! Values of the components (one row per quadrature node, one column per component).
+        Eigen::MatrixXd values_;
+
+        //! Derivatives of the components (one row per quadrature node, one column per component).
+        Eigen::MatrixXd derivatives_;
+
+        //! Integrals of the components (one row per quadrature node, one column per component).
+        Eigen::MatrixXd integrals_;
+
+        //! Integrals of the components at the departure time.
+        Eigen::RowVectorXd initialIntegrals_;
+    };
+
+    //! Tabulate the components of a velocity function at the given quadrature nodes.
+    void tabulateVelocityFunctionComponents(
+            const std::shared_ptr< CompositeFunctionHodographicShaping > velocityFunction,
+            const Eigen::VectorXd& quadratureNodes,
+            TabulatedVelocityFunctionComponents& tabulatedComponents );
+
+    //! Update the quadrature nodes and weights, and the tabulated velocity function components, if the time of flight
+    //! differs from the one for which they were last computed.
+    void updateTabulatedVelocityFunctionComponents( );
+
+    //! Compute the radial distance at the quadrature nodes, from the tabulated radial velocity function components.
+    void computeTabulatedRadialDistances( );
+
 
     //! Central body gravitational parameter.
     const double centralBodyGravitationalParameter_;
@@ -175,6 +196,23 @@ private:
     //! Quadrature settings (used when computing multiple things)
     std::shared_ptr< numerical_quadrature::QuadratureSettings< double > > quadratureSettings_;
 
+    //! Number of Gauss quadrature nodes, used to compute the final polar angle and the deltaV.
+    const unsigned int numberOfQuadratureNodes_;
+
+    //! Time of flight for which the quadrature nodes and tabulated velocity function components were last computed.
+    double tabulatedTimeOfFlight_;
+
+    //! Gauss quadrature weights (for the interval [-1, 1]).
+    Eigen::ArrayXd quadratureWeights_;
+
+    //! Values of the radial, normal and axial velocity function components at the quadrature nodes.
+    TabulatedVelocityFunctionComponents tabulatedRadialVelocityComponents_;
+    TabulatedVelocityFunctionComponents tabulatedNormalVelocityComponents_;
+    TabulatedVelocityFunctionComponents tabulatedAxialVelocityComponents_;
+
+    //! Radial distance at the quadrature nodes, for the current coefficients of the radial velocity function.
+    Eigen::ArrayXd tabulatedRadialDistances_;
+
     //! Velocity functions.
     std::shared_ptr< CompositeFunctionHodographicShaping > radialVelocityFunction_;
     std::shared_ptr< CompositeFunctionHodographicShaping > normalVelocityFunction_;
@@ -176,6 +176,71 @@ protected:
     //! Compute normalized thrust acceleration vector in spherical coordinates.
     Eigen::Vector3d computeNormalizedThrustAccelerationInSphericalCoordinates (const double currentAzimuthAngle );
 
+    //! Compute values of the base functions of the radial distance and elevation angle functions, and of their first three
+    //! derivatives, at a list of azimuth angles.
+    /*!
+     * Compute values of the base functions of the radial distance and elevation angle functions, and of their first three
+     * derivatives w.r.t. azimuth angle, at a list of azimuth angles.
+     * \param azimuthAngles Azimuth angles at which the base functions are to be evaluated
+     * \param radialBaseFunctionValues Values of radial distance base functions (returned by reference). Entry i contains
+     * the i-th derivative, with one row per azimuth angle and one column per base function.
+     * \param elevationBaseFunctionValues Values of elevation angle base functions (returned by reference), ordered as
+     * radialBaseFunctionValues.
+     * \param maximumDerivativeOrder Highest order of the derivatives that are to be computed (at most 3)
+     */
+    void computeBaseFunctionValues( const Eigen::VectorXd& azimuthAngles,
+                                    std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+                                    std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues,
+                                    const unsigned int maximumDerivativeOrder = 3 );
+
+    //! Compute values of the radial distance and elevation angle functions, and of their first three derivatives, from
+    //! the values of their base functions and the current coefficients.
+    void computeShapingFunctionValues( const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+                                       const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues,
+                                       std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                       std::vector< Eigen::ArrayXd >& elevationAngleValues );
+
+    //! Compute scalar function D (Eq. 7.62 of Roegiers (2014)) from the values of the shaping functions.
+    Eigen::ArrayXd computeScalarFunctionD( const std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                           const std::vector< Eigen::ArrayXd >& elevationAngleValues );
+
+    //! Compute derivative of scalar function D (Eq. 7.63 of Roegiers (2014)) w.r.t. azimuth angle from the values of the
+    //! shaping functions.
+    Eigen::ArrayXd computeDerivativeScalarFunctionD( const std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                                     const std::vector< Eigen::ArrayXd >& elevationAngleValues );
+
+    //! Compute derivative of the normalized time w.r.t. the azimuth angle, from the values of the base functions.
+    /*!
+     * Compute derivative of the normalized time w.r.t. the azimuth angle (i.e. the integrand of the time equation), from
+     * the values of the base functions at a list of azimuth angles, computed by computeBaseFunctionValues.
+     * \param radialBaseFunctionValues Values of radial distance base functions, and their derivatives
+     * \param elevationBaseFunctionValues Values of elevation angle base functions, and their derivatives
+     * \return Derivative of the normalized time w.r.t. azimuth angle at each of the azimuth angles
+     */
+    Eigen::ArrayXd computeDerivativesOfTimeWrtAzimuthAngle(
+            const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+            const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues );
+
+    //! Compute derivative of the normalized deltaV w.r.t. the azimuth angle, from the values of the base functions.
+    /*!
+     * Compute derivative of the normalized deltaV w.r.t. the azimuth angle (i.e. the magnitude of the normalized thrust
+     * acceleration, multiplied by the derivative of the time w.r.t. the azimuth angle), from the values of the base
+     * functions at a list of azimuth angles, computed by computeBaseFunctionValues.
+     * \param radialBaseFunctionValues Values of radial distance base functions, and their derivatives
+     * \param elevationBaseFunctionValues Values of elevation angle base functions, and their derivatives
+     * \return Derivative of the normalized deltaV w.r.t. azimuth angle at each of the azimuth angles
+     */
+    Eigen::ArrayXd computeDerivativesOfDeltaVWrtAzimuthAngle(
+            const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+            const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues );
+
+    //! Update the values of the base functions at the quadrature nodes between the initial and final azimuth angle, if the
+    //! azimuth angles differ from those for which they were last computed.
+    void updateTabulatedBaseFunctionValues( );
+
+    //! Convert a list of azimuth angles to the associated normalized times since departure.
+    Eigen::VectorXd convertAzimuthAnglesToNormalizedTimes( const Eigen::VectorXd& azimuthAngles );
+
     //! Time of flight function for the root-finder.
     struct TimeOfFlightFunction : public basic_mathematics::BasicFunction< double, double >
     {
@@ -300,6 +365,27 @@ private:
 
     std::shared_ptr< numerical_quadrature::QuadratureSettings< double > > quadratureSettings_;
 
+    //! Number of Gauss quadrature nodes, used to compute the time of flight and the deltaV.
+    const unsigned int numberOfQuadratureNodes_;
+
+    //! Gauss quadrature nodes (for the interval [-1, 1]).
+    Eigen::ArrayXd quadratureNodes_;
+
+    //! Gauss quadrature weights (for the interval [-1, 1]).
+    Eigen::ArrayXd quadratureWeights_;
+
+    //! Initial and final azimuth angle for which the base function values at the quadrature nodes were last computed.
+    double tabulatedInitialAzimuthAngle_;
+    double tabulatedFinalAzimuthAngle_;
+
+    //! Values of the radial distance base functions (and their derivatives) at the quadrature nodes between the initial
+    //! and final azimuth angle (see computeBaseFunctionValues).
+    std::vector< Eigen::MatrixXd > tabulatedRadialBaseFunctionValues_;
+
+    //! Values of the elevation angle base functions (and their derivatives) at the quadrature nodes between the initial
+    //! and final azimuth angle (see computeBaseFunctionValues).
+    std::vector< Eigen::MatrixXd > tabulatedElevationBaseFunctionValues_;
+
 };
 
 
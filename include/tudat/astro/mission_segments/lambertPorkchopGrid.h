@@ -0,0 +1,81 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_LAMBERT_PORKCHOP_GRID_H
+#define TUDAT_LAMBERT_PORKCHOP_GRID_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/ephemeris.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Compute the departure and arrival delta V's of Lambert transfers on a grid of departure and arrival times.
+/*!
+ * Computes the departure and arrival delta V's of (zero-revolution) Lambert transfers between two bodies on a grid of
+ * departure and arrival times, as used for porkchop plots and grid searches. The delta V's are the norms of the
+ * differences between the transfer velocities and the velocities of the bodies (i.e. the excess velocities w.r.t. the
+ * bodies). The states of the bodies are retrieved once per departure and arrival time, on the calling thread. The
+ * Lambert problems are then solved concurrently per departure time, with each problem started from the solution at the
+ * previous arrival time (see solveLambertProblemIzzoWithInitialGuess). Entries for which the arrival time is not after
+ * the departure time, or for which no solution is found, are set to NaN.
+ * \param departureBodyEphemeris Ephemeris of the departure body, w.r.t. the central body.
+ * \param arrivalBodyEphemeris Ephemeris of the arrival body, w.r.t. the central body.
+ * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+ * \param departureTimes Departure times (seconds since epoch of the ephemerides).
+ * \param arrivalTimes Arrival times (seconds since epoch of the ephemerides).
+ * \param deltaVsAtDeparture Departure delta V's, with one row per departure time and one column per arrival time.
+ * (returned by reference)
+ * \param deltaVsAtArrival Arrival delta V's, with one row per departure time and one column per arrival time.
+ * (returned by reference)
+ * \param numberOfThreads Number of threads to use (0 for the number of hardware threads).
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ */
+void computeLambertPorkchopGrid( const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+                                 const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+                                 const double centralBodyGravitationalParameter,
+                                 const std::vector< double >& departureTimes,
+                                 const std::vector< double >& arrivalTimes,
+                                 Eigen::MatrixXd& deltaVsAtDeparture,
+                                 Eigen::MatrixXd& deltaVsAtArrival,
+                                 const unsigned int numberOfThreads = 1,
+                                 const bool isRetrograde = false );
+
+//! Compute the total delta V of Lambert transfers on a grid of departure and arrival times.
+/*!
+ * Computes the total delta V (sum of departure and arrival delta V) of (zero-revolution) Lambert transfers between two
+ * bodies on a grid of departure and arrival times (see computeLambertPorkchopGrid for details).
+ * \param departureBodyEphemeris Ephemeris of the departure body, w.r.t. the central body.
+ * \param arrivalBodyEphemeris Ephemeris of the arrival body, w.r.t. the central body.
+ * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+ * \param departureTimes Departure times (seconds since epoch of the ephemerides).
+ * \param arrivalTimes Arrival times (seconds since epoch of the ephemerides).
+ * \param numberOfThreads Number of threads to use (0 for the number of hardware threads).
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ * \return Total delta V's, with one row per departure time and one column per arrival time.
+ */
+Eigen::MatrixXd computeLambertPorkchopGrid( const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+                                            const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+                                            const double centralBodyGravitationalParameter,
+                                            const std::vector< double >& departureTimes,
+                                            const std::vector< double >& arrivalTimes,
+                                            const unsigned int numberOfThreads = 1,
+                                            const bool isRetrograde = false );
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_PORKCHOP_GRID_H
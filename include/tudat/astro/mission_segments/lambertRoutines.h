@@ -67,6 +67,102 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
                               const double convergenceTolerance = 1e-9,
                               const unsigned int maximumNumberOfIterations = 50 );
 
+//! Solve Lambert Problem using Izzo's algorithm, with an initial guess from a neighbouring solution.
+/*!
+ * Solves the Lambert Problem using Izzo's algorithm (see solveLambertProblemIzzo), starting the root finder from the
+ * x-parameter of a neighbouring solution (e.g. an adjacent cell in a grid of departure and arrival times), which
+ * typically reduces the number of iterations that is needed. If no valid initial guess is provided, or the root finder
+ * does not converge from the initial guess, the default initial guesses of solveLambertProblemIzzo are used.
+ * Contrary to solveLambertProblemIzzo, no exception is thrown if no solution is found (or if the time of flight is not
+ * positive), in which case the velocities are set to NaN, and false is returned.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocityAtDeparture Velocity at departure. [Output]
+ * \param cartesianVelocityAtArrival Velocity at arrival. [Output]
+ * \param xParameter x-parameter of neighbouring solution, ignored if NaN [Input], x-parameter of solution, NaN if no
+ *          solution is found [Output].
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ *          [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ *          [Input, Optional]
+ * \return True if a solution is found, false otherwise.
+ */
+bool solveLambertProblemIzzoWithInitialGuess( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter,
+                                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                                              double& xParameter,
+                                              const bool isRetrograde = false,
+                                              const double convergenceTolerance = 1e-9,
+                                              const unsigned int maximumNumberOfIterations = 50 );
+
+//! Solve a batch of Lambert Problems using Izzo's algorithm.
+/*!
+ * Solves a batch of Lambert Problems using Izzo's algorithm (see solveLambertProblemIzzo), for instance for a grid
+ * search over departure and arrival times. The problems are divided into blocks of consecutive problems, which are
+ * distributed over the requested number of threads. Within a block, each problem may be started from the solution of
+ * the previous problem (see solveLambertProblemIzzoWithInitialGuess), so problems should preferably be ordered such
+ * that consecutive problems are similar (e.g. by increasing arrival time for a single departure time). The results do
+ * not depend on the number of threads. Problems for which no solution is found have NaN velocities.
+ * \param cartesianPositionsAtDeparture Cartesian positions at departure (one column per problem). [Input]
+ * \param cartesianPositionsAtArrival Cartesian positions at arrival (one column per problem). [Input]
+ * \param timesOfFlight Times-of-flight between departure and arrival (one entry per problem). [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocitiesAtDeparture Velocities at departure (one column per problem). [Output]
+ * \param cartesianVelocitiesAtArrival Velocities at arrival (one column per problem). [Output]
+ * \param numberOfThreads Number of threads to use (0 for the number of hardware threads). [Input, Optional]
+ * \param useWarmStart Boolean denoting whether problems are started from the solution of the previous problem.
+ *          [Input, Optional]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ *          [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ *          [Input, Optional]
+ */
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const unsigned int numberOfThreads = 1,
+                               const bool useWarmStart = true,
+                               const bool isRetrograde = false,
+                               const double convergenceTolerance = 1e-9,
+                               const unsigned int maximumNumberOfIterations = 50 );
+
+//! Compute the departure and arrival delta V's of a batch of Lambert transfers between given states.
+/*!
+ * Computes the departure and arrival delta V's of a batch of Lambert transfers between given states (e.g. of the
+ * departure and arrival bodies), i.e. the norms of the differences between the transfer velocities and the velocities
+ * of the given states. The Lambert problems are solved as in solveLambertProblemsIzzo, and the delta V's of problems
+ * for which no solution is found are NaN.
+ * \param statesAtDeparture Cartesian states at departure (one column per problem). [Input]
+ * \param statesAtArrival Cartesian states at arrival (one column per problem). [Input]
+ * \param timesOfFlight Times-of-flight between departure and arrival (one entry per problem). [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param deltaVsAtDeparture Delta V's at departure (one entry per problem). [Output]
+ * \param deltaVsAtArrival Delta V's at arrival (one entry per problem). [Output]
+ * \param numberOfThreads Number of threads to use (0 for the number of hardware threads). [Input, Optional]
+ * \param useWarmStart Boolean denoting whether problems are started from the solution of the previous problem.
+ *          [Input, Optional]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ */
+void computeLambertTransferDeltaVs( const Eigen::Matrix< double, 6, Eigen::Dynamic >& statesAtDeparture,
+                                    const Eigen::Matrix< double, 6, Eigen::Dynamic >& statesAtArrival,
+                                    const Eigen::VectorXd& timesOfFlight,
+                                    const double gravitationalParameter,
+                                    Eigen::VectorXd& deltaVsAtDeparture,
+                                    Eigen::VectorXd& deltaVsAtArrival,
+                                    const unsigned int numberOfThreads = 1,
+                                    const bool useWarmStart = true,
+                                    const bool isRetrograde = false );
+
 //! Compute time-of-flight using Lagrange's equation.
 /*!
  * Computes the time-of-flight according to Lagrange's equation as a function of the x-parameter.
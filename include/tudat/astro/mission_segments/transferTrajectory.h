@@ -46,7 +46,9 @@ public:
     TransferTrajectory(
             const std::vector< std::shared_ptr< TransferLeg > > legs,
             const std::vector< std::shared_ptr< TransferNode > > nodes ):
-        legs_( legs ), nodes_( nodes ), isComputed_( false )
+        legs_( legs ), nodes_( nodes ), isComputed_( false ),
+        legEvaluated_( legs.size( ), false ), nodeEvaluated_( nodes.size( ), false ),
+        legTotalParameters_( legs.size( ) ), nodeTotalParameters_( nodes.size( ) )
     {
         totalDeltaV_ = 0.0;
     }
@@ -149,6 +151,18 @@ private:
 
     //! Boolean defining whether the object is in a valid state (trajectory parameters have been set)
     bool isComputed_;
+
+    //! Flags indicating which legs have been evaluated in current call to evaluateTrajectory
+    std::vector< bool > legEvaluated_;
+
+    //! Flags indicating which nodes have been evaluated in current call to evaluateTrajectory
+    std::vector< bool > nodeEvaluated_;
+
+    //! Full set of parameters per leg, retained between calls to evaluateTrajectory to prevent reallocation
+    std::vector< Eigen::VectorXd > legTotalParameters_;
+
+    //! Full set of parameters per node, retained between calls to evaluateTrajectory to prevent reallocation
+    std::vector< Eigen::VectorXd > nodeTotalParameters_;
 };
 
 
@@ -0,0 +1,202 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TRANSFER_TRAJECTORY_EVALUATOR_H
+#define TUDAT_TRANSFER_TRAJECTORY_EVALUATOR_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/mission_segments/createTransferTrajectory.h"
+#include "tudat/astro/mission_segments/transferTrajectory.h"
+#include "tudat/simulation/environment_setup/body.h"
+
+namespace tudat
+{
+
+namespace mission_segments
+{
+
+//! Class to evaluate a single transfer trajectory definition for many parameter vectors, concurrently if required.
+/*!
+ *  Class to evaluate a single transfer trajectory definition (legs and nodes settings) for many parameter vectors, as
+ *  done by the fitness function of an optimizer. Since the legs and nodes of a TransferTrajectory store the results of
+ *  the most recent evaluation (and are linked to one another), a single TransferTrajectory cannot be evaluated from
+ *  multiple threads. This class therefore creates a number of independent workspaces, each of which consists of a
+ *  TransferTrajectory and the preallocated node times and free parameters that are used as its input. Evaluations that
+ *  are done simultaneously each use a different workspace, and after the first evaluation in a workspace no memory is
+ *  (re)allocated by the trajectory itself.
+ *
+ *  The parameter vector of a trajectory consists of the times of the nodes (in seconds since J2000, one per node),
+ *  followed by the free parameters of the nodes and legs, in the order defined by
+ *  getParameterVectorDecompositionIndices (see also printTransferParameterDefinition).
+ *
+ *  The ephemerides of the bodies used by different workspaces must be safe for concurrent use. Since this is not the case
+ *  for all ephemeris models (e.g. the approximate planet position models store their most recent results), the bodies
+ *  of each workspace are created separately by a user-defined function. This function may return the same bodies for
+ *  each workspace if their ephemerides are thread-safe, or if only a single workspace is used.
+ */
+class TransferTrajectoryEvaluator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the workspaces (on the calling thread, in order of their index).
+     *  \param bodiesCreationFunction Function that returns the bodies to be used by the workspace with the given index
+     *  \param legSettings Settings for the legs of the trajectory
+     *  \param nodeSettings Settings for the nodes of the trajectory
+     *  \param nodeIds Names of the bodies at the nodes of the trajectory
+     *  \param centralBody Name of the central body of the trajectory
+     *  \param numberOfWorkspaces Number of workspaces (maximum number of concurrent evaluations). If 0, the number of
+     *  hardware threads is used.
+     */
+    TransferTrajectoryEvaluator(
+            const std::function< simulation_setup::SystemOfBodies( const unsigned int ) > bodiesCreationFunction,
+            const std::vector< std::shared_ptr< TransferLegSettings > >& legSettings,
+            const std::vector< std::shared_ptr< TransferNodeSettings > >& nodeSettings,
+            const std::vector< std::string >& nodeIds,
+            const std::string& centralBody,
+            const unsigned int numberOfWorkspaces = 0 );
+
+    //! Function to compute the total Delta V of the trajectory for a given parameter vector, using any free workspace
+    /*!
+     *  Function to compute the total Delta V of the trajectory for a given parameter vector. This function may be called
+     *  concurrently from any number of threads: each call uses a workspace that is not in use by any other call, and
+     *  waits for a workspace to become available if all are in use.
+     *  \param trajectoryParameters Parameter vector of the trajectory (node times, followed by free parameters)
+     *  \return Total Delta V of the trajectory
+     */
+    double computeTotalDeltaV( const Eigen::VectorXd& trajectoryParameters );
+
+    //! Function to compute the total Delta V of the trajectory for a given parameter vector, using a given workspace
+    /*!
+     *  Function to compute the total Delta V of the trajectory for a given parameter vector, using a given workspace. The
+     *  caller is responsible for ensuring that the workspace is not used by any other thread concurrently. After the call,
+     *  the details of the trajectory (Delta V per leg, states along trajectory, etc.) can be retrieved from the
+     *  trajectory returned by getTransferTrajectory.
+     *  \param trajectoryParameters Parameter vector of the trajectory (node times, followed by free parameters)
+     *  \param workspaceIndex Index of workspace that is to be used
+     *  \return Total Delta V of the trajectory
+     */
+    double computeTotalDeltaV( const Eigen::VectorXd& trajectoryParameters,
+                               const unsigned int workspaceIndex );
+
+    //! Function to compute the total Delta V of the trajectory for a batch of parameter vectors (e.g. a population)
+    /*!
+     *  Function to compute the total Delta V of the trajectory for a batch of parameter vectors (e.g. all members of a
+     *  population), using all workspaces concurrently. The parameter vectors are distributed dynamically over the
+     *  workspaces, which are acquired in the same manner as in computeTotalDeltaV. If the evaluation of any parameter
+     *  vector throws an exception, no new evaluations are started, and the exception is rethrown after all workspaces have
+     *  finished.
+     *  \param trajectoryParameters Parameter vectors of the trajectories (one per column)
+     *  \param totalDeltaVs Total Delta V of each of the trajectories (returned by reference)
+     */
+    void computeTotalDeltaVs( const Eigen::MatrixXd& trajectoryParameters,
+                              Eigen::VectorXd& totalDeltaVs );
+
+    //! Function to compute the total Delta V of the trajectory for a batch of parameter vectors (e.g. a population)
+    /*!
+     *  Function to compute the total Delta V of the trajectory for a batch of parameter vectors (see overloaded function
+     *  for details).
+     *  \param trajectoryParameters Parameter vectors of the trajectories (one per column)
+     *  \return Total Delta V of each of the trajectories
+     */
+    Eigen::VectorXd computeTotalDeltaVs( const Eigen::MatrixXd& trajectoryParameters );
+
+    //! Function to retrieve the number of parameters defining the trajectory
+    /*!
+     *  Function to retrieve the number of parameters defining the trajectory (node times and free parameters)
+     *  \return Number of parameters defining the trajectory
+     */
+    int getNumberOfParameters( )
+    {
+        return numberOfParameters_;
+    }
+
+    //! Function to retrieve the number of workspaces
+    /*!
+     *  Function to retrieve the number of workspaces
+     *  \return Number of workspaces
+     */
+    unsigned int getNumberOfWorkspaces( )
+    {
+        return workspaces_.size( );
+    }
+
+    //! Function to retrieve the transfer trajectory of a single workspace
+    /*!
+     *  Function to retrieve the transfer trajectory of a single workspace
+     *  \param workspaceIndex Index of workspace
+     *  \return Transfer trajectory of requested workspace
+     */
+    std::shared_ptr< TransferTrajectory > getTransferTrajectory( const unsigned int workspaceIndex )
+    {
+        return workspaces_.at( workspaceIndex )->transferTrajectory_;
+    }
+
+private:
+
+    //! Transfer trajectory and preallocated input of a single workspace
+    struct TransferTrajectoryWorkspace
+    {
+        //! Transfer trajectory of the workspace
+        std::shared_ptr< TransferTrajectory > transferTrajectory_;
+
+        //! Times of the nodes, as used for the current evaluation
+        std::vector< double > nodeTimes_;
+
+        //! Free parameters of the legs, as used for the current evaluation
+        std::vector< Eigen::VectorXd > legFreeParameters_;
+
+        //! Free parameters of the nodes, as used for the current evaluation
+        std::vector< Eigen::VectorXd > nodeFreeParameters_;
+    };
+
+    //! Function to retrieve the index of a workspace that is not in use, waiting for one if all are in use
+    unsigned int acquireWorkspace( );
+
+    //! Function to mark a workspace as no longer in use
+    void releaseWorkspace( const unsigned int workspaceIndex );
+
+    //! Indices of the first entry in the parameter vector, and number of entries, for the free parameters of each leg
+    std::vector< std::pair< int, int > > legParameterIndices_;
+
+    //! Indices of the first entry in the parameter vector, and number of entries, for the free parameters of each node
+    std::vector< std::pair< int, int > > nodeParameterIndices_;
+
+    //! Number of parameters defining the trajectory (node times and free parameters)
+    int numberOfParameters_;
+
+    //! List of workspaces
+    std::vector< std::shared_ptr< TransferTrajectoryWorkspace > > workspaces_;
+
+    //! Indices of workspaces that are not in use by computeTotalDeltaV
+    std::vector< unsigned int > availableWorkspaces_;
+
+    //! Mutex protecting availableWorkspaces_
+    std::mutex workspaceMutex_;
+
+    //! Condition variable used to wait for a workspace to become available
+    std::condition_variable workspaceAvailableCondition_;
+};
+
+} // namespace mission_segments
+
+} // namespace tudat
+
+#endif // TUDAT_TRANSFER_TRAJECTORY_EVALUATOR_H
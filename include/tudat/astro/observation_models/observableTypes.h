@@ -110,6 +110,15 @@ std::vector< LinkEndType > getLinkEndTypesForGivenLinkEndId(
         const LinkEnds& linkEnds,
         const LinkEndId linkEndToCheck );
 
+//! Function to check whether residuals of an observable type may contain (2 pi) discontinuities that are to be corrected
+/*!
+ * Function to check whether residuals of an observable type may contain (2 pi) discontinuities that are to be corrected
+ * by checkObservationResidualDiscontinuities, in which case each residual depends on the preceding residual of same type.
+ * \param observableType Observable type for which check is to be performed
+ * \return True if residual discontinuities are to be checked for given observable type
+ */
+bool isResidualDiscontinuityCheckRequired( const ObservableType observableType );
+
 void checkObservationResidualDiscontinuities(
         Eigen::Block< Eigen::VectorXd > observationBlock,
         const ObservableType observableType );
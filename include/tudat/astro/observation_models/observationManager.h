@@ -350,11 +350,13 @@ protected:
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        // Retrieve partials for current link ends (by reference, so that different link ends may be processed concurrently)
+        const std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >&
+                currentLinkEndPartials = observationPartials_.at( linkEnds );
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, std::shared_ptr<
-             observation_partials::ObservationPartial< ObservationSize > > >::iterator
+             observation_partials::ObservationPartial< ObservationSize > > >::const_iterator
              partialIterator = currentLinkEndPartials.begin( );
              partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
         {
@@ -414,10 +416,6 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
-
 };
 
 extern template class ObservationManagerBase< double, double >;
@@ -247,6 +247,10 @@ private:
     //! Polyhedron edge dyads.
     std::vector< Eigen::MatrixXd > edgeDyads_;
 
+    //! Function returning position of body undergoing acceleration wrt body exerting acceleration, in body-fixed frame
+    //! (as used by acceleration model).
+    std::function< Eigen::Vector3d( ) > bodyFixedRelativePositionFunction_;
+
     //! Function returning position of body undergoing acceleration.
     std::function< Eigen::Vector3d( ) > positionFunctionOfAcceleratedBody_;
 
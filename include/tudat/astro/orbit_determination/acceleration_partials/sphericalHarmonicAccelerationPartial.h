@@ -358,6 +358,22 @@ protected:
             const std::vector< std::pair< int, int > >& blockIndices,
             Eigen::MatrixXd& partialDerivatives );
 
+    //! Function to calculate the partial of the acceleration wrt a set of coefficients, using the Pines formulation.
+    /*!
+     *  Function to calculate the partial of the acceleration wrt a set of cosine or sine coefficients, using the
+     *  Pines formulation of the spherical harmonic gravity field.
+     *  \param blockIndices List of coefficient indices wrt which the partials are to be taken (first and second
+     *  are degree and order for each vector entry).
+     *  \param areCosineCoefficients Boolean denoting whether the partials wrt cosine (if true) or sine (if false)
+     *  coefficients are to be computed
+     *  \param partialDerivatives Matrix of acceleration partials that is set by this function (returned by reference),
+     *  with each column containg the partial wrt a single coefficient (in same order as blockIndices).
+     */
+    void wrtCoefficientBlockUsingPinesFormulation(
+            const std::vector< std::pair< int, int > >& blockIndices,
+            const bool areCosineCoefficients,
+            Eigen::MatrixXd& partialDerivatives );
+
     //! Function to calculate an acceleration partial wrt a rotational parameter.
     /*!
      *  Function to calculate an acceleration partial wrt a rotational parameter of the rotation model of the body
@@ -415,6 +431,10 @@ protected:
     //! calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicCache_;
 
+    //! Cache object used for the Pines formulation of the spherical harmonic gravity field calculations (nullptr if the
+    //! acceleration model uses the formulation in spherical coordinates).
+    std::shared_ptr< gravitation::PinesSphericalHarmonicsCache > pinesSphericalHarmonicsCache_;
+
     //! Function returning position of body undergoing acceleration.
     std::function< Eigen::Vector3d( ) > positionFunctionOfAcceleratedBody_;
 
@@ -11,7 +11,9 @@
 #ifndef TUDAT_PODINPUTOUTPUTTYPES_H
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
+#include <fstream>
 #include <map>
+#include <string>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -20,6 +22,7 @@
 #include <Eigen/LU>
 
 #include "tudat/basics/timeType.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/simulation/estimation_setup/observations.h"
@@ -58,7 +61,12 @@ public:
         saveInformationMatrix_( true ),
         printOutput_( true ),
         saveResidualsAndParametersFromEachIteration_( true ),
-        saveStateHistoryForEachIteration_( false )
+        saveStateHistoryForEachIteration_( false ),
+        accumulateNormalEquations_( false ),
+        maximumNumberOfObservationsPerBlock_( 1000 ),
+        partialsFileName_( "" ),
+        numberOfThreads_( 1 ),
+        normalEquationsSolverType_( linear_algebra::svd_normal_equations_solver )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -229,6 +237,58 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define whether the normal equations are to be accumulated per block of observations
+    /*!
+     *  Function to define whether the normal equations are to be accumulated per block of observations. If so, the
+     *  partials are computed for (at most) maximumNumberOfObservationsPerBlock observation times at a time, and their
+     *  contribution to the normal equations is added immediately, so that the full matrix of partials (of size number of
+     *  observations times number of parameters) is never stored. In this case, the partials are not saved in the
+     *  estimation output, but they may be written to a (binary) file for later analysis.
+     *  \param accumulateNormalEquations Boolean denoting whether the normal equations are to be accumulated per block
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observation times for which partials are computed at once
+     *  \param partialsFileName Name of file to which the unnormalized partials of the best iteration are written (as
+     *  row-major matrix of doubles, one row per observable). No file is written if empty.
+     */
+    void defineNormalEquationsAccumulationSettings( const bool accumulateNormalEquations = 1,
+                                                    const int maximumNumberOfObservationsPerBlock = 1000,
+                                                    const std::string& partialsFileName = "" )
+    {
+        if( maximumNumberOfObservationsPerBlock < 1 )
+        {
+            throw std::runtime_error( "Error when defining normal equations accumulation, maximum number of observations per block must be positive, provided value is " +
+                                      std::to_string( maximumNumberOfObservationsPerBlock ) );
+        }
+        accumulateNormalEquations_ = accumulateNormalEquations;
+        maximumNumberOfObservationsPerBlock_ = maximumNumberOfObservationsPerBlock;
+        partialsFileName_ = partialsFileName;
+    }
+
+    //! Function to set the number of threads over which the computation of observations and partials is distributed
+    /*!
+     *  Function to set the number of threads over which the computation of the observations, residuals and partials is
+     *  distributed. The observations of different link ends are processed concurrently (with all link ends of observable
+     *  types requiring a residual discontinuity check processed as one task). During this phase, the environment is only
+     *  read, and the thread safety of the standard environment models is ensured. Custom environment or observation
+     *  models that store intermediate results must be thread-safe when more than one thread is used.
+     *  \param numberOfThreads Number of threads (1 for serial computation, 0 to use all available hardware threads)
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    //! Function to set the type of solver that is used for the normal equations
+    /*!
+     *  Function to set the type of solver that is used for the normal equations. By default, an SVD decomposition is used.
+     *  For large numbers of parameters, a Cholesky decomposition is much faster (with an SVD decomposition used as fallback
+     *  if the normal matrix is not numerically positive definite).
+     *  \param normalEquationsSolverType Type of solver that is used for the normal equations
+     */
+    void setNormalEquationsSolverType( const linear_algebra::NormalEquationsSolverType normalEquationsSolverType )
+    {
+        normalEquationsSolverType_ = normalEquationsSolverType;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -331,6 +391,36 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the boolean denoting whether the normal equations are to be accumulated per block of observations
+    bool getAccumulateNormalEquations( )
+    {
+        return accumulateNormalEquations_;
+    }
+
+    //! Function to return the maximum number of observation times for which partials are computed at once
+    int getMaximumNumberOfObservationsPerBlock( )
+    {
+        return maximumNumberOfObservationsPerBlock_;
+    }
+
+    //! Function to return the name of file to which partials are written when accumulating normal equations
+    std::string getPartialsFileName( )
+    {
+        return partialsFileName_;
+    }
+
+    //! Function to return the number of threads over which the computation of observations and partials is distributed
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to return the type of solver that is used for the normal equations
+    linear_algebra::NormalEquationsSolverType getNormalEquationsSolverType( )
+    {
+        return normalEquationsSolverType_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationCollection_;
@@ -362,6 +452,21 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Boolean denoting whether the normal equations are to be accumulated per block of observations
+    bool accumulateNormalEquations_;
+
+    //! Maximum number of observation times for which partials are computed at once (when accumulating normal equations)
+    int maximumNumberOfObservationsPerBlock_;
+
+    //! Name of file to which partials are written when accumulating normal equations (none if empty)
+    std::string partialsFileName_;
+
+    //! Number of threads over which computation of observations and partials is distributed (0 for all hardware threads)
+    unsigned int numberOfThreads_;
+
+    //! Type of solver that is used for the normal equations
+    linear_algebra::NormalEquationsSolverType normalEquationsSolverType_;
+
 };
 
 //! Class that is used during the orbit determination/parameter estimation to determine whether the estimation is converged.
@@ -576,6 +681,54 @@ struct PodOutput
     {
         return normalizedInformationMatrix_;
     }
+
+    //! Function to set the name of the file to which the unnormalized partials were written during the estimation
+    void setPartialsFileName( const std::string& partialsFileName )
+    {
+        partialsFileName_ = partialsFileName;
+    }
+
+    //! Function to retrieve the name of the file to which the unnormalized partials were written during the estimation
+    std::string getPartialsFileName( )
+    {
+        return partialsFileName_;
+    }
+
+    //! Function to read a block of rows of the unnormalized partials from the file written during the estimation
+    /*!
+     * Function to read a block of rows of the unnormalized partials (typically denoted as H) from the file written during
+     * the estimation, for the case where the normal equations were accumulated per block of observations, and the full
+     * matrix of partials is not stored in this object.
+     * \param startRow Index of first row (observable) to read
+     * \param numberOfRows Number of rows to read
+     * \return Block of matrix of unnormalized partial derivatives
+     */
+    Eigen::MatrixXd getUnnormalizedInformationMatrixBlockFromFile( const int startRow, const int numberOfRows )
+    {
+        if( partialsFileName_ == "" )
+        {
+            throw std::runtime_error( "Error when reading partials from file, no partials file was written during estimation" );
+        }
+        else if( startRow < 0 || numberOfRows < 0 || ( startRow + numberOfRows ) > residuals_.rows( ) )
+        {
+            throw std::runtime_error( "Error when reading partials from file, requested rows " + std::to_string( startRow ) +
+                                      " to " + std::to_string( startRow + numberOfRows ) + " are not in range of " +
+                                      std::to_string( residuals_.rows( ) ) + " observables" );
+        }
+
+        const int numberOfParameters = informationMatrixTransformationDiagonal_.rows( );
+        Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > partialsBlock( numberOfRows, numberOfParameters );
+
+        std::ifstream partialsFile( partialsFileName_, std::ios::binary );
+        partialsFile.seekg( static_cast< std::streamoff >( startRow ) * numberOfParameters * sizeof( double ) );
+        partialsFile.read( reinterpret_cast< char* >( partialsBlock.data( ) ),
+                           static_cast< std::streamsize >( numberOfRows ) * numberOfParameters * sizeof( double ) );
+        if( !partialsFile )
+        {
+            throw std::runtime_error( "Error when reading partials from file " + partialsFileName_ + ", could not read requested rows" );
+        }
+        return partialsBlock;
+    }
     // Michael
     std::vector< std::vector< std::map< TimeType, Eigen::VectorXd > > > getDependentVariableHistory( )
     {
@@ -715,6 +868,9 @@ struct PodOutput
     //! Vector of parameter vectors per iteration (entry 0 is pre-estimation values)
     std::vector< Eigen::VectorXd > parameterHistory_;
 
+    //! Name of file to which the unnormalized partials were written during the estimation (none if empty)
+    std::string partialsFileName_;
+
     //! List of numerical solutions of dynamics (per iteration, per arc)
     std::vector< std::vector< std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > > > dynamicsHistoryPerIteration_;
 
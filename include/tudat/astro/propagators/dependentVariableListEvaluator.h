@@ -0,0 +1,104 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_DEPENDENTVARIABLELISTEVALUATOR_H
+#define TUDAT_DEPENDENTVARIABLELISTEVALUATOR_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class to evaluate a list of scalar and vector dependent variables, and write the results into a single vector
+/*!
+ *  Class to evaluate a list of scalar and vector dependent variables, and write the concatenated results into a single
+ *  (caller-provided) vector. The list of variable functions is set once, upon creation of the propagation, so that
+ *  evaluating the dependent variables does not copy the function list, and does not require any memory allocation for the
+ *  concatenation of the results: vector variables are written directly into their segment of the output vector. The variables are evaluated in the order in which they were
+ *  added. NOTE: The environment and state derivative models need to be updated to the current state and independent
+ *  variable before the dependent variables are evaluated.
+ */
+class DependentVariableListEvaluator
+{
+public:
+
+    //! Constructor, creates an empty list of dependent variables
+    DependentVariableListEvaluator( ): totalSize_( 0 ){ }
+
+    //! Function to add a scalar dependent variable to the end of the list
+    /*!
+     * Function to add a scalar dependent variable to the end of the list
+     * \param variableFunction Function returning the dependent variable
+     */
+    void addScalarVariable( const std::function< double( ) >& variableFunction );
+
+    //! Function to add a vector dependent variable to the end of the list
+    /*!
+     * Function to add a vector dependent variable to the end of the list
+     * \param variableFunction Function writing the dependent variable into its input block (of size variableSize)
+     * \param variableSize Size of the dependent variable
+     */
+    void addVectorVariable( const std::function< void( Eigen::Ref< Eigen::VectorXd > ) >& variableFunction,
+                            const int variableSize );
+
+    //! Function to evaluate all dependent variables, and write them into the given vector
+    /*!
+     * Function to evaluate all dependent variables, and write them into the given vector (e.g. an entry of a
+     * ContiguousHistory), without allocating intermediate vectors for the concatenation.
+     * \param dependentVariables Vector into which the dependent variables are written, must be of size getTotalSize( )
+     */
+    void evaluate( Eigen::Ref< Eigen::VectorXd > dependentVariables ) const;
+
+    //! Function to evaluate all dependent variables, and return them as a single vector
+    /*!
+     * Function to evaluate all dependent variables, and return them as a single vector
+     * \return Concatenated values of all dependent variables
+     */
+    Eigen::VectorXd evaluate( ) const;
+
+    //! Function to retrieve the total size of all dependent variables
+    /*!
+     * Function to retrieve the total size of all dependent variables
+     * \return Total size of all dependent variables
+     */
+    int getTotalSize( ) const
+    {
+        return totalSize_;
+    }
+
+private:
+
+    //! Function returning a scalar dependent variable (nullptr if the variable is a vector).
+    std::vector< std::function< double( ) > > scalarFunctions_;
+
+    //! Function writing a vector dependent variable into its segment (nullptr if the variable is a scalar).
+    std::vector< std::function< void( Eigen::Ref< Eigen::VectorXd > ) > > vectorFunctions_;
+
+    //! Start index of each of the dependent variables in the concatenated vector.
+    std::vector< int > startIndices_;
+
+    //! Size of each of the dependent variables.
+    std::vector< int > variableSizes_;
+
+    //! Total size of all dependent variables.
+    int totalSize_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_DEPENDENTVARIABLELISTEVALUATOR_H
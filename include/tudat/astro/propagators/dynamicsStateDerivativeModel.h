@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 
+#include "tudat/basics/contiguousHistory.h"
 #include "tudat/astro/basic_astro/torqueModelTypes.h"
 #include "tudat/astro/propagators/bodyMassStateDerivative.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
@@ -370,6 +371,32 @@ public:
         }
     }
 
+    //! Function to convert a state history stored in contiguous memory from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a state history stored in contiguous memory from propagator-specific form to the conventional
+     * form (not necessarily in inertial frame). Any entries in the convertedSolution are removed.
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            utilities::ContiguousHistory< TimeType, StateScalarType >& convertedSolution,
+            const utilities::ContiguousHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( );
+        convertedSolution.reserve( rawSolution.size( ) );
+
+        // Iterate over all times, in order in which they were added to raw solution
+        const std::vector< TimeType >& times = rawSolution.getIndependentVariables( );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentRawState;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            currentRawState = rawSolution.getDataBlock( ).row( i ).transpose( );
+            convertedSolution.insert( times.at( i ), convertToOutputSolution( currentRawState, times.at( i ) ) );
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
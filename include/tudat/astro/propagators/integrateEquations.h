@@ -27,7 +27,9 @@
 #include "tudat/math/integrators/numericalIntegrator.h"
 
 #include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/basics/contiguousHistory.h"
 #include "tudat/basics/timeType.h"
+#include "tudat/astro/propagators/dependentVariableListEvaluator.h"
 #include "tudat/astro/propagators/singleStateTypeDerivative.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
@@ -43,8 +45,11 @@ namespace propagators
 //! Function to determine, for a given time step of the numerical integrator, the error in termination dependent variable
 /*!
  *  Function to determine, for a given time step of the numerical integrator, the error in termination dependent variable. This
- *  function is used as input for the root finder when the propagation must terminate exactly on a dependent variable value
- *  \param timeStep Time step to take with the numerical integrator
+ *  function is used as input for the root finder when the propagation must terminate exactly on a dependent variable value.
+ *  If the dense output of the integrator is available for the last step, the state is retrieved from the dense output,
+ *  instead of taking (and undoing) an integration step.
+ *  \param timeStep Time step to take with the numerical integrator (w.r.t. the previous independent variable of the
+ *  integrator when using dense output)
  *  \param integrator Numerical integrator used for propagation
  *  \param dependentVariableTerminationCondition Settings used to determine value/type of dependent variable at which propagation
  *  is to terminate
@@ -57,6 +62,14 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
         integrator,
         const std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition )
 {
+    // Retrieve state from dense output, and compute dependent variable error
+    if( integrator->isDenseOutputAvailable( ) )
+    {
+        TimeType currentTime = integrator->getPreviousIndependentVariable( ) + timeStep;
+        integrator->getStateDerivativeFunction( )( currentTime, integrator->getDenseOutputState( currentTime ) );
+        return static_cast< TimeStepType >( dependentVariableTerminationCondition->getStopConditionError( ) );
+    }
+
     // Perform integration step
     integrator->performIntegrationStep( timeStep );
 
@@ -76,9 +89,12 @@ TimeStepType getTerminationDependentVariableErrorForGivenTimeStep(
 /*!
  * Function that propagates to an exact final condition (within tolerance) for dependent variable termination condition.
  * Determines the time step that is to be taken by using a root finder, and returns (by reference) the converged final time
- * and state.
+ * and state. If the dense output of the integrator is available for the last step, the root finder evaluates the dependent
+ * variable from the dense output, instead of taking an integration step per iteration. In either case, the final state is
+ * obtained from a single integration step to the converged time, so that it has the accuracy of the integrator.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is rolled
- * back to the secondToLastTime/secondToLastState
+ * back to the secondToLastTime/secondToLastState, unless its dense output is available for the last step (in which case the
+ * integrator is at the lastTime/lastState, and is rolled back by this function before taking the final step).
  * \param dependentVariableTerminationCondition Termination condition that is to be used
  * \param secondToLastTime Second to last time (e.g. last time at which integration did not exceed termination condition)
  * \param lastTime Time at which integration first exceeded termination condition
@@ -136,6 +152,12 @@ void getFinalStateForExactDependentVariableTerminationCondition(
                     std::make_shared< basic_mathematics::FunctionProxy< TimeStepType, TimeStepType > >(
                         dependentVariableErrorFunction ), ( lastTime - secondToLastTime ) / 2.0 );
 
+        // Take final step with the integrator itself, so that the final state has the accuracy of the integrator (if the
+        // root was found using the dense output, the integrator is first rolled back to the start of the last step)
+        if( integrator->isDenseOutputAvailable( ) )
+        {
+            integrator->rollbackToPreviousState( );
+        }
         endState = integrator->performIntegrationStep( finalTimeStep );
         endTime = integrator->getCurrentIndependentVariable( );
     }
@@ -267,7 +289,9 @@ bool getFinalStateForExactHybridVariableTerminationCondition(
 
 //! Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition
 /*!
- * Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition.
+ * Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition. If the
+ * dense output of the integrator is available for the last step, it is used to locate a dependent variable termination
+ * condition, after which a single integration step is taken to the located time.
  * \param integrator Numerical integrator that is used for propagation. Upon input to this function, the integrator is at
  * the lastTime/lastState
  * \param terminationCondition Termination condition that is to be used
@@ -320,7 +344,10 @@ bool getFinalStateForExactTerminationCondition(
     }
     case dependent_variable_stopping_condition:
     {
-        integrator->rollbackToPreviousState( );
+        if( !integrator->isDenseOutputAvailable( ) )
+        {
+            integrator->rollbackToPreviousState( );
+        }
 
         std::shared_ptr< SingleVariableLimitPropagationTerminationCondition > dependentVariableTerminationCondition =
                 std::dynamic_pointer_cast< SingleVariableLimitPropagationTerminationCondition >( terminationCondition );
@@ -355,6 +382,61 @@ bool getFinalStateForExactTerminationCondition(
     return useNewSolution;
 }
 
+//! Function to evaluate the dependent variables, and add them to a history
+/*!
+ * Function to evaluate the dependent variables, and add them to a history (given as map or ContiguousHistory).
+ * \param dependentVariableHistory History of dependent variables to which entry is to be added (returned by reference)
+ * \param currentTime Time at which dependent variables are evaluated
+ * \param dependentVariableFunction Function returning dependent variables
+ */
+template< typename TimeType, typename DependentVariableHistoryType >
+void addDependentVariableHistoryEntry(
+        DependentVariableHistoryType& dependentVariableHistory,
+        const TimeType currentTime,
+        const std::function< Eigen::VectorXd( ) >& dependentVariableFunction )
+{
+    utilities::addHistoryEntry( dependentVariableHistory, currentTime, dependentVariableFunction( ) );
+}
+
+//! Function to evaluate the dependent variables directly into a new entry of a map
+/*!
+ * Function to evaluate the dependent variables directly into a new entry of a map, without creating a temporary vector
+ * for the concatenated dependent variables (only the vector stored in the map is allocated).
+ * \param dependentVariableHistory History of dependent variables to which entry is to be added (returned by reference)
+ * \param currentTime Time at which dependent variables are evaluated
+ * \param dependentVariableEvaluator Object evaluating the dependent variables
+ */
+template< typename TimeType >
+void addDependentVariableHistoryEntry(
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const TimeType currentTime,
+        const std::shared_ptr< DependentVariableListEvaluator >& dependentVariableEvaluator )
+{
+    Eigen::VectorXd& dependentVariables = dependentVariableHistory[ currentTime ];
+    dependentVariables.resize( dependentVariableEvaluator->getTotalSize( ) );
+    dependentVariableEvaluator->evaluate( dependentVariables );
+}
+
+//! Function to evaluate the dependent variables directly into a new entry of a ContiguousHistory
+/*!
+ * Function to evaluate the dependent variables directly into a new entry of a ContiguousHistory, without creating a
+ * temporary vector for the concatenated dependent variables.
+ * \param dependentVariableHistory History of dependent variables to which entry is to be added (returned by reference)
+ * \param currentTime Time at which dependent variables are evaluated
+ * \param dependentVariableEvaluator Object evaluating the dependent variables
+ */
+template< typename TimeType >
+void addDependentVariableHistoryEntry(
+        utilities::ContiguousHistory< TimeType, double >& dependentVariableHistory,
+        const TimeType currentTime,
+        const std::shared_ptr< DependentVariableListEvaluator >& dependentVariableEvaluator )
+{
+    const int totalSize = dependentVariableEvaluator->getTotalSize( );
+    dependentVariableEvaluator->evaluate(
+                Eigen::Map< Eigen::VectorXd >(
+                    dependentVariableHistory.addEntry( currentTime, totalSize, 1 ).data( ), totalSize ) );
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition.
@@ -363,21 +445,24 @@ bool getFinalStateForExactTerminationCondition(
  * \param propagationTerminationCondition Termination condition that is to be used
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
- * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
+ * derivative model), or DependentVariableListEvaluator.
+ * \param solutionHistory History of state variables that are to be saved, given as map or ContiguousHistory
  * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ * \param dependentVariableHistory History of dependent variables that are to be saved, given as map or ContiguousHistory
  * (time as key; returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename StateHistoryType = std::map< TimeType, StateType >,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd >,
+          typename DependentVariableFunctionType = std::function< Eigen::VectorXd( ) > >
 void propagateToExactTerminationCondition(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
-        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        const DependentVariableFunctionType& dependentVariableFunction,
+        StateHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step size control
@@ -396,40 +481,27 @@ void propagateToExactTerminationCondition(
     {
 
         // Check if any dependent variables are saved. If so, remove last entry
+        const bool isPropagationForward = ( timeStep > 0 );
         bool recomputeDependentVariables = false;
         if( dependentVariableHistory.size( ) > 0 )
         {
-            if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+            if( utilities::getMostRecentHistoryIndependentVariable( dependentVariableHistory, isPropagationForward ) ==
+                    utilities::getMostRecentHistoryIndependentVariable( solutionHistory, isPropagationForward ) )
             {
-                if( timeStep > 0 )
-                {
-                    dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-                }
-                else
-                {
-                    dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-                }
+                utilities::eraseMostRecentHistoryEntry( dependentVariableHistory, isPropagationForward );
                 recomputeDependentVariables = true;
             }
         }
 
         // Remove state entry last added, and enter converged final state
-        if( timeStep > 0 )
-        {
-            solutionHistory.erase( std::prev( solutionHistory.end() ) );
-            solutionHistory[ endTime ] = endState;
-        }
-        else
-        {
-            solutionHistory.erase( solutionHistory.begin( ) );
-            solutionHistory[ endTime ] = endState;
-        }
+        utilities::eraseMostRecentHistoryEntry( solutionHistory, isPropagationForward );
+        utilities::addHistoryEntry( solutionHistory, endTime, endState );
 
         // Recompute final dependent variables, if required
         if( recomputeDependentVariables )
         {
             integrator->getStateDerivativeFunction( )( endTime, endState );
-            dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+            addDependentVariableHistoryEntry( dependentVariableHistory, endTime, dependentVariableFunction );
 
             // Check stopping conditions to be able to save details
             propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -446,21 +518,22 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
-//! Function to numerically integrate a given first order differential equation
+//! Function to numerically integrate a given first order differential equation, saving the results in given history types
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
- *  a single independent variable and the current state
+ *  a single independent variable and the current state. This function is templated on the types in which the histories
+ *  are stored (std::map or ContiguousHistory), and is called by the integrateEquationsFromIntegrator overloads.
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
- *  \param solutionHistory History of state variables that are to be saved given as map
+ *  \param solutionHistory History of state variables that are to be saved
  *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  \param dependentVariableHistory History of dependent variables that are to be saved
  *  (time as key; returned by reference)
- *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
- *  as map (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved
+ *  (returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
- *  derivative model).
+ *  derivative model), or DependentVariableListEvaluator.
  *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
  *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
  *  steps, with n = saveFrequency).
@@ -469,20 +542,22 @@ void propagateToExactTerminationCondition(
  *  By default now(), i.e. the moment at which this function is called.
  *  \return Event that triggered the termination of the propagation
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
-std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+template< typename StateType, typename TimeType, typename TimeStepType,
+          typename StateHistoryType, typename DependentVariableHistoryType, typename ComputationTimeHistoryType,
+          typename DependentVariableFunctionType >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegratorToHistories(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        std::map< TimeType, double >& cumulativeComputationTimeHistory,
-        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
-        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
-        const int saveFrequency = TUDAT_NAN,
-        const TimeType statePrintInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
-        const bool printInitialAndFinalCondition = false )
+        StateHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
+        ComputationTimeHistoryType& cumulativeComputationTimeHistory,
+        const DependentVariableFunctionType& dependentVariableFunction,
+        const std::function< void( StateType& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const TimeType statePrintInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const bool printInitialAndFinalCondition )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
@@ -493,20 +568,20 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
     // Initialization of numerical solutions for variational equations
     solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    utilities::addHistoryEntry( solutionHistory, currentTime, newState );
 
     dependentVariableHistory.clear( );
     if( !( dependentVariableFunction == nullptr ) )
     {
-        integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        integrator->evaluateStateDerivativeAtCurrentState( );
+        addDependentVariableHistoryEntry( dependentVariableHistory, currentTime, dependentVariableFunction );
     }
 
     // CPU time
     cumulativeComputationTimeHistory.clear( );
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-    cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+    utilities::addHistoryEntry( cumulativeComputationTimeHistory, currentTime, currentCPUTime );
 
     // Set initial time step and total integration time.
     TimeStepType timeStep = initialTimeStep;
@@ -595,12 +670,14 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 saveIndex = saveIndex % saveFrequency;
                 if( saveIndex == 0 )
                 {
-                    solutionHistory[ currentTime ] = newState;
+                    utilities::addHistoryEntry( solutionHistory, currentTime, newState );
 
+                    // Update environment to current state, re-using state derivative evaluations of the integrator
                     if( !( dependentVariableFunction == nullptr ) )
                     {
-                        integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        integrator->evaluateStateDerivativeAtCurrentState( );
+                        addDependentVariableHistoryEntry(
+                                    dependentVariableHistory, currentTime, dependentVariableFunction );
                     }
                 }
             }
@@ -615,7 +692,7 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
-            cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
+            utilities::addHistoryEntry( cumulativeComputationTimeHistory, currentTime, currentCPUTime );
 
             if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
@@ -682,6 +759,143 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     return propagationTerminationReason;
 }
 
+//! Function to numerically integrate a given first order differential equation
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of state variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
+ *  (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
+ *  as map (time as key; returned by reference)
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        std::map< TimeType, StateType >& solutionHistory,
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        std::map< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType statePrintInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const bool printInitialAndFinalCondition = false )
+{
+    return integrateEquationsFromIntegratorToHistories(
+                integrator, initialTimeStep, propagationTerminationCondition,
+                solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                dependentVariableFunction, statePostProcessingFunction, saveFrequency, statePrintInterval,
+                initialClockTime, printInitialAndFinalCondition );
+}
+
+//! Function to numerically integrate a given first order differential equation, saving the results in contiguous memory
+/*!
+ *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+ *  a single independent variable and the current state. Contrary to the overload using std::map objects, the histories
+ *  are stored in ContiguousHistory objects, which do not require a separate allocation for each saved epoch.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of state variables that are to be saved given as ContiguousHistory
+ *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as ContiguousHistory
+ *  (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
+ *  as ContiguousHistory (time as key; returned by reference)
+ *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
+ *  derivative model).
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ContiguousHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        utilities::ContiguousHistory< TimeType, double >& dependentVariableHistory,
+        utilities::ContiguousHistory< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
+        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType statePrintInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const bool printInitialAndFinalCondition = false )
+{
+    return integrateEquationsFromIntegratorToHistories(
+                integrator, initialTimeStep, propagationTerminationCondition,
+                solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                dependentVariableFunction, statePostProcessingFunction, saveFrequency, statePrintInterval,
+                initialClockTime, printInitialAndFinalCondition );
+}
+
+//! Function to numerically integrate a given first order differential equation, evaluating dependent variables in place
+/*!
+ *  Function to numerically integrate a given first order differential equation, saving the results in ContiguousHistory
+ *  objects. Contrary to the overload taking the dependent variables as a std::function, the dependent variables are
+ *  evaluated directly into the dependent variable history, so that no temporary vector is created for each saved epoch.
+ *  \param integrator Numerical integrator used for propagation
+ *  \param initialTimeStep Time step to use for first step of numerical integration
+ *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+ *  \param solutionHistory History of state variables that are to be saved given as ContiguousHistory
+ *  (time as key; returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as ContiguousHistory
+ *  (time as key; returned by reference)
+ *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
+ *  as ContiguousHistory (time as key; returned by reference)
+ *  \param dependentVariableEvaluator Object evaluating the dependent variables (obtained from environment and state
+ *  derivative model); nullptr if no dependent variables are to be saved.
+ *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+ *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration time
+ *  steps, with n = saveFrequency).
+ *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
+ *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+ *  By default now(), i.e. the moment at which this function is called.
+ *  \return Event that triggered the termination of the propagation
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const TimeStepType initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::ContiguousHistory< TimeType, typename StateType::Scalar >& solutionHistory,
+        utilities::ContiguousHistory< TimeType, double >& dependentVariableHistory,
+        utilities::ContiguousHistory< TimeType, double >& cumulativeComputationTimeHistory,
+        const std::shared_ptr< DependentVariableListEvaluator > dependentVariableEvaluator,
+        const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+        const int saveFrequency = TUDAT_NAN,
+        const TimeType statePrintInterval = TUDAT_NAN,
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const bool printInitialAndFinalCondition = false )
+{
+    return integrateEquationsFromIntegratorToHistories(
+                integrator, initialTimeStep, propagationTerminationCondition,
+                solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                dependentVariableEvaluator, statePostProcessingFunction, saveFrequency, statePrintInterval,
+                initialClockTime, printInitialAndFinalCondition );
+}
+
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::MatrixXd, double, double >(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd, double > > integrator,
@@ -831,6 +1045,69 @@ public:
                     printInitialAndFinalCondition );
     }
 
+    //! Function to numerically integrate a given first order differential equation, evaluating dependent variables in place
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. Contrary to the overload taking the dependent variables as a
+     *  std::function, the dependent variables are evaluated directly into the dependent variable history, so that no
+     *  temporary vector is created for each saved epoch. The histories may be given as std::map or ContiguousHistory.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (time as key; returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (time as key; returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved
+     *  (time as key; returned by reference)
+     *  \param dependentVariableEvaluator Object evaluating the dependent variables (obtained from environment and state
+     *  derivative model); nullptr if no dependent variables are to be saved.
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \return Event that triggered the termination of the propagation
+     */
+    template< typename StateHistoryType, typename DependentVariableHistoryType, typename ComputationTimeHistoryType >
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
+            StateHistoryType& solutionHistory,
+            const StateType initialState,
+            const double initialTime,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& cumulativeComputationTimeHistory,
+            const std::shared_ptr< DependentVariableListEvaluator > dependentVariableEvaluator,
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const double statePrintInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const bool printInitialAndFinalCondition = false )
+    {
+        std::function< bool( const double, const double ) > stopPropagationFunction =
+                std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
+
+        // Create numerical integrator.
+        std::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
+                numerical_integrators::createIntegrator< double, StateType >(
+                    stateDerivativeFunction, initialState, initialTime, integratorSettings );
+
+        if( integratorSettings->assessTerminationOnMinorSteps_ )
+        {
+            integrator->setPropagationTerminationFunction( stopPropagationFunction );
+        }
+
+        return integrateEquationsFromIntegratorToHistories< StateType, double >(
+                    integrator, integratorSettings->initialTimeStep_, propagationTerminationCondition, solutionHistory,
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    dependentVariableEvaluator,
+                    statePostProcessingFunction,
+                    integratorSettings->saveFrequency_,
+                    statePrintInterval,
+                    initialClockTime,
+                    printInitialAndFinalCondition );
+    }
+
 };
 
 //! Interface class for integrating some state derivative function.
@@ -900,6 +1177,69 @@ public:
                     printInitialAndFinalCondition );
     }
 
+    //! Function to numerically integrate a given first order differential equation, evaluating dependent variables in place
+    /*!
+     *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
+     *  a single independent variable and the current state. Contrary to the overload taking the dependent variables as a
+     *  std::function, the dependent variables are evaluated directly into the dependent variable history, so that no
+     *  temporary vector is created for each saved epoch. The histories may be given as std::map or ContiguousHistory.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param solutionHistory History of numerical states (time as key; returned by reference)
+     *  \param initialState Initial state
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
+     *  \param dependentVariableHistory History of dependent variables that are to be saved (time as key; returned by reference)
+     *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved
+     *  (time as key; returned by reference)
+     *  \param dependentVariableEvaluator Object evaluating the dependent variables (obtained from environment and state
+     *  derivative model); nullptr if no dependent variables are to be saved.
+     *  \param statePostProcessingFunction Function to post-process state after numerical integration (obtained from state derivative model).
+     *  \param statePrintInterval Frequency with which to print progress to console (nan = never).
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  By default now(), i.e. the moment at which this function is called.
+     *  \return Event that triggered the termination of the propagation
+     */
+    template< typename StateHistoryType, typename DependentVariableHistoryType, typename ComputationTimeHistoryType >
+    static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
+            std::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
+            StateHistoryType& solutionHistory,
+            const StateType initialState,
+            const Time initialTime,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
+            const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& cumulativeComputationTimeHistory,
+            const std::shared_ptr< DependentVariableListEvaluator > dependentVariableEvaluator,
+            const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
+            const Time statePrintInterval = TUDAT_NAN,
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const bool printInitialAndFinalCondition = false )
+    {
+        std::function< bool( const double, const double ) > stopPropagationFunction =
+                std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
+
+        // Create numerical integrator.
+        std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, StateType, StateType, long double > > integrator =
+                numerical_integrators::createIntegrator< Time, StateType, long double  >(
+                    stateDerivativeFunction, initialState, initialTime, integratorSettings );
+
+        if( integratorSettings->assessTerminationOnMinorSteps_ )
+        {
+            integrator->setPropagationTerminationFunction( stopPropagationFunction );
+        }
+
+        return integrateEquationsFromIntegratorToHistories< StateType, Time, long double >(
+                    integrator, integratorSettings->initialTimeStep_, propagationTerminationCondition, solutionHistory,
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    dependentVariableEvaluator,
+                    statePostProcessingFunction,
+                    integratorSettings->saveFrequency_,
+                    statePrintInterval,
+                    initialClockTime,
+                    printInitialAndFinalCondition );
+    }
+
 };
 
 } // namespace propagators
@@ -137,10 +137,7 @@ public:
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator ),
         statePartialAdditionIndices_( statePartialAdditionIndices )
-    {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
-    }
+    { }
 
     //! Destructor.
     ~SingleArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
@@ -214,9 +211,6 @@ public:
 
 private:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
-
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
@@ -0,0 +1,505 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CONTIGUOUSHISTORY_H
+#define TUDAT_CONTIGUOUSHISTORY_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Class to store a history of equally sized matrices (e.g. propagated states) in contiguous memory
+/*!
+ *  Class to store a history of equally sized matrices (e.g. propagated states or dependent variables), as a function of an
+ *  independent variable (e.g. time). Contrary to a std::map< TimeType, Eigen::MatrixXd >, which requires a tree node and a
+ *  separate heap allocation per entry, the independent variables are stored in a single array, and the entries in a single
+ *  data block, with the (column-major) data of each entry stored contiguously (i.e. a row-major block with one row per entry).
+ *  Both arrays grow geometrically, so that adding an entry is amortized constant time, without any further allocation.
+ *
+ *  Entries must be added monotonically: each new entry must be beyond the most recently added entry, in the direction set by
+ *  the first two entries (increasing for forward propagation, decreasing for backward propagation). Adding an entry at the
+ *  independent variable of the most recently added entry overwrites it. Internally, the entries are stored in the order in
+ *  which they were added (see getIndependentVariables and getDataBlock), while the iterators and look-up functions, which
+ *  are compatible with those of a std::map, present the entries in increasing order of the independent variable.
+ *  \tparam TimeType Type of the independent variable
+ *  \tparam ScalarType Type of the entries of the stored matrices
+ */
+template< typename TimeType = double, typename ScalarType = double >
+class ContiguousHistory
+{
+public:
+
+    //! Typedef for the type of a single entry.
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > EntryType;
+
+    //! Typedef for a read-only view on a single entry.
+    typedef Eigen::Map< const EntryType > ConstEntryMap;
+
+    //! Typedef for a read-only view on the full data block (one row per entry).
+    typedef Eigen::Map< const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > >
+    ConstDataBlockMap;
+
+    //! Typedef for the (time, entry) pair returned when dereferencing an iterator.
+    typedef std::pair< TimeType, ConstEntryMap > ValueType;
+
+    //! Iterator over the entries, in increasing (or, for reverse iterators, decreasing) order of the independent variable.
+    class ConstIterator
+    {
+    public:
+
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename ContiguousHistory::ValueType value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        //! Helper struct to allow the use of iterator->first/iterator->second.
+        struct ArrowProxy
+        {
+            value_type value;
+            const value_type* operator->( ) const { return &value; }
+        };
+
+        //! Constructor
+        /*!
+         * Constructor
+         * \param history History over which to iterate
+         * \param sortedIndex Index of the entry, in increasing order of the independent variable
+         * \param isReversed Boolean denoting whether the iterator moves in decreasing order of the independent variable
+         */
+        ConstIterator( const ContiguousHistory* history, const int sortedIndex, const bool isReversed ):
+            history_( history ), sortedIndex_( sortedIndex ), isReversed_( isReversed ){ }
+
+        value_type operator*( ) const
+        {
+            return history_->getEntryAtSortedIndex( sortedIndex_ );
+        }
+
+        ArrowProxy operator->( ) const
+        {
+            return ArrowProxy{ history_->getEntryAtSortedIndex( sortedIndex_ ) };
+        }
+
+        ConstIterator& operator++( )
+        {
+            sortedIndex_ += ( isReversed_ ? -1 : 1 );
+            return *this;
+        }
+
+        ConstIterator operator++( int )
+        {
+            ConstIterator currentIterator = *this;
+            ++( *this );
+            return currentIterator;
+        }
+
+        ConstIterator& operator--( )
+        {
+            sortedIndex_ -= ( isReversed_ ? -1 : 1 );
+            return *this;
+        }
+
+        ConstIterator operator--( int )
+        {
+            ConstIterator currentIterator = *this;
+            --( *this );
+            return currentIterator;
+        }
+
+        bool operator==( const ConstIterator& otherIterator ) const
+        {
+            return ( history_ == otherIterator.history_ ) && ( sortedIndex_ == otherIterator.sortedIndex_ );
+        }
+
+        bool operator!=( const ConstIterator& otherIterator ) const
+        {
+            return !( *this == otherIterator );
+        }
+
+    private:
+
+        //! History over which to iterate
+        const ContiguousHistory* history_;
+
+        //! Index of the current entry, in increasing order of the independent variable
+        int sortedIndex_;
+
+        //! Boolean denoting whether the iterator moves in decreasing order of the independent variable
+        bool isReversed_;
+    };
+
+    //! Constructor
+    ContiguousHistory( ):
+        entryRows_( 0 ), entryColumns_( 0 ), isIncreasing_( true ), numberOfEntriesToReserve_( 0 ){ }
+
+    //! Function to retrieve the number of entries
+    unsigned int size( ) const
+    {
+        return independentVariables_.size( );
+    }
+
+    //! Function to check whether the history is empty
+    bool empty( ) const
+    {
+        return independentVariables_.empty( );
+    }
+
+    //! Function to remove all entries (the allocated memory is retained, for re-use)
+    void clear( )
+    {
+        independentVariables_.clear( );
+        data_.clear( );
+        entryRows_ = 0;
+        entryColumns_ = 0;
+        isIncreasing_ = true;
+    }
+
+    //! Function to pre-allocate memory for a given number of entries
+    /*!
+     * Function to pre-allocate memory for a given number of entries. If the size of the entries is not yet known, the memory
+     * for the data block is allocated when the first entry is added.
+     * \param numberOfEntries Number of entries for which memory is to be allocated.
+     */
+    void reserve( const unsigned int numberOfEntries )
+    {
+        numberOfEntriesToReserve_ = numberOfEntries;
+        independentVariables_.reserve( numberOfEntries );
+        if( entryRows_ * entryColumns_ > 0 )
+        {
+            data_.reserve( numberOfEntries * entryRows_ * entryColumns_ );
+        }
+    }
+
+    //! Function to add an entry to the history
+    /*!
+     * Function to add an entry to the history. The entry must be beyond the most recently added entry (in the direction of
+     * the history, see class description), or at the same independent variable (in which case the entry is overwritten), and
+     * must have the same size as all previous entries.
+     * \param independentVariable Independent variable of the new entry
+     * \param entry New entry
+     */
+    void insert( const TimeType independentVariable, const Eigen::Ref< const EntryType >& entry )
+    {
+        addEntry( independentVariable, entry.rows( ), entry.cols( ) ) = entry;
+    }
+
+    //! Function to add an (uninitialized) entry to the history, and retrieve a writable view on it
+    /*!
+     * Function to add an (uninitialized) entry to the history, and retrieve a writable view on it, so that the entry can be
+     * computed directly into the history without a temporary. The same requirements as for the insert function apply. The
+     * returned view is invalidated when adding further entries to the history.
+     * \param independentVariable Independent variable of the new entry
+     * \param entryRows Number of rows of the new entry
+     * \param entryColumns Number of columns of the new entry
+     * \return View on the new entry
+     */
+    Eigen::Map< EntryType > addEntry( const TimeType independentVariable, const int entryRows, const int entryColumns )
+    {
+        // Set entry size, if this is the first entry.
+        if( independentVariables_.empty( ) )
+        {
+            entryRows_ = entryRows;
+            entryColumns_ = entryColumns;
+            if( numberOfEntriesToReserve_ > 0 )
+            {
+                data_.reserve( numberOfEntriesToReserve_ * entryRows_ * entryColumns_ );
+            }
+        }
+        else if( entryRows != entryRows_ || entryColumns != entryColumns_ )
+        {
+            throw std::runtime_error( "Error when adding entry to contiguous history, entry size is inconsistent" );
+        }
+
+        const int entrySize = entryRows_ * entryColumns_;
+        if( !independentVariables_.empty( ) && independentVariables_.back( ) == independentVariable )
+        {
+            // Overwrite most recent entry
+            return Eigen::Map< EntryType >( data_.data( ) + data_.size( ) - entrySize, entryRows_, entryColumns_ );
+        }
+
+        // Check whether new entry is consistent with direction of history
+        if( independentVariables_.size( ) == 1 )
+        {
+            isIncreasing_ = ( independentVariable > independentVariables_.back( ) );
+        }
+        else if( independentVariables_.size( ) > 1 )
+        {
+            if( ( independentVariable > independentVariables_.back( ) ) != isIncreasing_ )
+            {
+                throw std::runtime_error( "Error when adding entry to contiguous history, entries must be added "
+                                          "monotonically." );
+            }
+        }
+
+        independentVariables_.push_back( independentVariable );
+        data_.resize( data_.size( ) + entrySize );
+        return Eigen::Map< EntryType >( data_.data( ) + data_.size( ) - entrySize, entryRows_, entryColumns_ );
+    }
+
+    //! Function to add a scalar entry to the history
+    /*!
+     * Function to add a scalar entry (stored as a 1x1 matrix) to the history, see insert function for matrix entries.
+     * \param independentVariable Independent variable of the new entry
+     * \param entry New entry
+     */
+    void insert( const TimeType independentVariable, const ScalarType entry )
+    {
+        insert( independentVariable, EntryType::Constant( 1, 1, entry ) );
+    }
+
+    //! Function to remove the most recently added entry
+    void eraseMostRecentEntry( )
+    {
+        if( independentVariables_.empty( ) )
+        {
+            throw std::runtime_error( "Error when removing entry from contiguous history, history is empty" );
+        }
+        independentVariables_.pop_back( );
+        data_.resize( data_.size( ) - entryRows_ * entryColumns_ );
+    }
+
+    //! Function to retrieve the independent variable of the most recently added entry
+    TimeType getMostRecentIndependentVariable( ) const
+    {
+        if( independentVariables_.empty( ) )
+        {
+            throw std::runtime_error( "Error when retrieving entry from contiguous history, history is empty" );
+        }
+        return independentVariables_.back( );
+    }
+
+    //! Function to retrieve the entry at a given independent variable (throws std::out_of_range if not found)
+    ConstEntryMap at( const TimeType independentVariable ) const
+    {
+        int storageIndex = findStorageIndex( independentVariable );
+        if( storageIndex < 0 )
+        {
+            throw std::out_of_range( "Error when retrieving entry from contiguous history, independent variable not found" );
+        }
+        return getEntryAtStorageIndex( storageIndex );
+    }
+
+    //! Function to check whether an entry exists at a given independent variable (returns 1 if so, 0 if not).
+    unsigned int count( const TimeType independentVariable ) const
+    {
+        return ( findStorageIndex( independentVariable ) < 0 ) ? 0 : 1;
+    }
+
+    //! Function to retrieve an iterator to the entry at a given independent variable (end( ) if not found).
+    ConstIterator find( const TimeType independentVariable ) const
+    {
+        int storageIndex = findStorageIndex( independentVariable );
+        return ( storageIndex < 0 ) ? end( ) : ConstIterator( this, getSortedIndex( storageIndex ), false );
+    }
+
+    //! Function to retrieve an iterator to the entry with the lowest independent variable
+    ConstIterator begin( ) const { return ConstIterator( this, 0, false ); }
+
+    //! Function to retrieve an iterator past the entry with the highest independent variable
+    ConstIterator end( ) const { return ConstIterator( this, size( ), false ); }
+
+    //! Function to retrieve a reverse iterator to the entry with the highest independent variable
+    ConstIterator rbegin( ) const { return ConstIterator( this, static_cast< int >( size( ) ) - 1, true ); }
+
+    //! Function to retrieve a reverse iterator before the entry with the lowest independent variable
+    ConstIterator rend( ) const { return ConstIterator( this, -1, true ); }
+
+    //! Function to check whether the entries have been added with increasing independent variable
+    bool isIncreasing( ) const
+    {
+        return isIncreasing_;
+    }
+
+    //! Function to retrieve the independent variables, in the order in which they were added
+    const std::vector< TimeType >& getIndependentVariables( ) const
+    {
+        return independentVariables_;
+    }
+
+    //! Function to retrieve the data block, with one row per entry, in the order in which they were added
+    /*!
+     * Function to retrieve the data block, with one row per entry (containing the column-major data of the entry), in the
+     * order in which they were added. The returned view is invalidated when adding entries to the history.
+     * \return Data block with all entries
+     */
+    ConstDataBlockMap getDataBlock( ) const
+    {
+        return ConstDataBlockMap( data_.data( ), independentVariables_.size( ), entryRows_ * entryColumns_ );
+    }
+
+    //! Function to convert the history to a std::map
+    /*!
+     * Function to convert the history to a std::map, for use in interfaces that require this type.
+     * \tparam ValueType Type of the map values, which should be assignable from an Eigen matrix
+     * \return Map with all entries of the history
+     */
+    template< typename MapValueType = EntryType >
+    std::map< TimeType, MapValueType > toMap( ) const
+    {
+        std::map< TimeType, MapValueType > historyMap;
+        for( unsigned int i = 0; i < independentVariables_.size( ); i++ )
+        {
+            historyMap.emplace_hint( historyMap.end( ), independentVariables_.at( getStorageIndex( i ) ),
+                                     MapValueType( getEntryAtStorageIndex( getStorageIndex( i ) ) ) );
+        }
+        return historyMap;
+    }
+
+private:
+
+    //! Function to convert the index in increasing order of the independent variable, to the index in memory
+    int getStorageIndex( const int sortedIndex ) const
+    {
+        return isIncreasing_ ? sortedIndex : ( static_cast< int >( independentVariables_.size( ) ) - 1 - sortedIndex );
+    }
+
+    //! Function to convert the index in memory to the index in increasing order of the independent variable
+    int getSortedIndex( const int storageIndex ) const
+    {
+        return getStorageIndex( storageIndex );
+    }
+
+    //! Function to retrieve a read-only view of the entry at the given index in memory
+    ConstEntryMap getEntryAtStorageIndex( const int storageIndex ) const
+    {
+        return ConstEntryMap( data_.data( ) + storageIndex * entryRows_ * entryColumns_, entryRows_, entryColumns_ );
+    }
+
+    //! Function to retrieve the (time, entry) pair at the given index in increasing order of the independent variable
+    ValueType getEntryAtSortedIndex( const int sortedIndex ) const
+    {
+        int storageIndex = getStorageIndex( sortedIndex );
+        return ValueType( independentVariables_.at( storageIndex ), getEntryAtStorageIndex( storageIndex ) );
+    }
+
+    //! Function to find the index in memory of an entry (-1 if not found), using a binary search
+    int findStorageIndex( const TimeType independentVariable ) const
+    {
+        typename std::vector< TimeType >::const_iterator searchIterator;
+        if( isIncreasing_ )
+        {
+            searchIterator = std::lower_bound(
+                        independentVariables_.begin( ), independentVariables_.end( ), independentVariable );
+        }
+        else
+        {
+            searchIterator = std::lower_bound(
+                        independentVariables_.begin( ), independentVariables_.end( ), independentVariable,
+                        std::greater< TimeType >( ) );
+        }
+
+        if( searchIterator == independentVariables_.end( ) || !( *searchIterator == independentVariable ) )
+        {
+            return -1;
+        }
+        return static_cast< int >( std::distance( independentVariables_.begin( ), searchIterator ) );
+    }
+
+    //! Independent variables of all entries, in the order in which they were added
+    std::vector< TimeType > independentVariables_;
+
+    //! Data of all entries, in the order in which they were added
+    std::vector< ScalarType > data_;
+
+    //! Number of rows of each entry
+    int entryRows_;
+
+    //! Number of columns of each entry
+    int entryColumns_;
+
+    //! Boolean denoting whether the entries are added with increasing independent variable
+    bool isIncreasing_;
+
+    //! Number of entries for which memory is to be allocated once the entry size is known
+    unsigned int numberOfEntriesToReserve_;
+};
+
+//! Function to add an entry to a propagation history stored as a map
+template< typename TimeType, typename ValueType >
+void addHistoryEntry( std::map< TimeType, ValueType >& history, const TimeType independentVariable, const ValueType& entry )
+{
+    history[ independentVariable ] = entry;
+}
+
+//! Function to add an entry to a propagation history stored as a ContiguousHistory
+template< typename TimeType, typename ScalarType, typename ValueType >
+void addHistoryEntry( ContiguousHistory< TimeType, ScalarType >& history, const TimeType independentVariable,
+                      const ValueType& entry )
+{
+    history.insert( independentVariable, entry );
+}
+
+//! Function to retrieve the independent variable of the most recently added entry of a propagation history stored as a map
+/*!
+ * Function to retrieve the independent variable of the most recently added entry of a propagation history stored as a map,
+ * which is the highest (lowest) independent variable for forward (backward) propagation.
+ * \param history History from which entry is to be retrieved
+ * \param isPropagationForward Boolean denoting whether the entries were added in forward direction
+ * \return Independent variable of most recently added entry
+ */
+template< typename TimeType, typename ValueType >
+TimeType getMostRecentHistoryIndependentVariable( const std::map< TimeType, ValueType >& history,
+                                                  const bool isPropagationForward )
+{
+    return isPropagationForward ? history.rbegin( )->first : history.begin( )->first;
+}
+
+//! Function to retrieve the independent variable of the most recently added entry of a ContiguousHistory
+template< typename TimeType, typename ScalarType >
+TimeType getMostRecentHistoryIndependentVariable( const ContiguousHistory< TimeType, ScalarType >& history,
+                                                  const bool )
+{
+    return history.getMostRecentIndependentVariable( );
+}
+
+//! Function to remove the most recently added entry of a propagation history stored as a map
+/*!
+ * Function to remove the most recently added entry of a propagation history stored as a map, which is the entry with the
+ * highest (lowest) independent variable for forward (backward) propagation.
+ * \param history History from which entry is to be removed
+ * \param isPropagationForward Boolean denoting whether the entries were added in forward direction
+ */
+template< typename TimeType, typename ValueType >
+void eraseMostRecentHistoryEntry( std::map< TimeType, ValueType >& history, const bool isPropagationForward )
+{
+    if( isPropagationForward )
+    {
+        history.erase( std::prev( history.end( ) ) );
+    }
+    else
+    {
+        history.erase( history.begin( ) );
+    }
+}
+
+//! Function to remove the most recently added entry of a ContiguousHistory
+template< typename TimeType, typename ScalarType >
+void eraseMostRecentHistoryEntry( ContiguousHistory< TimeType, ScalarType >& history, const bool )
+{
+    history.eraseMostRecentEntry( );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_CONTIGUOUSHISTORY_H
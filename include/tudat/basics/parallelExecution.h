@@ -0,0 +1,346 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELEXECUTION_H
+#define TUDAT_PARALLELEXECUTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads to use for a parallel task
+/*!
+ *  Function to retrieve the number of threads to use for a parallel task. If the requested number is zero, the number of
+ *  hardware threads is returned (or 1 if this cannot be determined). The result is never larger than the number of tasks.
+ *  \param requestedNumberOfThreads Number of threads requested by user (0 to use all available hardware threads)
+ *  \param numberOfTasks Number of independent tasks that are to be executed.
+ *  \return Number of threads that is to be used.
+ */
+inline unsigned int getNumberOfThreadsToUse( const unsigned int requestedNumberOfThreads,
+                                             const unsigned int numberOfTasks )
+{
+    unsigned int numberOfThreads = requestedNumberOfThreads;
+    if( numberOfThreads == 0 )
+    {
+        numberOfThreads = std::thread::hardware_concurrency( );
+    }
+    if( numberOfThreads > numberOfTasks )
+    {
+        numberOfThreads = numberOfTasks;
+    }
+    if( numberOfThreads == 0 )
+    {
+        numberOfThreads = 1;
+    }
+    return numberOfThreads;
+}
+
+//! Function to execute a list of independent tasks on a set of worker threads.
+/*!
+ *  Function to execute a list of independent tasks, identified by their index, on a set of worker threads. Each worker
+ *  retrieves the next unprocessed task index until all tasks have been executed, so that tasks of unequal duration are
+ *  balanced over the threads. If a single thread is to be used, all tasks are executed in order on the calling thread.
+ *  If any of the tasks throws an exception, the remaining tasks are not started, and the first exception that was caught
+ *  is rethrown on the calling thread after all workers have finished.
+ *
+ *  The task function is responsible for ensuring that concurrent calls with different indices do not modify any
+ *  shared data.
+ *  \param numberOfTasks Number of tasks that are to be executed (tasks are numbered 0 to numberOfTasks - 1)
+ *  \param taskFunction Function executing a single task, with the task index as input
+ *  \param numberOfThreads Number of threads to use (0 to use all available hardware threads)
+ */
+inline void executeInParallel( const unsigned int numberOfTasks,
+                               const std::function< void( const unsigned int ) >& taskFunction,
+                               const unsigned int numberOfThreads = 0 )
+{
+    unsigned int numberOfThreadsToUse = getNumberOfThreadsToUse( numberOfThreads, numberOfTasks );
+
+    // Run on current thread if no parallelization is required
+    if( numberOfThreadsToUse <= 1 )
+    {
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i );
+        }
+        return;
+    }
+
+    std::atomic< unsigned int > nextTaskIndex( 0 );
+    std::atomic< bool > isExceptionCaught( false );
+    std::vector< std::exception_ptr > caughtExceptions( numberOfThreadsToUse );
+
+    // Define function that is run by each worker thread
+    auto workerFunction = [ & ]( const unsigned int threadIndex )
+    {
+        unsigned int currentTaskIndex;
+        while( ( !isExceptionCaught ) && ( ( currentTaskIndex = nextTaskIndex++ ) < numberOfTasks ) )
+        {
+            try
+            {
+                taskFunction( currentTaskIndex );
+            }
+            catch( ... )
+            {
+                caughtExceptions[ threadIndex ] = std::current_exception( );
+                isExceptionCaught = true;
+            }
+        }
+    };
+
+    // Start workers, and use current thread as one of the workers
+    std::vector< std::thread > workerThreads;
+    for( unsigned int i = 1; i < numberOfThreadsToUse; i++ )
+    {
+        workerThreads.push_back( std::thread( workerFunction, i ) );
+    }
+    workerFunction( 0 );
+
+    for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+    {
+        workerThreads.at( i ).join( );
+    }
+
+    // Propagate exception to calling thread
+    for( unsigned int i = 0; i < caughtExceptions.size( ); i++ )
+    {
+        if( caughtExceptions.at( i ) != nullptr )
+        {
+            std::rethrow_exception( caughtExceptions.at( i ) );
+        }
+    }
+}
+
+//! Class to repeatedly execute lists of independent tasks on a persistent set of worker threads.
+/*!
+ *  Class to repeatedly execute lists of independent tasks on a persistent set of worker threads. In contrast to the
+ *  executeInParallel function, the worker threads are started once upon construction, and wait for new tasks between
+ *  calls to executeTasks, so that no threads are started and joined for each list of tasks. This makes the class
+ *  suitable for parallelizing computations that are repeated at each function evaluation of a propagation (e.g. the
+ *  evaluation of a gravity field). The task distribution and exception handling are as for executeInParallel. The
+ *  executeTasks function is not re-entrant: it may not be called concurrently from multiple threads on the same object.
+ */
+class ParallelTaskPool
+{
+public:
+
+    //! Constructor, starts the worker threads
+    /*!
+     *  Constructor, starts the worker threads
+     *  \param numberOfThreads Number of threads over which the tasks are to be distributed, including the calling thread
+     *  (0 to use all available hardware threads)
+     */
+    ParallelTaskPool( const unsigned int numberOfThreads ):
+        currentTaskFunction_( nullptr ), currentNumberOfTasks_( 0 ), nextTaskIndex_( 0 ), isExceptionCaught_( false ),
+        numberOfActiveWorkers_( 0 ), taskListIndex_( 0 ), isTerminated_( false )
+    {
+        numberOfThreads_ = getNumberOfThreadsToUse( numberOfThreads, std::numeric_limits< unsigned int >::max( ) );
+        caughtExceptions_.resize( numberOfThreads_ );
+        for( unsigned int i = 1; i < numberOfThreads_; i++ )
+        {
+            workerThreads_.push_back( std::thread( &ParallelTaskPool::runWorker, this, i ) );
+        }
+    }
+
+    //! Destructor, stops and joins the worker threads
+    ~ParallelTaskPool( )
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            isTerminated_ = true;
+        }
+        tasksAvailableCondition_.notify_all( );
+        for( unsigned int i = 0; i < workerThreads_.size( ); i++ )
+        {
+            workerThreads_.at( i ).join( );
+        }
+    }
+
+    ParallelTaskPool( const ParallelTaskPool& ) = delete;
+
+    ParallelTaskPool& operator=( const ParallelTaskPool& ) = delete;
+
+    //! Function to execute a list of independent tasks on the worker threads and the calling thread
+    /*!
+     *  Function to execute a list of independent tasks, identified by their index, on the worker threads and the calling
+     *  thread. The function returns once all tasks have been executed. If any of the tasks throws an exception, the
+     *  remaining tasks are not started, and the first exception that was caught is rethrown on the calling thread.
+     *  \param numberOfTasks Number of tasks that are to be executed (tasks are numbered 0 to numberOfTasks - 1)
+     *  \param taskFunction Function executing a single task, with the task index as input
+     */
+    void executeTasks( const unsigned int numberOfTasks,
+                       const std::function< void( const unsigned int ) >& taskFunction )
+    {
+        // Run on current thread if no parallelization is required
+        if( workerThreads_.size( ) == 0 || numberOfTasks <= 1 )
+        {
+            for( unsigned int i = 0; i < numberOfTasks; i++ )
+            {
+                taskFunction( i );
+            }
+            return;
+        }
+
+        // Provide new list of tasks to workers
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            currentTaskFunction_ = &taskFunction;
+            currentNumberOfTasks_ = numberOfTasks;
+            nextTaskIndex_ = 0;
+            isExceptionCaught_ = false;
+            numberOfActiveWorkers_ = workerThreads_.size( );
+            taskListIndex_++;
+        }
+        tasksAvailableCondition_.notify_all( );
+
+        // Use current thread as one of the workers, and wait for other workers to finish
+        processTasks( 0 );
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            tasksFinishedCondition_.wait( lock, [ this ]( ){ return numberOfActiveWorkers_ == 0; } );
+            currentTaskFunction_ = nullptr;
+        }
+
+        // Propagate exception to calling thread
+        for( unsigned int i = 0; i < caughtExceptions_.size( ); i++ )
+        {
+            if( caughtExceptions_.at( i ) != nullptr )
+            {
+                std::exception_ptr caughtException = caughtExceptions_.at( i );
+                std::fill( caughtExceptions_.begin( ), caughtExceptions_.end( ), nullptr );
+                std::rethrow_exception( caughtException );
+            }
+        }
+    }
+
+    //! Function to retrieve the number of threads over which the tasks are distributed, including the calling thread
+    /*!
+     *  Function to retrieve the number of threads over which the tasks are distributed, including the calling thread
+     *  \return Number of threads over which the tasks are distributed
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+private:
+
+    //! Function executing tasks from the current list until no tasks remain
+    /*!
+     *  Function executing tasks from the current list until no tasks remain (or an exception has been caught)
+     *  \param threadIndex Index of the thread on which the function is run (0 for the calling thread)
+     */
+    void processTasks( const unsigned int threadIndex )
+    {
+        unsigned int currentTaskIndex;
+        while( ( !isExceptionCaught_ ) && ( ( currentTaskIndex = nextTaskIndex_++ ) < currentNumberOfTasks_ ) )
+        {
+            try
+            {
+                ( *currentTaskFunction_ )( currentTaskIndex );
+            }
+            catch( ... )
+            {
+                caughtExceptions_[ threadIndex ] = std::current_exception( );
+                isExceptionCaught_ = true;
+            }
+        }
+    }
+
+    //! Function run by each worker thread, waiting for and processing lists of tasks until the pool is destroyed
+    /*!
+     *  Function run by each worker thread, waiting for and processing lists of tasks until the pool is destroyed
+     *  \param threadIndex Index of the worker thread
+     */
+    void runWorker( const unsigned int threadIndex )
+    {
+        unsigned long processedTaskListIndex = 0;
+        while( true )
+        {
+            {
+                std::unique_lock< std::mutex > lock( mutex_ );
+                tasksAvailableCondition_.wait( lock, [ & ]( ){
+                    return isTerminated_ || taskListIndex_ != processedTaskListIndex; } );
+                if( isTerminated_ )
+                {
+                    return;
+                }
+                processedTaskListIndex = taskListIndex_;
+            }
+
+            processTasks( threadIndex );
+
+            {
+                std::lock_guard< std::mutex > lock( mutex_ );
+                numberOfActiveWorkers_--;
+                if( numberOfActiveWorkers_ == 0 )
+                {
+                    tasksFinishedCondition_.notify_one( );
+                }
+            }
+        }
+    }
+
+    //! Number of threads over which the tasks are distributed, including the calling thread
+    unsigned int numberOfThreads_;
+
+    //! Function executing a single task of the current list of tasks
+    const std::function< void( const unsigned int ) >* currentTaskFunction_;
+
+    //! Number of tasks in the current list of tasks
+    unsigned int currentNumberOfTasks_;
+
+    //! Index of the next task of the current list that is to be executed
+    std::atomic< unsigned int > nextTaskIndex_;
+
+    //! Boolean denoting whether a task of the current list has thrown an exception
+    std::atomic< bool > isExceptionCaught_;
+
+    //! Exceptions caught by each of the threads (nullptr if none)
+    std::vector< std::exception_ptr > caughtExceptions_;
+
+    //! Number of worker threads that have not yet finished the current list of tasks
+    unsigned int numberOfActiveWorkers_;
+
+    //! Index of the current list of tasks, incremented for each call to executeTasks
+    unsigned long taskListIndex_;
+
+    //! Boolean denoting whether the worker threads are to be stopped
+    bool isTerminated_;
+
+    //! Mutex protecting the task list data and the termination flag
+    std::mutex mutex_;
+
+    //! Condition variable on which the workers wait for a new list of tasks
+    std::condition_variable tasksAvailableCondition_;
+
+    //! Condition variable on which the calling thread waits for the workers to finish the current list of tasks
+    std::condition_variable tasksFinishedCondition_;
+
+    //! Worker threads (excluding the calling thread)
+    std::vector< std::thread > workerThreads_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELEXECUTION_H
@@ -24,6 +24,7 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,18 @@ namespace tudat {
 
 namespace spice_interface {
 
+//! Retrieve the mutex that serialises all calls to the Spice toolkit.
+/*!
+ *  Retrieve the mutex that serialises all calls to the Spice toolkit. CSPICE keeps its kernel pool and error state in
+ *  global variables, and is not thread-safe. Each of the functions in this file (and therefore the SpiceEphemeris and
+ *  SpiceRotationalEphemeris classes) locks this mutex for the duration of its calls to Spice, so that they may be used
+ *  concurrently from multiple threads. These calls are then executed one at a time; where Spice evaluations are a
+ *  bottleneck in concurrent propagations, a ChebyshevEphemeris fitted to the Spice data can be evaluated without
+ *  locking. Any code calling CSPICE directly must lock this (recursive) mutex as well.
+ *  \return Mutex that serialises all calls to the Spice toolkit.
+ */
+std::recursive_mutex &getSpiceMutex();
+
 //! @get_docstring(convert_julian_date_to_ephemeris_time)
 double convertJulianDateToEphemerisTime(const double julianDate);
 
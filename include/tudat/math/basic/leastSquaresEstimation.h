@@ -18,6 +18,7 @@
 #include <map>
 
 #include <Eigen/Core>
+#include <Eigen/Cholesky>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
@@ -28,6 +29,13 @@ namespace tudat
 namespace linear_algebra
 {
 
+//! Types of linear solvers that may be used to solve the normal equations of a least squares problem
+enum NormalEquationsSolverType
+{
+    svd_normal_equations_solver,
+    cholesky_normal_equations_solver
+};
+
 //! Function to get condition number of matrix (using SVD decomposition)
 /*!
  *  Function to get condition number of matrix (using SVD decomposition)
@@ -61,6 +69,42 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
                                                const bool checkConditionNumber = 1,
                                                const double maximumAllowedConditionNumber = 1.0E-8 );
 
+//! Solve symmetric positive definite system of equations with Cholesky decomposition, with SVD as fallback
+/*!
+ * Solve symmetric positive definite system of equations (such as normal equations) with Cholesky decomposition. Only the
+ * lower triangular part of the matrix is used. If the decomposition fails (i.e. the matrix is not numerically positive
+ * definite), the system is solved with solveSystemOfEquationsWithSvd instead. The condition number is estimated from the
+ * decomposition (reciprocal condition number estimate in the 1-norm), which is much cheaper than computing it from the
+ * singular values, but is an estimate only.
+ * \param matrixToInvert Symmetric positive definite matrix A that is to be inverted to solve the equation
+ * \param rightHandSideVector Vector on the righthandside of the matrix equation that is to be solved
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded)
+ * \return Solution x of matrix equation A*x=b
+ */
+Eigen::VectorXd solveSymmetricSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                             const Eigen::VectorXd& rightHandSideVector,
+                                                             const bool checkConditionNumber = 1,
+                                                             const double maximumAllowedConditionNumber = 1.0E8 );
+
+//! Function to add the weighted product of an information matrix with itself to a (symmetric) normal matrix
+/*!
+ * Function to add the weighted product of an information matrix with itself (H^T*W*H, with W a diagonal weights matrix) to
+ * a symmetric normal matrix. The information matrix is processed in blocks of rows, each of which is added to the lower
+ * triangular part of the normal matrix as a symmetric rank-k update, so that no weighted copy of the full information
+ * matrix is made. The upper triangular part is set afterwards, so the input normal matrix must be symmetric.
+ * \param informationMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+ * \param normalMatrix Symmetric normal matrix to which H^T*W*H is to be added (modified by this function)
+ */
+void addWeightedRankUpdateToNormalMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        Eigen::MatrixXd& normalMatrix );
+
 //! Function to multiply information matrix by diagonal weights matrix
 /*!
  * Function to multiply information matrix by diagonal weights matrix
@@ -100,6 +144,52 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::MatrixXd& informationMatrix,
         const Eigen::VectorXd& diagonalOfWeightMatrix );
 
+//! Function to add the contribution of a block of observations to the normal equations
+/*!
+ * Function to add the contribution of a block of observations to the normal equations, i.e. to add H^T*W*H to the
+ * normal matrix and H^T*W*r to its right-hand side, with H the partials, W the (diagonal) weights and r the residuals of
+ * the observations in the block. By calling this function for all blocks of observations in turn, the normal equations
+ * are formed without the full information matrix being stored.
+ * \param informationMatrixBlock Matrix containing partial derivatives of the observations in the block (rows) w.r.t.
+ * estimated parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations in the block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix for observations in the block
+ * \param normalMatrix Normal matrix to which the contribution of the block is added (modified by this function)
+ * \param normalRightHandSide Right-hand side of normal equations to which the contribution of the block is added
+ * (modified by this function)
+ */
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide );
+
+//! Function to perform an iteration of least squares estimation from the normal equations
+/*!
+ * Function to perform an iteration of least squares estimation from the normal equations, which are provided directly
+ * (e.g. as accumulated by addObservationBlockToNormalEquations), instead of being computed from the full information
+ * matrix.
+ * \param inverseOfCovarianceMatrix Normal matrix, including the inverse of the a priori covariance matrix
+ * \param normalRightHandSide Right-hand side of the normal equations (H^T*W*r)
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param solverType Type of solver used for the normal equations. With constraints, the (indefinite) system is always
+ * solved with SVD.
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
+        const NormalEquationsSolverType solverType = svd_normal_equations_solver );
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 /*!
@@ -117,6 +207,7 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
  * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
  * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
  * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param solverType Type of solver used for the normal equations (see performLeastSquaresAdjustmentFromNormalEquations)
  * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
  */
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
@@ -127,7 +218,8 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8,
         const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
-        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
+        const NormalEquationsSolverType solverType = svd_normal_equations_solver );
 
 //! Function to perform an iteration of least squares estimation from information matrix, weights and residuals
 /*!
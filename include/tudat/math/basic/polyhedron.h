@@ -62,6 +62,24 @@ void calculatePolyhedronPerFacetFactor (
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
         const Eigen::MatrixXi& verticesDefiningEachFacet);
 
+/*! Calculates the per-facet factor of a range of polyhedron facets.
+ *
+ * Calculates the per-facet factor of a range of polyhedron facets, according to Eq. 27 of Werner and Scheeres (1997).
+ * Only the entries of perFacetFactor corresponding to the selected facets are modified, such that the factors of
+ * different ranges may be computed concurrently.
+ * @param perFacetFactor Vector with the per-facet factor of each facet, of size equal to the number of facets (output).
+ * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point (input).
+ * @param verticesDefiningEachFacet Identification of the vertices defining each facet (0 indexed) (input)
+ * @param firstFacet Index of the first facet for which the factor is to be computed (input).
+ * @param numberOfFacetsToCompute Number of facets for which the factor is to be computed (input).
+ */
+void calculatePolyhedronPerFacetFactor (
+        Eigen::VectorXd& perFacetFactor,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const unsigned int firstFacet,
+        const unsigned int numberOfFacetsToCompute );
+
 /*! Calculates the per-edge factor of each polyhedron edge.
  *
  * Calculates the per-edge factor of each polyhedron edge, according to Eq. 7 of Werner and Scheeres (1997).
@@ -74,6 +92,24 @@ void calculatePolyhedronPerEdgeFactor (
         const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
         const Eigen::MatrixXi& verticesDefiningEachEdge);
 
+/*! Calculates the per-edge factor of a range of polyhedron edges.
+ *
+ * Calculates the per-edge factor of a range of polyhedron edges, according to Eq. 7 of Werner and Scheeres (1997).
+ * Only the entries of perEdgeFactor corresponding to the selected edges are modified, such that the factors of
+ * different ranges may be computed concurrently.
+ * @param perEdgeFactor Vector with the per-edge factor of each edge, of size equal to the number of edges (output).
+ * @param verticesCoordinatesRelativeToFieldPoint Matrix with coordinates of each vertex wrt field point (input).
+ * @param verticesDefiningEachEdge Identification of the vertices defining each facet (0 indexed) (input)
+ * @param firstEdge Index of the first edge for which the factor is to be computed (input).
+ * @param numberOfEdgesToCompute Number of edges for which the factor is to be computed (input).
+ */
+void calculatePolyhedronPerEdgeFactor (
+        Eigen::VectorXd& perEdgeFactor,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const unsigned int firstEdge,
+        const unsigned int numberOfEdgesToCompute );
+
 /*! Calculates the gravitational potential of a constant-density polyhedron.
  *
  * Calculates the gravitational potential of a constant-density polyhedron, according to Eq. 10 of Werner and Scheeres
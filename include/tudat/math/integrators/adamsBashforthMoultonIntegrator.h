@@ -29,6 +29,7 @@
 
 #include <Eigen/Core>
 
+#include "tudat/math/integrators/hermiteDenseOutput.h"
 #include "tudat/math/integrators/numericalIntegrator.h"
 #include "tudat/math/integrators/reinitializableNumericalIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
@@ -110,7 +111,8 @@ public:
           maximumStepSize_( std::fabs( static_cast< double >( maximumStepSize ) ) ),
           relativeErrorTolerance_( relativeErrorTolerance.array( ).abs( ) ),
           absoluteErrorTolerance_( absoluteErrorTolerance.array( ).abs( ) ),
-          bandwidth_( std::fabs( static_cast< double >( bandwidth ) ) )
+          bandwidth_( std::fabs( static_cast< double >( bandwidth ) ) ),
+          useDenseOutput_( false )
     {
         if( !( currentState_.rows( ) == relativeErrorTolerance_.rows( ) ) ||
                 !( currentState_.cols( ) == relativeErrorTolerance_.cols( ) ) )
@@ -266,6 +268,13 @@ public:
      */
     StateType performIntegrationStep( )
     {
+        // Store state and state derivative at start of step for dense output.
+        if( useDenseOutput_ && ( ( denseOutput_.getNumberOfNodes( ) == 0 ) ||
+                !( denseOutput_.getLastNodeIndependentVariable( ) == currentIndependentVariable_ ) ) )
+        {
+            denseOutput_.addNode( currentIndependentVariable_, currentState_, derivHistory_.front( ) );
+        }
+
         // Set last* variables for rollback.
         lastStepSize_ = stepSize_;
         lastState_ = stateHistory_.back( );
@@ -475,6 +484,12 @@ public:
         stateHistory_.push_front( currentState_ );
         derivHistory_.push_front( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ) );
+
+        // Store state and state derivative at end of step for dense output.
+        if( useDenseOutput_ )
+        {
+            denseOutput_.addNode( currentIndependentVariable_, currentState_, derivHistory_.front( ) );
+        }
         return currentState_;
     }
 
@@ -494,6 +509,7 @@ public:
         }
         currentIndependentVariable_ = lastIndependentVariable_;
         stepSize_ = lastStepSize_;
+        denseOutput_.clear( );
         stateHistory_.push_back( lastState_ );
         derivHistory_.push_back( lastDerivative_ );
         stateHistory_.pop_front( );
@@ -519,6 +535,12 @@ public:
      */
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
+        // Dense output of last step is invalid if state is changed
+        if( !( ( newState.rows( ) == currentState_.rows( ) ) && ( newState.cols( ) == currentState_.cols( ) ) &&
+               ( newState == currentState_ ) ) )
+        {
+            denseOutput_.clear( );
+        }
         currentState_ = newState;
 
         // Clear the history and initiate with new state and derivative.
@@ -534,6 +556,52 @@ public:
         fixedSingleStep_ = fixedStepSize_;
     }
 
+    //! Function to toggle the use of dense output
+    /*!
+     * Function to toggle the use of dense output. If used, the state and state derivative at the boundaries of the most
+     * recent steps are stored, and used to compute the state at any value of the independent variable within the last
+     * step from a Hermite interpolating polynomial (see HermiteDenseOutput). Since the state derivative at the end of each
+     * step is always computed by this integrator, no additional state derivative evaluations are required. The stored
+     * nodes are cleared when calling this function.
+     * \param useDenseOutput Boolean denoting whether dense output is to be used
+     */
+    void setDenseOutput( const bool useDenseOutput )
+    {
+        useDenseOutput_ = useDenseOutput;
+        denseOutput_.clear( );
+    }
+
+    //! Function to check whether dense output is available for the last step
+    /*!
+     * Function to check whether dense output is available for the last step, i.e. whether dense output is used, the
+     * last step has not been rolled back, or modified, and sufficient steps have been taken for the interpolant to reach
+     * its full degree.
+     * \return True if getDenseOutputState can be called for values of the independent variable in the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        return useDenseOutput_ && !( currentIndependentVariable_ == lastIndependentVariable_ ) &&
+                denseOutput_.isStepCovered( lastIndependentVariable_, currentIndependentVariable_ ) &&
+                ( denseOutput_.getNumberOfNodes( ) >= denseOutput_.getMaximumNumberOfNodes( ) );
+    }
+
+    //! Function to retrieve the state from the dense output of the integrator
+    /*!
+     * Function to retrieve the state from the dense output of the integrator, at a value of the independent variable within
+     * the last step.
+     * \param independentVariable Value of the independent variable at which the state is to be retrieved.
+     * \return State at the requested value of the independent variable.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error when retrieving dense output from ABM integrator, "
+                                      "dense output is not available for last step." );
+        }
+        return denseOutput_.getState( independentVariable );
+    }
+
     //! Return maximum truncation error.
     /*!
      * Return the truncation error to be estimated by computError( ).
@@ -1041,6 +1109,12 @@ protected:
      * Last state derivative as computed by performIntegrationStep( ).
      */
     StateDerivativeType lastDerivative_;
+
+    //! Boolean denoting whether dense output is to be used
+    bool useDenseOutput_;
+
+    //! Object storing the most recent step boundaries, from which the dense output is computed
+    HermiteDenseOutput< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > denseOutput_;
 };
 
 extern template class AdamsBashforthMoultonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -73,13 +73,16 @@ public:
                         const bool assessTerminationOnMinorSteps = false ) :
         integratorType_( integratorType ), initialTimeDeprecated_( initialTime ),
         initialTimeStep_( initialTimeStep ), saveFrequency_( saveFrequency ),
-        assessTerminationOnMinorSteps_( assessTerminationOnMinorSteps )
+        assessTerminationOnMinorSteps_( assessTerminationOnMinorSteps ), useDenseOutput_( false )
     { }
 
     virtual std::shared_ptr< IntegratorSettings > clone( ) const
     {
-        return std::make_shared< IntegratorSettings >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< IntegratorSettings >(
                     integratorType_, initialTimeDeprecated_, initialTimeStep_, saveFrequency_, assessTerminationOnMinorSteps_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     
@@ -124,6 +127,15 @@ public:
      */
     bool assessTerminationOnMinorSteps_;
 
+    // Whether the dense output (continuous extension) of the integrator is to be used.
+    /*
+     * Whether the dense output (continuous extension) of the integrator is to be used to locate an exact dependent variable
+     * termination condition, instead of taking an integration step per root finder iteration. The final state is still
+     * computed by an integration step. Only supported by the variable step RK and ABM integrators; the default value is
+     * false.
+     */
+    bool useDenseOutput_;
+
 };
 
 // Class to define settings of fixed step RK numerical integrator.
@@ -166,8 +178,11 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaFixedStepSizeSettings< IndependentVariableType > >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaFixedStepSizeSettings< IndependentVariableType > >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_, orderToUse_, this->saveFrequency_, this->assessTerminationOnMinorSteps_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Virtual destructor.
@@ -238,11 +253,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType> >(
                     areTolerancesDefinedAsScalar_, this->initialTimeDeprecated_, this->initialTimeStep_, coefficientSet_,
                     minimumStepSize_, maximumStepSize_, this->saveFrequency_, this->assessTerminationOnMinorSteps_,
                     safetyFactorForNextStepSize_, maximumFactorIncreaseForNextStepSize_, minimumFactorDecreaseForNextStepSize_,
                     exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Virtual destructor.
@@ -330,12 +348,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->saveFrequency_, this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
     // Constructor.
     /*
@@ -465,12 +486,15 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, this->coefficientSet_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->saveFrequency_, this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_,
                     this->exceptionIfMinimumStepExceeded_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -539,11 +563,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_, extrapolationSequence_, maximumNumberOfSteps_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     this->saveFrequency_, this->assessTerminationOnMinorSteps_,
                     this->safetyFactorForNextStepSize_, this->maximumFactorIncreaseForNextStepSize_, this->minimumFactorDecreaseForNextStepSize_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor.
@@ -636,11 +663,14 @@ public:
 
     virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
     {
-        return std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType> >(
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > clonedSettings =
+                std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType> >(
                     this->initialTimeDeprecated_, this->initialTimeStep_,
                     this->minimumStepSize_, this->maximumStepSize_, relativeErrorTolerance_, absoluteErrorTolerance_,
                     minimumOrder_, maximumOrder_,
                     this->saveFrequency_, this->assessTerminationOnMinorSteps_, bandwidth_ );
+        clonedSettings->useDenseOutput_ = this->useDenseOutput_;
+        return clonedSettings;
     }
 
     // Destructor
@@ -1220,6 +1250,11 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         throw std::runtime_error( "Error while creating integrator. The resulting integrator pointer is null." );
     }
 
+    if( integratorSettings->useDenseOutput_ )
+    {
+        integrator->setDenseOutput( true );
+    }
+
     // Give back integrator
     return integrator;
 }
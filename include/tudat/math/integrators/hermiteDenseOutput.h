@@ -0,0 +1,238 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Norsett, S.P., Wanner, G., Solving Ordinary Differential Equations I, 2nd edition, Springer, 1993.
+ *      Burden, R.L., Faires, J.D., Numerical Analysis, 9th edition, Brooks/Cole, 2010.
+ *
+ */
+
+#ifndef TUDAT_HERMITE_DENSE_OUTPUT_H
+#define TUDAT_HERMITE_DENSE_OUTPUT_H
+
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class that provides the continuous extension (dense output) of a numerical integrator.
+/*!
+ * Class that provides the continuous extension (dense output) of a numerical integrator, from the states and state
+ * derivatives at the most recent step boundaries (nodes). The state at an arbitrary value of the independent variable is
+ * computed from the Hermite polynomial that matches both the state and state derivative at all stored nodes (Burden and
+ * Faires, 2010), so that with n nodes a polynomial of degree 2n - 1 is obtained. With the default of four nodes, the
+ * resulting interpolant is of degree seven, which is consistent with the accuracy of high-order integrators (Hairer et al.,
+ * 1993), without requiring method-specific interpolation coefficients. The polynomial is evaluated in terms of the
+ * independent variable normalized by the size of the last step, to prevent ill-conditioning for large values of the step.
+ * The interpolant is intended to be used within the last step (between the two most recent nodes), and only reaches its
+ * full degree once the maximum number of nodes is stored.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state. This type should be an Eigen::Matrix derived type.
+ * \tparam StateDerivativeType The type of the state derivative. This type should be an Eigen::Matrix derived type.
+ * \tparam TimeStepType The type of the time step.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = StateType, typename TimeStepType = IndependentVariableType >
+class HermiteDenseOutput
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param maximumNumberOfNodes Maximum number of nodes that are used for the interpolation. When a node is added and
+     * this number is exceeded, the oldest node is discarded.
+     */
+    HermiteDenseOutput( const unsigned int maximumNumberOfNodes = 4 ):
+        maximumNumberOfNodes_( maximumNumberOfNodes )
+    {
+        if( maximumNumberOfNodes_ < 2 )
+        {
+            throw std::runtime_error( "Error when creating Hermite dense output, at least 2 nodes are required." );
+        }
+    }
+
+    //! Function to add a node (step boundary) to the interpolant.
+    /*!
+     * Function to add a node (step boundary) to the interpolant. The independent variable of the new node must be
+     * different from that of the most recent node, and the nodes must be added in the direction of integration.
+     * \param independentVariable Value of the independent variable at the node.
+     * \param state State at the node.
+     * \param stateDerivative State derivative at the node.
+     */
+    void addNode( const IndependentVariableType independentVariable,
+                  const StateType& state,
+                  const StateDerivativeType& stateDerivative )
+    {
+        if( independentVariables_.size( ) > 0 && independentVariables_.back( ) == independentVariable )
+        {
+            throw std::runtime_error( "Error when adding node to Hermite dense output, node is already present." );
+        }
+
+        if( independentVariables_.size( ) == maximumNumberOfNodes_ )
+        {
+            independentVariables_.pop_front( );
+            states_.pop_front( );
+            stateDerivatives_.pop_front( );
+        }
+
+        independentVariables_.push_back( independentVariable );
+        states_.push_back( state );
+        stateDerivatives_.push_back( stateDerivative );
+    }
+
+    //! Function to remove all nodes from the interpolant.
+    void clear( )
+    {
+        independentVariables_.clear( );
+        states_.clear( );
+        stateDerivatives_.clear( );
+    }
+
+    //! Function to retrieve the number of nodes currently stored.
+    /*!
+     * Function to retrieve the number of nodes currently stored.
+     * \return Number of nodes currently stored.
+     */
+    unsigned int getNumberOfNodes( ) const
+    {
+        return independentVariables_.size( );
+    }
+
+    //! Function to retrieve the maximum number of nodes that are used for the interpolation.
+    /*!
+     * Function to retrieve the maximum number of nodes that are used for the interpolation.
+     * \return Maximum number of nodes that are used for the interpolation.
+     */
+    unsigned int getMaximumNumberOfNodes( ) const
+    {
+        return maximumNumberOfNodes_;
+    }
+
+    //! Function to retrieve the value of the independent variable at the most recent node.
+    /*!
+     * Function to retrieve the value of the independent variable at the most recent node. Throws an exception if no
+     * nodes are stored.
+     * \return Value of the independent variable at the most recent node.
+     */
+    IndependentVariableType getLastNodeIndependentVariable( ) const
+    {
+        if( independentVariables_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving last node of Hermite dense output, no nodes are stored." );
+        }
+        return independentVariables_.back( );
+    }
+
+    //! Function to check whether the last step is covered by the nodes of the interpolant.
+    /*!
+     * Function to check whether the last step, from startIndependentVariable to endIndependentVariable, is covered by
+     * the two most recent nodes of the interpolant.
+     * \param startIndependentVariable Independent variable at the start of the last step.
+     * \param endIndependentVariable Independent variable at the end of the last step.
+     * \return True if the two most recent nodes correspond to the given start and end of the step.
+     */
+    bool isStepCovered( const IndependentVariableType startIndependentVariable,
+                        const IndependentVariableType endIndependentVariable ) const
+    {
+        unsigned int numberOfNodes = independentVariables_.size( );
+        return ( numberOfNodes >= 2 ) &&
+                ( independentVariables_.at( numberOfNodes - 1 ) == endIndependentVariable ) &&
+                ( independentVariables_.at( numberOfNodes - 2 ) == startIndependentVariable );
+    }
+
+    //! Function to compute the interpolated state.
+    /*!
+     * Function to compute the interpolated state at the given value of the independent variable, using the Hermite
+     * polynomial through all stored nodes (in Newton form, using divided differences with repeated nodes). The interpolant
+     * is not modified, so that this function may be called concurrently.
+     * \param independentVariable Value of the independent variable at which the state is to be computed.
+     * \return Interpolated state.
+     */
+    StateType getState( const IndependentVariableType independentVariable ) const
+    {
+        const unsigned int numberOfNodes = independentVariables_.size( );
+        if( numberOfNodes < 2 )
+        {
+            throw std::runtime_error( "Error when computing state from Hermite dense output, at least 2 nodes are required." );
+        }
+
+        // Normalize independent variables w.r.t. last node and last step size.
+        const IndependentVariableType referenceIndependentVariable = independentVariables_.back( );
+        const TimeStepType lastStepSize = static_cast< TimeStepType >(
+                    independentVariables_.back( ) - independentVariables_.at( numberOfNodes - 2 ) );
+
+        const unsigned int numberOfCoefficients = 2 * numberOfNodes;
+        std::vector< TimeStepType > normalizedNodes( numberOfCoefficients );
+        std::vector< StateType > coefficients( numberOfCoefficients );
+        for( unsigned int i = 0; i < numberOfNodes; i++ )
+        {
+            normalizedNodes[ 2 * i ] = static_cast< TimeStepType >(
+                        independentVariables_.at( i ) - referenceIndependentVariable ) / lastStepSize;
+            normalizedNodes[ 2 * i + 1 ] = normalizedNodes[ 2 * i ];
+            coefficients[ 2 * i ] = states_.at( i );
+            coefficients[ 2 * i + 1 ] = states_.at( i );
+        }
+
+        // Compute divided differences in-place, using the (normalized) state derivative for repeated nodes.
+        for( unsigned int order = 1; order < numberOfCoefficients; order++ )
+        {
+            for( unsigned int j = numberOfCoefficients - 1; j >= order; j-- )
+            {
+                if( order == 1 && ( j % 2 == 1 ) )
+                {
+                    coefficients[ j ] = lastStepSize * stateDerivatives_.at( j / 2 );
+                }
+                else
+                {
+                    coefficients[ j ] = ( coefficients[ j ] - coefficients[ j - 1 ] ) /
+                            ( normalizedNodes[ j ] - normalizedNodes[ j - order ] );
+                }
+            }
+        }
+
+        // Evaluate Newton polynomial using Horner's scheme.
+        const TimeStepType normalizedIndependentVariable =
+                static_cast< TimeStepType >( independentVariable - referenceIndependentVariable ) / lastStepSize;
+        StateType interpolatedState = coefficients[ numberOfCoefficients - 1 ];
+        for( int j = numberOfCoefficients - 2; j >= 0; j-- )
+        {
+            interpolatedState = coefficients[ j ] +
+                    ( normalizedIndependentVariable - normalizedNodes[ j ] ) * interpolatedState;
+        }
+        return interpolatedState;
+    }
+
+private:
+
+    //! Maximum number of nodes that are used for the interpolation.
+    unsigned int maximumNumberOfNodes_;
+
+    //! Values of the independent variable at the nodes (oldest first).
+    std::deque< IndependentVariableType > independentVariables_;
+
+    //! States at the nodes (oldest first).
+    std::deque< StateType > states_;
+
+    //! State derivatives at the nodes (oldest first).
+    std::deque< StateDerivativeType > stateDerivatives_;
+};
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_HERMITE_DENSE_OUTPUT_H
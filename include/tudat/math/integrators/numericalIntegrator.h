@@ -197,6 +197,58 @@ public:
      */
     virtual void setStepSizeControl( const bool useStepSizeControl ) { }
 
+    //! Function to toggle the use of dense output (continuous extension of the numerical solution)
+    /*!
+     * Function to toggle the use of dense output, by which the state can be retrieved at any value of the independent
+     * variable within the last step (see getDenseOutputState). To be implemented in derived classes that provide dense
+     * output; an exception is thrown if dense output is requested for an integrator that does not support it.
+     * \param useDenseOutput Boolean denoting whether dense output is to be used
+     */
+    virtual void setDenseOutput( const bool useDenseOutput )
+    {
+        if( useDenseOutput )
+        {
+            throw std::runtime_error( "Error in numerical integrator. Dense output has not been implemented in this integrator." );
+        }
+    }
+
+    //! Function to check whether dense output is available for the last step
+    /*!
+     * Function to check whether dense output is available for the last step, i.e. whether dense output is used, and the
+     * last step (from getPreviousIndependentVariable to getCurrentIndependentVariable) has not been invalidated by a
+     * rollback, or a modification of the state.
+     * \return True if getDenseOutputState can be called for values of the independent variable in the last step.
+     */
+    virtual bool isDenseOutputAvailable( ) { return false; }
+
+    //! Function to retrieve the state from the dense output of the integrator
+    /*!
+     * Function to retrieve the state from the dense output (continuous extension) of the integrator, at a value of the
+     * independent variable within the last step. This allows the state to be obtained at an arbitrary epoch without
+     * re-stepping the integrator. To be implemented in derived classes that provide dense output.
+     * \param independentVariable Value of the independent variable at which the state is to be retrieved.
+     * \return State at the requested value of the independent variable.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Error in numerical integrator. Dense output has not been implemented in this integrator." );
+    }
+
+    //! Function to evaluate the state derivative at the current independent variable and state
+    /*!
+     * Function to evaluate the state derivative at the current independent variable and state, so that any models updated
+     * by the state derivative function (e.g. the environment, from which dependent variables are computed) are at the
+     * current state. Derived classes may skip the evaluation if the last state derivative evaluation of the last step was
+     * already at the current state (first-same-as-last schemes), or store the result for re-use as the first stage of the
+     * next step, so that no additional state derivative evaluation is needed. Should be called directly after a step, or
+     * after modifying the current state.
+     */
+    virtual void evaluateStateDerivativeAtCurrentState( )
+    {
+        stateDerivativeFunction_( getCurrentIndependentVariable( ), getCurrentState( ) );
+    }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
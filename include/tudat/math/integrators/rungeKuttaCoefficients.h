@@ -20,6 +20,7 @@
 #include <Eigen/Core>
 
 #include <iostream>
+#include <vector>
 
 namespace tudat
 {
@@ -87,6 +88,13 @@ struct RungeKuttaCoefficients
     // Name of the coefficients.
     std::string name;
 
+    // Indices of the non-zero a-coefficients of each stage (derived from aCoefficients).
+    std::vector< std::vector< int > > nonZeroACoefficientIndices;
+
+    // Boolean denoting whether the last stage is evaluated at the integrated state at the end of the step, so that it can
+    // be reused as the first stage of the next step (first-same-as-last; derived from the Butcher tableau).
+    bool isFirstSameAsLast;
+
     // Default constructor.
     /*
      * Default constructor that initializes coefficients to 0.
@@ -99,7 +107,8 @@ struct RungeKuttaCoefficients
         lowerOrder( 0 ),
         orderEstimateToIntegrate( lower ),
         isFixedStepSize( false ),
-        name( "Undefined" )        
+        name( "Undefined" ),
+        isFirstSameAsLast( false )
     { }
 
     // Constructor.
@@ -130,8 +139,18 @@ struct RungeKuttaCoefficients
         lowerOrder( lowerOrder_ ),
         orderEstimateToIntegrate( order ),
         isFixedStepSize( isFixedStepSize_ ),
-        name( name_ )
-    { }
+        name( name_ ),
+        isFirstSameAsLast( false )
+    {
+        computeDerivedProperties( );
+    }
+
+    // Function to compute the properties derived from the Butcher tableau.
+    /*
+     * Function to compute the properties derived from the Butcher tableau (nonZeroACoefficientIndices and
+     * isFirstSameAsLast). Must be called after the coefficients have been modified.
+     */
+    void computeDerivedProperties( );
 
     // Get coefficients for a specified coefficient set.
     /*
@@ -85,7 +85,8 @@ public:
         currentState_( initialState ),
         lastIndependentVariable_( intervalStart ),
         coefficientsSet_( coefficientsSet ),
-        orderToUse_( orderToUse )
+        orderToUse_( orderToUse ),
+        isFirstStageDerivativeAvailable_( false )
     {
         // Load the Butcher tableau coefficients.
         setCoefficients( coefficientsSet );
@@ -122,6 +123,7 @@ public:
 
         currentScaledStateDerivatives_.clear( );
         currentScaledStateDerivatives_.resize( this->butcherTableau_.cCoefficients.rows( ) );
+        isFirstStageDerivativeAvailable_ = false;
 
     }
 
@@ -181,10 +183,17 @@ public:
             // Compute the intermediate state to pass to the state derivative for this stage.
             StateType intermediateState = this->currentState_ + stateUpdate;
 
-            // Compute the state derivative.
+            // Compute the state derivative (first stage is evaluated at the current state, and may already be known).
             const IndependentVariableType time = this->currentIndependentVariable_ +
                     this->butcherTableau_.cCoefficients( stage ) * stepSize;
-            currentScaledStateDerivatives_[ stage ] = stepSize * this->stateDerivativeFunction_( time, intermediateState );
+            if( stage == 0 && isFirstStageDerivativeAvailable_ )
+            {
+                currentScaledStateDerivatives_[ stage ] = stepSize * firstStageStateDerivative_;
+            }
+            else
+            {
+                currentScaledStateDerivatives_[ stage ] = stepSize * this->stateDerivativeFunction_( time, intermediateState );
+            }
 
             // Check if propagation should terminate because the propagation termination condition has been reached
             // while computing the intermediate state.
@@ -196,6 +205,8 @@ public:
             }
         }
 
+        isFirstStageDerivativeAvailable_ = false;
+
         stateUpdate.setZero( );
         for ( int stage = 0; stage < this->butcherTableau_.cCoefficients.rows( ); stage++ )
         {
@@ -236,6 +247,7 @@ public:
 
         currentIndependentVariable_ = lastIndependentVariable_;
         currentState_ = lastState_;
+        isFirstStageDerivativeAvailable_ = false;
         return true;
     }
 
@@ -269,6 +281,20 @@ public:
         return butcherTableau_;
     }
 
+    //! Function to evaluate the state derivative at the current independent variable and state
+    /*!
+     * Function to evaluate the state derivative at the current independent variable and state. The result is re-used as
+     * the first stage derivative of the next step, so that no additional state derivative evaluation is required.
+     */
+    void evaluateStateDerivativeAtCurrentState( )
+    {
+        if( !isFirstStageDerivativeAvailable_ )
+        {
+            firstStageStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+            isFirstStageDerivativeAvailable_ = true;
+        }
+    }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
@@ -281,6 +307,12 @@ public:
      */
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
+        // First stage derivative can only be reused if state is unchanged
+        if( !( ( newState.rows( ) == currentState_.rows( ) ) && ( newState.cols( ) == currentState_.cols( ) ) &&
+               ( newState == currentState_ ) ) )
+        {
+            isFirstStageDerivativeAvailable_ = false;
+        }
         currentState_ = newState;
         if ( !allowRollback )
         {
@@ -298,6 +330,7 @@ public:
     void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
                                             const bool allowRollback = false )
     {
+        isFirstStageDerivativeAvailable_ = false;
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
         if ( !allowRollback )
@@ -352,6 +385,12 @@ protected:
 
     // Order of Runge-Kutta method to be used.
     RungeKuttaCoefficients::OrderEstimateToIntegrate orderToUse_;
+
+    //! State derivative at the current state, evaluated after the last step (see evaluateStateDerivativeAtCurrentState).
+    StateDerivativeType firstStageStateDerivative_;
+
+    //! Boolean denoting whether firstStageStateDerivative_ is valid for the current state and independent variable.
+    bool isFirstStageDerivativeAvailable_;
 };
 
 extern template class RungeKuttaFixedStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -28,6 +28,7 @@ using namespace boost::placeholders;
 #include <vector>
 
 #include "tudat/basics/utilityMacros.h"
+#include "tudat/math/integrators/hermiteDenseOutput.h"
 #include "tudat/math/integrators/reinitializableNumericalIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
 
@@ -139,8 +140,14 @@ public:
         maximumFactorIncreaseForNextStepSize_( std::fabs( static_cast< double >( maximumFactorIncreaseForNextStepSize ) ) ),
         minimumFactorDecreaseForNextStepSize_( std::fabs( static_cast< double >( minimumFactorDecreaseForNextStepSize ) ) ),
         newStepSizeFunction_( newStepSizeFunction ), exceptionIfMinimumStepExceeded_( exceptionIfMinimumStepExceeded ),
-        useStepSizeControl_( true )
+        useStepSizeControl_( true ),
+        isLastStageDerivativeReusable_( false ),
+        isFirstStageDerivativeAvailable_( false ),
+        useDenseOutput_( false )
     {
+        // Ensure that properties derived from (possibly user-defined) Butcher tableau are set.
+        coefficients_.computeDerivedProperties( );
+
         if( !( currentState_.rows( ) == relativeErrorTolerance_.rows( ) ) ||
                 !( currentState_.cols( ) == relativeErrorTolerance_.cols( ) ) )
         {
@@ -217,8 +224,14 @@ public:
         minimumFactorDecreaseForNextStepSize_( std::fabs( static_cast< double >( minimumFactorDecreaseForNextStepSize ) ) ),
         newStepSizeFunction_( newStepSizeFunction ),
         exceptionIfMinimumStepExceeded_( exceptionIfMinimumStepExceeded ),
-        useStepSizeControl_( true )
+        useStepSizeControl_( true ),
+        isLastStageDerivativeReusable_( false ),
+        isFirstStageDerivativeAvailable_( false ),
+        useDenseOutput_( false )
     {
+        // Ensure that properties derived from (possibly user-defined) Butcher tableau are set.
+        coefficients_.computeDerivedProperties( );
+
         // Set default newStepSizeFunction_ to the class method.
         if ( newStepSizeFunction_ == 0 )
         {
@@ -296,6 +309,7 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        resetStateDerivativeReuse( );
         return true;
     }
 
@@ -331,6 +345,12 @@ public:
      */
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
+        // Last stage derivative can only be reused if state is unchanged (e.g. after state post-processing that has no effect)
+        if( !( ( newState.rows( ) == currentState_.rows( ) ) && ( newState.cols( ) == currentState_.cols( ) ) &&
+               ( newState == currentState_ ) ) )
+        {
+            resetStateDerivativeReuse( );
+        }
         currentState_ = newState;
         if ( !allowRollback )
         {
@@ -348,6 +368,7 @@ public:
     void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
                                             const bool allowRollback = false )
     {
+        resetStateDerivativeReuse( );
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
         if ( !allowRollback )
@@ -366,8 +387,117 @@ public:
         useStepSizeControl_ = useStepSizeControl;
     }
 
+    //! Function to toggle the use of dense output
+    /*!
+     * Function to toggle the use of dense output. If used, the state and state derivative at the boundaries of the most
+     * recent steps are stored, and used to compute the state at any value of the independent variable within the last
+     * step from a Hermite interpolating polynomial (see HermiteDenseOutput). The stored nodes are cleared when calling
+     * this function.
+     * \param useDenseOutput Boolean denoting whether dense output is to be used
+     */
+    void setDenseOutput( const bool useDenseOutput )
+    {
+        useDenseOutput_ = useDenseOutput;
+        denseOutput_.clear( );
+    }
+
+    //! Function to check whether dense output is available for the last step
+    /*!
+     * Function to check whether dense output is available for the last step, i.e. whether dense output is used, the
+     * state derivative at the start of the last step is stored (it is not if the last step was rolled back, or the state
+     * was modified), and sufficient steps have been taken since for the interpolant to reach its full degree.
+     * \return True if getDenseOutputState can be called for values of the independent variable in the last step.
+     */
+    bool isDenseOutputAvailable( )
+    {
+        if( !useDenseOutput_ || ( this->currentIndependentVariable_ == this->lastIndependentVariable_ ) ||
+                denseOutput_.getNumberOfNodes( ) == 0 )
+        {
+            return false;
+        }
+
+        // Check if step is covered, where the node at the end of the step may not have been added yet.
+        unsigned int numberOfNodes = denseOutput_.getNumberOfNodes( );
+        if( denseOutput_.getLastNodeIndependentVariable( ) == this->lastIndependentVariable_ )
+        {
+            numberOfNodes++;
+        }
+        else if( !denseOutput_.isStepCovered( this->lastIndependentVariable_, this->currentIndependentVariable_ ) )
+        {
+            return false;
+        }
+        return numberOfNodes >= denseOutput_.getMaximumNumberOfNodes( );
+    }
+
+    //! Function to retrieve the state from the dense output of the integrator
+    /*!
+     * Function to retrieve the state from the dense output of the integrator, at a value of the independent variable within
+     * the last step. If the state derivative at the end of the last step is not yet known (i.e. for coefficient sets that are
+     * not first-same-as-last), it is evaluated here, and re-used as the first stage derivative of the next step, so that
+     * no additional state derivative evaluations are required.
+     * \param independentVariable Value of the independent variable at which the state is to be retrieved.
+     * \return State at the requested value of the independent variable.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        if( !isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error when retrieving dense output from variable step-size RK integrator, "
+                                      "dense output is not available for last step." );
+        }
+
+        // Add node at end of step, if not yet done
+        if( !( denseOutput_.getLastNodeIndependentVariable( ) == this->currentIndependentVariable_ ) )
+        {
+            currentStateDerivatives_[ 0 ] = this->stateDerivativeFunction_(
+                        this->currentIndependentVariable_, this->currentState_ );
+            isFirstStageDerivativeAvailable_ = true;
+            denseOutput_.addNode( this->currentIndependentVariable_, this->currentState_, currentStateDerivatives_[ 0 ] );
+        }
+
+        return denseOutput_.getState( independentVariable );
+    }
+
+    //! Function to evaluate the state derivative at the current independent variable and state
+    /*!
+     * Function to evaluate the state derivative at the current independent variable and state. For first-same-as-last
+     * coefficient sets, the last stage of the last step was evaluated at the current state, and no evaluation is
+     * performed. Otherwise, the state derivative is evaluated, and re-used as the first stage derivative of the next step.
+     */
+    void evaluateStateDerivativeAtCurrentState( )
+    {
+        if( isLastStageDerivativeReusable_ || isFirstStageDerivativeAvailable_ )
+        {
+            return;
+        }
+
+        const int numberOfStages = this->coefficients_.cCoefficients.rows( );
+        if( static_cast< int >( currentStateDerivatives_.size( ) ) != numberOfStages )
+        {
+            currentStateDerivatives_.resize( numberOfStages );
+        }
+        currentStateDerivatives_[ 0 ] = this->stateDerivativeFunction_(
+                    this->currentIndependentVariable_, this->currentState_ );
+        isFirstStageDerivativeAvailable_ = true;
+
+        // Add node at end of step to dense output, if not yet done
+        if( isDenseOutputAvailable( ) &&
+                !( denseOutput_.getLastNodeIndependentVariable( ) == this->currentIndependentVariable_ ) )
+        {
+            denseOutput_.addNode( this->currentIndependentVariable_, this->currentState_, currentStateDerivatives_[ 0 ] );
+        }
+    }
+
 protected:
 
+    //! Function to reset the re-use of stage derivatives, and the dense output nodes, after a change in current state/time.
+    void resetStateDerivativeReuse( )
+    {
+        isLastStageDerivativeReusable_ = false;
+        isFirstStageDerivativeAvailable_ = false;
+        denseOutput_.clear( );
+    }
+
     //! Computes the next step size and validates the result.
     /*!
      * Computes the next step size based on a higher and lower order estimate, determines if the
@@ -501,15 +631,46 @@ protected:
 
     //! Vector of state derivatives.
     /*!
-     * Vector of state derivatives, i.e. values of k_{i} in Runge-Kutta scheme.
+     * Vector of state derivatives, i.e. values of k_{i} in Runge-Kutta scheme. The vector is sized to the number of stages
+     * once, and its entries are overwritten at each step.
      */
     std::vector< StateDerivativeType > currentStateDerivatives_;
 
+    //! Intermediate state at which the state derivative of the current stage is evaluated (re-used between stages).
+    StateType intermediateState_;
+
+    //! Lower order estimate of the state at the end of the current step (re-used between steps).
+    StateType lowerOrderEstimate_;
+
+    //! Higher order estimate of the state at the end of the current step (re-used between steps).
+    StateType higherOrderEstimate_;
+
     bool exceptionIfMinimumStepExceeded_;
 
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Boolean denoting whether the last stage derivative of the previous step is the first stage derivative of the next.
+    /*!
+     * Boolean denoting whether the last stage derivative of the previous step is the first stage derivative of the next
+     * step. This is the case if the coefficient set is first-same-as-last, the previous step was completed, and the current
+     * state and independent variable have not been modified since.
+     */
+    bool isLastStageDerivativeReusable_;
+
+    //! Boolean denoting whether the first stage derivative of the next step has already been computed.
+    /*!
+     * Boolean denoting whether the first stage derivative of the next step has already been computed (and stored in the
+     * first entry of currentStateDerivatives_), which is the case if the dense output was evaluated after the last step.
+     */
+    bool isFirstStageDerivativeAvailable_;
+
+    //! Boolean denoting whether dense output is to be used
+    bool useDenseOutput_;
+
+    //! Object storing the most recent step boundaries, from which the dense output is computed
+    HermiteDenseOutput< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > denseOutput_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -528,75 +689,129 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         throw std::invalid_argument( "Error in RKF integrator, step size is NaN" );
     }
 
-    // Define and allocated vector for the number of stages.
-    currentStateDerivatives_.clear( );
-    currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
+    // Allocate vector for the number of stages (only on first step).
+    const int numberOfStages = this->coefficients_.cCoefficients.rows( );
+    if( static_cast< int >( currentStateDerivatives_.size( ) ) != numberOfStages )
+    {
+        currentStateDerivatives_.resize( numberOfStages );
+        isLastStageDerivativeReusable_ = false;
+    }
 
-    // Define lower and higher order estimates.
-    StateType lowerOrderEstimate( this->currentState_ ), higherOrderEstimate( this->currentState_ );
+    // For first-same-as-last coefficients, the first stage derivative is equal to the last stage derivative of the
+    // previous step.
+    // Also, if the dense output was evaluated after the previous step, the first stage derivative is already computed.
+    bool isFirstStageDerivativeComputed = isFirstStageDerivativeAvailable_;
+    if( isLastStageDerivativeReusable_ )
+    {
+        currentStateDerivatives_[ 0 ] = currentStateDerivatives_[ numberOfStages - 1 ];
+        isFirstStageDerivativeComputed = true;
+    }
+    isLastStageDerivativeReusable_ = false;
+    isFirstStageDerivativeAvailable_ = false;
 
-    // Compute the k_i state derivatives per stage.
-    for ( int stage = 0; stage < this->coefficients_.cCoefficients.rows( ); stage++ )
+    // Take steps until step is accepted.
+    TimeStepType currentStepSize = stepSize;
+    bool isStepAccepted = false;
+    while( !isStepAccepted )
     {
-        // Compute the intermediate state to pass to the state derivative for this stage.
-        StateType intermediateState( this->currentState_ );
+        // Initialize lower and higher order estimates.
+        lowerOrderEstimate_ = this->currentState_;
+        higherOrderEstimate_ = this->currentState_;
 
-        // Compute the intermediate state.
-        for ( int column = 0; column < stage; column++ )
+        // Compute the k_i state derivatives per stage.
+        for ( int stage = 0; stage < numberOfStages; stage++ )
         {
-            intermediateState += stepSize * this->coefficients_.aCoefficients( stage, column ) *
-                    currentStateDerivatives_[ column ];
-        }
+            // The first stage is evaluated at the current state, so it only needs to be computed once, also if
+            // the step is rejected.
+            if( !( stage == 0 && isFirstStageDerivativeComputed ) )
+            {
+                // Compute the intermediate state to pass to the state derivative for this stage, skipping zero
+                // coefficients.
+                intermediateState_ = this->currentState_;
+                const std::vector< int >& nonZeroColumns = this->coefficients_.nonZeroACoefficientIndices[ stage ];
+                for ( unsigned int i = 0; i < nonZeroColumns.size( ); i++ )
+                {
+                    intermediateState_ += ( currentStepSize * this->coefficients_.aCoefficients( stage, nonZeroColumns[ i ] ) ) *
+                            currentStateDerivatives_[ nonZeroColumns[ i ] ];
+                }
+
+                // Compute the state derivative.
+                const IndependentVariableType time = this->currentIndependentVariable_ +
+                        this->coefficients_.cCoefficients( stage ) * currentStepSize;
+                currentStateDerivatives_[ stage ] = this->stateDerivativeFunction_( time, intermediateState_ );
+
+                // Check if propagation should terminate because the propagation termination condition has been reached
+                // while computing the intermediate state.
+                // If so, return immediately the current state (not recomputed yet), which will be discarded.
+                if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
+                {
+                    this->propagationTerminationConditionReachedDuringStep_ = true;
+                    return this->currentState_;
+                }
+
+                if( stage == 0 )
+                {
+                    isFirstStageDerivativeComputed = true;
+                }
+            }
 
-        // Compute the state derivative.
-        const IndependentVariableType time = this->currentIndependentVariable_ +
-                this->coefficients_.cCoefficients( stage ) * stepSize;
-        currentStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+            // Store state and state derivative at start of step for dense output.
+            if( stage == 0 && useDenseOutput_ && ( ( denseOutput_.getNumberOfNodes( ) == 0 ) ||
+                    !( denseOutput_.getLastNodeIndependentVariable( ) == this->currentIndependentVariable_ ) ) )
+            {
+                denseOutput_.addNode( this->currentIndependentVariable_, this->currentState_, currentStateDerivatives_[ 0 ] );
+            }
 
-        // Check if propagation should terminate because the propagation termination condition has been reached
-        // while computing the intermediate state.
-        // If so, return immediately the current state (not recomputed yet), which will be discarded.
-        if ( this->propagationTerminationFunction_( static_cast< double >( time ), TUDAT_NAN ) )
-        {
-            this->propagationTerminationConditionReachedDuringStep_ = true;
-            return this->currentState_;
+            // Update the estimate.
+            if( this->coefficients_.bCoefficients( 0, stage ) != 0.0 )
+            {
+                lowerOrderEstimate_ += ( this->coefficients_.bCoefficients( 0, stage ) * currentStepSize ) *
+                        currentStateDerivatives_[ stage ];
+            }
+            if( this->coefficients_.bCoefficients( 1, stage ) != 0.0 )
+            {
+                higherOrderEstimate_ += ( this->coefficients_.bCoefficients( 1, stage ) * currentStepSize ) *
+                        currentStateDerivatives_[ stage ];
+            }
         }
 
-        // Update the estimate.
-        lowerOrderEstimate += this->coefficients_.bCoefficients( 0, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
-        higherOrderEstimate += this->coefficients_.bCoefficients( 1, stage ) * stepSize *
-                currentStateDerivatives_[ stage ];
+        // Determine if the error was within bounds and compute a new step size. If not, the step is redone with the
+        // new step size.
+        isStepAccepted = computeNextStepSizeAndValidateResult( lowerOrderEstimate_, higherOrderEstimate_, currentStepSize );
+        if( !isStepAccepted )
+        {
+            currentStepSize = this->stepSize_;
+        }
     }
 
-    // Determine if the error was within bounds and compute a new step size.
-    if ( computeNextStepSizeAndValidateResult( lowerOrderEstimate,
-                                               higherOrderEstimate, stepSize ) )
-    {
-        // Accept the current step.
-        this->lastIndependentVariable_ = this->currentIndependentVariable_;
-        this->lastState_ = this->currentState_;
-        this->currentIndependentVariable_ += stepSize;
+    // Accept the current step.
+    this->lastIndependentVariable_ = this->currentIndependentVariable_;
+    this->lastState_ = this->currentState_;
+    this->currentIndependentVariable_ += currentStepSize;
 
-        switch ( this->coefficients_.orderEstimateToIntegrate )
-        {
-        case RungeKuttaCoefficients::lower:
-            this->currentState_ = lowerOrderEstimate;
-            return this->currentState_;
+    switch ( this->coefficients_.orderEstimateToIntegrate )
+    {
+    case RungeKuttaCoefficients::lower:
+        this->currentState_ = lowerOrderEstimate_;
+        break;
 
-        case RungeKuttaCoefficients::higher:
-            this->currentState_ = higherOrderEstimate;
-            return this->currentState_;
+    case RungeKuttaCoefficients::higher:
+        this->currentState_ = higherOrderEstimate_;
+        break;
 
-        default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
-            throw std::runtime_error( "Order estimate to integrate is invalid." );
-        }
+    default: // The default case will never occur because OrderEstimateToIntegrate is an enum.
+        throw std::runtime_error( "Order estimate to integrate is invalid." );
     }
-    else
+
+    isLastStageDerivativeReusable_ = this->coefficients_.isFirstSameAsLast;
+
+    // For first-same-as-last coefficients, the state derivative at the end of the step is already known.
+    if( useDenseOutput_ && isLastStageDerivativeReusable_ )
     {
-        // Reject current step.
-        return performIntegrationStep( this->stepSize_ );
+        denseOutput_.addNode( this->currentIndependentVariable_, this->currentState_,
+                              currentStateDerivatives_[ numberOfStages - 1 ] );
     }
+    return this->currentState_;
 }
 
 //! Compute the next step size and validate the result.
@@ -137,9 +137,6 @@ public:
         // interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -218,8 +215,6 @@ public:
         //interpolation call.
         initializeDenominators( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -306,7 +301,9 @@ public:
             else
             {
                 // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
+                // interpolant is created (cache is local to thread, so that interpolator may be used concurrently).
+                thread_local std::vector< ScalarType > independentVariableDifferenceCache;
+                independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
                 int j = 0;
                 for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
                 {
@@ -483,8 +480,6 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
     std::shared_ptr< OneDimensionalInterpolator
     < IndependentVariableType, DependentVariableType > > beginInterpolator_;
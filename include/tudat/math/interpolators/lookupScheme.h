@@ -12,6 +12,7 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <atomic>
 #include <vector>
 
 #include <memory>
@@ -106,15 +107,14 @@ public:
 
     //! Constructor, used to set data vector.
     /*!
-     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 0.
+     *  Constructor, used to set data vector. Initializes guess from 'previous' request to 'no previous request'.
      * \param independentVariableValues vector of independent variable values in which to perform
      * lookup procedure.
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
         : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+          previousNearestLowerIndex_( -1 )
     { }
 
     //! Default destructor
@@ -126,7 +126,9 @@ public:
     //! Find nearest left neighbour.
     /*!
      * Function finds nearest left neighbour of given value in ndependentVariableValues_. If this
-     * is first call of function, a binary search is used.
+     * is first call of function, a binary search is used. The index found on the previous call is only used as a starting
+     * guess, and is stored atomically, so that the function may be called concurrently from multiple threads (in which
+     * case the guess may come from any of the threads).
      * \param valueToLookup Value of which nearest neighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
@@ -135,22 +137,22 @@ public:
     {
         // Initialize return value.
         int newNearestLowerIndex = 0;
+        const int previousNearestLowerIndex = previousNearestLowerIndex_.load( std::memory_order_relaxed );
 
         // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
+        if ( previousNearestLowerIndex < 0 )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
                     < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
         }
 
         else
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex, valueToLookup, independentVariableValues_ ) )
             {
-                newNearestLowerIndex = previousNearestLowerIndex_;
+                return previousNearestLowerIndex;
             }
 
             // Otherwise, perform hunting algorithm.
@@ -159,29 +161,23 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex, independentVariableValues_ );
             }
         }
 
         // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
 
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
+    //! Nearest left index during previous call (negative if no lookup has been done yet).
     /*!
-     * Boolean to denote whether a lookup has been done.
+     * Nearest left index during previous call (negative if no lookup has been done yet).
      */
-    bool isFirstLookupDone;
-
-    //! Nearest left index during previous call.
-    /*!
-     * Nearest left index during previous call
-     */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
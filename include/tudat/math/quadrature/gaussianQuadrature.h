@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <boost/make_shared.hpp>
 
 #include <Eigen/Core>
@@ -119,6 +120,7 @@ struct GaussQuadratureNodesAndWeights
     */
     IndependentVariableArray getNodes( const unsigned int order )
     {
+        std::lock_guard< std::mutex > cacheLock( cacheMutex_ );
         if ( nodes_.count( order ) == 0 )
         {
             IndependentVariableArray newNodes( order );
@@ -147,6 +149,7 @@ struct GaussQuadratureNodesAndWeights
     //! Get all the weight factors (i.e. n weight factors for nth order) from uniqueWeights_
     IndependentVariableArray getWeights( const unsigned int n )
     {
+        std::lock_guard< std::mutex > cacheLock( cacheMutex_ );
         if ( weights_.count( n ) == 0 )
         {
             IndependentVariableArray newWeights( n );
@@ -187,6 +190,9 @@ struct GaussQuadratureNodesAndWeights
     std::map< unsigned int, IndependentVariableArray > uniqueWeights_;
     std::map< unsigned int, IndependentVariableArray > weights_;
 
+    //! Mutex protecting nodes_ and weights_, which are extended on first use of each order (possibly concurrently)
+    std::mutex cacheMutex_;
+
 };
 
 //! Object containing nodes/weights for long double Gauss quadrature
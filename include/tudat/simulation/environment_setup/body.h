@@ -15,6 +15,7 @@
 #include <vector>
 
 #include <memory>
+#include <mutex>
 
 #include <Eigen/Core>
 
@@ -309,6 +310,10 @@ public:
     template<typename StateScalarType = double, typename TimeType = double>
     void setStateFromEphemeris(const TimeType &time)
     {
+        std::unique_lock<std::recursive_mutex> stateLock(ephemerisStateMutex_, std::defer_lock);
+        if (areEphemerisStatesRequestedConcurrently_) {
+            stateLock.lock();
+        }
         if (!(static_cast<Time>(time) == timeOfCurrentState_))
         {
             if( bodyEphemeris_ == nullptr )
@@ -374,6 +379,10 @@ public:
     template<typename StateScalarType = double, typename TimeType = double>
     Eigen::Matrix<StateScalarType, 6, 1> getStateInBaseFrameFromEphemeris(const TimeType time)
     {
+        std::unique_lock<std::recursive_mutex> stateLock(ephemerisStateMutex_, std::defer_lock);
+        if (areEphemerisStatesRequestedConcurrently_) {
+            stateLock.lock();
+        }
         setStateFromEphemeris<StateScalarType, TimeType>(time);
         if (sizeof(StateScalarType) == 8) {
             return currentState_.template cast<StateScalarType>();
@@ -398,6 +407,10 @@ public:
             throw std::runtime_error("Error, calling global frame origin barycentric state on body that is not global frame origin");
         }
 
+        std::unique_lock<std::recursive_mutex> stateLock(ephemerisStateMutex_, std::defer_lock);
+        if (areEphemerisStatesRequestedConcurrently_) {
+            stateLock.lock();
+        }
         setStateFromEphemeris<StateScalarType, TimeType>(time);
 
         if (sizeof(StateScalarType) == 8) {
@@ -851,7 +864,8 @@ public:
 
         currentMass_ = gravityFieldModel_->getGravitationalParameter( )
                 / physical_constants::GRAVITATIONAL_CONSTANT;
-        bodyMassFunction_ = [ = ]( const double ){ return currentMass_; };
+        const double gravityFieldMass = currentMass_;
+        bodyMassFunction_ = [ = ]( const double ){ return gravityFieldMass; };
     }
 
     //! Function to set the atmosphere model of the body.
@@ -1152,6 +1166,21 @@ public:
         currentMass_ = bodyMass;
     }
 
+    //! Function to set the mass and inertia properties of the body equal to those of another body
+    /*!
+     * Function to set the mass and inertia properties of the body (current mass, mass function, inertia tensor, scaled
+     * mean moment of inertia and density) equal to those of another body. The mass function is shared with the other body.
+     * \param originalBody Body from which the mass and inertia properties are to be copied
+     */
+    void setMassPropertiesFromBody( const std::shared_ptr< Body > originalBody )
+    {
+        currentMass_ = originalBody->currentMass_;
+        bodyMassFunction_ = originalBody->bodyMassFunction_;
+        bodyInertiaTensor_ = originalBody->bodyInertiaTensor_;
+        scaledMeanMomentOfInertia_ = originalBody->scaledMeanMomentOfInertia_;
+        density_ = originalBody->density_;
+    }
+
     //! Function to get the function returning body mass as a function of time
     /*!
      * Function to get the function returning body mass as a function of time
@@ -1416,6 +1445,17 @@ public:
      */
     void setIsBodyInPropagation(const bool isBodyInPropagation);
 
+    //! Function to define whether the state of the body may be requested from its ephemeris by multiple threads concurrently
+    /*!
+     *  Function to define whether the state of the body may be requested from its ephemeris by multiple threads
+     *  concurrently (e.g. when computing observations in parallel). Only if this is set to true is the current ephemeris
+     *  state protected by a mutex, so that serial computations incur no locking overhead.
+     *  \param areEphemerisStatesRequestedConcurrently Boolean defining whether the ephemeris state may be requested concurrently
+     */
+    void setAreEphemerisStatesRequestedConcurrently(const bool areEphemerisStatesRequestedConcurrently) {
+        areEphemerisStatesRequestedConcurrently_ = areEphemerisStatesRequestedConcurrently;
+    }
+
 //    void setSuppressDependentOrientationCalculatorWarning(const bool suppressDependentOrientationCalculatorWarning) {
 //        suppressDependentOrientationCalculatorWarning_ = suppressDependentOrientationCalculatorWarning;
 //    }
@@ -1444,6 +1484,13 @@ private:
     //! Time at which state was last set from ephemeris
     Time timeOfCurrentState_;
 
+    //! Mutex protecting the state retrieved from the ephemeris (and the time at which it was set), so that the
+    //! ephemeris state may be requested concurrently (e.g. when computing observations in parallel).
+    std::recursive_mutex ephemerisStateMutex_;
+
+    //! Boolean denoting whether the ephemeris state may be requested concurrently, in which case ephemerisStateMutex_ is used
+    bool areEphemerisStatesRequestedConcurrently_ = false;
+
     //! Class returning the state of this body's ephemeris origin w.r.t. the global origin (as typically created by
     //! setGlobalFrameBodyEphemerides function).
     std::shared_ptr<BaseStateInterface> ephemerisFrameToBaseFrame_;
@@ -1894,6 +1941,15 @@ std::string getGlobalFrameOrigin(const SystemOfBodies &bodies);
 void setAreBodiesInPropagation(const SystemOfBodies &bodies,
                                const bool areBodiesInPropagation);
 
+//! Function to set whether the ephemeris states of the bodies may be requested by multiple threads concurrently
+/*!
+ * Function to set whether the ephemeris states of the bodies may be requested by multiple threads concurrently
+ * \param bodies List of body objects.
+ * \param areEphemerisStatesRequestedConcurrently Boolean defining whether the ephemeris states may be requested concurrently
+ */
+void setAreEphemerisStatesRequestedConcurrently(const SystemOfBodies &bodies,
+                                                const bool areEphemerisStatesRequestedConcurrently);
+
 //! Function to compute the acceleration of a body, using its ephemeris and finite differences
 /*!
  *  Function to compute the acceleration of a body, using its ephemeris and 8th order finite difference and 100 s time step
@@ -0,0 +1,144 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_CLONEBODIES_H
+#define TUDAT_CLONEBODIES_H
+
+#include <memory>
+#include <string>
+
+#include "tudat/simulation/environment_setup/body.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to create an independent copy of a gravity field model
+/*!
+ *  Function to create an independent copy of a gravity field model, sharing no mutable data (gravitational parameter,
+ *  caches) with the original model. The spherical harmonic coefficients are shared with the original model, and are
+ *  only copied by a model when its coefficients are reset (as is done when they are estimated parameters), so that
+ *  modifying the coefficients of either model does not affect the other. If the original model updates the inertia
+ *  tensor of its body when it is modified, the copy is set to update the inertia tensor of the cloned body instead.
+ *  Time-dependent spherical harmonic gravity fields, and gravity field types other than point mass, spherical harmonic
+ *  and polyhedron, are not supported, and result in an exception.
+ *  \param originalGravityField Gravity field model that is to be copied
+ *  \param clonedBody Body to which the copied gravity field model is to be assigned
+ *  \param bodyName Name of body (used for error messages)
+ *  \return Independent copy of gravity field model
+ */
+std::shared_ptr< gravitation::GravityFieldModel > cloneGravityFieldModel(
+        const std::shared_ptr< gravitation::GravityFieldModel > originalGravityField,
+        const std::shared_ptr< Body > clonedBody,
+        const std::string& bodyName );
+
+//! Function to create a copy of an ephemeris model for use in a cloned body
+/*!
+ *  Function to create a copy of an ephemeris model for use in a cloned body. Tabulated and multi-arc ephemerides, which
+ *  may be reset with propagation results, are copied (including the arcs of a multi-arc ephemeris), so that resetting
+ *  the interpolator of the copy does not affect the original. Ephemerides that store no state when evaluated (Spice,
+ *  Kepler, constant, Chebyshev, GTOP, TLE and custom ephemerides) are returned as is, and are shared with the original
+ *  body. Other ephemeris types (e.g. the approximate JPL ephemerides, which store intermediate results when evaluated,
+ *  and composite or scaled ephemerides, which wrap other models) are not supported, and result in an exception.
+ *  \param originalEphemeris Ephemeris that is to be copied
+ *  \param bodyName Name of body (used for error messages)
+ *  \return Copy of (or pointer to) ephemeris
+ */
+std::shared_ptr< ephemerides::Ephemeris > cloneEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > originalEphemeris,
+        const std::string& bodyName );
+
+//! Function to create a copy of a rotation model for use in a cloned body
+/*!
+ *  Function to create a copy of a rotation model for use in a cloned body. Tabulated rotational ephemerides, which store
+ *  the current rotational state and may be reset with propagation results, are copied. Rotation models that are
+ *  defined from the state of the (original) bodies (synchronous, direction-based and aerodynamic angle-based rotation
+ *  models) are not supported, and result in an exception. All other rotation models are returned as is, and are shared
+ *  with the original body.
+ *  \param originalRotationModel Rotation model that is to be copied
+ *  \param bodyName Name of body (used for error messages)
+ *  \return Copy of (or pointer to) rotation model
+ */
+std::shared_ptr< ephemerides::RotationalEphemeris > cloneRotationalEphemeris(
+        const std::shared_ptr< ephemerides::RotationalEphemeris > originalRotationModel,
+        const std::string& bodyName );
+
+//! Function to create a copy of an atmosphere model for use in a cloned body
+/*!
+ *  Function to create a copy of an atmosphere model for use in a cloned body. The NRLMSISE00 model, which stores its most
+ *  recently computed properties, is copied. All other atmosphere models are returned as is, and are shared with the
+ *  original body.
+ *  \param originalAtmosphereModel Atmosphere model that is to be copied
+ *  \return Copy of (or pointer to) atmosphere model
+ */
+std::shared_ptr< aerodynamics::AtmosphereModel > cloneAtmosphereModel(
+        const std::shared_ptr< aerodynamics::AtmosphereModel > originalAtmosphereModel );
+
+//! Function to create an independent copy of an aerodynamic coefficient interface
+/*!
+ *  Function to create an independent copy of an aerodynamic coefficient interface, with its own current coefficients.
+ *  Only custom coefficient interfaces (including tabulated coefficients) without control surfaces are supported, other
+ *  interfaces result in an exception. The coefficient functions are shared with the original interface.
+ *  \param originalCoefficientInterface Aerodynamic coefficient interface that is to be copied
+ *  \param bodyName Name of body (used for error messages)
+ *  \return Independent copy of aerodynamic coefficient interface
+ */
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > cloneAerodynamicCoefficientInterface(
+        const std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > originalCoefficientInterface,
+        const std::string& bodyName );
+
+//! Function to create an independent copy of a radiation pressure interface, coupled to the cloned bodies
+/*!
+ *  Function to create an independent copy of a radiation pressure interface, in which the positions of the source,
+ *  target and occulting bodies are retrieved from the cloned bodies. Only cannonball radiation pressure interfaces are
+ *  supported, other interfaces result in an exception.
+ *  \param originalRadiationPressureInterface Radiation pressure interface that is to be copied
+ *  \param sourceBodyName Name of body emitting the radiation
+ *  \param bodyName Name of body undergoing the radiation pressure
+ *  \param clonedBodies Cloned bodies, to which the new interface is to be coupled
+ *  \return Independent copy of radiation pressure interface
+ */
+std::shared_ptr< electromagnetism::RadiationPressureInterface > cloneRadiationPressureInterface(
+        const std::shared_ptr< electromagnetism::RadiationPressureInterface > originalRadiationPressureInterface,
+        const std::string& sourceBodyName,
+        const std::string& bodyName,
+        const SystemOfBodies& clonedBodies );
+
+//! Function to create a deep copy of a system of bodies
+/*!
+ *  Function to create a copy of a system of bodies, that can be used (and modified) independently of the original
+ *  bodies, for instance to run multiple propagations concurrently, or to restart a simulation without recreating the
+ *  environment from its settings. Data that is not modified during a propagation (stateless ephemerides such as those
+ *  read from Spice, gravity field coefficient tables, shape models, tabulated atmospheres, etc.) is shared with the
+ *  original bodies, so that no files are reread and no kernels are reloaded. Models that store a mutable state, or that
+ *  are modified by a propagation or estimation (gravity field models, tabulated and multi-arc (rotational) ephemerides,
+ *  NRLMSISE00 atmosphere, aerodynamic coefficient interfaces, radiation pressure interfaces, ground station states, mass
+ *  properties), are duplicated, and any link to a body is set to the corresponding cloned body.
+ *
+ *  Flight conditions are not copied, as they are created automatically when creating aerodynamic acceleration models
+ *  (or can be added using the addFlightConditions function). Similarly, any model that refers to body objects (in
+ *  particular acceleration, torque and mass rate models) must be created anew for the cloned bodies, using the same
+ *  settings as for the original bodies (e.g. using the createAccelerationModelsMap function). Gravity field variations,
+ *  vehicle systems with engine models, and models not supported by the clone functions in this file (including
+ *  ephemerides that store intermediate results, see cloneEphemeris) result in an exception. Stateful rotation models
+ *  that are shared (e.g. full planetary rotation model) and user-defined functions (e.g. of custom ephemerides) are not
+ *  safe for concurrent use by the original and cloned bodies, unless they are thread-safe themselves.
+ *  \param originalBodies System of bodies that is to be copied
+ *  \return Copy of system of bodies
+ */
+SystemOfBodies cloneSystemOfBodies( const SystemOfBodies& originalBodies );
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_CLONEBODIES_H
@@ -49,7 +49,8 @@ enum EphemerisType
     custom_ephemeris,
     direct_tle_ephemeris,
     interpolated_tle_ephemeris,
-    scaled_ephemeris
+    scaled_ephemeris,
+    chebyshev_spice
 };
 
 // Class for providing settings for ephemeris model.
@@ -403,6 +404,85 @@ private:
     bool useLongDoubleStates_;
 };
 
+// EphemerisSettings derived class for defining settings of a Chebyshev polynomial ephemeris fitted to Spice data.
+/*
+ *  EphemerisSettings derived class for defining settings of an ephemeris consisting of piecewise Chebyshev
+ *  polynomials, fitted to Spice data upon creation. The time interval is divided into segments of at most a given
+ *  duration, which are bisected until the fit meets the position and velocity tolerances. Evaluating the resulting
+ *  ephemeris requires no calls to Spice, so that it is considerably faster than DirectSpiceEphemerisSettings, and may be
+ *  used concurrently from multiple threads.
+ */
+class ChebyshevSpiceEphemerisSettings: public DirectSpiceEphemerisSettings
+{
+public:
+
+    // Constructor.
+    /* Constructor, sets the properties from which the Chebyshev polynomials are to be fitted to Spice data.
+     * \param initialTime Initial time from which the Chebyshev polynomials are to be fitted.
+     * \param finalTime Final time until which the Chebyshev polynomials are to be fitted.
+     * \param positionTolerance Maximum position error of the fit (in m).
+     * \param velocityTolerance Maximum velocity error of the fit (in m/s).
+     * \param polynomialDegree Degree of the Chebyshev polynomials on each segment.
+     * \param maximumSegmentDuration Maximum duration of a single segment.
+     * \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     * \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *          calculated (optional "ECLIPJ2000" by default).
+     * \param bodyNameOverride Name of body in Spice, if different from the name of the body in the environment.
+     */
+    ChebyshevSpiceEphemerisSettings( const double initialTime,
+                                     const double finalTime,
+                                     const double positionTolerance,
+                                     const double velocityTolerance,
+                                     const int polynomialDegree = 12,
+                                     const double maximumSegmentDuration = 86400.0,
+                                     const std::string frameOrigin = "SSB",
+                                     const std::string frameOrientation = "ECLIPJ2000",
+                                     const std::string bodyNameOverride = "" ):
+        DirectSpiceEphemerisSettings( frameOrigin, frameOrientation, bodyNameOverride, chebyshev_spice ),
+        initialTime_( initialTime ), finalTime_( finalTime ),
+        positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+        polynomialDegree_( polynomialDegree ), maximumSegmentDuration_( maximumSegmentDuration ){ }
+
+    // Function to return initial time from which the Chebyshev polynomials are to be fitted.
+    double getInitialTime( ){ return initialTime_; }
+
+    // Function to return final time until which the Chebyshev polynomials are to be fitted.
+    double getFinalTime( ){ return finalTime_; }
+
+    // Function to return maximum position error of the fit (in m).
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    // Function to return maximum velocity error of the fit (in m/s).
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    // Function to return degree of the Chebyshev polynomials on each segment.
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    // Function to return maximum duration of a single segment.
+    double getMaximumSegmentDuration( ){ return maximumSegmentDuration_; }
+
+private:
+
+    // Initial time from which the Chebyshev polynomials are to be fitted.
+    double initialTime_;
+
+    // Final time until which the Chebyshev polynomials are to be fitted.
+    double finalTime_;
+
+    // Maximum position error of the fit (in m).
+    double positionTolerance_;
+
+    // Maximum velocity error of the fit (in m/s).
+    double velocityTolerance_;
+
+    // Degree of the Chebyshev polynomials on each segment.
+    int polynomialDegree_;
+
+    // Maximum duration of a single segment.
+    double maximumSegmentDuration_;
+};
+
 // EphemerisSettings derived class for defining settings of an approximate ephemeris for major
 // planets.
 /*
@@ -1054,6 +1134,23 @@ inline std::shared_ptr< EphemerisSettings > interpolatedSpiceEphemerisSettings(
             initialTime, finalTime, timeStep, frameOrigin, frameOrientation, interpolatorSettings, bodyNameOverride );
 }
 
+//! @get_docstring(chebyshevSpiceEphemerisSettings)
+inline std::shared_ptr< EphemerisSettings > chebyshevSpiceEphemerisSettings(
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree = 12,
+        const double maximumSegmentDuration = 86400.0,
+        const std::string frameOrigin = "SSB",
+        const std::string frameOrientation = "ECLIPJ2000",
+        const std::string bodyNameOverride = "" )
+{
+    return std::make_shared< ChebyshevSpiceEphemerisSettings >(
+            initialTime, finalTime, positionTolerance, velocityTolerance, polynomialDegree, maximumSegmentDuration,
+            frameOrigin, frameOrientation, bodyNameOverride );
+}
+
 //! @get_docstring(tabulatedEphemerisSettings)
 inline std::shared_ptr< EphemerisSettings > tabulatedEphemerisSettings(
 		const std::map< double, Eigen::Vector6d >& bodyStateHistory,
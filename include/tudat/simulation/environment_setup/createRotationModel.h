@@ -268,7 +268,8 @@ public:
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, "ITRS" ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ),
+        anglesInterpolationTimeStep_( TUDAT_NAN ), numberOfAnglesInterpolationPoints_( 8 ){ }
 
     //Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -332,6 +333,42 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //Function to retrieve the time step with which the Earth orientation angles are tabulated (NaN if not tabulated)
+    /*
+     * Function to retrieve the time step with which the Earth orientation angles are tabulated (NaN if not tabulated)
+     * \return Time step with which the Earth orientation angles are tabulated
+     */
+    double getAnglesInterpolationTimeStep( )
+    {
+        return anglesInterpolationTimeStep_;
+    }
+
+    //Function to retrieve the number of points used for the interpolation of the Earth orientation angles
+    /*
+     * Function to retrieve the number of points used for the interpolation of the Earth orientation angles
+     * \return Number of points used for the interpolation of the Earth orientation angles
+     */
+    int getNumberOfAnglesInterpolationPoints( )
+    {
+        return numberOfAnglesInterpolationPoints_;
+    }
+
+    //Function to reset the settings for the interpolation of the Earth orientation angles
+    /*
+     * Function to reset the settings for the interpolation of the Earth orientation angles. If a time step is provided, the
+     * angles are lazily tabulated on a grid with this time step, and interpolated during propagation, instead of being
+     * computed directly at each evaluation (see TabulatedEarthOrientationAnglesCalculator).
+     * \param anglesInterpolationTimeStep Time step with which the Earth orientation angles are tabulated (NaN to compute
+     * the angles directly)
+     * \param numberOfAnglesInterpolationPoints Number of points used for the interpolation (must be even)
+     */
+    void resetAnglesInterpolationSettings( const double anglesInterpolationTimeStep,
+                                           const int numberOfAnglesInterpolationPoints = 8 )
+    {
+        anglesInterpolationTimeStep_ = anglesInterpolationTimeStep;
+        numberOfAnglesInterpolationPoints_ = numberOfAnglesInterpolationPoints;
+    }
+
 private:
 
     //Time scale in which input to the rotation model class is provided
@@ -352,6 +389,12 @@ private:
     //Settings for short-period polar motion variations
     std::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //Time step with which the Earth orientation angles are tabulated (NaN if not tabulated)
+    double anglesInterpolationTimeStep_;
+
+    //Number of points used for the interpolation of the Earth orientation angles
+    int numberOfAnglesInterpolationPoints_;
+
 };
 //#endif
 
@@ -1007,11 +1050,17 @@ inline std::shared_ptr< RotationModelSettings > spiceRotationModelSettings(
 //! @get_docstring(gcrsToItrsRotationModelSettings)
 inline std::shared_ptr< RotationModelSettings > gcrsToItrsRotationModelSettings(
         const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
-        const std::string baseFrameName = "GCRS" )
+        const std::string baseFrameName = "GCRS",
+        const double anglesInterpolationTimeStep = TUDAT_NAN,
+        const int numberOfAnglesInterpolationPoints = 8 )
 {
-    return std::make_shared< GcrsToItrsRotationModelSettings >(
+    std::shared_ptr< GcrsToItrsRotationModelSettings > rotationModelSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >(
                 nutationTheory, baseFrameName
                 );
+    rotationModelSettings->resetAnglesInterpolationSettings(
+                anglesInterpolationTimeStep, numberOfAnglesInterpolationPoints );
+    return rotationModelSettings;
 }
 
 //! @get_docstring(synchronousRotationModelSettings)
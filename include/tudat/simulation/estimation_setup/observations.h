@@ -11,6 +11,7 @@
 #ifndef TUDAT_OBSERVATIONS_H
 #define TUDAT_OBSERVATIONS_H
 
+#include <algorithm>
 #include <vector>
 
 #include <boost/bind.hpp>
@@ -34,6 +35,13 @@ namespace tudat
 namespace observation_models
 {
 
+//! Class storing a set of observations of a single observable type and set of link ends
+/*!
+ *  Class storing a set of observations of a single observable type and set of link ends. The observations are stored
+ *  contiguously (concatenated in a single vector), as are the observation dependent variables (one column per
+ *  observation), so that no separate memory allocation is required per observation, and the data can be used by the
+ *  estimation without copying.
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
 class SingleObservationSet
@@ -50,24 +58,71 @@ public:
             const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr ):
         observableType_( observableType ),
         linkEnds_( linkEnds ),
-        observations_( observations ),
         observationTimes_( observationTimes ),
         referenceLinkEnd_( referenceLinkEnd ),
-        observationsDependentVariables_( observationsDependentVariables ),
         dependentVariableCalculator_( dependentVariableCalculator ),
-        numberOfObservations_( observations_.size( ) )
+        numberOfObservations_( observations.size( ) ),
+        singleObservableSize_( observations.size( ) > 0 ? observations.at( 0 ).rows( ) : 0 )
     {
-        if( observations_.size( ) != observationTimes_.size( ) )
+        if( observations.size( ) != observationTimes_.size( ) )
         {
             throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." );
         }
 
-        for( unsigned int i = 1; i < observations.size( ); i++ )
+        // Concatenate observations
+        observationsVector_.resize( singleObservableSize_ * numberOfObservations_ );
+        for( unsigned int i = 0; i < observations.size( ); i++ )
         {
-            if( observations.at( i ).rows( ) != observations.at( i - 1 ).rows( ) )
+            if( observations.at( i ).rows( ) != singleObservableSize_ )
             {
                 throw std::runtime_error( "Error when making SingleObservationSet, input observables not of consistent size." );
             }
+            observationsVector_.segment( i * singleObservableSize_, singleObservableSize_ ) = observations.at( i );
+        }
+
+        setDependentVariables( observationsDependentVariables );
+    }
+
+    //! Constructor, taking the observations concatenated in a single vector
+    /*!
+     *  Constructor, taking the observations concatenated in a single vector (with the observables of each observation
+     *  stored consecutively), so that no separate vector needs to be created for each observation.
+     *  \param observableType Type of observable
+     *  \param linkEnds Link ends of observable
+     *  \param observationsVector Concatenated observations (of size observationTimes.size( ) times observable size)
+     *  \param observationTimes Times at which the observations are taken
+     *  \param referenceLinkEnd Link end at which observation times are defined
+     *  \param observationsDependentVariables Dependent variables, with one column per observation (empty if none)
+     *  \param dependentVariableCalculator Object used to compute the dependent variables
+     */
+    SingleObservationSet(
+            const ObservableType observableType,
+            const LinkEnds& linkEnds,
+            const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observationsVector,
+            const std::vector< TimeType >& observationTimes,
+            const LinkEndType referenceLinkEnd,
+            const Eigen::MatrixXd& observationsDependentVariables = Eigen::MatrixXd::Zero( 0, 0 ),
+            const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr ):
+        observableType_( observableType ),
+        linkEnds_( linkEnds ),
+        observationsVector_( observationsVector ),
+        observationTimes_( observationTimes ),
+        referenceLinkEnd_( referenceLinkEnd ),
+        observationsDependentVariables_( observationsDependentVariables ),
+        dependentVariableCalculator_( dependentVariableCalculator ),
+        numberOfObservations_( observationTimes.size( ) ),
+        singleObservableSize_( getObservableSize( observableType ) )
+    {
+        if( observationsVector_.rows( ) != singleObservableSize_ * numberOfObservations_ )
+        {
+            throw std::runtime_error( "Error when making SingleObservationSet, observation vector size is inconsistent with "
+                                      "number of observation times." );
+        }
+
+        if( observationsDependentVariables_.size( ) > 0 && observationsDependentVariables_.cols( ) != numberOfObservations_ )
+        {
+            throw std::runtime_error( "Error when making SingleObservationSet, dependent variable size is inconsistent with "
+                                      "number of observation times." );
         }
     }
 
@@ -83,10 +138,22 @@ public:
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservations( )
     {
-        return observations_;
+        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+        observations.reserve( numberOfObservations_ );
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            observations.push_back( getObservation( i ) );
+        }
+        return observations;
+    }
+
+    //! Function to retrieve a view on a single observation (without copying)
+    Eigen::VectorBlock< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservation( const int index ) const
+    {
+        return observationsVector_.segment( index * singleObservableSize_, singleObservableSize_ );
     }
 
-    std::vector< TimeType > getObservationTimes( )
+    const std::vector< TimeType >& getObservationTimes( ) const
     {
         return observationTimes_;
     }
@@ -101,37 +168,43 @@ public:
         return numberOfObservations_;
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationsVector( )
+    //! Function to retrieve the size of a single observable
+    int getSingleObservableSize( ) const
     {
-        int singleObservableSize = 0;
-        if( numberOfObservations_ != 0 )
-        {
-            singleObservableSize = observations_.at( 0 ).rows( );
-        }
+        return singleObservableSize_;
+    }
 
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero(
-                    singleObservableSize * numberOfObservations_ );
-        for( unsigned int i = 0; i < observations_.size( ); i++ )
-        {
-            observationsVector.segment( i * singleObservableSize, singleObservableSize ) =
-                    observations_.at( i );
-        }
-        return observationsVector;
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& getObservationsVector( ) const
+    {
+        return observationsVector_;
     }
 
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsHistory( )
     {
-        return utilities::createMapFromVectors< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
-                    observationTimes_, observations_ );
+        std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observationsHistory;
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            observationsHistory[ observationTimes_.at( i ) ] = getObservation( i );
+        }
+        return observationsHistory;
     }
 
-
     std::vector< Eigen::VectorXd > getObservationsDependentVariables( )
     {
-        return observationsDependentVariables_;
+        std::vector< Eigen::VectorXd > observationsDependentVariables;
+        observationsDependentVariables.reserve( observationsDependentVariables_.cols( ) );
+        for( int i = 0; i < observationsDependentVariables_.cols( ); i++ )
+        {
+            observationsDependentVariables.push_back( observationsDependentVariables_.col( i ) );
+        }
+        return observationsDependentVariables;
     }
 
+    //! Function to retrieve the dependent variables, with one column per observation (without copying)
+    const Eigen::MatrixXd& getObservationsDependentVariablesMatrix( ) const
+    {
+        return observationsDependentVariables_;
+    }
 
     std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > getDependentVariableCalculator( )
     {
@@ -140,33 +213,78 @@ public:
 
     std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
     {
-        return utilities::createMapFromVectors< TimeType, Eigen::VectorXd >(
-                    observationTimes_, observationsDependentVariables_ );
+        if( observationsDependentVariables_.cols( ) != numberOfObservations_ )
+        {
+            throw std::runtime_error( "Error when getting dependent variable history of observation set, no dependent "
+                                      "variables are stored for all observations." );
+        }
+
+        std::map< TimeType, Eigen::VectorXd > dependentVariableHistory;
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            dependentVariableHistory[ observationTimes_.at( i ) ] = observationsDependentVariables_.col( i );
+        }
+        return dependentVariableHistory;
     }
 
 
 
 private:
 
+    //! Function to set the dependent variables from a list (one entry per observation) into a single matrix
+    void setDependentVariables( const std::vector< Eigen::VectorXd >& observationsDependentVariables )
+    {
+        if( observationsDependentVariables.size( ) == 0 )
+        {
+            observationsDependentVariables_.resize( 0, 0 );
+            return;
+        }
+
+        observationsDependentVariables_.resize( observationsDependentVariables.at( 0 ).rows( ),
+                                                observationsDependentVariables.size( ) );
+        for( unsigned int i = 0; i < observationsDependentVariables.size( ); i++ )
+        {
+            if( observationsDependentVariables.at( i ).rows( ) != observationsDependentVariables_.rows( ) )
+            {
+                throw std::runtime_error( "Error when making SingleObservationSet, dependent variables not of consistent size." );
+            }
+            observationsDependentVariables_.col( i ) = observationsDependentVariables.at( i );
+        }
+    }
+
     const ObservableType observableType_;
 
     const LinkEnds linkEnds_;
 
-    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations_;
+    //! Concatenated observations, with the observables of each observation stored consecutively
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector_;
 
     const std::vector< TimeType > observationTimes_;
 
     const LinkEndType referenceLinkEnd_;
 
-    const std::vector< Eigen::VectorXd > observationsDependentVariables_;
+    //! Dependent variables, with one column per observation
+    Eigen::MatrixXd observationsDependentVariables_;
 
     const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator_;
 
     const int numberOfObservations_;
 
+    //! Size of a single observable
+    const int singleObservableSize_;
+
 };
 
 
+//! Class storing a collection of observations, of any number of observable types and link ends
+/*!
+ *  Class storing a collection of observations, of any number of observable types and link ends. In addition to the
+ *  list of observation sets, the collection stores all observations in a columnar format: contiguous vectors of
+ *  observables, times, link end ids and observable types, with one entry per observable (i.e. a three-dimensional
+ *  observable has three entries). The index ranges of each observable type, link ends and observation set in these
+ *  vectors are stored as well, so that the data can be used without copying (e.g. by taking a segment of the
+ *  concatenated vectors).
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
 class ObservationCollection
@@ -183,34 +301,38 @@ public:
         setConcatenatedObservationsAndTimes( );
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationVector( )
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& getObservationVector( ) const
     {
         return concatenatedObservations_;
     }
 
-    std::vector< TimeType > getConcatenatedTimeVector( )
+    const std::vector< TimeType >& getConcatenatedTimeVector( ) const
     {
         return concatenatedTimes_;
     }
 
-    std::vector< int > getConcatenatedLinkEndIds( )
+    const std::vector< int >& getConcatenatedLinkEndIds( ) const
     {
         return concatenatedLinkEndIds_;
     }
 
-    std::map< observation_models::LinkEnds, int > getLinkEndIdentifierMap( )
+    //! Function to retrieve the observable type of each entry of the concatenated observations
+    const std::vector< ObservableType >& getConcatenatedObservableTypes( ) const
     {
-        return linkEndIds_;
+        return concatenatedObservableTypes_;
     }
 
+    const std::map< observation_models::LinkEnds, int >& getLinkEndIdentifierMap( ) const
+    {
+        return linkEndIds_;
+    }
 
-
-    std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > > getObservationSetStartAndSize( )
+    const std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > >& getObservationSetStartAndSize( ) const
     {
         return observationSetStartAndSize_;
     }
 
-    std::map< ObservableType, std::pair< int, int > > getObservationTypeStartAndSize( )
+    const std::map< ObservableType, std::pair< int, int > >& getObservationTypeStartAndSize( ) const
     {
         return observationTypeStartAndSize_;
     }
@@ -220,7 +342,7 @@ public:
         return totalObservableSize_;
     }
 
-    SortedObservationSets getObservations( )
+    const SortedObservationSets& getObservations( ) const
     {
         return observationSetList_;
     }
@@ -232,65 +354,54 @@ public:
         return observationSetList_.at( observableType ).at( linkEnds );
     }
 
-    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getSingleLinkObservations(
+    //! Function to retrieve the start index and size of the observations of a single observable type and link ends
+    /*!
+     *  Function to retrieve the start index and size of the observations of a single observable type and link ends, in
+     *  the concatenated vectors of observations, times, link end ids and observable types.
+     *  \param observableType Observable type for which the indices are to be retrieved
+     *  \param linkEnds Link ends for which the indices are to be retrieved
+     *  \return Start index and size of the requested observations
+     */
+    std::pair< int, int > getSingleLinkStartAndSize(
             const ObservableType observableType,
-            const LinkEnds& linkEnds )
+            const LinkEnds& linkEnds ) const
     {
         if( observationSetStartAndSize_.count( observableType ) == 0 )
         {
             throw std::runtime_error( " Error when getting single link observations, not observations of type "
                                       + std::to_string( observableType ) );
         }
-        else
+        else if( observationSetStartAndSize_.at( observableType ).count( linkEnds ) == 0 )
         {
-            if( observationSetStartAndSize_.at( observableType ).count( linkEnds ) == 0 )
-            {
-                throw std::runtime_error( " Error when getting single link observations, not observations of type "
-                                          + std::to_string( observableType ) + " for given link ends." );
-            }
-            else
-            {
-                std::vector< std::pair< int, int > > combinedIndices =
-                        observationSetStartAndSize_.at( observableType ).at( linkEnds );
-                int startIndex = combinedIndices.at( 0 ).first;
-                int finalEntry = combinedIndices.size( ) - 1;
-
-                int numberOfObservables = ( combinedIndices.at( finalEntry ).first - startIndex ) +
-                        combinedIndices.at( finalEntry ).second;
-                return concatenatedObservations_.segment( startIndex, numberOfObservables );
-            }
+            throw std::runtime_error( " Error when getting single link observations, not observations of type "
+                                      + std::to_string( observableType ) + " for given link ends." );
         }
+
+        const std::vector< std::pair< int, int > >& combinedIndices =
+                observationSetStartAndSize_.at( observableType ).at( linkEnds );
+        int startIndex = combinedIndices.at( 0 ).first;
+        int finalEntry = combinedIndices.size( ) - 1;
+
+        int numberOfObservables = ( combinedIndices.at( finalEntry ).first - startIndex ) +
+                combinedIndices.at( finalEntry ).second;
+        return std::make_pair( startIndex, numberOfObservables );
+    }
+
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getSingleLinkObservations(
+            const ObservableType observableType,
+            const LinkEnds& linkEnds )
+    {
+        std::pair< int, int > startAndSize = getSingleLinkStartAndSize( observableType, linkEnds );
+        return concatenatedObservations_.segment( startAndSize.first, startAndSize.second );
     }
 
     std::vector< TimeType > getSingleLinkTimes(
             const ObservableType observableType,
             const LinkEnds& linkEnds )
     {
-        if( observationSetStartAndSize_.count( observableType ) == 0 )
-        {
-            throw std::runtime_error( " Error when getting single link observations, not observations of type "
-                                      + std::to_string( observableType ) );
-        }
-        else
-        {
-            if( observationSetStartAndSize_.at( observableType ).count( linkEnds ) == 0 )
-            {
-                throw std::runtime_error( " Error when getting single link observations, not observations of type "
-                                          + std::to_string( observableType ) + " for given link ends." );
-            }
-            else
-            {
-                std::vector< std::pair< int, int > > combinedIndices =
-                        observationSetStartAndSize_.at( observableType ).at( linkEnds );
-                int startIndex = combinedIndices.at( 0 ).first;
-                int finalEntry = combinedIndices.size( ) - 1;
-
-                int numberOfObservables = ( combinedIndices.at( finalEntry ).first - startIndex ) +
-                        combinedIndices.at( finalEntry ).second;
-                return std::vector< TimeType >( concatenatedTimes_.begin( ) + startIndex,
-                                                concatenatedTimes_.begin( ) + ( startIndex + numberOfObservables ) );
-            }
-        }
+        std::pair< int, int > startAndSize = getSingleLinkStartAndSize( observableType, linkEnds );
+        return std::vector< TimeType >( concatenatedTimes_.begin( ) + startAndSize.first,
+                                        concatenatedTimes_.begin( ) + ( startAndSize.first + startAndSize.second ) );
     }
 
     std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::vector< TimeType > > getSingleLinkObservationsAndTimes(
@@ -303,7 +414,13 @@ public:
 
     std::vector< LinkEnds > getConcatenatedLinkEndIdNames( )
     {
-        return concatenatedLinkEndIdNames_;
+        std::vector< LinkEnds > concatenatedLinkEndIdNames;
+        concatenatedLinkEndIdNames.reserve( concatenatedLinkEndIds_.size( ) );
+        for( unsigned int i = 0; i < concatenatedLinkEndIds_.size( ); i++ )
+        {
+            concatenatedLinkEndIdNames.push_back( linkEndIdNames_.at( concatenatedLinkEndIds_.at( i ) ) );
+        }
+        return concatenatedLinkEndIdNames;
     }
 
 
@@ -316,7 +433,7 @@ private:
         totalNumberOfObservables_ = 0;
         totalObservableSize_ = 0;
 
-        for( auto observationIterator : observationSetList_ )
+        for( auto& observationIterator : observationSetList_ )
         {
             ObservableType currentObservableType = observationIterator.first;
 
@@ -325,9 +442,9 @@ private:
 
             int currentObservableTypeSize = 0;
 
-            for( auto linkEndIterator : observationIterator.second )
+            for( auto& linkEndIterator : observationIterator.second )
             {
-                LinkEnds currentLinkEnds = linkEndIterator.first;
+                const LinkEnds& currentLinkEnds = linkEndIterator.first;
                 for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
                 {
                     int currentNumberOfObservables = linkEndIterator.second.at( i )->getNumberOfObservables( );
@@ -349,58 +466,65 @@ private:
 
     void setConcatenatedObservationsAndTimes( )
     {
-        concatenatedObservations_ = Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( totalObservableSize_ );
+        concatenatedObservations_.resize( totalObservableSize_ );
         concatenatedTimes_.resize( totalObservableSize_ );
         concatenatedLinkEndIds_.resize( totalObservableSize_ );
-        concatenatedLinkEndIdNames_.resize( totalObservableSize_ );
-
+        concatenatedObservableTypes_.resize( totalObservableSize_ );
 
-        int observationCounter = 0;
-        int maximumStationId = 0;
         int currentStationId;
-
-        for( auto observationIterator : observationSetList_ )
+        for( auto& observationIterator : observationSetList_ )
         {
             ObservableType currentObservableType = observationIterator.first;
             int observableSize = getObservableSize(  currentObservableType );
 
-            for( auto linkEndIterator : observationIterator.second )
+            for( auto& linkEndIterator : observationIterator.second )
             {
-                LinkEnds currentLinkEnds = linkEndIterator.first;
+                const LinkEnds& currentLinkEnds = linkEndIterator.first;
                 if( linkEndIds_.count( currentLinkEnds ) == 0 )
                 {
-                    linkEndIds_[ currentLinkEnds ] = maximumStationId;
-                    currentStationId = maximumStationId;
-                    maximumStationId++;
+                    currentStationId = linkEndIdNames_.size( );
+                    linkEndIds_[ currentLinkEnds ] = currentStationId;
+                    linkEndIdNames_.push_back( currentLinkEnds );
                 }
                 else
                 {
-                    currentStationId = linkEndIds_[ currentLinkEnds ];
+                    currentStationId = linkEndIds_.at( currentLinkEnds );
                 }
 
                 for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
                 {
                     std::pair< int, int > startAndSize =
                             observationSetStartAndSize_.at( currentObservableType ).at( currentLinkEnds ).at( i );
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > currentObservables =
-                            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( startAndSize.second );
-
-                    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > currentObservationSet =
-                            linkEndIterator.second.at( i )->getObservations( );
-                    std::vector< TimeType > currentObservationTimes =
-                            linkEndIterator.second.at( i )->getObservationTimes( );
-                    for( unsigned int j = 0; j < currentObservationSet.size( ); j++ )
+                    const std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > >& currentObservationSet =
+                            linkEndIterator.second.at( i );
+                    if( currentObservationSet->getNumberOfObservables( ) > 0 &&
+                            currentObservationSet->getSingleObservableSize( ) != observableSize )
+                    {
+                        throw std::runtime_error( "Error when creating observation collection, observable size of type " +
+                                                  std::to_string( currentObservableType ) + " is inconsistent." );
+                    }
+
+                    // Copy observations, which are already concatenated in observation set
+                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) =
+                            currentObservationSet->getObservationsVector( );
+
+                    // Set time, link end id and observable type of each observable
+                    const std::vector< TimeType >& currentObservationTimes = currentObservationSet->getObservationTimes( );
+                    int observationCounter = startAndSize.first;
+                    for( unsigned int j = 0; j < currentObservationTimes.size( ); j++ )
                     {
-                        currentObservables.segment( j * observableSize, observableSize ) = currentObservationSet.at( j );
                         for( int k = 0; k < observableSize; k++ )
                         {
-                            concatenatedTimes_[ observationCounter ] = currentObservationTimes.at( j );
-                            concatenatedLinkEndIds_[ observationCounter ] = currentStationId;
-                            concatenatedLinkEndIdNames_[ observationCounter ] = currentLinkEnds;
+                            concatenatedTimes_[ observationCounter ] = currentObservationTimes[ j ];
                             observationCounter++;
                         }
                     }
-                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) = currentObservables;
+                    std::fill( concatenatedLinkEndIds_.begin( ) + startAndSize.first,
+                               concatenatedLinkEndIds_.begin( ) + startAndSize.first + startAndSize.second,
+                               currentStationId );
+                    std::fill( concatenatedObservableTypes_.begin( ) + startAndSize.first,
+                               concatenatedObservableTypes_.begin( ) + startAndSize.first + startAndSize.second,
+                               currentObservableType );
                 }
             }
         }
@@ -414,10 +538,14 @@ private:
 
     std::vector< int > concatenatedLinkEndIds_;
 
-    std::vector< LinkEnds > concatenatedLinkEndIdNames_;
+    //! Observable type of each entry of the concatenated observations
+    std::vector< ObservableType > concatenatedObservableTypes_;
 
     std::map< observation_models::LinkEnds, int > linkEndIds_;
 
+    //! Link ends for each link end id (inverse of linkEndIds_)
+    std::vector< LinkEnds > linkEndIdNames_;
+
     std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > > observationSetStartAndSize_;
 
     std::map< ObservableType, std::pair< int, int > > observationTypeStartAndSize_;
@@ -12,9 +12,16 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
 
 #include <boost/make_shared.hpp>
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
 #include "tudat/astro/observation_models/observationManager.h"
@@ -355,75 +362,357 @@ public:
 //        return std::make_pair( numberOfObservations, totalNumberOfObservations );
 //    }
 
+    //! Function to retrieve the list of tasks into which the computation of observations and partials is split
+    /*!
+     *  Function to retrieve the list of tasks into which the computation of observations and partials is split, with
+     *  each task consisting of an observable type and a list of link ends. Observations (and partials) of different link
+     *  ends are computed by different objects, so that the tasks may be processed concurrently. For observable types for
+     *  which residuals are checked for discontinuities (see isResidualDiscontinuityCheckRequired), each residual depends
+     *  on the preceding residual of the same type, and all link ends of such a type may be grouped into a single task.
+     *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+     *  \param groupDiscontinuousObservables Boolean denoting whether all link ends of an observable type requiring a
+     *  residual discontinuity check are to be combined into a single task.
+     *  \return List of tasks (observable type and link ends)
+     */
+    std::vector< std::pair< observation_models::ObservableType, std::vector< observation_models::LinkEnds > > >
+    getObservationProcessingTasks(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const bool groupDiscontinuousObservables )
+    {
+        std::vector< std::pair< observation_models::ObservableType, std::vector< observation_models::LinkEnds > > > tasks;
+        for( const auto& observablesIterator : observationsCollection->getObservations( ) )
+        {
+            bool groupLinkEnds = groupDiscontinuousObservables &&
+                    observation_models::isResidualDiscontinuityCheckRequired( observablesIterator.first );
+            for( auto dataIterator = observablesIterator.second.begin( ); dataIterator != observablesIterator.second.end( );
+                 dataIterator++ )
+            {
+                if( !groupLinkEnds || dataIterator == observablesIterator.second.begin( ) )
+                {
+                    tasks.push_back( std::make_pair( observablesIterator.first, std::vector< observation_models::LinkEnds >( ) ) );
+                }
+                tasks.back( ).second.push_back( dataIterator->first );
+            }
+        }
+        return tasks;
+    }
+
+    //! Function to execute the observation processing tasks, concurrently if more than one thread is to be used
+    /*!
+     *  Function to execute the observation processing tasks, concurrently if more than one thread is to be used. In that
+     *  case, the bodies are set to protect their ephemeris states from concurrent access for the duration of the tasks.
+     *  \param numberOfTasks Number of tasks that are to be executed
+     *  \param processTask Function executing a single task, with the task index as input
+     *  \param numberOfThreads Number of threads over which the tasks are distributed (0 for all hardware threads)
+     */
+    void executeObservationTasks(
+            const unsigned int numberOfTasks,
+            const std::function< void( const unsigned int ) >& processTask,
+            const unsigned int numberOfThreads )
+    {
+        bool areTasksConcurrent = ( utilities::getNumberOfThreadsToUse( numberOfThreads, numberOfTasks ) > 1 );
+        if( areTasksConcurrent )
+        {
+            setAreEphemerisStatesRequestedConcurrently( bodies_, true );
+        }
+
+        try
+        {
+            utilities::executeInParallel( numberOfTasks, processTask, numberOfThreads );
+        }
+        catch( ... )
+        {
+            if( areTasksConcurrent )
+            {
+                setAreEphemerisStatesRequestedConcurrently( bodies_, false );
+            }
+            throw;
+        }
+
+        if( areTasksConcurrent )
+        {
+            setAreEphemerisStatesRequestedConcurrently( bodies_, false );
+        }
+    }
+
     //! Function to calculate the observation partials matrix and residuals
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
-     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  Partials and observations are calculated by the observationManagers_. The observations of different link ends may
+     *  be computed concurrently, in which case each task writes to its own rows of the residuals and partials. Residual
+     *  discontinuities are corrected afterwards, so that the results are independent of the number of threads.
+     *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
      *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
      *  observables w.r.t. parameter vector (return by reference).
+     *  \param numberOfThreads Number of threads over which the link ends are distributed (0 for all hardware threads)
      */
     void calculateObservationMatrixAndResiduals(
             const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
             const int parameterVectorSize, const int totalObservationSize,
-            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials  )
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials,
+            const unsigned int numberOfThreads = 1 )
     {
         // Initialize return data.
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
-        typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
+        const typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets&
                 sortedObservations = observationsCollection->getObservations( );
+        const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< std::pair< int, int > > > >&
+                observationSetStartAndSize = observationsCollection->getObservationSetStartAndSize( );
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& concatenatedObservations =
+                observationsCollection->getObservationVector( );
 
-        // Iterate over all observable types in observationsAndTimes
-        for( auto observablesIterator : sortedObservations )
-        {
-            observation_models::ObservableType currentObservableType = observablesIterator.first;
+        std::vector< std::pair< observation_models::ObservableType, std::vector< observation_models::LinkEnds > > > tasks =
+                getObservationProcessingTasks( observationsCollection, false );
 
-            // Iterate over all link ends for current observable type in observationsAndTimes
-            for( auto dataIterator : observablesIterator.second )
+        // Compute observations and partials for all link ends of a single task (written to disjoint rows of output)
+        std::function< void( const unsigned int ) > processTask = [ & ]( const unsigned int taskIndex )
+        {
+            observation_models::ObservableType currentObservableType = tasks.at( taskIndex ).first;
+            for( const observation_models::LinkEnds& currentLinkEnds : tasks.at( taskIndex ).second )
             {
-                observation_models::LinkEnds currentLinkEnds = dataIterator.first;
-                for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
+                const std::vector< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > >&
+                        currentObservationSets = sortedObservations.at( currentObservableType ).at( currentLinkEnds );
+                for( unsigned int i = 0; i < currentObservationSets.size( ); i++ )
                 {
-                    std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
-                            dataIterator.second.at( i );
-                    std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                    const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >& currentObservations =
+                            currentObservationSets.at( i );
+                    std::pair< int, int > observationIndices = observationSetStartAndSize.at(
                                 currentObservableType ).at( currentLinkEnds ).at( i );
 
                     // Compute estimated ranges and range partials from current parameter estimate.
                     std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                    observationsWithPartials = observationManagers_[ currentObservableType ]->
+                    observationsWithPartials = observationManagers_.at( currentObservableType )->
                             computeObservationsWithPartials(
                                 currentObservations->getObservationTimes( ), currentLinkEnds,
                                 currentObservations->getReferenceLinkEnd( ) );
 
                     // Compute residuals for current link ends and observabel type.
                     residualsAndPartials.first.segment( observationIndices.first, observationIndices.second ) =
-                            ( currentObservations->getObservationsVector( ) - observationsWithPartials.first ).template cast< double >( );
+                            ( concatenatedObservations.segment( observationIndices.first, observationIndices.second ) -
+                              observationsWithPartials.first ).template cast< double >( );
 
                     // Set current observation partials in matrix of all partials
                     residualsAndPartials.second.block( observationIndices.first, 0, observationIndices.second, parameterVectorSize ) =
                             observationsWithPartials.second;
-
                 }
-
             }
+        };
+        executeObservationTasks( tasks.size( ), processTask, numberOfThreads );
 
-            std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
-
+        // Correct residual discontinuities for each observable type
+        for( const auto& observableStartAndSize : observationsCollection->getObservationTypeStartAndSize( ) )
+        {
             observation_models::checkObservationResidualDiscontinuities(
-                        residualsAndPartials.first.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 ),
-                        currentObservableType );
+                        residualsAndPartials.first.block( observableStartAndSize.second.first, 0, observableStartAndSize.second.second, 1 ),
+                        observableStartAndSize.first );
         }
-
     }
 
 
 
+    //! Function to calculate the residuals, and accumulate the normal equations per block of observations
+    /*!
+     *  Function to calculate the residuals, and accumulate the (unnormalized) normal equations per block of observations,
+     *  based on the state transition matrix, sensitivity matrix and body states resulting from the previous numerical
+     *  integration iteration. The partials of at most maximumNumberOfObservationsPerBlock observation times are computed at
+     *  once, and their contribution to the normal equations is added directly, so that the full matrix of partials is
+     *  never stored. The values by which the columns of the partials would be normalized (see normalizeObservationMatrix)
+     *  are computed as well, so that the normal equations can be normalized afterwards. Each of the tasks defined by
+     *  getObservationProcessingTasks accumulates its contribution separately (concurrently, if multiple threads are used),
+     *  and these contributions are added to the total normal equations in task order once all tasks are finished, so that
+     *  the result does not depend on the number of threads. Note that this stores one normal matrix per task.
+     *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonals Diagonal of observation weights matrix
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param maximumNumberOfObservationsPerBlock Maximum number of observation times for which partials are computed at once
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference)
+     *  \param normalMatrix Unnormalized normal matrix H^T*W*H (return by reference)
+     *  \param normalRightHandSide Unnormalized right-hand side of normal equations H^T*W*r (return by reference)
+     *  \param transformationData Vector with scaling values for normalization of partials (return by reference)
+     *  \param partialsFileName Name of file to which the unnormalized partials are written (as row-major matrix of doubles,
+     *  one row per observable). No file is written if empty.
+     *  \param numberOfThreads Number of threads over which the tasks are distributed (0 for all hardware threads)
+     */
+    void accumulateNormalEquationsAndResiduals(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+            const Eigen::VectorXd& weightsMatrixDiagonals,
+            const int parameterVectorSize, const int totalObservationSize,
+            const int maximumNumberOfObservationsPerBlock,
+            Eigen::VectorXd& residuals,
+            Eigen::MatrixXd& normalMatrix,
+            Eigen::VectorXd& normalRightHandSide,
+            Eigen::VectorXd& transformationData,
+            const std::string& partialsFileName = "",
+            const unsigned int numberOfThreads = 1 )
+    {
+        // Initialize return data.
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+        normalMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+        normalRightHandSide = Eigen::VectorXd::Zero( parameterVectorSize );
+
+        Eigen::VectorXd columnMinimum = Eigen::VectorXd::Constant( parameterVectorSize, std::numeric_limits< double >::infinity( ) );
+        Eigen::VectorXd columnMaximum = Eigen::VectorXd::Constant( parameterVectorSize, -std::numeric_limits< double >::infinity( ) );
+
+        std::ofstream partialsFile;
+        if( partialsFileName != "" )
+        {
+            partialsFile.open( partialsFileName, std::ios::binary | std::ios::trunc );
+            if( !partialsFile )
+            {
+                throw std::runtime_error( "Error when accumulating normal equations, could not open partials file " + partialsFileName );
+            }
+        }
+
+        const typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets&
+                sortedObservations = observationsCollection->getObservations( );
+        const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, std::vector< std::pair< int, int > > > >&
+                observationSetStartAndSize = observationsCollection->getObservationSetStartAndSize( );
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& concatenatedObservations =
+                observationsCollection->getObservationVector( );
+
+        std::vector< std::pair< observation_models::ObservableType, std::vector< observation_models::LinkEnds > > > tasks =
+                getObservationProcessingTasks( observationsCollection, true );
+
+        // Each task accumulates its contribution separately, so that the total can be summed in task order
+        std::vector< Eigen::MatrixXd > taskNormalMatrices( tasks.size( ) );
+        std::vector< Eigen::VectorXd > taskNormalRightHandSides( tasks.size( ) );
+        std::vector< Eigen::VectorXd > taskColumnMinima( tasks.size( ) );
+        std::vector< Eigen::VectorXd > taskColumnMaxima( tasks.size( ) );
+        std::mutex partialsFileMutex;
+
+        // Compute residuals and normal equations contribution for all link ends of a single task
+        std::function< void( const unsigned int ) > processTask = [ & ]( const unsigned int taskIndex )
+        {
+            Eigen::MatrixXd& currentNormalMatrix = taskNormalMatrices[ taskIndex ];
+            Eigen::VectorXd& currentNormalRightHandSide = taskNormalRightHandSides[ taskIndex ];
+            Eigen::VectorXd& currentColumnMinimum = taskColumnMinima[ taskIndex ];
+            Eigen::VectorXd& currentColumnMaximum = taskColumnMaxima[ taskIndex ];
+            currentNormalMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+            currentNormalRightHandSide = Eigen::VectorXd::Zero( parameterVectorSize );
+            currentColumnMinimum = Eigen::VectorXd::Constant( parameterVectorSize, std::numeric_limits< double >::infinity( ) );
+            currentColumnMaximum = Eigen::VectorXd::Constant( parameterVectorSize, -std::numeric_limits< double >::infinity( ) );
+
+            std::vector< TimeType > blockTimes;
+            Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > rowMajorPartials;
+
+            observation_models::ObservableType currentObservableType = tasks.at( taskIndex ).first;
+            int observableSize = observation_models::getObservableSize( currentObservableType );
+            int observableTypeStartIndex = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType ).first;
+            bool checkResidualDiscontinuities = observation_models::isResidualDiscontinuityCheckRequired( currentObservableType );
+
+            // Iterate over all link ends of current task
+            for( const observation_models::LinkEnds& currentLinkEnds : tasks.at( taskIndex ).second )
+            {
+                const std::vector< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > >&
+                        currentObservationSets = sortedObservations.at( currentObservableType ).at( currentLinkEnds );
+                for( unsigned int i = 0; i < currentObservationSets.size( ); i++ )
+                {
+                    const std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >& currentObservations =
+                            currentObservationSets.at( i );
+                    const std::vector< TimeType >& currentObservationTimes = currentObservations->getObservationTimes( );
+                    int observationSetStartIndex = observationSetStartAndSize.at(
+                                currentObservableType ).at( currentLinkEnds ).at( i ).first;
+
+                    // Iterate over blocks of observations in current set
+                    for( unsigned int blockStart = 0; blockStart < currentObservationTimes.size( );
+                         blockStart += maximumNumberOfObservationsPerBlock )
+                    {
+                        unsigned int blockEnd = std::min( static_cast< unsigned int >( currentObservationTimes.size( ) ),
+                                                          blockStart + maximumNumberOfObservationsPerBlock );
+                        blockTimes.assign( currentObservationTimes.begin( ) + blockStart, currentObservationTimes.begin( ) + blockEnd );
+
+                        int blockStartIndex = observationSetStartIndex + blockStart * observableSize;
+                        int blockSize = ( blockEnd - blockStart ) * observableSize;
+
+                        // Compute estimated observations and partials for current block.
+                        std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                                observationManagers_.at( currentObservableType )->computeObservationsWithPartials(
+                                    blockTimes, currentLinkEnds, currentObservations->getReferenceLinkEnd( ) );
+
+                        residuals.segment( blockStartIndex, blockSize ) =
+                                ( concatenatedObservations.segment( blockStartIndex, blockSize ) -
+                                  observationsWithPartials.first ).template cast< double >( );
+
+                        // Correct residual discontinuities, including previous residual (if any) of same type (which is
+                        // part of the same task)
+                        if( checkResidualDiscontinuities )
+                        {
+                            int discontinuityCheckStartIndex = std::max( observableTypeStartIndex, blockStartIndex - 1 );
+                            observation_models::checkObservationResidualDiscontinuities(
+                                        residuals.block( discontinuityCheckStartIndex, 0,
+                                                         blockStartIndex + blockSize - discontinuityCheckStartIndex, 1 ),
+                                        currentObservableType );
+                        }
+
+                        // Add contribution of current block to normal equations
+                        linear_algebra::addObservationBlockToNormalEquations(
+                                    observationsWithPartials.second, residuals.segment( blockStartIndex, blockSize ),
+                                    weightsMatrixDiagonals.segment( blockStartIndex, blockSize ),
+                                    currentNormalMatrix, currentNormalRightHandSide );
+
+                        currentColumnMinimum = currentColumnMinimum.cwiseMin(
+                                    observationsWithPartials.second.colwise( ).minCoeff( ).transpose( ) );
+                        currentColumnMaximum = currentColumnMaximum.cwiseMax(
+                                    observationsWithPartials.second.colwise( ).maxCoeff( ).transpose( ) );
+
+                        if( partialsFile.is_open( ) )
+                        {
+                            rowMajorPartials = observationsWithPartials.second;
+                            std::lock_guard< std::mutex > fileLock( partialsFileMutex );
+                            partialsFile.seekp( static_cast< std::streamoff >( blockStartIndex ) * parameterVectorSize * sizeof( double ) );
+                            partialsFile.write( reinterpret_cast< const char* >( rowMajorPartials.data( ) ),
+                                                static_cast< std::streamsize >( blockSize ) * parameterVectorSize * sizeof( double ) );
+                        }
+                    }
+                }
+            }
+        };
+        executeObservationTasks( tasks.size( ), processTask, numberOfThreads );
+
+        // Add contributions of all tasks to total, in task order, so that the result is independent of the number of
+        // threads
+        for( unsigned int i = 0; i < tasks.size( ); i++ )
+        {
+            normalMatrix += taskNormalMatrices.at( i );
+            normalRightHandSide += taskNormalRightHandSides.at( i );
+            columnMinimum = columnMinimum.cwiseMin( taskColumnMinima.at( i ) );
+            columnMaximum = columnMaximum.cwiseMax( taskColumnMaxima.at( i ) );
+        }
+
+        if( partialsFile.is_open( ) )
+        {
+            partialsFile.close( );
+            if( !partialsFile )
+            {
+                throw std::runtime_error( "Error when accumulating normal equations, could not write partials file " + partialsFileName );
+            }
+        }
+
+        // Compute normalization terms, identical to those computed by normalizeObservationMatrix
+        transformationData = Eigen::VectorXd( parameterVectorSize );
+        for( int i = 0; i < parameterVectorSize; i++ )
+        {
+            if( std::fabs( columnMinimum( i ) ) > columnMaximum( i ) )
+            {
+                transformationData( i ) = columnMinimum( i );
+            }
+            else
+            {
+                transformationData( i ) = columnMaximum( i );
+            }
+            if( transformationData( i ) == 0.0 || !std::isfinite( transformationData( i ) ) )
+            {
+                transformationData( i ) = 1.0;
+            }
+        }
+    }
+
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
      * Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
@@ -513,7 +802,10 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        bool accumulateNormalEquations = podInput->getAccumulateNormalEquations( );
+        Eigen::MatrixXd bestInformationMatrix = accumulateNormalEquations ?
+                    Eigen::MatrixXd::Zero( 0, parameterVectorSize ) :
+                    Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
 
@@ -594,12 +886,39 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationCollection( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
+            Eigen::VectorXd transformationData;
+            Eigen::MatrixXd normalizedNormalMatrix;
+            Eigen::VectorXd normalizedNormalRightHandSide;
+            std::string currentPartialsFileName = "";
+            if( accumulateNormalEquations )
+            {
+                if( podInput->getPartialsFileName( ) != "" )
+                {
+                    currentPartialsFileName = podInput->getPartialsFileName( ) + ".current";
+                }
+
+                accumulateNormalEquationsAndResiduals(
+                            podInput->getObservationCollection( ), podInput->getWeightsMatrixDiagonals( ),
+                            parameterVectorSize, totalNumberOfObservations, podInput->getMaximumNumberOfObservationsPerBlock( ),
+                            residualsAndPartials.first, normalizedNormalMatrix, normalizedNormalRightHandSide,
+                            transformationData, currentPartialsFileName, podInput->getNumberOfThreads( ) );
+
+                // Normalize normal equations, equivalent to normalizing columns of partials
+                Eigen::VectorXd inverseTransformationData = transformationData.cwiseInverse( );
+                normalizedNormalMatrix = inverseTransformationData.asDiagonal( ) * normalizedNormalMatrix *
+                        inverseTransformationData.asDiagonal( );
+                normalizedNormalRightHandSide = normalizedNormalRightHandSide.cwiseProduct( inverseTransformationData );
+            }
+            else
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationCollection( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials,
+                            podInput->getNumberOfThreads( ) );
 
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -621,11 +940,23 @@ public:
                 Eigen::MatrixXd constraintStateMultiplier;
                 Eigen::VectorXd constraintRightHandSide;
                 parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
-                leastSquaresOutput =
-                        std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                                       residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                                       residualsAndPartials.first, podInput->getWeightsMatrixDiagonals( ),
-                                       normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                if( accumulateNormalEquations )
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalizedNormalMatrix + normalizedInverseAprioriCovarianceMatrix,
+                                           normalizedNormalRightHandSide, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide,
+                                           podInput->getNormalEquationsSolverType( ) ) );
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                                           residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                                           residualsAndPartials.first, podInput->getWeightsMatrixDiagonals( ),
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide,
+                                           podInput->getNormalEquationsSolverType( ) ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -686,10 +1017,19 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = std::move( oldParameterEstimate );
                 bestResiduals = std::move( residualsAndPartials.first );
-                if( podInput->getSaveInformationMatrix( ) )
+                if( podInput->getSaveInformationMatrix( ) && !accumulateNormalEquations )
                 {
                     bestInformationMatrix = std::move( residualsAndPartials.second );
                 }
+                else if( currentPartialsFileName != "" )
+                {
+                    // Remove file of previous best iteration, since std::rename does not replace existing files on all systems
+                    std::remove( podInput->getPartialsFileName( ).c_str( ) );
+                    if( std::rename( currentPartialsFileName.c_str( ), podInput->getPartialsFileName( ).c_str( ) ) != 0 )
+                    {
+                        throw std::runtime_error( "Error when saving partials file of best iteration to " + podInput->getPartialsFileName( ) );
+                    }
+                }
                 bestWeightsMatrixDiagonal = std::move( podInput->getWeightsMatrixDiagonals( ) );
                 bestTransformationData = std::move( transformationData );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
@@ -714,6 +1054,12 @@ public:
                     bestInverseNormalizedCovarianceMatrix, bestResidual, residualHistory, parameterHistory, exceptionDuringInversion,
                     exceptionDuringPropagation );
 
+        if( accumulateNormalEquations && podInput->getPartialsFileName( ) != "" )
+        {
+            std::remove( ( podInput->getPartialsFileName( ) + ".current" ).c_str( ) );
+            podOutput->setPartialsFileName( podInput->getPartialsFileName( ) );
+        }
+
         if( podInput->getSaveStateHistoryForEachIteration( ) )
         {
             podOutput->setStateHistories(
@@ -867,6 +1213,7 @@ protected:
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
             const bool propagateOnCreation = true )
     {
+        bodies_ = bodies;
         propagators::toggleIntegratedResultSettings< ObservationScalarType, TimeType >( propagatorSettings );
         using namespace numerical_integrators;
         using namespace orbit_determination;
@@ -956,6 +1303,9 @@ protected:
 
     }
 
+    //! Map of body objects with names of bodies, storing all environment models used in simulation.
+    SystemOfBodies bodies_;
+
     //! Boolean to denote whether any dynamical parameters are estimated
     bool integrateAndEstimateOrbit_;
 
@@ -317,7 +317,10 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
         const TimeType startTime = TimeType( 1.0E7 ),
         const int numberOfDaysOfData = 3,
         const int numberOfIterations = 5,
-        const bool useFullParameterSet = true )
+        const bool useFullParameterSet = true,
+        const bool accumulateNormalEquations = false,
+        const std::string& partialsFileName = "",
+        const unsigned int numberOfThreads = 1 )
 {
 
     //Load spice kernels.
@@ -604,6 +607,11 @@ Eigen::VectorXd executeEarthOrbiterParameterEstimation(
 
     podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     podInput->defineEstimationSettings( true, true, true, true, false );
+    if( accumulateNormalEquations )
+    {
+        podInput->defineNormalEquationsAccumulationSettings( true, 100, partialsFileName );
+    }
+    podInput->setNumberOfThreads( numberOfThreads );
 
     // Perform estimation
     std::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
@@ -622,7 +630,10 @@ extern template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double,
         const double startTime,
         const int numberOfDaysOfData,
         const int numberOfIterations,
-        const bool useFullParameterSet );
+        const bool useFullParameterSet,
+        const bool accumulateNormalEquations,
+        const std::string& partialsFileName,
+        const unsigned int numberOfThreads );
 
 
 
@@ -17,6 +17,7 @@
 #include <boost/tuple/tuple_io.hpp>
 
 #include "tudat/basics/utilities.h"
+#include "tudat/basics/parallelExecution.h"
 
 #include "tudat/astro/basic_astro/accelerationModel.h"
 #include "tudat/math/interpolators/interpolator.h"
@@ -1126,13 +1127,19 @@ public:
      *  end of this contructor (default false).
      *  \param resetMultiArcDynamicsAfterPropagation Boolean denoting whether to reset the multi-arc dynamics after
      *  propagation (default true).
+     *  \param arcWiseBodies List of environments (one per arc) in which the dynamics and variational equations of each arc
+     *  are to be evaluated. If empty (default), the bodies input is used for all arcs. If the environments are independent
+     *  (see areEnvironmentsIndependent), the arcs may be propagated concurrently (see MultiArcPropagatorSettings::resetNumberOfThreads). Since the
+     *  estimated parameter objects only modify the environment for which they were created, only initial state parameters
+     *  may be estimated when arc-wise environments are provided (an exception is thrown otherwise).
      */
-
     MultiArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
-            const bool integrateEquationsOnCreation = false ):
+            const bool integrateEquationsOnCreation = false,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodies, parametersToEstimate, propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false  ),
@@ -1147,13 +1154,22 @@ public:
         checkMultiArcPropagatorSettingsAndParameterEstimationConsistency(
                     propagatorSettings_, parametersToEstimate );
 
+        // Parameter objects reset only the environment for which they were created, which would leave the arc-wise
+        // environments at their initial parameter values
+        if( arcWiseBodies.size( ) > 0 && ( parametersToEstimate->getEstimatedDoubleParameters( ).size( ) > 0 ||
+                                           parametersToEstimate->getEstimatedVectorParameters( ).size( ) > 0 ) )
+        {
+            throw std::runtime_error( "Error when making multi-arc variational equations solver, only initial state "
+                                      "parameters can be estimated when using arc-wise environments" );
+        }
+
         parameterVectorSize_ = estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate );
 
         stateTransitionMatrixSize_ -= ( parametersToEstimate->getParameterSetSize( ) -
                                         estimatable_parameters::getSingleArcParameterSetSize( parametersToEstimate ) );
 
         dynamicsSimulator_ =  std::make_shared< MultiArcDynamicsSimulator< StateScalarType, TimeType > >(
-                    bodies, propagatorSettings, false );
+                    bodies, propagatorSettings, false, arcWiseBodies );
 
 
         std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
@@ -1165,7 +1181,8 @@ public:
             // Create variational equations objects.
             std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
                     simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodies, parametersToEstimate );
+                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ),
+                        singleArcDynamicsSimulators.at( i )->getSystemOfBodies( ), parametersToEstimate );
             std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
                     std::make_shared< VariationalEquations >(
                         stateDerivativePartials, parametersToEstimate_, dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ),
@@ -1314,8 +1331,6 @@ public:
         if( integrateEquationsConcurrently )
         {
             // Allocate maps that stored numerical solution for equations of motion
-            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
-                    currentEquationsOfMotionNumericalSolutionsRaw;
             std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
                     equationsOfMotionNumericalSolutions;
             std::vector< std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > >
@@ -1326,89 +1341,57 @@ public:
 
             dependentVariableHistorySolutions.resize( numberOfArcs_ );
             cumulativeComputationTimeHistorySolutions.resize( numberOfArcs_ );
+            arcInitialStates.resize( numberOfArcs_ );
 
-            // Integrate equations for all arcs.
+            // Split arcs into sequences; each sequence starts with an arc for which the initial state is defined. If
+            // initial state is NaN, this signals that the initial state is to be taken from previous arc
+            std::vector< unsigned int > arcSequenceStartIndices;
             for( int i = 0; i < numberOfArcs_; i++ )
             {
-                // Retrieve integrator settings, and ensure correct initial time.
-                std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
-                        singleArcDynamicsSimulators.at( i )->getIntegratorSettings( );
-
-                // Set state derivative model to propagate both variational equations and equations of motion
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->setPropagationSettings(
-                            std::vector< IntegratedStateType >( ), 1, 1 );
-
-
-                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
-                // previous arc
-                VectorType currentArcInitialState;
-
                 if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
                 {
-                    currentArcInitialState = initialStateEstimate.at( i );
+                    arcSequenceStartIndices.push_back( i );
                 }
                 else
                 {
-                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                                equationsOfMotionNumericalSolutions.at( i - 1 ),
-                                singleArcDynamicsSimulators.at( i )->getInitialPropagationTime( ) );
                     updateInitialStates = true;
                 }
-                arcInitialStates.push_back( currentArcInitialState );
-
-                // Update state derivative model to (possible) update in state.
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->
-                        updateStateDerivativeModelSettings( currentArcInitialState );
-
-                // Create initial state for combined variational/equations of motion.
-                MatrixType initialVariationalState = this->createInitialConditions(
-                            currentArcInitialState );
-
-
-                // Integrate variational and state equations.
-                dynamicsSimulator_->getDynamicsStateDerivative( ).at( i )->resetFunctionEvaluationCounter( );
-
-                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( i )->printPrePropagationMessages( );
-                simulation_setup::setAreBodiesInPropagation( bodies_, true );
-
-                std::map< TimeType, MatrixType > rawNumericalSolution;
-                std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason =
-                        EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
-                            singleArcDynamicsSimulators.at( i )->getStateDerivativeFunction( ),
-                            rawNumericalSolution,
-                            initialVariationalState,
-                            singleArcDynamicsSimulators.at( i )->getInitialPropagationTime( ),
-                            integratorSettings,
-                            singleArcDynamicsSimulators.at( i )->getPropagationTerminationCondition( ),
-                            dependentVariableHistorySolutions.at( i ),
-                            cumulativeComputationTimeHistorySolutions.at( i ),
-                            singleArcDynamicsSimulators.at( i )->getDependentVariablesFunctions( ),
-                            std::bind(
-                                &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
-                                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
-                dynamicsSimulator_->setPropagationTerminationReason( propagationTerminationReason, i );
-
-                simulation_setup::setAreBodiesInPropagation( bodies_, false );
-                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( i )->printPostPropagationMessages( );
-
-                // Extract solution of equations of motion.
-                utilities::createVectorBlockMatrixHistory(
-                            rawNumericalSolution, currentEquationsOfMotionNumericalSolutionsRaw,
-                            std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
-
+            }
+            arcSequenceStartIndices.push_back( numberOfArcs_ );
 
-                // Transform equations of motion solution to output formulation
-                convertNumericalStateSolutionsToOutputSolutions(
-                            equationsOfMotionNumericalSolutions[ i ], currentEquationsOfMotionNumericalSolutionsRaw,
-                            dynamicsStateDerivatives_.at( i ) );
+            // Define function to integrate equations for a single sequence of arcs
+            std::function< void( const unsigned int ) > integrateArcSequence = [ & ]( const unsigned int sequenceIndex )
+            {
+                for( unsigned int i = arcSequenceStartIndices.at( sequenceIndex );
+                     i < arcSequenceStartIndices.at( sequenceIndex + 1 ); i++ )
+                {
+                    // Get arc initial state.
+                    if( i == arcSequenceStartIndices.at( sequenceIndex ) )
+                    {
+                        arcInitialStates[ i ] = initialStateEstimate.at( i );
+                    }
+                    else
+                    {
+                        arcInitialStates[ i ] = getArcInitialStateFromPreviousArcResult(
+                                    equationsOfMotionNumericalSolutions.at( i - 1 ),
+                                    singleArcDynamicsSimulators.at( i )->getInitialPropagationTime( ) );
+                    }
 
-                // Save state transition and sensitivity matrix solutions for current arc.
-                setVariationalEquationsSolution(
-                            rawNumericalSolution, variationalEquationsSolution_[ i ],
-                            std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                            stateTransitionMatrixSize_, parameterVectorSize_ );
+                    integrateSingleArcVariationalAndDynamicalEquations(
+                                i, arcInitialStates[ i ], equationsOfMotionNumericalSolutions[ i ],
+                                dependentVariableHistorySolutions[ i ], cumulativeComputationTimeHistorySolutions[ i ] );
+                }
+            };
 
+            // Integrate equations for all arcs.
+            unsigned int numberOfThreads = propagatorSettings_->getNumberOfThreads( );
+            if( numberOfThreads != 1 && !dynamicsSimulator_->getAreArcEnvironmentsIndependent( ) )
+            {
+                throw std::runtime_error( "Error in multi-arc variational equations propagation, arcs can only be propagated "
+                                          "concurrently if each arc uses its own environment, without Body objects or "
+                                          "stateful environment models shared between arcs (see areEnvironmentsIndependent)." );
             }
+            utilities::executeInParallel( arcSequenceStartIndices.size( ) - 1, integrateArcSequence, numberOfThreads );
 
             // Process numerical solution of equations of motion
             dynamicsSimulator_->manuallySetAndProcessRawNumericalEquationsOfMotionSolution(
@@ -1593,6 +1576,82 @@ protected:
 
 private:
 
+    //! Function to integrate variational equations and equations of motion for a single arc.
+    /*!
+     *  Function to integrate variational equations and equations of motion for a single arc, and store the variational
+     *  equations solution of the arc. This function modifies only data associated with the given arc, and may be called
+     *  concurrently for different arcs, provided that the arcs' environments are independent.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of the equations of motion for the arc
+     *  \param equationsOfMotionNumericalSolution Numerical solution of the equations of motion, in output formulation
+     *  (returned by reference)
+     *  \param dependentVariableHistorySolution Dependent variable history of the arc (returned by reference)
+     *  \param cumulativeComputationTimeHistorySolution Cumulative computation time history of the arc (returned by reference)
+     */
+    void integrateSingleArcVariationalAndDynamicalEquations(
+            const unsigned int arcIndex,
+            const VectorType& arcInitialState,
+            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+            std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > >& dependentVariableHistorySolution,
+            std::map< TimeType, double >& cumulativeComputationTimeHistorySolution )
+    {
+        std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > singleArcDynamicsSimulator =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( arcIndex );
+
+        // Set state derivative model to propagate both variational equations and equations of motion
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->setPropagationSettings(
+                    std::vector< IntegratedStateType >( ), 1, 1 );
+
+        // Update state derivative model to (possible) update in state.
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->updateStateDerivativeModelSettings( arcInitialState );
+
+        // Create initial state for combined variational/equations of motion.
+        MatrixType initialVariationalState = this->createInitialConditions( arcInitialState );
+
+        // Integrate variational and state equations.
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->resetFunctionEvaluationCounter( );
+
+        singleArcDynamicsSimulator->printPrePropagationMessages( );
+        simulation_setup::setAreBodiesInPropagation( singleArcDynamicsSimulator->getSystemOfBodies( ), true );
+
+        std::map< TimeType, MatrixType > rawNumericalSolution;
+        std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason =
+                EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
+                    singleArcDynamicsSimulator->getStateDerivativeFunction( ),
+                    rawNumericalSolution,
+                    initialVariationalState,
+                    singleArcDynamicsSimulator->getInitialPropagationTime( ),
+                    singleArcDynamicsSimulator->getIntegratorSettings( ),
+                    singleArcDynamicsSimulator->getPropagationTerminationCondition( ),
+                    dependentVariableHistorySolution,
+                    cumulativeComputationTimeHistorySolution,
+                    singleArcDynamicsSimulator->getDependentVariablesFunctions( ),
+                    std::bind(
+                        &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
+                        singleArcDynamicsSimulator->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
+        dynamicsSimulator_->setPropagationTerminationReason( propagationTerminationReason, arcIndex );
+
+        simulation_setup::setAreBodiesInPropagation( singleArcDynamicsSimulator->getSystemOfBodies( ), false );
+        singleArcDynamicsSimulator->printPostPropagationMessages( );
+
+        // Extract solution of equations of motion.
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw;
+        utilities::createVectorBlockMatrixHistory(
+                    rawNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+
+        // Transform equations of motion solution to output formulation
+        convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    dynamicsStateDerivatives_.at( arcIndex ) );
+
+        // Save state transition and sensitivity matrix solutions for current arc.
+        setVariationalEquationsSolution(
+                    rawNumericalSolution, variationalEquationsSolution_[ arcIndex ],
+                    std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+    }
+
     //! Reset solutions of variational equations.
     /*!
      *  Reset solutions of variational equations (stateTransitionMatrixInterpolator_ and sensitivityMatrixInterpolator_) for each
@@ -1725,19 +1784,38 @@ public:
     using VariationalEquationsSolver< StateScalarType, TimeType >::parameterVectorSize_;
     using VariationalEquationsSolver< StateScalarType, TimeType >::stateTransitionInterface_;
 
+    //! Constructor
+    /*!
+     *  Constructor, sets up object for automatic evaluation and numerical integration of variational equations and equations of motion.
+     *  \param bodies Map of bodies (with names) of all bodies in integration.
+     *  \param propagatorSettings Settings for propagator.
+     *  \param parametersToEstimate Object containing all parameters that are to be estimated and their current settings and values.
+     *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
+     *  end of this contructor.
+     *  \param integrateDynamicalAndVariationalEquationsConcurrently Boolean defining whether variational and dynamical
+     *  equations are to be propagated concurrently (if true) or sequentially (of false)
+     *  \param arcWiseBodies List of environments (one per arc) in which the dynamics and variational equations of each
+     *  multi-arc are to be evaluated. If empty (default), the bodies input is used for all arcs. The multi-arc settings must be
+     *  created in these environments, and the single-arc settings must be created from acceleration settings, so that
+     *  they can be recreated for each arc. If the environments are independent (see areEnvironmentsIndependent), the arcs
+     *  may be propagated concurrently (see MultiArcPropagatorSettings::resetNumberOfThreads). Only initial state parameters may be estimated
+     *  when arc-wise environments are provided (an exception is thrown otherwise).
+     */
     HybridArcVariationalEquationsSolver(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< HybridArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > parametersToEstimate,
             const bool integrateEquationsOnCreation = false,
-            const bool integrateDynamicalAndVariationalEquationsConcurrently = true ):
+            const bool integrateDynamicalAndVariationalEquationsConcurrently = true,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodies, parametersToEstimate, propagatorSettings != nullptr ?
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false  )
     {
 //        propagatorSettings->getOutputSettingsWithCheck( )->setIntegratedResult( false );
         initializeHybridArcVariationalEquationsSolver(
-                    bodies, propagatorSettings, true, integrateEquationsOnCreation );
+                    bodies, propagatorSettings, true, integrateEquationsOnCreation, arcWiseBodies );
     }
 
     //! Constructor
@@ -1788,7 +1866,9 @@ public:
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< PropagatorSettings< StateScalarType > > propagatorSettings,
             const bool integrateDynamicalAndVariationalEquationsConcurrently,
-            const bool integrateEquationsOnCreation )
+            const bool integrateEquationsOnCreation,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) )
     {
 
         // Cast propagator settings to correct type and check validity
@@ -1816,7 +1896,9 @@ public:
                 getExtendedMultiPropagatorSettings(
                     originalPopagatorSettings_->getSingleArcPropagatorSettings( ),
                     originalPopagatorSettings_->getMultiArcPropagatorSettings( ),
-                    numberOfArcs );
+                    numberOfArcs, arcWiseBodies );
+        extendedMultiArcSettings->resetNumberOfThreads(
+                    originalPopagatorSettings_->getMultiArcPropagatorSettings( )->getNumberOfThreads( ) );
 
         multiArcDynamicsSize_ = extendedMultiArcSettings->getConventionalStateSize( );
         multiArcDynamicsSingleArcSize_ = extendedMultiArcSettings->getConventionalStateSize( ) / numberOfArcs;
@@ -1832,7 +1914,7 @@ public:
 
         originalMultiArcSolver_ = std::make_shared< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, originalPopagatorSettings_->getMultiArcPropagatorSettings( ),
-                    originalMultiArcParametersToEstimate_, false );
+                    originalMultiArcParametersToEstimate_, false, arcWiseBodies );
 
         // Create variational equations solvers for single- and multi-arc
         singleArcSolver_ = std::make_shared< SingleArcVariationalEquationsSolver< StateScalarType, TimeType > >(
@@ -1840,7 +1922,7 @@ public:
                     singleArcParametersToEstimate_, false );
         multiArcSolver_ = std::make_shared< MultiArcVariationalEquationsSolver< StateScalarType, TimeType > >(
                     bodies, extendedMultiArcSettings,
-                    multiArcParametersToEstimate_, false );
+                    multiArcParametersToEstimate_, false, arcWiseBodies );
 
         for( unsigned int i = 0; i < multiArcSolver_->getDynamicsStateDerivatives( ).size( ); i++ )
         {
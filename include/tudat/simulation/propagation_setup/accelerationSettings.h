@@ -100,11 +100,15 @@ public:
      *  Constructor to set maximum degree and order that is to be taken into account.
      *  \param maximumDegree Maximum degree
      *  \param maximumOrder Maximum order
+     *  \param formulation Formulation that is to be used to evaluate the gravity field (spherical coordinates by default,
+     *  Pines formulation is singularity-free and faster at high degree)
      */
     SphericalHarmonicAccelerationSettings( const int maximumDegree,
-                                           const int maximumOrder ):
+                                           const int maximumOrder,
+                                           const gravitation::SphericalHarmonicsGravityFormulation formulation =
+            gravitation::spherical_coordinates_formulation ):
         AccelerationSettings( basic_astrodynamics::spherical_harmonic_gravity ),
-        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ){ }
+        maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ), formulation_( formulation ){ }
 
 
     // Maximum degree that is to be used for spherical harmonic acceleration
@@ -112,13 +116,18 @@ public:
 
     // Maximum order that is to be used for spherical harmonic acceleration
     int maximumOrder_;
+
+    // Formulation that is to be used to evaluate the gravity field
+    gravitation::SphericalHarmonicsGravityFormulation formulation_;
 };
 
 //! @get_docstring(sphericalHarmonicAcceleration)
 inline std::shared_ptr< AccelerationSettings > sphericalHarmonicAcceleration(
-        const int maximumDegree, const int maximumOrder )
+        const int maximumDegree, const int maximumOrder,
+        const gravitation::SphericalHarmonicsGravityFormulation formulation =
+        gravitation::spherical_coordinates_formulation )
 {
-    return std::make_shared< SphericalHarmonicAccelerationSettings >( maximumDegree, maximumOrder );
+    return std::make_shared< SphericalHarmonicAccelerationSettings >( maximumDegree, maximumOrder, formulation );
 }
 
 // Class for providing acceleration settings for mutual spherical harmonics acceleration model.
@@ -195,9 +204,49 @@ inline std::shared_ptr< AccelerationSettings > mutualSphericalHarmonicAccelerati
 			);
 }
 
-inline std::shared_ptr< AccelerationSettings > polyhedronAcceleration( )
+// Class for providing settings for polyhedron acceleration model.
+/*
+ *  Class for providing settings for polyhedron acceleration model, specifically the (optional) spherical harmonic
+ *  expansion of the polyhedron that is to be used to compute the far field, and the number of threads used to evaluate
+ *  the polyhedron model.
+ */
+class PolyhedronAccelerationSettings: public AccelerationSettings
+{
+public:
+    // Constructor to set far-field expansion and number of threads.
+    /*
+     *  Constructor to set far-field expansion and number of threads.
+     *  \param farFieldMaximumDegree Maximum degree of the spherical harmonic expansion that is used beyond the far-field
+     *  switch radius (no expansion is used if negative).
+     *  \param farFieldSwitchRadiusRatio Ratio of the far-field switch radius to the radius of the Brillouin sphere of the
+     *  polyhedron (must be larger than 1).
+     *  \param numberOfThreads Number of threads used to evaluate the polyhedron model (0 to use all available hardware
+     *  threads). Only beneficial for polyhedra with a large number of facets.
+     */
+    PolyhedronAccelerationSettings( const int farFieldMaximumDegree = -1,
+                                    const double farFieldSwitchRadiusRatio = 2.0,
+                                    const unsigned int numberOfThreads = 1 ):
+        AccelerationSettings( basic_astrodynamics::polyhedron_gravity ),
+        farFieldMaximumDegree_( farFieldMaximumDegree ), farFieldSwitchRadiusRatio_( farFieldSwitchRadiusRatio ),
+        numberOfThreads_( numberOfThreads ){ }
+
+    // Maximum degree of the far-field spherical harmonic expansion (no expansion is used if negative)
+    int farFieldMaximumDegree_;
+
+    // Ratio of the far-field switch radius to the radius of the Brillouin sphere of the polyhedron
+    double farFieldSwitchRadiusRatio_;
+
+    // Number of threads used to evaluate the polyhedron model
+    unsigned int numberOfThreads_;
+};
+
+inline std::shared_ptr< AccelerationSettings > polyhedronAcceleration(
+        const int farFieldMaximumDegree = -1,
+        const double farFieldSwitchRadiusRatio = 2.0,
+        const unsigned int numberOfThreads = 1 )
 {
-    return std::make_shared< AccelerationSettings >( basic_astrodynamics::polyhedron_gravity );
+    return std::make_shared< PolyhedronAccelerationSettings >(
+                farFieldMaximumDegree, farFieldSwitchRadiusRatio, numberOfThreads );
 }
 
 // Class to provide settings for typical relativistic corrections to the dynamics of an orbiter.
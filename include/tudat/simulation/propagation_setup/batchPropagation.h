@@ -0,0 +1,287 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BATCHPROPAGATION_H
+#define TUDAT_BATCHPROPAGATION_H
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/environment_setup/cloneBodies.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/propagationSettings.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Set of independent simulation objects, used by a single worker of a batch propagation.
+/*!
+ *  Set of independent simulation objects, used by a single worker of a batch propagation (see SingleArcBatchPropagator).
+ *  The bodies and propagator settings of one worker must not share any mutable object (environment models, acceleration
+ *  models, mass rate models, etc.) with those of any other worker, as the workers propagate concurrently. The
+ *  sampleSetupFunction_ is called before each propagation, and must modify the environment and/or the propagator settings
+ *  of this worker to represent the given sample (for instance by calling resetInitialStates on the propagator settings, or
+ *  resetting the value of a parameter).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+struct SingleArcBatchPropagationWorkerSetup
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param bodies Bodies used by this worker
+     *  \param propagatorSettings Propagator settings used by this worker (including integrator settings)
+     *  \param sampleSetupFunction Function that sets the environment and propagator settings of this worker for the
+     *  sample with the given index.
+     */
+    SingleArcBatchPropagationWorkerSetup(
+            const simulation_setup::SystemOfBodies& bodies,
+            const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const std::function< void( const unsigned int ) > sampleSetupFunction ):
+        bodies_( bodies ), propagatorSettings_( propagatorSettings ), sampleSetupFunction_( sampleSetupFunction ){ }
+
+    //! Bodies used by this worker
+    simulation_setup::SystemOfBodies bodies_;
+
+    //! Propagator settings used by this worker (including integrator settings)
+    std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings_;
+
+    //! Function that sets the environment and propagator settings of this worker for the sample with the given index.
+    std::function< void( const unsigned int ) > sampleSetupFunction_;
+};
+
+//! Class to propagate a large number of samples of a single-arc propagation (e.g. a Monte Carlo analysis) concurrently.
+/*!
+ *  Class to propagate a large number of samples of a single-arc propagation (e.g. a Monte Carlo analysis, with
+ *  perturbed initial states and/or parameters) concurrently. A number of independent workers is created once, each of
+ *  which has its own bodies, propagator settings and dynamics simulator. The samples are distributed dynamically over the
+ *  workers, and each worker reuses its environment and simulator for all of the samples that it propagates, so that the
+ *  (often expensive) creation of the environment and the dynamical models is only done once per worker. The simulation
+ *  objects of the workers are either created by a user-defined function, or (for translational dynamics) by cloning a
+ *  single set of bodies for each worker.
+ *
+ *  The results of each sample are passed to a collector function as soon as the propagation of the sample is finished.
+ *  Calls to the collector function are serialized, so the collector does not need to be thread-safe. Since the
+ *  propagation results object of a worker is reset when it propagates its next sample, the collector must copy any data
+ *  that it wants to retain. The order in which the samples are passed to the collector is not defined when more than one
+ *  worker is used.
+ *
+ *  Models that use global data which is not thread-safe (other than SPICE, calls to which are serialized) may not be used
+ *  with more than one worker.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class SingleArcBatchPropagator
+{
+public:
+
+    //! Typedef for function that is called with the results of a single sample
+    typedef std::function< void( const unsigned int,
+                                 const std::shared_ptr< SingleArcPropagatorResults< StateScalarType, TimeType > > ) >
+    ResultsCollectorFunction;
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the workers and their dynamics simulators (without propagating). The worker setup function is
+     *  called once for each worker, in order on the calling thread, so that it may use resources that are not
+     *  thread-safe (such as loading SPICE kernels).
+     *  \param workerSetupFunction Function that creates a new, independent, set of simulation objects for a worker. It
+     *  is called with the index of the worker that is created as input. An exception is thrown if two workers share their
+     *  propagator settings, or environments that are not independent (see areEnvironmentsIndependent).
+     *  \param numberOfWorkers Number of workers (and threads) to use. If 0, the number of hardware threads is used.
+     */
+    SingleArcBatchPropagator(
+            const std::function< std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > >(
+                const unsigned int ) > workerSetupFunction,
+            const unsigned int numberOfWorkers = 0 )
+    {
+        unsigned int numberOfWorkersToUse = utilities::getNumberOfThreadsToUse(
+                    numberOfWorkers, std::numeric_limits< unsigned int >::max( ) );
+        for( unsigned int i = 0; i < numberOfWorkersToUse; i++ )
+        {
+            std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > > currentWorkerSetup =
+                    workerSetupFunction( i );
+            if( currentWorkerSetup == nullptr )
+            {
+                throw std::runtime_error( "Error when creating batch propagator, no setup created for worker " +
+                                          std::to_string( i ) );
+            }
+            for( unsigned int j = 0; j < workerSetups_.size( ); j++ )
+            {
+                if( workerSetups_.at( j )->propagatorSettings_ == currentWorkerSetup->propagatorSettings_ )
+                {
+                    throw std::runtime_error( "Error when creating batch propagator, propagator settings of workers " +
+                                              std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+                }
+                if( !areEnvironmentsIndependent( { workerSetups_.at( j )->bodies_, currentWorkerSetup->bodies_ } ) )
+                {
+                    throw std::runtime_error( "Error when creating batch propagator, environments of workers " +
+                                              std::to_string( j ) + " and " + std::to_string( i ) + " are not independent" );
+                }
+            }
+
+            workerSetups_.push_back( currentWorkerSetup );
+            dynamicsSimulators_.push_back(
+                        std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                            currentWorkerSetup->bodies_, currentWorkerSetup->propagatorSettings_, false ) );
+        }
+    }
+
+    //! Constructor for translational dynamics, creating the environment of each worker by cloning the given bodies
+    /*!
+     *  Constructor for translational dynamics, creating the environment of each worker by cloning the given bodies (see
+     *  cloneSystemOfBodies), after which the acceleration models of the worker are created from the given acceleration
+     *  settings and the cloned bodies. The propagator settings of each worker are a copy of the given propagator
+     *  settings (with their own acceleration models). The bodies and propagator settings given as input are not modified,
+     *  and not used during the batch propagation.
+     *  \param bodies Bodies that are to be cloned for each worker
+     *  \param accelerationSettings Settings for the acceleration models, created for each worker from its cloned bodies
+     *  \param propagatorSettings Propagator settings that are to be copied for each worker (acceleration models in these
+     *  settings are not used)
+     *  \param sampleSetupFunction Function that sets the environment and propagator settings of a worker for the sample
+     *  with the given index, called with the sample index and the simulation objects of the worker as input.
+     *  \param numberOfWorkers Number of workers (and threads) to use. If 0, the number of hardware threads is used.
+     */
+    SingleArcBatchPropagator(
+            const simulation_setup::SystemOfBodies& bodies,
+            const simulation_setup::SelectedAccelerationMap& accelerationSettings,
+            const std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const std::function< void( const unsigned int,
+                                       SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType >& ) > sampleSetupFunction,
+            const unsigned int numberOfWorkers = 0 ):
+        SingleArcBatchPropagator( [ & ]( const unsigned int )
+    {
+        simulation_setup::SystemOfBodies workerBodies = simulation_setup::cloneSystemOfBodies( bodies );
+
+        std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType, TimeType > > workerPropagatorSettings =
+                std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType, TimeType > >(
+                    propagatorSettings->clone( ) );
+        workerPropagatorSettings->resetAccelerationModelsMap( accelerationSettings, workerBodies );
+
+        std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > > workerSetup =
+                std::make_shared< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > >(
+                    workerBodies, workerPropagatorSettings, nullptr );
+
+        // Pass worker setup to sample setup function by pointer, to prevent circular reference
+        SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType >* workerSetupPointer = workerSetup.get( );
+        if( sampleSetupFunction != nullptr )
+        {
+            workerSetup->sampleSetupFunction_ = [ = ]( const unsigned int sampleIndex )
+            {
+                sampleSetupFunction( sampleIndex, *workerSetupPointer );
+            };
+        }
+        return workerSetup;
+    }, numberOfWorkers ){ }
+
+    //! Function to propagate a given number of samples, and pass the results of each to the collector function
+    /*!
+     *  Function to propagate a given number of samples, and pass the results of each to the collector function. For each
+     *  sample, the sample setup function of the worker that is to propagate it is called, after which the equations of
+     *  motion are propagated from the initial state in the worker's propagator settings. If the propagation of any sample
+     *  throws an exception, no new samples are started, and the exception is rethrown after all workers have finished.
+     *  \param numberOfSamples Number of samples that are to be propagated (with indices 0 to numberOfSamples - 1)
+     *  \param resultsCollector Function that is called with the sample index and propagation results of each sample.
+     */
+    void propagateSamples( const unsigned int numberOfSamples,
+                           const ResultsCollectorFunction& resultsCollector )
+    {
+        std::atomic< unsigned int > nextSampleIndex( 0 );
+        std::atomic< bool > isPropagationStopped( false );
+        std::mutex collectorMutex;
+
+        utilities::executeInParallel(
+                    dynamicsSimulators_.size( ), [ & ]( const unsigned int workerIndex )
+        {
+            const std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > >& workerSetup =
+                    workerSetups_.at( workerIndex );
+            const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > >& dynamicsSimulator =
+                    dynamicsSimulators_.at( workerIndex );
+
+            unsigned int currentSampleIndex;
+            while( ( !isPropagationStopped ) && ( ( currentSampleIndex = nextSampleIndex++ ) < numberOfSamples ) )
+            {
+                try
+                {
+                    if( workerSetup->sampleSetupFunction_ != nullptr )
+                    {
+                        workerSetup->sampleSetupFunction_( currentSampleIndex );
+                    }
+                    dynamicsSimulator->integrateEquationsOfMotion( workerSetup->propagatorSettings_->getInitialStates( ) );
+
+                    std::lock_guard< std::mutex > collectorLock( collectorMutex );
+                    resultsCollector( currentSampleIndex, dynamicsSimulator->getPropagationResults( ) );
+                }
+                catch( ... )
+                {
+                    isPropagationStopped = true;
+                    throw;
+                }
+            }
+        }, dynamicsSimulators_.size( ) );
+    }
+
+    //! Function to retrieve the number of workers
+    /*!
+     *  Function to retrieve the number of workers
+     *  \return Number of workers
+     */
+    unsigned int getNumberOfWorkers( )
+    {
+        return dynamicsSimulators_.size( );
+    }
+
+    //! Function to retrieve the simulation objects of a single worker
+    /*!
+     *  Function to retrieve the simulation objects of a single worker
+     *  \param workerIndex Index of worker
+     *  \return Simulation objects of requested worker
+     */
+    std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > > getWorkerSetup(
+            const unsigned int workerIndex )
+    {
+        return workerSetups_.at( workerIndex );
+    }
+
+    //! Function to retrieve the dynamics simulator of a single worker
+    /*!
+     *  Function to retrieve the dynamics simulator of a single worker
+     *  \param workerIndex Index of worker
+     *  \return Dynamics simulator of requested worker
+     */
+    std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > getWorkerDynamicsSimulator(
+            const unsigned int workerIndex )
+    {
+        return dynamicsSimulators_.at( workerIndex );
+    }
+
+private:
+
+    //! Simulation objects of each of the workers
+    std::vector< std::shared_ptr< SingleArcBatchPropagationWorkerSetup< StateScalarType, TimeType > > > workerSetups_;
+
+    //! Dynamics simulators of each of the workers (created from entries of workerSetups_)
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > dynamicsSimulators_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_BATCHPROPAGATION_H
@@ -205,6 +205,10 @@ createMutualSphericalHarmonicsGravityAcceleration(
  *  \param nameOfBodyUndergoingAcceleration Name of body that is being accelerated.
  *  \param nameOfBodyExertingAcceleration Name of body that is exerting the spherical harmonic
  *  gravity acceleration.
+ *  \param useCentralBodyFixedFrame Boolean setting whether the central body gravitational parameter is to be summed
+ *  with that of the body undergoing the acceleration.
+ *  \param accelerationSettings Settings of the acceleration model; if these are of type
+ *  PolyhedronAccelerationSettings, the far-field expansion and number of threads are set from them (default none).
  *  \return Polyhedron gravity acceleration model pointer.
  */
 std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel >
@@ -213,7 +217,8 @@ createPolyhedronGravityAcceleration(
         const std::shared_ptr< Body > bodyExertingAcceleration,
         const std::string& nameOfBodyUndergoingAcceleration,
         const std::string& nameOfBodyExertingAcceleration,
-        const bool useCentralBodyFixedFrame);
+        const bool useCentralBodyFixedFrame,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings = nullptr );
 
 //! Function to create a third body central gravity acceleration model.
 /*!
@@ -12,6 +12,7 @@
 #define TUDAT_DYNAMICSSIMULATOR_H
 
 #include <vector>
+#include <set>
 #include <string>
 #include <chrono>
 
@@ -19,8 +20,13 @@
 
 #include "tudat/basics/tudatTypeTraits.h"
 #include "tudat/basics/utilities.h"
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/basics/contiguousHistory.h"
 #include "tudat/astro/propagators/nBodyStateDerivative.h"
 #include "tudat/astro/ephemerides/frameManager.h"
+#include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
 #include "tudat/simulation/propagation_setup/propagationSettings.h"
 #include "tudat/simulation/propagation_setup/setNumericallyIntegratedStates.h"
 #include "tudat/astro/propagators/integrateEquations.h"
@@ -415,6 +421,11 @@ public:
         stateIds_( stateIds ),
         outputSettings_( outputSettings ),
         propagationIsPerformed_( false ),
+        isContiguousHistoryStorageUsed_( false ),
+        isStateHistoryMapSet_( false ),
+        isRawStateHistoryMapSet_( false ),
+        isDependentVariableHistoryMapSet_( false ),
+        isComputationTimeHistoryMapSet_( false ),
         propagationTerminationReason_( std::make_shared< PropagationTerminationDetails >( propagation_never_run ) )
     {
     }
@@ -426,30 +437,105 @@ public:
         dependentVariableHistory_.clear( );
         cumulativeComputationTimeHistory_.clear( );
         cumulativeNumberOfFunctionEvaluations_.clear( );
+        equationsOfMotionNumericalSolutionContiguous_.clear( );
+        equationsOfMotionNumericalSolutionRawContiguous_.clear( );
+        dependentVariableHistoryContiguous_.clear( );
+        cumulativeComputationTimeHistoryContiguous_.clear( );
+        isContiguousHistoryStorageUsed_ = outputSettings_->getUseContiguousHistoryStorage( );
+        isStateHistoryMapSet_ = false;
+        isRawStateHistoryMapSet_ = false;
+        isDependentVariableHistoryMapSet_ = false;
+        isComputationTimeHistoryMapSet_ = false;
         propagationIsPerformed_ = false;
         propagationTerminationReason_ = std::make_shared< PropagationTerminationDetails >( propagation_never_run );
     }
 
+    //! Function to retrieve the state history, in the conventional form
+    /*!
+     *  Function to retrieve the state history, in the conventional form. If the history was stored in contiguous memory
+     *  during the propagation (see SingleArcPropagatorProcessingSettings::setUseContiguousHistoryStorage), the map is
+     *  created from it upon the first call to this function.
+     *  \return State history, in the conventional form
+     */
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
     {
-        return equationsOfMotionNumericalSolution_;
+        return getHistoryMap( equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionContiguous_,
+                              isStateHistoryMapSet_ );
     }
 
+    //! Function to retrieve the state history, in the propagator-specific form (created upon first call, see
+    //! getEquationsOfMotionNumericalSolution)
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
     {
-        return equationsOfMotionNumericalSolutionRaw_;
+        return getHistoryMap( equationsOfMotionNumericalSolutionRaw_, equationsOfMotionNumericalSolutionRawContiguous_,
+                              isRawStateHistoryMapSet_ );
     }
 
+    //! Function to retrieve the dependent variable history (created upon first call, see
+    //! getEquationsOfMotionNumericalSolution)
     std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
-        return dependentVariableHistory_;
+        return getHistoryMap( dependentVariableHistory_, dependentVariableHistoryContiguous_,
+                              isDependentVariableHistoryMapSet_ );
     }
 
+    //! Function to retrieve the cumulative computation time history (created upon first call, see
+    //! getEquationsOfMotionNumericalSolution)
     std::map< TimeType, double >& getCumulativeComputationTimeHistory( )
     {
+        if( isContiguousHistoryStorageUsed_ && !isComputationTimeHistoryMapSet_ )
+        {
+            cumulativeComputationTimeHistory_.clear( );
+            for( auto historyIterator = cumulativeComputationTimeHistoryContiguous_.begin( );
+                 historyIterator != cumulativeComputationTimeHistoryContiguous_.end( ); historyIterator++ )
+            {
+                cumulativeComputationTimeHistory_.emplace_hint(
+                            cumulativeComputationTimeHistory_.end( ), historyIterator->first, historyIterator->second( 0, 0 ) );
+            }
+            isComputationTimeHistoryMapSet_ = true;
+        }
         return cumulativeComputationTimeHistory_;
     }
 
+    //! Function to check whether the results of the most recent propagation were stored in contiguous memory
+    bool isContiguousHistoryStorageUsed( ) const
+    {
+        return isContiguousHistoryStorageUsed_;
+    }
+
+    //! Function to retrieve the state history in the conventional form, as stored in contiguous memory
+    /*!
+     *  Function to retrieve the state history in the conventional form, as stored in contiguous memory. This history is
+     *  only filled if contiguous history storage was used for the propagation
+     *  (see SingleArcPropagatorProcessingSettings::setUseContiguousHistoryStorage).
+     *  \return State history in the conventional form, as stored in contiguous memory
+     */
+    const utilities::ContiguousHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionContiguous( )
+    {
+        return equationsOfMotionNumericalSolutionContiguous_;
+    }
+
+    //! Function to retrieve the state history in the propagator-specific form, as stored in contiguous memory (see
+    //! getEquationsOfMotionNumericalSolutionContiguous)
+    const utilities::ContiguousHistory< TimeType, StateScalarType >& getEquationsOfMotionNumericalSolutionRawContiguous( )
+    {
+        return equationsOfMotionNumericalSolutionRawContiguous_;
+    }
+
+    //! Function to retrieve the dependent variable history, as stored in contiguous memory (see
+    //! getEquationsOfMotionNumericalSolutionContiguous)
+    const utilities::ContiguousHistory< TimeType, double >& getDependentVariableHistoryContiguous( )
+    {
+        return dependentVariableHistoryContiguous_;
+    }
+
+    //! Function to retrieve the cumulative computation time history, as stored in contiguous memory (see
+    //! getEquationsOfMotionNumericalSolutionContiguous)
+    const utilities::ContiguousHistory< TimeType, double >& getCumulativeComputationTimeHistoryContiguous( )
+    {
+        return cumulativeComputationTimeHistoryContiguous_;
+    }
+
     std::map< TimeType, unsigned int >& getCumulativeNumberOfFunctionEvaluations( )
     {
         return cumulativeNumberOfFunctionEvaluations_;
@@ -482,6 +568,41 @@ public:
 
 private:
 
+    //! Function to retrieve a history map, creating it from the associated contiguous history if required
+    /*!
+     *  Function to retrieve a history map. If contiguous history storage was used for the propagation, and the map has not
+     *  yet been created since the propagation, it is created from the associated contiguous history.
+     *  \param historyMap History map that is to be retrieved
+     *  \param contiguousHistory History stored in contiguous memory, from which the map is created
+     *  \param isMapSet Boolean denoting whether the map has been created since the propagation (set to true by this
+     *  function)
+     *  \return History map
+     */
+    template< typename MapValueType, typename ScalarType >
+    std::map< TimeType, MapValueType >& getHistoryMap(
+            std::map< TimeType, MapValueType >& historyMap,
+            const utilities::ContiguousHistory< TimeType, ScalarType >& contiguousHistory,
+            bool& isMapSet )
+    {
+        if( isContiguousHistoryStorageUsed_ && !isMapSet )
+        {
+            historyMap = contiguousHistory.template toMap< MapValueType >( );
+            isMapSet = true;
+        }
+        return historyMap;
+    }
+
+    //! Function to clear the state histories (both maps and contiguous histories)
+    void clearStateHistories( )
+    {
+        equationsOfMotionNumericalSolution_.clear( );
+        equationsOfMotionNumericalSolutionRaw_.clear( );
+        equationsOfMotionNumericalSolutionContiguous_.clear( );
+        equationsOfMotionNumericalSolutionRawContiguous_.clear( );
+        isStateHistoryMapSet_ = true;
+        isRawStateHistoryMapSet_ = true;
+    }
+
     //! Map of state history of numerically integrated bodies.
     /*!
      *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
@@ -509,6 +630,18 @@ private:
     //! Map of cumulative number of function evaluations that was saved during numerical propagation.
     std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations_;
 
+    //! State history in conventional form, stored in contiguous memory (only used if isContiguousHistoryStorageUsed_)
+    utilities::ContiguousHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionContiguous_;
+
+    //! State history in propagator-specific form, stored in contiguous memory (only used if isContiguousHistoryStorageUsed_)
+    utilities::ContiguousHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRawContiguous_;
+
+    //! Dependent variable history, stored in contiguous memory (only used if isContiguousHistoryStorageUsed_)
+    utilities::ContiguousHistory< TimeType, double > dependentVariableHistoryContiguous_;
+
+    //! Cumulative computation time history, stored in contiguous memory (only used if isContiguousHistoryStorageUsed_)
+    utilities::ContiguousHistory< TimeType, double > cumulativeComputationTimeHistoryContiguous_;
+
     //! Map listing starting entry of dependent variables in output vector, along with associated ID.
     std::map< std::pair< int, int >, std::string > dependentVariableIds_;
 
@@ -518,6 +651,15 @@ private:
 
     bool propagationIsPerformed_;
 
+    //! Boolean denoting whether the results of the most recent propagation were stored in contiguous memory
+    bool isContiguousHistoryStorageUsed_;
+
+    //! Booleans denoting whether the history maps have been created from the contiguous histories since the propagation
+    bool isStateHistoryMapSet_;
+    bool isRawStateHistoryMapSet_;
+    bool isDependentVariableHistoryMapSet_;
+    bool isComputationTimeHistoryMapSet_;
+
 
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
@@ -672,12 +814,15 @@ public:
         stateIds_ = getProcessedStateStrings(getIntegratedTypeAndBodyList( propagatorSettings_ ) );
         if( propagatorSettings_->getDependentVariablesToSave( ).size( ) > 0 )
         {
-            std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > dependentVariableData =
-                    createDependentVariableListFunction< TimeType, StateScalarType >(
+            std::pair< std::shared_ptr< DependentVariableListEvaluator >, std::map< std::pair< int, int >, std::string > >
+                    dependentVariableData = createDependentVariableListEvaluator< TimeType, StateScalarType >(
                         propagatorSettings_->getDependentVariablesToSave( ), bodies_,
                         dynamicsStateDerivative_->getStateDerivativeModels( ),
                         predefinedStateDerivativeModels.stateDerivativePartials_ );
-            dependentVariablesFunctions_ = dependentVariableData.first;
+            dependentVariablesEvaluator_ = dependentVariableData.first;
+            dependentVariablesFunctions_ = std::bind(
+                        static_cast< Eigen::VectorXd( DependentVariableListEvaluator::* )( ) const >(
+                            &DependentVariableListEvaluator::evaluate ), dependentVariablesEvaluator_ );
             dependentVariableIds_ = dependentVariableData.second;
 
 
@@ -792,27 +937,37 @@ public:
         // Integrate equations of motion numerically.
         resetPropagationTerminationConditions( );
         simulation_setup::setAreBodiesInPropagation( bodies_, true );
-        propagationResults_->propagationTerminationReason_ =
-                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
-                    stateDerivativeFunction_,
-                    propagationResults_->equationsOfMotionNumericalSolutionRaw_,
-                    dynamicsStateDerivative_->convertFromOutputSolution( initialStates, propagatorSettings_->getInitialTime( ) ),
-                    propagatorSettings_->getInitialTime( ),
-                    integratorSettings_,
-                    propagationTerminationCondition_,
-                    propagationResults_->dependentVariableHistory_,
-                    propagationResults_->cumulativeComputationTimeHistory_,
-                    dependentVariablesFunctions_,
-                    statePostProcessingFunction_,
-                    propagatorSettings_->getOutputSettings( )->getPrintSettings( )->getStatePrintInterval( ),
-                    std::chrono::steady_clock::now( ),
-                    propagatorSettings_->getOutputSettings( )->getPrintSettings( )->getPrintInitialAndFinalConditions( )  );
+        if( propagationResults_->isContiguousHistoryStorageUsed_ )
+        {
+            integrateEquationsOfMotionToHistories(
+                        initialStates,
+                        propagationResults_->equationsOfMotionNumericalSolutionRawContiguous_,
+                        propagationResults_->dependentVariableHistoryContiguous_,
+                        propagationResults_->cumulativeComputationTimeHistoryContiguous_ );
+        }
+        else
+        {
+            integrateEquationsOfMotionToHistories(
+                        initialStates,
+                        propagationResults_->equationsOfMotionNumericalSolutionRaw_,
+                        propagationResults_->dependentVariableHistory_,
+                        propagationResults_->cumulativeComputationTimeHistory_ );
+        }
         simulation_setup::setAreBodiesInPropagation( bodies_, false );
 
         // Convert numerical solution to conventional state
-        dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
-                    propagationResults_->equationsOfMotionNumericalSolution_,
-                    propagationResults_->equationsOfMotionNumericalSolutionRaw_ );
+        if( propagationResults_->isContiguousHistoryStorageUsed_ )
+        {
+            dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
+                        propagationResults_->equationsOfMotionNumericalSolutionContiguous_,
+                        propagationResults_->equationsOfMotionNumericalSolutionRawContiguous_ );
+        }
+        else
+        {
+            dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
+                        propagationResults_->equationsOfMotionNumericalSolution_,
+                        propagationResults_->equationsOfMotionNumericalSolutionRaw_ );
+        }
 
         // Retrieve number of cumulative function evaluations
         propagationResults_->cumulativeNumberOfFunctionEvaluations_ = dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( );
@@ -873,12 +1028,16 @@ public:
             const bool processSolution = true )
     {
         propagationResults_->equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
+        propagationResults_->equationsOfMotionNumericalSolutionContiguous_.clear( );
+        propagationResults_->isStateHistoryMapSet_ = true;
         if( processSolution )
         {
             processNumericalEquationsOfMotionSolution( );
         }
 
         propagationResults_->dependentVariableHistory_ = dependentVariableHistory;
+        propagationResults_->dependentVariableHistoryContiguous_.clear( );
+        propagationResults_->isDependentVariableHistoryMapSet_ = true;
     }
 
     //! Function to get the settings for the numerical integrator.
@@ -1025,21 +1184,20 @@ public:
         try
         {
             // Create and set interpolators for ephemerides
-            resetIntegratedStates( propagationResults_->equationsOfMotionNumericalSolution_, integratedStateProcessors_ );
+            resetIntegratedStates( propagationResults_->getEquationsOfMotionNumericalSolution( ), integratedStateProcessors_ );
         }
         catch( const std::exception& caughtException )
         {
             std::cerr << "Error occured when post-processing single-arc integration results, and seting integrated states in environment, caught error is: " << std::endl << std::endl;
             std::cerr << caughtException.what( ) << std::endl << std::endl;
             std::cerr << "The problem may be that there is an insufficient number of data points (epochs) at which propagation results are produced. Integrated results are given at" +
-                         std::to_string( propagationResults_->equationsOfMotionNumericalSolution_.size( ) ) + " epochs"<< std::endl;
+                         std::to_string( propagationResults_->getEquationsOfMotionNumericalSolution( ).size( ) ) + " epochs"<< std::endl;
         }
 
         // Clear numerical solution if so required.
         if( propagatorSettings_->getOutputSettings( )->getClearNumericalSolutions( ) )
         {
-            propagationResults_->equationsOfMotionNumericalSolution_.clear( );
-            propagationResults_->equationsOfMotionNumericalSolutionRaw_.clear( );
+            propagationResults_->clearStateHistories( );
         }
 
         for( auto bodyIterator : bodies_.getMap( )  )
@@ -1103,8 +1261,8 @@ public:
             if( outputSettings_->getPrintSettings( )->getPrintPropagationTime( ) )
             {
                 std::cout << "Total propagation clock time: "
-                      << std::fabs( propagationResults_->cumulativeComputationTimeHistory_.begin( )->second -
-                                    propagationResults_->cumulativeComputationTimeHistory_.rbegin( )->second )<<" seconds"<<std::endl;
+                      << std::fabs( propagationResults_->getCumulativeComputationTimeHistory( ).begin( )->second -
+                                    propagationResults_->getCumulativeComputationTimeHistory( ).rbegin( )->second )<<" seconds"<<std::endl;
             }
             if( outputSettings_->getPrintSettings( )->getPrintTerminationReason( ) )
             {
@@ -1129,7 +1287,7 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
     {
-        return propagationResults_->equationsOfMotionNumericalSolution_;
+        return propagationResults_->getEquationsOfMotionNumericalSolution( );
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
@@ -1139,7 +1297,7 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolutionRaw( )
     {
-        return propagationResults_->equationsOfMotionNumericalSolutionRaw_;
+        return propagationResults_->getEquationsOfMotionNumericalSolutionRaw( );
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
@@ -1149,7 +1307,7 @@ public:
      */
     const std::map< TimeType, Eigen::VectorXd >& getDependentVariableHistory( )
     {
-        return propagationResults_->dependentVariableHistory_;
+        return propagationResults_->getDependentVariableHistory( );
     }
 
     //! Function to return the map of cumulative computation time history that was saved during numerical propagation.
@@ -1159,7 +1317,7 @@ public:
      */
     std::map< TimeType, double > getCumulativeComputationTimeHistory( )
     {
-        return propagationResults_->cumulativeComputationTimeHistory_;
+        return propagationResults_->getCumulativeComputationTimeHistory( );
     }
 
     //! Function to return the map of number of cumulative function evaluations that was saved during numerical propagation.
@@ -1215,6 +1373,39 @@ public:
 
 protected:
 
+    //! Function to numerically integrate the equations of motion, saving the results in the given histories
+    /*!
+     *  Function to numerically integrate the equations of motion, saving the results in the given histories (either maps or
+     *  utilities::ContiguousHistory objects), and setting the termination reason in the propagation results.
+     *  \param initialStates Initial state vector that is to be used for numerical integration (in conventional form)
+     *  \param stateHistory State history in propagator-specific form (returned by reference)
+     *  \param dependentVariableHistory Dependent variable history (returned by reference)
+     *  \param computationTimeHistory Cumulative computation time history (returned by reference)
+     */
+    template< typename StateHistoryType, typename DependentVariableHistoryType, typename ComputationTimeHistoryType >
+    void integrateEquationsOfMotionToHistories(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates,
+            StateHistoryType& stateHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
+            ComputationTimeHistoryType& computationTimeHistory )
+    {
+        propagationResults_->propagationTerminationReason_ =
+                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
+                    stateDerivativeFunction_,
+                    stateHistory,
+                    dynamicsStateDerivative_->convertFromOutputSolution( initialStates, propagatorSettings_->getInitialTime( ) ),
+                    propagatorSettings_->getInitialTime( ),
+                    integratorSettings_,
+                    propagationTerminationCondition_,
+                    dependentVariableHistory,
+                    computationTimeHistory,
+                    dependentVariablesEvaluator_,
+                    statePostProcessingFunction_,
+                    propagatorSettings_->getOutputSettings( )->getPrintSettings( )->getStatePrintInterval( ),
+                    std::chrono::steady_clock::now( ),
+                    propagatorSettings_->getOutputSettings( )->getPrintSettings( )->getPrintInitialAndFinalConditions( )  );
+    }
+
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< std::shared_ptr<
     IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
@@ -1260,6 +1451,9 @@ protected:
     //! Function returning dependent variables (during numerical propagation)
     std::function< Eigen::VectorXd( ) > dependentVariablesFunctions_;
 
+    //! Object evaluating dependent variables directly into the dependent variable history (during numerical propagation)
+    std::shared_ptr< DependentVariableListEvaluator > dependentVariablesEvaluator_;
+
     std::map< std::pair< int, int >, std::string > dependentVariableIds_;
 
     std::map< std::pair< int, int >, std::string > stateIds_;
@@ -1492,11 +1686,98 @@ std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > valid
 }
 
 
+//! Function to retrieve the Body object and environment models of a body that may not be shared between environments
+/*!
+ *  Function to retrieve the Body object and environment models of a body that are modified when the environment is updated,
+ *  or that are coupled to the states of other bodies, and may therefore not be shared between environments that are
+ *  updated concurrently. These are: the Body object itself, its gravity field model, vehicle systems, aerodynamic
+ *  coefficient interface, flight conditions and radiation pressure interfaces, tabulated and multi-arc ephemerides, and
+ *  tabulated rotation models and rotation models that depend on the state of the bodies.
+ *  \param body Body for which the models are to be retrieved
+ *  \return List of addresses of the Body object and its environment models that may not be shared
+ */
+inline std::vector< const void* > getNonShareableBodyModels( const std::shared_ptr< simulation_setup::Body > body )
+{
+    std::vector< const void* > bodyModels;
+    bodyModels.push_back( body.get( ) );
+
+    std::shared_ptr< ephemerides::Ephemeris > ephemeris = body->getEphemeris( );
+    if( ephemerides::isTabulatedEphemeris( ephemeris ) ||
+            ( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemeris ) != nullptr ) )
+    {
+        bodyModels.push_back( ephemeris.get( ) );
+    }
+
+    std::shared_ptr< ephemerides::RotationalEphemeris > rotationModel = body->getRotationalEphemeris( );
+    if( ephemerides::isTabulatedRotationalEphemeris( rotationModel ) ||
+            ( std::dynamic_pointer_cast< ephemerides::SynchronousRotationalEphemeris >( rotationModel ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::DirectionBasedRotationalEphemeris >( rotationModel ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >( rotationModel ) != nullptr ) )
+    {
+        bodyModels.push_back( rotationModel.get( ) );
+    }
+
+    bodyModels.push_back( body->getGravityFieldModel( ).get( ) );
+    bodyModels.push_back( body->getVehicleSystems( ).get( ) );
+    bodyModels.push_back( body->getAerodynamicCoefficientInterface( ).get( ) );
+    bodyModels.push_back( body->getFlightConditions( ).get( ) );
+    for( auto radiationPressureIterator : body->getRadiationPressureInterfaces( ) )
+    {
+        bodyModels.push_back( radiationPressureIterator.second.get( ) );
+    }
+
+    return bodyModels;
+}
+
+//! Function to check whether a list of environments shares no Body objects, or environment models that store state
+/*!
+ *  Function to check whether a list of environments (typically one per arc of a multi-arc propagation) shares no Body
+ *  objects, and no environment models that are modified during an environment update (see getNonShareableBodyModels), in
+ *  which case the environments can be updated independently (and concurrently). Other models (e.g. shape models, and
+ *  Kepler or Spice ephemerides) are not modified when they are evaluated, and may be shared. NOTE: Atmosphere models are
+ *  assumed to be of this type as well, so that an NRLMSISE00 atmosphere model (which stores its last evaluation) may not
+ *  be shared between environments, as this is not detected here.
+ *  \param environments List of environments that is to be checked
+ *  \return True if no Body object or non-shareable environment model is contained in more than one of the environments
+ */
+inline bool areEnvironmentsIndependent( const std::vector< simulation_setup::SystemOfBodies >& environments )
+{
+    std::set< const void* > encounteredModels;
+    for( unsigned int i = 0; i < environments.size( ); i++ )
+    {
+        // Models may be shared by bodies of a single environment
+        std::set< const void* > currentEnvironmentModels;
+        for( auto bodyIterator : environments.at( i ).getMap( ) )
+        {
+            std::vector< const void* > bodyModels = getNonShareableBodyModels( bodyIterator.second );
+            currentEnvironmentModels.insert( bodyModels.begin( ), bodyModels.end( ) );
+        }
+        currentEnvironmentModels.erase( nullptr );
+
+        for( const void* model : currentEnvironmentModels )
+        {
+            if( !encounteredModels.insert( model ).second )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 //! Class for performing full numerical integration of a dynamical system over multiple arcs.
 /*!
  *  Class for performing full numerical integration of a dynamical system over multiple arcs, equations of motion are set up
  *  for each arc (and need not be equal for each arc). In this class, the governing equations are set once,
  *  but can be re-integrated for different initial conditions using the same instance of the class.
+ *
+ *  By default, all arcs are propagated in sequence, using the same environment. Alternatively, a separate environment can be
+ *  provided for each arc, in which case the single-arc propagator settings of each arc must have their (acceleration, torque,
+ *  etc.) models created from that arc's environment. If these environments share no Body objects or environment models that
+ *  store state (see areEnvironmentsIndependent), the arcs can be
+ *  distributed over multiple threads (see MultiArcPropagatorSettings::resetNumberOfThreads), which yields results identical
+ *  to a serial propagation. Arcs that take their initial state from the previous arc are always propagated directly after
+ *  that arc, on the same thread.
  */
 template< typename StateScalarType = double, typename TimeType = double >
 class MultiArcDynamicsSimulator: public DynamicsSimulator< StateScalarType, TimeType >
@@ -1505,14 +1786,28 @@ public:
 
     using DynamicsSimulator< StateScalarType, TimeType >::bodies_;
 
-
+    //! Constructor of multi-arc simulator
+    /*!
+     *  Constructor of multi-arc simulator
+     *  \param bodies Map of bodies (with names) of all bodies in integration. The propagation results are processed in this
+     *  environment.
+     *  \param propagatorSettings Propagator settings for dynamics
+     *  \param areEquationsOfMotionToBeIntegrated Boolean to denote whether equations of motion should be integrated at
+     *  the end of the contructor or not.
+     *  \param arcWiseBodies List of environments (one per arc) in which the dynamics of each arc is to be evaluated. If
+     *  empty (default), the bodies input is used for all arcs.
+     */
     MultiArcDynamicsSimulator(
             const simulation_setup::SystemOfBodies& bodies,
             const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
-            const bool areEquationsOfMotionToBeIntegrated = true ):
+            const bool areEquationsOfMotionToBeIntegrated = true,
+            const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+            std::vector< simulation_setup::SystemOfBodies >( ) ):
         DynamicsSimulator< StateScalarType, TimeType >(
             bodies, propagatorSettings  ),
-        multiArcPropagatorSettings_( propagatorSettings )
+        multiArcPropagatorSettings_( propagatorSettings ),
+        arcWiseBodies_( arcWiseBodies ),
+        areArcEnvironmentsIndependent_( false )
     {
         if( multiArcPropagatorSettings_ == nullptr )
         {
@@ -1523,15 +1818,34 @@ public:
             std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > singleArcSettings =
                     multiArcPropagatorSettings_->getSingleArcSettings( );
 
+            if( arcWiseBodies_.size( ) > 0 )
+            {
+                if( arcWiseBodies_.size( ) != singleArcSettings.size( ) )
+                {
+                    throw std::runtime_error( "Error when creating multi-arc dynamics simulator, " +
+                                              std::to_string( arcWiseBodies_.size( ) ) + " arc-wise environments provided for " +
+                                              std::to_string( singleArcSettings.size( ) ) + " arcs." );
+                }
+                areArcEnvironmentsIndependent_ = areEnvironmentsIndependent( arcWiseBodies_ );
+            }
+
             // Create dynamics simulators
             for( unsigned int i = 0; i < singleArcSettings.size( ); i++ )
             {
                 singleArcDynamicsSimulators_.push_back(
                             std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
-                                bodies, singleArcSettings.at( i ), false ) );
+                                ( arcWiseBodies_.size( ) > 0 ) ? arcWiseBodies_.at( i ) : bodies,
+                                singleArcSettings.at( i ), false ) );
                 singleArcDynamicsSimulators_[ i ]->createAndSetIntegratedStateProcessors( );
             }
 
+            // Create processors that set the propagation results in the (non-arc-wise) environment
+            if( arcWiseBodies_.size( ) > 0 )
+            {
+                integratedStateProcessors_ = createIntegratedStateProcessors< TimeType, StateScalarType >(
+                            singleArcSettings.at( 0 ), bodies_, simulation_setup::createFrameManager( bodies_.getMap( ) ) );
+            }
+
             equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
             dependentVariableHistory_.resize( singleArcSettings.size( ) );
             cumulativeComputationTimeHistory_.resize( singleArcSettings.size( ) );
@@ -1661,42 +1975,60 @@ public:
         }
 
 
-        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentArcInitialState;
-        std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
-        bool updateInitialStates = false;
+        std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList( singleArcDynamicsSimulators_.size( ) );
 
-        printPrePropagationMessages( );
-        // Propagate dynamics for each arc
+        // Determine sequences of arcs, where each sequence starts with an arc for which the initial state is provided. If
+        // initial state is NaN, this signals that the initial state is to be taken from previous arc.
+        std::vector< unsigned int > arcSequenceStartIndices;
+        bool updateInitialStates = false;
         for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
         {
-            // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from previous
-            // arc
             if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) ) )
             {
-                currentArcInitialState = initialStatesList.at( i );
+                arcSequenceStartIndices.push_back( i );
             }
             else
             {
-                currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                            equationsOfMotionNumericalSolution_.at( i - 1 ),
-                            singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
-
                 // If arc initial state is taken from previous arc, this indicates that the initial states in propagator settings
                 // need to be updated.
                 updateInitialStates = true;
             }
-            arcInitialStateList.push_back( currentArcInitialState );
-
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( ) );
-            dependentVariableHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( ) );
-            cumulativeComputationTimeHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getCumulativeComputationTimeHistory( ) );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
         }
+        arcSequenceStartIndices.push_back( singleArcDynamicsSimulators_.size( ) );
+
+        // Define function to propagate a single sequence of arcs
+        std::function< void( const unsigned int ) > propagateArcSequence = [ & ]( const unsigned int sequenceIndex )
+        {
+            for( unsigned int i = arcSequenceStartIndices.at( sequenceIndex );
+                 i < arcSequenceStartIndices.at( sequenceIndex + 1 ); i++ )
+            {
+                // Get arc initial state.
+                if( i == arcSequenceStartIndices.at( sequenceIndex ) )
+                {
+                    arcInitialStateList[ i ] = initialStatesList.at( i );
+                }
+                else
+                {
+                    arcInitialStateList[ i ] = getArcInitialStateFromPreviousArcResult(
+                                equationsOfMotionNumericalSolution_.at( i - 1 ),
+                                singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( ) );
+                }
+                propagateSingleArc( i, arcInitialStateList[ i ] );
+            }
+        };
+
+        printPrePropagationMessages( );
+
+        // Propagate dynamics for each sequence of arcs
+        unsigned int numberOfThreads = multiArcPropagatorSettings_->getNumberOfThreads( );
+        if( numberOfThreads != 1 && !areArcEnvironmentsIndependent_ )
+        {
+            throw std::runtime_error( "Error in multi-arc propagation, arcs can only be propagated concurrently if each arc "
+                                      "uses its own environment, without Body objects or stateful environment models shared "
+                                      "between arcs (see areEnvironmentsIndependent)." );
+        }
+        utilities::executeInParallel( arcSequenceStartIndices.size( ) - 1, propagateArcSequence, numberOfThreads );
+
         printPostPropagationMessages( );
 
         if( updateInitialStates )
@@ -1875,7 +2207,9 @@ public:
             // Create and set interpolators for ephemerides
             resetIntegratedMultiArcStatesWithEqualArcDynamics(
                         equationsOfMotionNumericalSolution_,
-                        singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
+                        ( arcWiseBodies_.size( ) > 0 ) ? integratedStateProcessors_ :
+                                                         singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ),
+                        arcStartTimes_ );
         }
         catch( const std::exception& caughtException )
         {
@@ -1911,6 +2245,18 @@ public:
         propagationTerminationReasons_[ arcIndex ] = propagationTerminationReason;
     }
 
+    //! Function to retrieve the list of environments in which each arc is propagated (empty if bodies_ is used for all arcs)
+    std::vector< simulation_setup::SystemOfBodies > getArcWiseBodies( )
+    {
+        return arcWiseBodies_;
+    }
+
+    //! Function to retrieve whether arc-wise environments are defined, and are independent (see areEnvironmentsIndependent)
+    bool getAreArcEnvironmentsIndependent( )
+    {
+        return areArcEnvironmentsIndependent_;
+    }
+
     void printPrePropagationMessages( )
     {
         if( multiArcPropagatorSettings_->getOutputSettings( )->printAnyOutput( ) )
@@ -1929,6 +2275,28 @@ public:
 
 protected:
 
+    //! Function to propagate a single arc, and store its results
+    /*!
+     *  Function to propagate a single arc, and store its results in the arc's entries of the member variables. This function
+     *  modifies only data associated with the given arc, and may be called concurrently for different arcs, provided that the
+     *  arcs' environments are independent.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of arc that is to be propagated
+     */
+    void propagateSingleArc( const unsigned int arcIndex,
+                             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& arcInitialState )
+    {
+        singleArcDynamicsSimulators_.at( arcIndex )->integrateEquationsOfMotion( arcInitialState );
+        equationsOfMotionNumericalSolution_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getEquationsOfMotionNumericalSolution( ) );
+        dependentVariableHistory_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getDependentVariableHistory( ) );
+        cumulativeComputationTimeHistory_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getCumulativeComputationTimeHistory( ) );
+        propagationTerminationReasons_[ arcIndex ] = singleArcDynamicsSimulators_.at( arcIndex )->getPropagationTerminationReason( );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution_[ arcIndex ].begin( )->first;
+    }
+
     //! List of maps of state history of numerically integrated states.
     /*!
      *  List of maps of state history of numerically integrated states. Each entry in the list contains data on a single arc.
@@ -1952,6 +2320,16 @@ protected:
 
     //! Propagator settings used by this objec
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > multiArcPropagatorSettings_;
+
+    //! List of environments in which each arc is propagated (empty if bodies_ is used for all arcs)
+    std::vector< simulation_setup::SystemOfBodies > arcWiseBodies_;
+
+    //! Boolean denoting whether arc-wise environments are defined, and are independent (see areEnvironmentsIndependent)
+    bool areArcEnvironmentsIndependent_;
+
+    //! Objects used to set the propagation results in bodies_, if arc-wise environments are used
+    std::map< IntegratedStateType, std::vector< std::shared_ptr<
+    IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
 };
 
 
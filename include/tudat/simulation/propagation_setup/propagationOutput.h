@@ -16,6 +16,7 @@
 #include "tudat/basics/utilities.h"
 #include "tudat/astro/basic_astro/astrodynamicsFunctions.h"
 #include "tudat/astro/aerodynamics/aerodynamics.h"
+#include "tudat/astro/propagators/dependentVariableListEvaluator.h"
 #include "tudat/astro/ephemerides/frameManager.h"
 #include "tudat/astro/propagators/dynamicsStateDerivativeModel.h"
 #include "tudat/astro/propagators/rotationalMotionStateDerivative.h"
@@ -131,7 +132,7 @@ bool isScalarDependentVariable(
  *  \param currentRotationMatrix Rotation matrix that is to be put into vector rerpesentation
  *  \return Column vector consisting of transpose of concatenated rows of currentRotationMatrix input.
  */
-Eigen::VectorXd getVectorRepresentationForRotationMatrix(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationMatrix(
         const Eigen::Matrix3d& currentRotationMatrix );
 
 //! Get the vector representation of a rotation matrix.
@@ -140,7 +141,7 @@ Eigen::VectorXd getVectorRepresentationForRotationMatrix(
  *  \param rotationFunction Function returning the rotation matrix that is to be put into vector rerpesentation
  *  \return Column vector consisting of transpose of concatenated rows of rotationFunction input.
  */
-Eigen::VectorXd getVectorRepresentationForRotationMatrixFunction(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationMatrixFunction(
         const std::function< Eigen::Matrix3d( ) > rotationFunction );
 
 //! Get the vector representation of a quaternion.
@@ -150,7 +151,7 @@ Eigen::VectorXd getVectorRepresentationForRotationMatrixFunction(
  *  \param rotationFunction Function returning the quaternion that is to be put inot vector rerpesentation
  *  \return Column vector consisting of transpose of concatenated rows of matrix representation of rotationFunction input.
  */
-Eigen::VectorXd getVectorRepresentationForRotationQuaternion(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationQuaternion(
         const std::function< Eigen::Quaterniond( ) > rotationFunction );
 
 
@@ -388,19 +389,38 @@ Eigen::VectorXd getConstellationMinimumVisibleDistance(
     const double limitAngle,
     const double time );
 
-//! Function to create a function returning a requested dependent variable value (of type VectorXd).
+//! Function to wrap a function returning a vector dependent variable into one writing it into a caller-provided block.
 /*!
- *  Function to create a function returning a requested dependent variable value (of type VectorXd), retrieved from
- *  environment and/or state derivative models.
+ *  Function to wrap a function returning a vector dependent variable into one writing it into a caller-provided block.
+ *  When the wrapped function returns a fixed-size vector (e.g. Eigen::Vector3d), no heap allocation takes place when
+ *  the resulting function is evaluated.
+ *  \param variableFunction Function returning the dependent variable value.
+ *  \return Function writing the dependent variable value into its input block (which must be of the correct size).
+ */
+template< typename VariableFunctionType >
+std::function< void( Eigen::Ref< Eigen::VectorXd > ) > createDependentVariableWriteFunction(
+        const VariableFunctionType& variableFunction )
+{
+    return [ = ]( Eigen::Ref< Eigen::VectorXd > dependentVariable )
+    {
+        dependentVariable = variableFunction( );
+    };
+}
+
+//! Function to create a function writing a requested dependent variable value (of type VectorXd) into a vector block.
+/*!
+ *  Function to create a function writing a requested dependent variable value (of type VectorXd) into a caller-provided
+ *  vector block, retrieved from environment and/or state derivative models.
  *  \param dependentVariableSettings Settings for dependent variable that is to be returned by function created here.
  *  \param bodies List of bodies to use in simulations (containing full environment).
  *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
  *  \param stateDerivativePartials List of state derivative partials used in simulations (sorted by dynamics type as key).
- *  \return Function returning requested dependent variable. NOTE: The environment and state derivative models need to
+ *  \return Pair with function writing requested dependent variable into its input block, and size of dependent variable.
+ *  NOTE: The environment and state derivative models need to
  *  be updated to current state and independent variable before computation is performed.
  */
 template< typename TimeType = double, typename StateScalarType = double >
-std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariableFunction(
+std::pair< std::function< void( Eigen::Ref< Eigen::VectorXd > ) >, int > getVectorDependentVariableWriteFunction(
         const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
         const simulation_setup::SystemOfBodies& bodies,
         const std::unordered_map< IntegratedStateType,
@@ -410,7 +430,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
         std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
 {
-    std::function< Eigen::VectorXd( ) > variableFunction;
+    std::function< void( Eigen::Ref< Eigen::VectorXd > ) > variableFunction;
     int parameterSize;
 
     // Retrieve base information on dependent variable
@@ -442,9 +462,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         {
             throw std::runtime_error( "Error, requested state of " + bodyWithProperty + " w.r.t. SSB, but SSB is not frame origin" );
         }
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &evaluateBivariateReferenceFunction< Eigen::Vector3d, Eigen::Vector3d >,
-                    functionToEvaluate, firstInput, secondInput );
+                    functionToEvaluate, firstInput, secondInput ) );
         parameterSize = 3;
         break;
     }
@@ -470,9 +490,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
             throw std::runtime_error( "Error, requested state of " + bodyWithProperty + " w.r.t. SSB, but SSB is not frame origin" );
         }
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &evaluateBivariateReferenceFunction< Eigen::Vector3d, Eigen::Vector3d >,
-                    functionToEvaluate, firstInput, secondInput );
+                    functionToEvaluate, firstInput, secondInput ) );
         parameterSize = 3;
 
 
@@ -547,8 +567,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     }
                 }
 
-                variableFunction = std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
-                                              listOfSuitableAccelerationModels.at( 0 ) );
+                variableFunction = createDependentVariableWriteFunction( std::bind( &basic_astrodynamics::AccelerationModel3d::getAcceleration,
+                                              listOfSuitableAccelerationModels.at( 0 ) ) );
                 parameterSize = 3;
             }
         }
@@ -578,9 +598,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                             sphericalHarmonicAcceleration );
 
                 directSphericalHarmonicAcceleration->setSaveSphericalHarmonicTermsSeparately( true );
-                variableFunction = std::bind(
+                variableFunction = createDependentVariableWriteFunction( std::bind(
                             &gravitation::SphericalHarmonicsGravitationalAccelerationModel::getConcatenatedAccelerationComponentNorms,
-                            directSphericalHarmonicAcceleration, accelerationComponentVariableSettings->componentIndices_ );
+                            directSphericalHarmonicAcceleration, accelerationComponentVariableSettings->componentIndices_ ) );
             }
             else if( std::dynamic_pointer_cast< gravitation::ThirdBodySphericalHarmonicsGravitationalAccelerationModel >(
                          sphericalHarmonicAcceleration ) != nullptr )
@@ -638,9 +658,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                             sphericalHarmonicAcceleration );
 
                 directSphericalHarmonicAcceleration->setSaveSphericalHarmonicTermsSeparately( true );
-                variableFunction = std::bind(
+                variableFunction = createDependentVariableWriteFunction( std::bind(
                             &gravitation::SphericalHarmonicsGravitationalAccelerationModel::getConcatenatedAccelerationComponents,
-                            directSphericalHarmonicAcceleration, accelerationComponentVariableSettings->componentIndices_ );
+                            directSphericalHarmonicAcceleration, accelerationComponentVariableSettings->componentIndices_ ) );
             }
             else if( std::dynamic_pointer_cast< gravitation::ThirdBodySphericalHarmonicsGravitationalAccelerationModel >(
                          sphericalHarmonicAcceleration ) != nullptr )
@@ -708,8 +728,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                                sphericalHarmonicAcceleration->getMaximumDegree( ),
                                sphericalHarmonicAcceleration->getMaximumOrder( ) );
 
-            variableFunction = std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
-                                          accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction );
+            variableFunction = createDependentVariableWriteFunction( std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
+                                          accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction ) );
 
             parameterSize = 3;
         }
@@ -744,7 +764,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                 std::vector< std::pair< int, int > > componentIndices = totalGravityFieldVariationSettings->componentIndices_;
                 unsigned int numberOfCoefficients =  componentIndices.size( );
 
-                variableFunction = [=]( )
+                variableFunction = createDependentVariableWriteFunction( [=]( )
                 {
                     Eigen::VectorXd coefficientCorrections =
                             Eigen::VectorXd::Zero( numberOfCoefficients );
@@ -754,7 +774,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                                     componentIndices.at( i ).first, componentIndices.at( i ).second );
                     }
                     return coefficientCorrections;
-                };
+                } );
 
                 parameterSize = numberOfCoefficients;
             }
@@ -791,7 +811,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                 std::vector< std::pair< int, int > > componentIndices = totalGravityFieldVariationSettings->componentIndices_;
                 int numberOfCoefficients =  componentIndices.size( );
 
-                variableFunction = [=]( )
+                variableFunction = createDependentVariableWriteFunction( [=]( )
                 {
                     Eigen::VectorXd coefficientCorrections =
                             Eigen::VectorXd::Zero( numberOfCoefficients );
@@ -801,7 +821,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                                     componentIndices.at( i ).first, componentIndices.at( i ).second );
                     }
                     return coefficientCorrections;
-                };
+                } );
 
                 parameterSize = numberOfCoefficients;
             }
@@ -854,8 +874,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         std::bind( &gravitation::GravityFieldVariations::getLastSineCorrection,
                                    gravityFieldVatiation );
 
-                variableFunction = std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
-                                              accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction );
+                variableFunction = createDependentVariableWriteFunction( std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
+                                              accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction ) );
 
             }
         }
@@ -908,8 +928,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         std::bind( &gravitation::GravityFieldVariations::getLastSineCorrection,
                                    gravityFieldVatiation );
 
-                variableFunction = std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
-                                              accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction );
+                variableFunction = createDependentVariableWriteFunction( std::bind( evaluateBivariateReferenceFunction< Eigen::VectorXd, Eigen::MatrixXd >,
+                                              accelerationFunction, cosineCorrectionFunction, sineCorrectionFunction ) );
 
             }
             parameterSize = 3 * accelerationVariableSettings->componentIndices_.size( );
@@ -926,10 +946,10 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
         }
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) ) );
         parameterSize = 3;
 
         break;
@@ -943,10 +963,10 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
         }
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) ) );
         parameterSize = 3;
 
         break;
@@ -955,7 +975,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
     {
         std::function< Eigen::Quaterniond( ) > rotationFunction =
                 std::bind( &simulation_setup::Body::getCurrentRotationToLocalFrame, bodies.at( bodyWithProperty ) );
-        variableFunction = std::bind( &getVectorRepresentationForRotationQuaternion, rotationFunction );
+        variableFunction = createDependentVariableWriteFunction( std::bind( &getVectorRepresentationForRotationQuaternion, rotationFunction ) );
         parameterSize = 9;
         break;
     }
@@ -984,7 +1004,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                            intermediateAerodynamicRotationVariableSaveSettings->baseFrame_,
                            intermediateAerodynamicRotationVariableSaveSettings->targetFrame_ );
 
-        variableFunction = std::bind( &getVectorRepresentationForRotationQuaternion, rotationFunction );
+        variableFunction = createDependentVariableWriteFunction( std::bind( &getVectorRepresentationForRotationQuaternion, rotationFunction ) );
         parameterSize = 9;
         break;
     }
@@ -997,9 +1017,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
         }
 
-        variableFunction = std::bind( &aerodynamics::AtmosphericFlightConditions::getCurrentAirspeedBasedVelocity,
+        variableFunction = createDependentVariableWriteFunction( std::bind( &aerodynamics::AtmosphericFlightConditions::getCurrentAirspeedBasedVelocity,
                                       std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                                          bodies.at( bodyWithProperty )->getFlightConditions( ) ) );
+                                          bodies.at( bodyWithProperty )->getFlightConditions( ) ) ) );
         parameterSize = 3;
         break;
     }
@@ -1017,8 +1037,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
             throw std::runtime_error( errorMessage );
         }
 
-        variableFunction = std::bind( &reference_frames::AerodynamicAngleCalculator::getCurrentGroundspeedBasedBodyFixedVelocity,
-                                      bodies.at( bodyWithProperty )->getFlightConditions( )->getAerodynamicAngleCalculator( ) );
+        variableFunction = createDependentVariableWriteFunction( std::bind( &reference_frames::AerodynamicAngleCalculator::getCurrentGroundspeedBasedBodyFixedVelocity,
+                                      bodies.at( bodyWithProperty )->getFlightConditions( )->getAerodynamicAngleCalculator( ) ) );
         parameterSize = 3;
         break;
     }
@@ -1041,8 +1061,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         std::function< Eigen::Matrix3d( ) > rotationFunction =
                 std::bind( &reference_frames::getTnwToInertialRotationFromFunctions,
                            vehicleStateFunction, centralBodyStateFunction, true );
-        variableFunction = std::bind(
-                    &getVectorRepresentationForRotationMatrixFunction, rotationFunction );
+        variableFunction = createDependentVariableWriteFunction( std::bind(
+                    &getVectorRepresentationForRotationMatrixFunction, rotationFunction ) );
 
         parameterSize = 9;
 
@@ -1067,8 +1087,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         std::function< Eigen::Matrix3d( ) > rotationFunction =
                 [=]( ){ return reference_frames::getRswSatelliteCenteredToInertialFrameRotationMatrix(
                         vehicleStateFunction( ) - centralBodyStateFunction( ) ); };
-        variableFunction = std::bind(
-                    &getVectorRepresentationForRotationMatrixFunction, rotationFunction );
+        variableFunction = createDependentVariableWriteFunction( std::bind(
+                    &getVectorRepresentationForRotationMatrixFunction, rotationFunction ) );
 
         parameterSize = 9;
 
@@ -1080,8 +1100,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         // Retrieve model responsible for computing accelerations of requested bodies.
         std::shared_ptr< RotationalMotionStateDerivative< StateScalarType, TimeType > > rotationalDynamicsModel =
                 getRotationalStateDerivativeModelForBody( bodyWithProperty, stateDerivativeModels );
-        variableFunction = std::bind( &RotationalMotionStateDerivative< StateScalarType, TimeType >::getTotalTorqueForBody,
-                                      rotationalDynamicsModel, bodyWithProperty );
+        variableFunction = createDependentVariableWriteFunction( std::bind( &RotationalMotionStateDerivative< StateScalarType, TimeType >::getTotalTorqueForBody,
+                                      rotationalDynamicsModel, bodyWithProperty ) );
         parameterSize = 3;
 
 
@@ -1120,8 +1140,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
             else
             {
                 //std::function< Eigen::Vector3d( ) > vectorFunction =
-                variableFunction = std::bind( &basic_astrodynamics::TorqueModel::getTorque,
-                                              listOfSuitableTorqueModels.at( 0 ) );
+                variableFunction = createDependentVariableWriteFunction( std::bind( &basic_astrodynamics::TorqueModel::getTorque,
+                                              listOfSuitableTorqueModels.at( 0 ) ) );
                 parameterSize = 3;
             }
         }
@@ -1180,8 +1200,8 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     &evaluateBivariateReferenceFunction< Eigen::Vector6d, Eigen::Vector6d >,
                     functionToEvaluate, firstInput, secondInput );
 
-        variableFunction = std::bind( &orbital_element_conversions::convertCartesianToKeplerianElementsFromFunctions< double >,
-                                      relativeStateFunction, effectiveGravitationalParameter );
+        variableFunction = createDependentVariableWriteFunction( std::bind( &orbital_element_conversions::convertCartesianToKeplerianElementsFromFunctions< double >,
+                                      relativeStateFunction, effectiveGravitationalParameter ) );
         parameterSize = 6;
 
 
@@ -1240,9 +1260,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     &evaluateBivariateReferenceFunction< Eigen::Vector6d, Eigen::Vector6d >,
                     functionToEvaluate, firstInput, secondInput );
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &orbital_element_conversions::convertCartesianToModifiedEquinoctialElementsFromStateFunction< double >,
-                    relativeStateFunction, effectiveGravitationalParameter );
+                    relativeStateFunction, effectiveGravitationalParameter ) );
         parameterSize = 6;
 
 
@@ -1257,9 +1277,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         std::function< Eigen::Quaterniond( ) > orientationFunctionOfCentralBody =
                 std::bind( &simulation_setup::Body::getCurrentRotationToLocalFrame, bodies.at( secondaryBody ) );
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &reference_frames::getBodyFixedCartesianPosition, positionFunctionOfCentralBody,
-                    positionFunctionOfRelativeBody, orientationFunctionOfCentralBody );
+                    positionFunctionOfRelativeBody, orientationFunctionOfCentralBody ) );
         parameterSize = 3;
         break;
     }
@@ -1272,9 +1292,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         std::function< Eigen::Quaterniond( ) > orientationFunctionOfCentralBody =
                 std::bind( &simulation_setup::Body::getCurrentRotationToLocalFrame, bodies.at( secondaryBody ) );
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &reference_frames::getBodyFixedSphericalPosition, positionFunctionOfCentralBody,
-                    positionFunctionOfRelativeBody, orientationFunctionOfCentralBody );
+                    positionFunctionOfRelativeBody, orientationFunctionOfCentralBody ) );
         parameterSize = 3;
         break;
     }
@@ -1286,9 +1306,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         std::function< Eigen::Vector3d( const Eigen::Quaterniond ) > eulerAngleFunction =
                 std::bind( &basic_mathematics::get313EulerAnglesFromQuaternion, std::placeholders::_1 );
 
-        variableFunction = std::bind(
+        variableFunction = createDependentVariableWriteFunction( std::bind(
                     &evaluateReferenceFunction< Eigen::Vector3d, Eigen::Quaterniond >,
-                    eulerAngleFunction, orientationFunctionOfBody );
+                    eulerAngleFunction, orientationFunctionOfBody ) );
         parameterSize = 3;
         break;
     }
@@ -1323,11 +1343,11 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
 
             if( partialFunction.second == 0 )
             {
-                variableFunction = [ = ]( ){ return Eigen::VectorXd::Zero( 18 ); };
+                variableFunction = createDependentVariableWriteFunction( [ = ]( ){ return Eigen::VectorXd::Zero( 18 ); } );
             }
             else
             {
-                variableFunction = std::bind( &getVectorFunctionFromBlockFunction, partialFunction.first, 3, 6 );
+                variableFunction = createDependentVariableWriteFunction( std::bind( &getVectorFunctionFromBlockFunction, partialFunction.first, 3, 6 ) );
             }
 
             parameterSize = 18;
@@ -1384,7 +1404,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                 }
             }
 
-            variableFunction = [ = ]( )
+            variableFunction = createDependentVariableWriteFunction( [ = ]( )
             {
                 Eigen::VectorXd variable = Eigen::VectorXd::Zero( 18 );
 
@@ -1397,7 +1417,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                 }
 
                 return variable;
-            };
+            } );
 
             parameterSize = 18;
         }
@@ -1424,7 +1444,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                             std::bind( &simulation_setup::Body::getPosition, bodies.at( minimumDistanceDependentVariable->bodiesToCheck_.at( i ) ) ) );
             }
 
-            variableFunction = std::bind( &getConstellationMinimumDistance, mainBodyPositionFunction, bodiesToCheckPositionFunctions );
+            variableFunction = createDependentVariableWriteFunction( std::bind( &getConstellationMinimumDistance, mainBodyPositionFunction, bodiesToCheckPositionFunctions ) );
             parameterSize = 2;
         }
         break;
@@ -1454,10 +1474,10 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                                        bodies.at( minimumDistanceDependentVariable->bodiesToCheck_.at( i ) ) ) );
             }
 
-            variableFunction = [=]( ){ return getConstellationMinimumVisibleDistance(
+            variableFunction = createDependentVariableWriteFunction( [=]( ){ return getConstellationMinimumVisibleDistance(
                                           stationPositionFunction, bodiesToCheckPositionFunctions,
                                           stationPointingAngleCalculator, minimumDistanceDependentVariable->elevationAngleLimit_,
-                            bodies.at( bodyWithProperty )->getDoubleTimeOfCurrentState( ) ); };
+                            bodies.at( bodyWithProperty )->getDoubleTimeOfCurrentState( ) ); } );
             parameterSize = 3;
         }
         break;
@@ -1474,7 +1494,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
         else
         {
-            variableFunction = [=]( )
+            variableFunction = createDependentVariableWriteFunction( [=]( )
             {
                 Eigen::VectorXd customVariables = customVariableSettings->customDependentVariableFunction_( );
                 if( customVariables.rows( ) != customVariableSettings->dependentVariableSize_ )
@@ -1482,7 +1502,7 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     throw std::runtime_error( "Error when retrieving custom dependent variable, actual size is different from pre-defined size" );
                 }
                 return customVariables;
-            };
+            } );
             parameterSize = customVariableSettings->dependentVariableSize_;
         }
         break;
@@ -1496,6 +1516,44 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
     return std::make_pair( variableFunction, parameterSize );
 }
 
+//! Function to create a function returning a requested dependent variable value (of type VectorXd).
+/*!
+ *  Function to create a function returning a requested dependent variable value (of type VectorXd), retrieved from
+ *  environment and/or state derivative models. The returned function creates a new vector on each call; use
+ *  getVectorDependentVariableWriteFunction to write the value into existing storage instead.
+ *  \param dependentVariableSettings Settings for dependent variable that is to be returned by function created here.
+ *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key).
+ *  \param stateDerivativePartials List of state derivative partials used in simulations (sorted by dynamics type as key).
+ *  \return Pair with function returning requested dependent variable, and size of dependent variable. NOTE: The
+ *  environment and state derivative models need to be updated to current state and independent variable before
+ *  computation is performed.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariableFunction(
+        const std::shared_ptr< SingleDependentVariableSaveSettings > dependentVariableSettings,
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels =
+        std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >( ),
+        const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
+        std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
+{
+    const std::pair< std::function< void( Eigen::Ref< Eigen::VectorXd > ) >, int > writeFunction =
+            getVectorDependentVariableWriteFunction< TimeType, StateScalarType >(
+                dependentVariableSettings, bodies, stateDerivativeModels, stateDerivativePartials );
+
+    const std::function< void( Eigen::Ref< Eigen::VectorXd > ) > variableWriteFunction = writeFunction.first;
+    const int parameterSize = writeFunction.second;
+    return std::make_pair( [ = ]( )
+    {
+        Eigen::VectorXd dependentVariable = Eigen::VectorXd( parameterSize );
+        variableWriteFunction( dependentVariable );
+        return dependentVariable;
+    }, parameterSize );
+}
+
 //! Acces element at index function
 /*!
  * Acces element at index function
@@ -2247,39 +2305,22 @@ std::function< double( ) > getDoubleDependentVariableFunction(
 }
 
 
-//! Function to return a vector containing only one value given by doubleFunction
-/*!
- *
- * \param doubleFunction Function returning the double value
- * \return The vector containing only one element
- */
-Eigen::VectorXd getVectorFromDoubleFunction( const std::function< double( ) >& doubleFunction );
-
-//! Function to evaluate a set of vector-returning functions and concatenate the results.
-/*!
- * Function to evaluate a set of vector-returning functions and concatenate the results.
- * \param vectorFunctionList List of functions returning vector variables (pairs denote function and return vector size)
- * \param totalSize Total size of concatenated vector (used as input for efficiency.
- * \return Concatenated results from input functions.
- */
-Eigen::VectorXd evaluateListOfVectorFunctions(
-        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList,
-        const int totalSize );
-
-//! Function to create a function that evaluates a list of dependent variables and concatenates the results.
+//! Function to create an object that evaluates a list of dependent variables and concatenates the results.
 /*!
- *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
+ *  Function to create an object that evaluates a list of dependent variables and concatenates the results, either into a
+ *  caller-provided vector (e.g. an entry of a ContiguousHistory) or into a newly created vector.
  *  Dependent variables functions are created inside this function from a list of settings on their required
  *  types/properties.
  *  \param saveSettings Object containing types and other properties of dependent variables.
  *  \param bodies List of bodies to use in simulations (containing full environment).
  *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key)
- *  \return Pair with function returning requested dependent variable values, and list variable names with start entries.
+ *  \return Pair with object evaluating requested dependent variable values, and list variable names with start entries.
  *  NOTE: The environment and state derivative models need to
  *  be updated to current state and independent variable before computation is performed.
  */
 template< typename TimeType = double, typename StateScalarType = double >
-std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > createDependentVariableListFunction(
+std::pair< std::shared_ptr< DependentVariableListEvaluator >, std::map< std::pair< int, int >, std::string > >
+createDependentVariableListEvaluator(
         const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables,
         const simulation_setup::SystemOfBodies& bodies,
         const std::unordered_map< IntegratedStateType,
@@ -2289,52 +2330,77 @@ std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >,
         const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
         std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
 {
-    // create list of vector parameters
-    std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList;
-    std::vector< std::pair< std::string, int > > vectorVariableList;
+    std::shared_ptr< DependentVariableListEvaluator > dependentVariableEvaluator =
+            std::make_shared< DependentVariableListEvaluator >( );
+    std::map< std::pair< int, int >, std::string > dependentVariableIds;
 
     for( std::shared_ptr< SingleDependentVariableSaveSettings > variable: dependentVariables )
     {
-        std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction;
+        const int startIndex = dependentVariableEvaluator->getTotalSize( );
+
         // Create double parameter
         if( isScalarDependentVariable( variable ) )
         {
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials );
+            dependentVariableEvaluator->addScalarVariable(
+                        getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials ) );
 #else
-            std::function< double( ) > doubleFunction =
-                    getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels );
+            dependentVariableEvaluator->addScalarVariable(
+                        getDoubleDependentVariableFunction( variable, bodies, stateDerivativeModels ) );
 #endif
-            vectorFunction = std::make_pair( std::bind( &getVectorFromDoubleFunction, doubleFunction ), 1 );
         }
         // Create vector parameter
         else
         {
 #if(TUDAT_BUILD_WITH_ESTIMATION_TOOLS )
-            vectorFunction = getVectorDependentVariableFunction(
-                        variable, bodies, stateDerivativeModels, stateDerivativePartials );
+            std::pair< std::function< void( Eigen::Ref< Eigen::VectorXd > ) >, int > vectorFunction =
+                    getVectorDependentVariableWriteFunction( variable, bodies, stateDerivativeModels, stateDerivativePartials );
 #else
-            vectorFunction =
-                    getVectorDependentVariableFunction( variable, bodies, stateDerivativeModels );
+            std::pair< std::function< void( Eigen::Ref< Eigen::VectorXd > ) >, int > vectorFunction =
+                    getVectorDependentVariableWriteFunction( variable, bodies, stateDerivativeModels );
 #endif
+            dependentVariableEvaluator->addVectorVariable( vectorFunction.first, vectorFunction.second );
         }
-        vectorFunctionList.push_back( vectorFunction );
-        vectorVariableList.push_back( std::make_pair( getDependentVariableId( variable ), vectorFunction.second ) );
-    }
 
-    // Set list of variable ids/indices in correc otder.
-    int totalVariableSize = 0;
-    std::map< std::pair< int, int >, std::string > dependentVariableIds;
-    for( std::pair< std::string, int > vectorVariable: vectorVariableList )
-    {
-        dependentVariableIds[ { totalVariableSize, vectorVariable.second } ] = vectorVariable.first;
-        totalVariableSize += vectorVariable.second;
+        // Set variable id/index
+        dependentVariableIds[ { startIndex, dependentVariableEvaluator->getTotalSize( ) - startIndex } ] =
+                getDependentVariableId( variable );
     }
 
-    // Create function conatenating function results.
-    return std::make_pair( std::bind( &evaluateListOfVectorFunctions, vectorFunctionList, totalVariableSize ),
-                           dependentVariableIds );
+    return std::make_pair( dependentVariableEvaluator, dependentVariableIds );
+}
+
+//! Function to create a function that evaluates a list of dependent variables and concatenates the results.
+/*!
+ *  Function to create a function that evaluates a list of dependent variables and concatenates the results.
+ *  Dependent variables functions are created inside this function from a list of settings on their required
+ *  types/properties.
+ *  \param saveSettings Object containing types and other properties of dependent variables.
+ *  \param bodies List of bodies to use in simulations (containing full environment).
+ *  \param stateDerivativeModels List of state derivative models used in simulations (sorted by dynamics type as key)
+ *  \return Pair with function returning requested dependent variable values, and list variable names with start entries.
+ *  NOTE: The environment and state derivative models need to
+ *  be updated to current state and independent variable before computation is performed.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::pair< std::function< Eigen::VectorXd( ) >, std::map< std::pair< int, int >, std::string > > createDependentVariableListFunction(
+        const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables,
+        const simulation_setup::SystemOfBodies& bodies,
+        const std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >& stateDerivativeModels =
+        std::unordered_map< IntegratedStateType,
+        std::vector< std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > > >( ),
+        const std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >& stateDerivativePartials =
+        std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >( ) )
+{
+    std::pair< std::shared_ptr< DependentVariableListEvaluator >, std::map< std::pair< int, int >, std::string > >
+            dependentVariableData = createDependentVariableListEvaluator< TimeType, StateScalarType >(
+                dependentVariables, bodies, stateDerivativeModels, stateDerivativePartials );
+
+    // Create function concatenating function results.
+    return std::make_pair( std::bind( static_cast< Eigen::VectorXd( DependentVariableListEvaluator::* )( ) const >(
+                                          &DependentVariableListEvaluator::evaluate ), dependentVariableData.first ),
+                           dependentVariableData.second );
 }
 
 } // namespace propagators
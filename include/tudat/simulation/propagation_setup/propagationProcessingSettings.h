@@ -89,6 +89,7 @@ public:
             std::make_shared< PropagationPrintSettings >( ) ):
         PropagatorProcessingSettings( clearNumericalSolutions, setIntegratedResult ),
         printSettings_( printSettings ),
+        useContiguousHistoryStorage_( false ),
         isPartOfMultiArc_( false ), arcIndex_( -1 ){ }
 
     virtual ~SingleArcPropagatorProcessingSettings( ){ }
@@ -98,6 +99,24 @@ public:
         return printSettings_;
     }
 
+    //! Function to set whether the propagation results are stored in contiguous memory during the propagation
+    /*!
+     *  Function to set whether the propagation results (state, dependent variable and computation time histories) are
+     *  stored in contiguous memory (as utilities::ContiguousHistory) during the propagation, instead of in a std::map with
+     *  one heap allocation per saved epoch. The std::map versions of the histories are then only created when they are
+     *  requested from the propagation results.
+     *  \param useContiguousHistoryStorage Boolean denoting whether contiguous history storage is to be used
+     */
+    void setUseContiguousHistoryStorage( const bool useContiguousHistoryStorage )
+    {
+        useContiguousHistoryStorage_ = useContiguousHistoryStorage;
+    }
+
+    bool getUseContiguousHistoryStorage( )
+    {
+        return useContiguousHistoryStorage_;
+    }
+
 
     bool printAnyOutput( )
     {
@@ -135,6 +154,9 @@ protected:
 
     const std::shared_ptr< PropagationPrintSettings > printSettings_;
 
+    //! Boolean denoting whether the propagation results are stored in contiguous memory during the propagation
+    bool useContiguousHistoryStorage_;
+
 private:
 
     void setAsMultiArc( const unsigned int arcIndex, const bool printArcIndex )
@@ -581,6 +581,30 @@ public:
         return outputSettings_;
     }
 
+    //! Function to retrieve the number of threads over which the arcs are to be distributed during propagation
+    /*!
+     * Function to retrieve the number of threads over which the arcs are to be distributed during propagation
+     * \return Number of threads over which the arcs are to be distributed (1 for serial propagation, 0 to use all
+     * available hardware threads)
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to reset the number of threads over which the arcs are to be distributed during propagation
+    /*!
+     * Function to reset the number of threads over which the arcs are to be distributed during propagation. Note that
+     * arcs can only be propagated concurrently if each arc uses its own environment, and these environments share no Body
+     * objects or environment models that store state (see MultiArcDynamicsSimulator and areEnvironmentsIndependent). Atmosphere
+     * models are not checked, so that an NRLMSISE00 atmosphere model may not be shared between the arc environments.
+     * \param numberOfThreads Number of threads over which the arcs are to be distributed (1 for serial propagation, 0 to
+     * use all available hardware threads)
+     */
+    void resetNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
 
 protected:
 
@@ -591,6 +615,9 @@ protected:
 
     //! List of initial states for each arc in propagation.
     std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > initialStateList_;
+
+    //! Number of threads over which the arcs are to be distributed (1 for serial propagation, 0 for all hardware threads)
+    unsigned int numberOfThreads_ = 1;
 };
 
 template< typename StateScalarType = double, typename TimeType = double >
@@ -1694,6 +1721,9 @@ customStatePropagatorSettings(
  *  multi-arc settings.
  *  \param multiArcSettings Multi-arc settings that are to be extended
  *  \param numberofArcs Number of arcs in which the single-arc dynamics is to be split
+ *  \param arcWiseBodies List of environments (one per arc) in which the single-arc acceleration models are to be recreated
+ *  for each arc. If empty (default), the single-arc acceleration models are used directly in each arc. If non-empty, the
+ *  single-arc settings must have been created from acceleration settings.
  *  \return Multi-arc propagator settings by merging an existing multi-arc with single-arc settings
  */
 template< typename StateScalarType = double, typename TimeType = double >
@@ -1701,8 +1731,18 @@ template< typename StateScalarType = double, typename TimeType = double >
 std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getExtendedMultiPropagatorSettings(
         const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > singleArcSettings,
         const std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > multiArcSettings,
-        const int numberofArcs )
+        const int numberofArcs,
+        const std::vector< simulation_setup::SystemOfBodies >& arcWiseBodies =
+        std::vector< simulation_setup::SystemOfBodies >( ) )
 {
+    if( arcWiseBodies.size( ) > 0 && static_cast< int >( arcWiseBodies.size( ) ) != numberofArcs )
+    {
+        throw std::runtime_error(
+                    "Error when making multi-arc propagator settings from single arc. Number of arc-wise environments (" +
+                    std::to_string( arcWiseBodies.size( ) ) + ") is incompatible with number of arcs (" +
+                    std::to_string( numberofArcs ) + ")." );
+    }
+
     std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType, TimeType > > > constituentSingleArcSettings;
 
     // Check parameter type
@@ -1739,7 +1779,23 @@ std::shared_ptr< MultiArcPropagatorSettings< StateScalarType, TimeType > > getEx
 
             // Create full accelerations map
             basic_astrodynamics::AccelerationMap multiArcAccelerationsMap = currentArcTranslationalSettings->getAccelerationsMap( );
-            basic_astrodynamics::AccelerationMap fullAccelerationsMap = singleArcTranslationalSettings->getAccelerationsMap( );
+            basic_astrodynamics::AccelerationMap fullAccelerationsMap;
+            if( arcWiseBodies.size( ) > 0 )
+            {
+                if( singleArcTranslationalSettings->getAccelerationSettingsMap( ).size( ) == 0 )
+                {
+                    throw std::runtime_error(
+                                "Error when making multi-arc propagator settings from single arc with arc-wise environments, "
+                                "single-arc acceleration settings not defined." );
+                }
+                fullAccelerationsMap = simulation_setup::createAccelerationModelsMap(
+                            arcWiseBodies.at( i ), singleArcTranslationalSettings->getAccelerationSettingsMap( ),
+                            singleArcTranslationalSettings->bodiesToIntegrate_, singleArcTranslationalSettings->centralBodies_ );
+            }
+            else
+            {
+                fullAccelerationsMap = singleArcTranslationalSettings->getAccelerationsMap( );
+            }
             fullAccelerationsMap.insert( multiArcAccelerationsMap.begin( ), multiArcAccelerationsMap.end( ) );
 
             // Create full list of propagated bodies
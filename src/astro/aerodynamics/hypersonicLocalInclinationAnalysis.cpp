@@ -13,6 +13,12 @@
  *
  */
 
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <sstream>
 #include <string>
 
 #include <boost/bind/bind.hpp>
@@ -26,6 +32,7 @@ using namespace boost::placeholders;
 
 #include <Eigen/Geometry>
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/astro/aerodynamics/aerodynamics.h"
@@ -178,14 +185,17 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients )
+        const bool savePressureCoefficients,
+        const unsigned int numberOfThreads,
+        const std::string& coefficientCacheDirectory )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },true, false ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods ),
-      savePressureCoefficients_( savePressureCoefficients )
+      savePressureCoefficients_( savePressureCoefficients ),
+      numberOfThreads_( numberOfThreads ),
+      coefficientCacheDirectory_( coefficientCacheDirectory )
 {
     // Set geometry if it is a single surface.
     if ( std::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
@@ -255,18 +265,39 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
+    // Store panel properties of all parts in contiguous arrays, and allocate memory for panel inclinations and
+    // pressure coefficients.
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelAreas_.resize( vehicleParts_.size( ) );
+    panelMomentArmsCrossNormals_.resize( vehicleParts_.size( ) );
     inclination_.resize( vehicleParts_.size( ) );
     pressureCoefficient_.resize( vehicleParts_.size( ) );
     for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        int numberOfPanelLines = vehicleParts_[ i ]->getNumberOfLines( ) - 1;
+        int numberOfPanelPoints = vehicleParts_[ i ]->getNumberOfPoints( ) - 1;
+        int numberOfPanels = numberOfPanelLines * numberOfPanelPoints;
+
+        panelSurfaceNormals_[ i ].resize( 3, numberOfPanels );
+        panelAreas_[ i ].resize( numberOfPanels );
+        panelMomentArmsCrossNormals_[ i ].resize( 3, numberOfPanels );
+        for ( int j = 0 ; j < numberOfPanelLines ; j++ )
         {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+            for ( int k = 0 ; k < numberOfPanelPoints ; k++ )
+            {
+                int panelIndex = j * numberOfPanelPoints + k;
+                Eigen::Vector3d panelSurfaceNormal = vehicleParts_[ i ]->getPanelSurfaceNormal( j, k );
+                Eigen::Vector3d referenceDistance =
+                        vehicleParts_[ i ]->getPanelCentroid( j, k ) - momentReferencePoint_;
+
+                panelSurfaceNormals_[ i ].col( panelIndex ) = panelSurfaceNormal;
+                panelAreas_[ i ]( panelIndex ) = vehicleParts_[ i ]->getPanelArea( j, k );
+                panelMomentArmsCrossNormals_[ i ].col( panelIndex ) = referenceDistance.cross( panelSurfaceNormal );
+            }
         }
+
+        inclination_[ i ] = Eigen::VectorXd::Zero( numberOfPanels );
+        pressureCoefficient_[ i ] = Eigen::VectorXd::Zero( numberOfPanels );
     }
 
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
@@ -281,7 +312,23 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    // Read coefficients from cache file if possible; otherwise, generate them (and write them to the cache file).
+    std::string cacheFileName;
+    bool areCoefficientsReadFromCache = false;
+    if( ( coefficientCacheDirectory_ != "" ) && !savePressureCoefficients_ )
+    {
+        cacheFileName = getCoefficientCacheFileName( );
+        areCoefficientsReadFromCache = readCoefficientsFromCacheFile( cacheFileName );
+    }
+
+    if( !areCoefficientsReadFromCache )
+    {
+        generateCoefficients( );
+        if( cacheFileName != "" )
+        {
+            writeCoefficientsToCacheFile( cacheFileName );
+        }
+    }
     createInterpolator( );
 }
 
@@ -301,56 +348,51 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
-
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    const unsigned int numberOfMachPoints = dataPointsOfIndependentVariables_[ 0 ].size( );
+    const unsigned int numberOfAngleOfSideslipPoints = dataPointsOfIndependentVariables_[ 2 ].size( );
+    const unsigned int numberOfAttitudes =
+            dataPointsOfIndependentVariables_[ 1 ].size( ) * numberOfAngleOfSideslipPoints;
+
+    // Mutex for storage of pressure coefficients, which is the only shared container that is resized by the tasks.
+    std::mutex pressureCoefficientListMutex;
+
+    // Iterate over all combinations of independent variables, with a single task per attitude. Each task writes to
+    // its own entries of aerodynamicCoefficients_ and isCoefficientGenerated_ only.
+    utilities::executeInParallel(
+                numberOfAttitudes, [ & ]( const unsigned int attitudeIndex )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 1 ] = attitudeIndex / numberOfAngleOfSideslipPoints;
+        independentVariableIndices[ 2 ] = attitudeIndex % numberOfAngleOfSideslipPoints;
+
+        // Determine panel inclinations for current attitude.
+        std::vector< Eigen::VectorXd > panelInclinations;
+        computePanelInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                                  dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ],
+                                  panelInclinations );
+
+        std::vector< Eigen::VectorXd > panelPressureCoefficients;
+        for ( unsigned int i = 0 ; i < numberOfMachPoints ; i++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
-            {
-                independentVariableIndices[ 2 ] = k;
+            independentVariableIndices[ 0 ] = i;
+            aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                        dataPointsOfIndependentVariables_[ 0 ][ i ], panelInclinations, panelPressureCoefficients );
+            isCoefficientGenerated_( independentVariableIndices ) = 1;
 
-                determineVehicleCoefficients( independentVariableIndices );
+            if( savePressureCoefficients_ )
+            {
+                std::vector< std::vector< std::vector< double > > > pressureCoefficientGrid =
+                        getPressureCoefficientGrid( panelPressureCoefficients );
+                std::lock_guard< std::mutex > pressureCoefficientListLock( pressureCoefficientListMutex );
+                pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficientGrid;
             }
-
         }
-    }
+    }, numberOfThreads_ );
 }
 
 //! Generate aerodynamic coefficients at a single set of independent variables.
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
-{
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
-
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
-    {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
-
-    if( savePressureCoefficients_ )
-    {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
-    }
-
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
-}
-
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
 {
     // Declare and determine angles of attack and sideslip for analysis.
     double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
@@ -359,14 +401,11 @@ Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
     double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
             [ independentVariableIndices[ 2 ] ];
 
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
+    // Check whether the inclinations of the vehicle have already been computed.
     if ( previouslyComputedInclinations_.count( std::pair< double, double >(
                                                     angleOfAttack, angleOfSideslip ) ) == 0 )
     {
-        // Determine panel inclinations for part.
+        // Determine panel inclinations for vehicle.
         determineInclinations( angleOfAttack, angleOfSideslip );
 
         // Add panel inclinations to container
@@ -381,53 +420,62 @@ Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
                     angleOfAttack, angleOfSideslip ) ];
     }
 
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                inclination_, pressureCoefficient_ );
 
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
+    if( savePressureCoefficients_ )
+    {
+        pressureCoefficientList_[ independentVariableIndices ] = getPressureCoefficientGrid( pressureCoefficient_ );
+    }
 
-    return partCoefficients;
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Determine aerodynamic coefficients of the full vehicle.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber,
+        const std::vector< Eigen::VectorXd >& panelInclinations,
+        std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
+    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
+    // to coefficients.
+    panelPressureCoefficients.resize( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+    {
+        // Set pressure coefficients of part for given independent variables.
+        panelPressureCoefficients[ i ].setZero( panelInclinations[ i ].rows( ) );
+        updateCompressionPressures( machNumber, i, panelInclinations[ i ], panelPressureCoefficients[ i ] );
+        updateExpansionPressures( machNumber, i, panelInclinations[ i ], panelPressureCoefficients[ i ] );
+
+        // Calculate force and moment coefficients from pressure coefficients.
+        Vector6d partCoefficients;
+        partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( i, panelPressureCoefficients[ i ] );
+        partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( i, panelPressureCoefficients[ i ] );
+
+        coefficients += partCoefficients;
+    }
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+    return coefficients;
 }
 
 //! Determine force coefficients from pressure coefficients.
 Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+        const int partNumber, const Eigen::VectorXd& panelPressureCoefficients ) const
 {
     // Declare force coefficient vector and intialize to zeros.
     Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
 
     // Loop over all panels and add pressures, scaled by panel area, to force
     // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    const Eigen::Matrix3Xd& panelSurfaceNormals = panelSurfaceNormals_[ partNumber ];
+    const Eigen::VectorXd& panelAreas = panelAreas_[ partNumber ];
+    for ( int i = 0 ; i < panelAreas.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
+        forceCoefficients -= panelPressureCoefficients( i ) * panelAreas( i ) * panelSurfaceNormals.col( i );
     }
 
     // Normalize result by reference area.
@@ -438,29 +486,17 @@ Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
 
 //! Determine moment coefficients from pressure coefficients.
 Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+        const int partNumber, const Eigen::VectorXd& panelPressureCoefficients ) const
 {
     // Declare moment coefficient vector and intialize to zeros.
     Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
 
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
-
     // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    const Eigen::Matrix3Xd& panelMomentArmsCrossNormals = panelMomentArmsCrossNormals_[ partNumber ];
+    const Eigen::VectorXd& panelAreas = panelAreas_[ partNumber ];
+    for ( int i = 0 ; i < panelAreas.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        momentCoefficients -= panelPressureCoefficients( i ) * panelAreas( i ) * panelMomentArmsCrossNormals.col( i );
     }
 
     // Scale result by reference length and area.
@@ -469,9 +505,17 @@ Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
     return momentCoefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
+//! Determines the inclination angle of panels on all parts.
 void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
                                                                 const double angleOfSideslip )
+{
+    computePanelInclinations( angleOfAttack, angleOfSideslip, inclination_ );
+}
+
+//! Determine inclination angles of the panels of all parts.
+void HypersonicLocalInclinationAnalysis::computePanelInclinations(
+        const double angleOfAttack, const double angleOfSideslip,
+        std::vector< Eigen::VectorXd >& panelInclinations ) const
 {
     // Declare free-stream velocity vector.
     Eigen::Vector3d freestreamVelocityDirection;
@@ -484,33 +528,28 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
     freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
     freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
 
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Loop over all panels of all vehicle parts and set inclination angles.
+    panelInclinations.resize( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        // Determine cosine of inclination angle from inner product between
+        // surface normal and free-stream direction.
+        const Eigen::Matrix3Xd& panelSurfaceNormals = panelSurfaceNormals_[ k ];
+        panelInclinations[ k ].resize( panelSurfaceNormals.cols( ) );
+        for ( int i = 0 ; i < panelSurfaceNormals.cols( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
+            // Set inclination angle.
+            panelInclinations[ k ]( i ) = PI / 2.0 - acos(
+                        panelSurfaceNormals.col( i ).dot( freestreamVelocityDirection ) );
         }
     }
 }
 
 //! Determine compression pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+                                                                     const int partNumber,
+                                                                     const Eigen::VectorXd& panelInclinations,
+                                                                     Eigen::VectorXd& panelPressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
@@ -525,9 +564,11 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
 
     case 1:
+        // Determine stagnation point pressure coefficients. Value is computed once
+        // here to prevent its calculation in inner loop.
         pressureFunction =
                 std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                           stagnationPressureCoefficient );
+                           computeStagnationPressure( machNumber, ratioOfSpecificHeats ) );
         break;
 
     case 2:
@@ -578,23 +619,21 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < panelInclinations.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( panelInclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            panelPressureCoefficients( i ) = pressureFunction( panelInclinations( i ) );
         }
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+                                                                   const int partNumber,
+                                                                   const Eigen::VectorXd& panelInclinations,
+                                                                   Eigen::VectorXd& panelPressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
@@ -621,17 +660,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < panelInclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( panelInclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
+                // If panel inclination is negative, calculate pressure using
+                // Van Dyke unified method.
+                panelPressureCoefficients( i ) = pressureFunction( );
             }
         }
     }
@@ -670,17 +705,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < panelInclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( panelInclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure using
+                // Van Dyke unified method.
+                panelPressureCoefficients( i ) = pressureFunction( panelInclinations( i ) );
             }
         }
     }
@@ -693,5 +724,166 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
     }
 }
 
+//! Function to convert the pressure coefficients of all panels to a per-part, per-line, per-point list
+std::vector< std::vector< std::vector< double > > > HypersonicLocalInclinationAnalysis::getPressureCoefficientGrid(
+        const std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const
+{
+    std::vector< std::vector< std::vector< double > > > pressureCoefficientGrid( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    {
+        int numberOfPanelPoints = vehicleParts_[ i ]->getNumberOfPoints( ) - 1;
+        pressureCoefficientGrid[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
+        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        {
+            pressureCoefficientGrid[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ), 0.0 );
+            if( j < vehicleParts_[ i ]->getNumberOfLines( ) - 1 )
+            {
+                for ( int k = 0 ; k < numberOfPanelPoints ; k++ )
+                {
+                    pressureCoefficientGrid[ i ][ j ][ k ] =
+                            panelPressureCoefficients[ i ]( j * numberOfPanelPoints + k );
+                }
+            }
+        }
+    }
+    return pressureCoefficientGrid;
+}
+
+//! Function to update a 64-bit FNV-1a hash with the binary representation of a set of values
+/*!
+ *  Function to update a 64-bit FNV-1a hash with the binary representation of a set of values
+ *  \param hash Hash that is to be updated (modified by reference)
+ *  \param data Pointer to first value
+ *  \param numberOfBytes Total size of the values, in bytes
+ */
+static void updateCoefficientCacheHash( uint64_t& hash, const void* data, const std::size_t numberOfBytes )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < numberOfBytes; i++ )
+    {
+        hash ^= static_cast< uint64_t >( bytes[ i ] );
+        hash *= 1099511628211ULL;
+    }
+}
+
+//! Identifier (and version) of the format of the coefficient cache files
+static const uint64_t coefficientCacheFileFormatIdentifier = 0x48594c4941303031ULL;
+
+//! Function to retrieve the name of the cache file for the current geometry and settings
+std::string HypersonicLocalInclinationAnalysis::getCoefficientCacheFileName( ) const
+{
+    uint64_t hash = 14695981039346656037ULL;
+    updateCoefficientCacheHash( hash, &coefficientCacheFileFormatIdentifier, sizeof( uint64_t ) );
+
+    // Add independent variables and settings to hash
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
+    {
+        uint64_t numberOfDataPoints = dataPointsOfIndependentVariables_[ i ].size( );
+        updateCoefficientCacheHash( hash, &numberOfDataPoints, sizeof( uint64_t ) );
+        updateCoefficientCacheHash( hash, dataPointsOfIndependentVariables_[ i ].data( ),
+                                    numberOfDataPoints * sizeof( double ) );
+    }
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        updateCoefficientCacheHash( hash, selectedMethods_[ i ].data( ), selectedMethods_[ i ].size( ) * sizeof( int ) );
+    }
+    double referenceQuantities[ 6 ] = { referenceArea_, referenceLength_, momentReferencePoint_( 0 ),
+                                        momentReferencePoint_( 1 ), momentReferencePoint_( 2 ), ratioOfSpecificHeats };
+    updateCoefficientCacheHash( hash, referenceQuantities, sizeof( referenceQuantities ) );
+
+    // Add panel geometry to hash
+    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
+    {
+        uint64_t numberOfPanels = panelAreas_[ i ].rows( );
+        updateCoefficientCacheHash( hash, &numberOfPanels, sizeof( uint64_t ) );
+        updateCoefficientCacheHash( hash, panelSurfaceNormals_[ i ].data( ), 3 * numberOfPanels * sizeof( double ) );
+        updateCoefficientCacheHash( hash, panelAreas_[ i ].data( ), numberOfPanels * sizeof( double ) );
+        updateCoefficientCacheHash( hash, panelMomentArmsCrossNormals_[ i ].data( ),
+                                    3 * numberOfPanels * sizeof( double ) );
+    }
+
+    std::ostringstream fileNameStream;
+    fileNameStream << "hypersonicLocalInclinationCoefficients_" << std::hex << std::setw( 16 ) << std::setfill( '0' )
+                   << hash << ".bin";
+    return ( boost::filesystem::path( coefficientCacheDirectory_ ) / fileNameStream.str( ) ).string( );
+}
+
+//! Function to read the aerodynamic coefficients from a cache file
+bool HypersonicLocalInclinationAnalysis::readCoefficientsFromCacheFile( const std::string& fileName )
+{
+    std::ifstream cacheFile( fileName, std::ios::binary );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    // Check file format and size of coefficient tables
+    uint64_t fileHeader[ 4 ];
+    cacheFile.read( reinterpret_cast< char* >( fileHeader ), sizeof( fileHeader ) );
+    if( !cacheFile.good( ) || fileHeader[ 0 ] != coefficientCacheFileFormatIdentifier )
+    {
+        return false;
+    }
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        if( fileHeader[ i + 1 ] != dataPointsOfIndependentVariables_[ i ].size( ) )
+        {
+            return false;
+        }
+    }
+
+    // Read coefficients, and only set them if the file is complete
+    std::vector< double > coefficientData( 6 * aerodynamicCoefficients_.num_elements( ) );
+    cacheFile.read( reinterpret_cast< char* >( coefficientData.data( ) ), coefficientData.size( ) * sizeof( double ) );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        aerodynamicCoefficients_.data( )[ i ] = Eigen::Map< const Vector6d >( coefficientData.data( ) + 6 * i );
+    }
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+    return true;
+}
+
+//! Function to write the aerodynamic coefficients to a cache file
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToCacheFile( const std::string& fileName ) const
+{
+    // Check if cache directory exists; create it if it doesn't.
+    if( !boost::filesystem::exists( coefficientCacheDirectory_ ) )
+    {
+        boost::filesystem::create_directories( coefficientCacheDirectory_ );
+    }
+
+    std::string temporaryFileName = fileName + ".tmp" + std::to_string( std::random_device( )( ) );
+    {
+        std::ofstream cacheFile( temporaryFileName, std::ios::binary );
+        uint64_t fileHeader[ 4 ] = { coefficientCacheFileFormatIdentifier, dataPointsOfIndependentVariables_[ 0 ].size( ),
+                                     dataPointsOfIndependentVariables_[ 1 ].size( ),
+                                     dataPointsOfIndependentVariables_[ 2 ].size( ) };
+        cacheFile.write( reinterpret_cast< const char* >( fileHeader ), sizeof( fileHeader ) );
+        for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+        {
+            cacheFile.write( reinterpret_cast< const char* >( aerodynamicCoefficients_.data( )[ i ].data( ) ),
+                             6 * sizeof( double ) );
+        }
+        if( !cacheFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing hypersonic local inclination coefficients to cache file " +
+                                      temporaryFileName );
+        }
+    }
+
+    boost::system::error_code renameError;
+    boost::filesystem::rename( temporaryFileName, fileName, renameError );
+    if( renameError )
+    {
+        boost::filesystem::remove( temporaryFileName, renameError );
+    }
+}
+
 } // namespace aerodynamics
 } // namespace tudat
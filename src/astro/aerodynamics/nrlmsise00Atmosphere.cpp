@@ -10,6 +10,8 @@
 
 #include "tudat/astro/aerodynamics/nrlmsise00Atmosphere.h"
 #include "tudat/math/basic/mathematicalConstants.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 //! Tudat library namespace.
@@ -18,102 +20,357 @@ namespace tudat
 namespace aerodynamics
 {
 
+//! Number of entries of the nrlmsise_output struct that are tabulated (d[0]-d[8], t[0], t[1])
+static const unsigned int NUMBER_OF_TABULATED_OUTPUTS = 11;
+
 void NRLMSISE00Atmosphere::computeProperties(
         const double altitude, const double longitude,
         const double latitude, const double time )
 {
-    // Compute the hash key
-    size_t hashKey = hashFunc( altitude, longitude, latitude, time );
-
-    // If hash key is same do nothing
-    if (hashKey == hashKey_)
+    // If properties of current state are already computed, do nothing
+    for( unsigned int i = 0; i < numberOfValidStates_; i++ )
     {
-        return;
+        const NRLMSISE00StateProperties& storedProperties = computedProperties_[ i ];
+        if( storedProperties.altitude == altitude && storedProperties.longitude == longitude &&
+                storedProperties.latitude == latitude && storedProperties.time == time )
+        {
+            currentStateIndex_ = i;
+            return;
+        }
     }
-    hashKey_ = hashKey;
 
-    // Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-                altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
+    // Compute properties in place of the oldest stored state (only marked as valid once computation is finished)
+    NRLMSISE00StateProperties& properties = computedProperties_[ nextStateIndex_ ];
+    properties.altitude = TUDAT_NAN;
 
-    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.alt    = altitude * 1.0E-3; // m to km
-    input_.year   = inputData_.year;
-    input_.doy    = inputData_.dayOfTheYear;
-    input_.sec    = inputData_.secondOfTheDay;
-    input_.lst    = inputData_.localSolarTime;
-    input_.f107   = inputData_.f107;
-    input_.f107A  = inputData_.f107a;
-    input_.ap     = inputData_.apDaily;
-    input_.ap_a   = &aph_;
+    // Retrieve input data.
+    if( solarActivityTable_ != nullptr )
+    {
+        solarActivityTable_->updateNRLMSISE00Input( properties.inputData, longitude, time, false, TUDAT_NAN );
+    }
+    else
+    {
+        properties.inputData = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude, time );
+    }
 
-    // Call NRLMSISE00
-    gtd7(&input_, &flags_, &output_);
+    // Call NRLMSISE00 (or its tabulated approximation)
+    if( tabulationSettings_ == nullptr ||
+            !computeTabulatedOutput( properties.inputData, altitude, latitude, properties.output ) )
+    {
+        evaluateModel( properties.inputData, altitude, longitude, latitude,
+                       properties.inputData.secondOfTheDay, properties.inputData.localSolarTime, properties.output );
+    }
+    const nrlmsise_output& output = properties.output;
 
     // Retrieve density and temperature
-    density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
-    temperature_ = output_.t[1];
+    properties.density = output.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
+    properties.temperature = output.t[1];
 
     // Get number densities
-    numberDensities_.resize(8);
-    numberDensities_[0] = output_.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
-    numberDensities_[1] = output_.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
-    numberDensities_[2] = output_.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
-    numberDensities_[3] = output_.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
-    numberDensities_[4] = output_.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
-    numberDensities_[5] = output_.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
-    numberDensities_[6] = output_.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
-    numberDensities_[7] = output_.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
+    std::vector< double >& numberDensities = properties.numberDensities;
+    numberDensities.resize(8);
+    numberDensities[0] = output.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
+    numberDensities[1] = output.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
+    numberDensities[2] = output.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
+    numberDensities[3] = output.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
+    numberDensities[4] = output.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
+    numberDensities[5] = output.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
+    numberDensities[6] = output.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
+    numberDensities[7] = output.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
 
     // Get average number density
     double sumOfNumberDensity = 0.0 ;
-    for( unsigned int i = 0 ; i < numberDensities_.size( ) ; i++)
+    for( unsigned int i = 0 ; i < numberDensities.size( ) ; i++)
     {
-        sumOfNumberDensity += numberDensities_[ i ];
+        sumOfNumberDensity += numberDensities[ i ];
     }
-    averageNumberDensity_ = sumOfNumberDensity / double( numberDensities_.size( ) );
+    properties.averageNumberDensity = sumOfNumberDensity / double( numberDensities.size( ) );
 
     // Mean molar mass (Thermodynamics an Engineering Approach, Michael A. Boles)
-    meanMolarMass_ = numberDensities_[0] * gasComponentProperties_.molarMassHelium;
-    meanMolarMass_ += numberDensities_[1] * gasComponentProperties_.molarMassAtomicOxygen;
-    meanMolarMass_ += numberDensities_[2] * gasComponentProperties_.molarMassNitrogen;
-    meanMolarMass_ += numberDensities_[3] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ += numberDensities_[4] * gasComponentProperties_.molarMassArgon;
-    meanMolarMass_ += numberDensities_[5] * gasComponentProperties_.molarMassAtomicHydrogen;
-    meanMolarMass_ += numberDensities_[6] * gasComponentProperties_.molarMassAtomicNitrogen;
-    meanMolarMass_ += numberDensities_[7] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ = meanMolarMass_ / sumOfNumberDensity ;
+    double meanMolarMass = numberDensities[0] * gasComponentProperties_.molarMassHelium;
+    meanMolarMass += numberDensities[1] * gasComponentProperties_.molarMassAtomicOxygen;
+    meanMolarMass += numberDensities[2] * gasComponentProperties_.molarMassNitrogen;
+    meanMolarMass += numberDensities[3] * gasComponentProperties_.molarMassOxygen;
+    meanMolarMass += numberDensities[4] * gasComponentProperties_.molarMassArgon;
+    meanMolarMass += numberDensities[5] * gasComponentProperties_.molarMassAtomicHydrogen;
+    meanMolarMass += numberDensities[6] * gasComponentProperties_.molarMassAtomicNitrogen;
+    meanMolarMass += numberDensities[7] * gasComponentProperties_.molarMassOxygen;
+    properties.meanMolarMass = meanMolarMass / sumOfNumberDensity ;
 
     // Speed of sound
-    speedOfSound_ = aerodynamics::computeSpeedOfSound(
-                temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+    properties.speedOfSound = aerodynamics::computeSpeedOfSound(
+                properties.temperature, specificHeatRatio_, molarGasConstant_ / properties.meanMolarMass );
 
     // Collision diameter
-    weightedAverageCollisionDiameter_ = numberDensities_[0]* gasComponentProperties_.diameterHelium ;
-    weightedAverageCollisionDiameter_ += numberDensities_[1]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[2]* gasComponentProperties_.diameterNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[3]* gasComponentProperties_.diameterOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[4]* gasComponentProperties_.diameterArgon ;
-    weightedAverageCollisionDiameter_ += numberDensities_[5]* gasComponentProperties_.diameterAtomicHydrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[6]* gasComponentProperties_.diameterAtomicNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[7]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ = weightedAverageCollisionDiameter_ / sumOfNumberDensity;
+    double weightedAverageCollisionDiameter = numberDensities[0]* gasComponentProperties_.diameterHelium ;
+    weightedAverageCollisionDiameter += numberDensities[1]* gasComponentProperties_.diameterAtomicOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[2]* gasComponentProperties_.diameterNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[3]* gasComponentProperties_.diameterOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[4]* gasComponentProperties_.diameterArgon ;
+    weightedAverageCollisionDiameter += numberDensities[5]* gasComponentProperties_.diameterAtomicHydrogen ;
+    weightedAverageCollisionDiameter += numberDensities[6]* gasComponentProperties_.diameterAtomicNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[7]* gasComponentProperties_.diameterAtomicOxygen ;
+    properties.weightedAverageCollisionDiameter = weightedAverageCollisionDiameter / sumOfNumberDensity;
 
     // Mean free path.
-    meanFreePath_ = aerodynamics::computeMeanFreePath( weightedAverageCollisionDiameter_, averageNumberDensity_ );
+    properties.meanFreePath = aerodynamics::computeMeanFreePath(
+                properties.weightedAverageCollisionDiameter, properties.averageNumberDensity );
 
     // Calculate pressure using ideal gas law (Thermodynamics an Engineering Approach, Michael A. Boles)
     if( useIdealGasLaw_ )
     {
-        pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_ ;
+        properties.pressure = properties.density * molarGasConstant_ * properties.temperature / properties.meanMolarMass ;
     }
     else
     {
-        pressure_ = TUDAT_NAN;
+        properties.pressure = TUDAT_NAN;
+    }
+
+    // Set state of computed properties, and mark them as valid and current
+    properties.altitude = altitude;
+    properties.longitude = longitude;
+    properties.latitude = latitude;
+    properties.time = time;
+
+    currentStateIndex_ = nextStateIndex_;
+    nextStateIndex_ = ( nextStateIndex_ + 1 ) % computedProperties_.size( );
+    if( numberOfValidStates_ < computedProperties_.size( ) )
+    {
+        numberOfValidStates_++;
+    }
+}
+
+//! Function to evaluate the full NRLMSISE00 model at a given position
+void NRLMSISE00Atmosphere::evaluateModel(
+        const NRLMSISE00Input& inputData,
+        const double altitude, const double longitude, const double latitude,
+        const double secondOfTheDay, const double localSolarTime,
+        nrlmsise_output& output )
+{
+    std::copy( inputData.apVector.begin( ),
+               inputData.apVector.begin( ) + std::min< unsigned int >( inputData.apVector.size( ), 7 ), aph_.a );
+    std::copy( inputData.switches.begin( ),
+               inputData.switches.begin( ) + std::min< unsigned int >( inputData.switches.size( ), 24 ),
+               flags_.switches );
+
+    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.alt    = altitude * 1.0E-3; // m to km
+    input_.year   = inputData.year;
+    input_.doy    = inputData.dayOfTheYear;
+    input_.sec    = secondOfTheDay;
+    input_.lst    = localSolarTime;
+    input_.f107   = inputData.f107;
+    input_.f107A  = inputData.f107a;
+    input_.ap     = inputData.apDaily;
+    input_.ap_a   = &aph_;
+
+    gtd7(&input_, &flags_, &output);
+}
+
+//! Function to set (or remove) the tabulated approximation of the model
+void NRLMSISE00Atmosphere::setTabulationSettings(
+        const std::shared_ptr< NRLMSISE00TabulationSettings > tabulationSettings )
+{
+    tabulationSettings_ = tabulationSettings;
+    tabulatedOutputs_.clear( );
+    tabulatedCellStatus_.clear( );
+
+    if( tabulationSettings_ != nullptr )
+    {
+        if( !( tabulationSettings_->maximumAltitude_ > tabulationSettings_->minimumAltitude_ ) ||
+                !( tabulationSettings_->altitudeStep_ > 0.0 ) || !( tabulationSettings_->localSolarTimeStep_ > 0.0 ) ||
+                !( tabulationSettings_->latitudeStep_ > 0.0 ) ||
+                !( tabulationSettings_->maximumRelativeDensityError_ >= 0.0 ) )
+        {
+            throw std::runtime_error( "Error when setting NRLMSISE00 tabulation, altitude range, step sizes and "
+                                      "error tolerance must be positive" );
+        }
+
+        // Set grid in altitude (from minimum altitude), local solar time (0 to 24 hours) and latitude (-90 to 90 deg).
+        tabulationSteps_[ 0 ] = tabulationSettings_->altitudeStep_ * 1.0E-3;
+        numberOfTabulatedNodes_[ 0 ] = static_cast< unsigned int >( std::ceil(
+                    ( tabulationSettings_->maximumAltitude_ - tabulationSettings_->minimumAltitude_ ) /
+                    tabulationSettings_->altitudeStep_ ) ) + 1;
+
+        unsigned int numberOfIntervals = static_cast< unsigned int >(
+                    std::ceil( 24.0 / tabulationSettings_->localSolarTimeStep_ ) );
+        tabulationSteps_[ 1 ] = 24.0 / static_cast< double >( numberOfIntervals );
+        numberOfTabulatedNodes_[ 1 ] = numberOfIntervals + 1;
+
+        numberOfIntervals = static_cast< unsigned int >(
+                    std::ceil( mathematical_constants::PI / tabulationSettings_->latitudeStep_ ) );
+        tabulationSteps_[ 2 ] = 180.0 / static_cast< double >( numberOfIntervals );
+        numberOfTabulatedNodes_[ 2 ] = numberOfIntervals + 1;
+
+        tabulatedOutputs_.resize( NUMBER_OF_TABULATED_OUTPUTS * numberOfTabulatedNodes_[ 0 ] *
+                numberOfTabulatedNodes_[ 1 ] * numberOfTabulatedNodes_[ 2 ] );
+        tabulatedCellStatus_.resize( ( numberOfTabulatedNodes_[ 0 ] - 1 ) *
+                ( numberOfTabulatedNodes_[ 1 ] - 1 ) * ( numberOfTabulatedNodes_[ 2 ] - 1 ) );
+    }
+
+    resetHashKey( );
+}
+
+//! Function to compute the output of the model from the tabulated approximation (if possible)
+bool NRLMSISE00Atmosphere::computeTabulatedOutput(
+        const NRLMSISE00Input& inputData,
+        const double altitude, const double latitude,
+        nrlmsise_output& output )
+{
+    // Check if state is inside table
+    double minimumAltitude = tabulationSettings_->minimumAltitude_;
+    double localSolarTime = std::fmod( inputData.localSolarTime, 24.0 );
+    if( !( altitude >= minimumAltitude && altitude <= tabulationSettings_->maximumAltitude_ ) ||
+            !( std::fabs( latitude ) <= mathematical_constants::PI / 2.0 ) || !std::isfinite( localSolarTime ) )
+    {
+        return false;
+    }
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+
+    // Clear table if day has changed
+    if( inputData.year != tabulatedYear_ || inputData.dayOfTheYear != tabulatedDayOfTheYear_ )
+    {
+        std::fill( tabulatedOutputs_.begin( ), tabulatedOutputs_.end( ), TUDAT_NAN );
+        std::fill( tabulatedCellStatus_.begin( ), tabulatedCellStatus_.end( ), 0 );
+        tabulatedYear_ = inputData.year;
+        tabulatedDayOfTheYear_ = inputData.dayOfTheYear;
+    }
+
+    // Find grid cell and fractional position in cell
+    double gridCoordinates[ 3 ] = { ( altitude - minimumAltitude ) * 1.0E-3, localSolarTime,
+                                    latitude * 180.0 / mathematical_constants::PI + 90.0 };
+    unsigned int cellIndices[ 3 ];
+    double fractions[ 3 ];
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double scaledCoordinate = gridCoordinates[ i ] / tabulationSteps_[ i ];
+        cellIndices[ i ] = std::min( static_cast< unsigned int >( scaledCoordinate ), numberOfTabulatedNodes_[ i ] - 2 );
+        fractions[ i ] = std::min( scaledCoordinate - static_cast< double >( cellIndices[ i ] ), 1.0 );
+    }
+    unsigned char& cellStatus = tabulatedCellStatus_[
+            ( cellIndices[ 0 ] * ( numberOfTabulatedNodes_[ 1 ] - 1 ) + cellIndices[ 1 ] ) *
+            ( numberOfTabulatedNodes_[ 2 ] - 1 ) + cellIndices[ 2 ] ];
+
+    // Check approximation error in center of cell, if not yet done
+    if( cellStatus == 0 )
+    {
+        double centerFractions[ 3 ] = { 0.5, 0.5, 0.5 };
+        interpolateTabulatedOutput( inputData, cellIndices, centerFractions, output );
+
+        double centerLocalSolarTime = ( static_cast< double >( cellIndices[ 1 ] ) + 0.5 ) * tabulationSteps_[ 1 ];
+        evaluateModel( inputData,
+                       minimumAltitude + ( static_cast< double >( cellIndices[ 0 ] ) + 0.5 ) *
+                       tabulationSteps_[ 0 ] * 1.0E3,
+                       ( centerLocalSolarTime - inputData.secondOfTheDay / 3600.0 ) * mathematical_constants::PI / 12.0,
+                       ( ( static_cast< double >( cellIndices[ 2 ] ) + 0.5 ) * tabulationSteps_[ 2 ] - 90.0 ) *
+                       mathematical_constants::PI / 180.0,
+                       inputData.secondOfTheDay, centerLocalSolarTime, output_ );
+
+        cellStatus = ( std::fabs( output.d[ 5 ] - output_.d[ 5 ] ) <=
+                       tabulationSettings_->maximumRelativeDensityError_ * std::fabs( output_.d[ 5 ] ) ) ? 1 : 2;
+    }
+
+    if( cellStatus == 2 )
+    {
+        return false;
+    }
+
+    interpolateTabulatedOutput( inputData, cellIndices, fractions, output );
+    return true;
+}
+
+//! Function to interpolate the tabulated model output in a single grid cell
+void NRLMSISE00Atmosphere::interpolateTabulatedOutput(
+        const NRLMSISE00Input& inputData,
+        const unsigned int cellIndices[ 3 ], const double fractions[ 3 ],
+        nrlmsise_output& output )
+{
+    // Retrieve nodes and interpolation weights of cell corners
+    unsigned int nodeIndices[ 8 ];
+    double weights[ 8 ];
+    for( unsigned int i = 0; i < 8; i++ )
+    {
+        unsigned int cornerOffsets[ 3 ] = { ( i >> 2 ) & 1, ( i >> 1 ) & 1, i & 1 };
+        nodeIndices[ i ] = getTabulatedNodeIndex(
+                    inputData, cellIndices[ 0 ] + cornerOffsets[ 0 ], cellIndices[ 1 ] + cornerOffsets[ 1 ],
+                    cellIndices[ 2 ] + cornerOffsets[ 2 ] );
+        weights[ i ] = 1.0;
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            weights[ i ] *= ( cornerOffsets[ j ] == 1 ) ? fractions[ j ] : ( 1.0 - fractions[ j ] );
+        }
+    }
+
+    // Interpolate densities logarithmically (linearly if density is zero at any of the nodes)
+    for( unsigned int j = 0; j < 9; j++ )
+    {
+        double logarithmicValue = 0.0;
+        for( unsigned int i = 0; i < 8; i++ )
+        {
+            logarithmicValue += weights[ i ] * tabulatedOutputs_[ nodeIndices[ i ] + j ];
+        }
+
+        if( std::isfinite( logarithmicValue ) )
+        {
+            output.d[ j ] = std::exp( logarithmicValue );
+        }
+        else
+        {
+            output.d[ j ] = 0.0;
+            for( unsigned int i = 0; i < 8; i++ )
+            {
+                output.d[ j ] += weights[ i ] * std::exp( tabulatedOutputs_[ nodeIndices[ i ] + j ] );
+            }
+        }
+    }
+
+    // Interpolate temperatures linearly
+    for( unsigned int j = 0; j < 2; j++ )
+    {
+        output.t[ j ] = 0.0;
+        for( unsigned int i = 0; i < 8; i++ )
+        {
+            output.t[ j ] += weights[ i ] * tabulatedOutputs_[ nodeIndices[ i ] + 9 + j ];
+        }
+    }
+}
+
+//! Function to retrieve the index of the first entry of a node in tabulatedOutputs_, computing the node if needed
+unsigned int NRLMSISE00Atmosphere::getTabulatedNodeIndex(
+        const NRLMSISE00Input& inputData,
+        const unsigned int altitudeIndex,
+        const unsigned int localSolarTimeIndex,
+        const unsigned int latitudeIndex )
+{
+    unsigned int nodeIndex = NUMBER_OF_TABULATED_OUTPUTS * (
+                ( altitudeIndex * numberOfTabulatedNodes_[ 1 ] + localSolarTimeIndex ) * numberOfTabulatedNodes_[ 2 ] +
+            latitudeIndex );
+
+    if( std::isnan( tabulatedOutputs_[ nodeIndex ] ) )
+    {
+        // Evaluate model at node (at 12h UT, with the longitude set consistently with the local solar time)
+        double localSolarTime = static_cast< double >( localSolarTimeIndex ) * tabulationSteps_[ 1 ];
+        evaluateModel( inputData,
+                       tabulationSettings_->minimumAltitude_ +
+                       static_cast< double >( altitudeIndex ) * tabulationSteps_[ 0 ] * 1.0E3,
+                       ( localSolarTime - 12.0 ) * mathematical_constants::PI / 12.0,
+                       ( static_cast< double >( latitudeIndex ) * tabulationSteps_[ 2 ] - 90.0 ) *
+                       mathematical_constants::PI / 180.0,
+                       43200.0, localSolarTime, output_ );
+
+        for( unsigned int j = 0; j < 9; j++ )
+        {
+            tabulatedOutputs_[ nodeIndex + j ] = std::log( output_.d[ j ] );
+        }
+        tabulatedOutputs_[ nodeIndex + 9 ] = output_.t[ 0 ];
+        tabulatedOutputs_[ nodeIndex + 10 ] = output_.t[ 1 ];
     }
+    return nodeIndex;
 }
 
 //! Overloaded ostream to print class information.
@@ -153,10 +410,11 @@ NRLMSISE00Atmosphere::getFullOutput( const double altitude, const double longitu
     std::pair< std::vector< double >, std::vector< double >> output;
 
     // Copy array members of struct to vectors on the pair.
+    const nrlmsise_output& currentOutput = getCurrentProperties( ).output;
     output.first = std::vector< double >(
-                output_.d, output_.d + sizeof output_.d / sizeof output_.d[ 0 ] );
+                currentOutput.d, currentOutput.d + sizeof currentOutput.d / sizeof currentOutput.d[ 0 ] );
     output.second = std::vector< double >(
-                output_.t, output_.t + sizeof output_.t / sizeof output_.t[ 0 ] );
+                currentOutput.t, currentOutput.t + sizeof currentOutput.t / sizeof currentOutput.t[ 0 ] );
     return output;
 }
 
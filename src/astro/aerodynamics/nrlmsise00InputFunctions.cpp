@@ -105,5 +105,107 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     return nrlmsiseInputData;
 }
 
+//! Constructor
+NRLMSISE00SolarActivityTable::NRLMSISE00SolarActivityTable(
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    if( solarActivityMap.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating NRLMSISE00 solar activity table, no solar activity data provided" );
+    }
+
+    firstJulianDay_ = solarActivityMap.begin( )->first;
+    unsigned int numberOfDays = static_cast< unsigned int >(
+                std::floor( solarActivityMap.rbegin( )->first - firstJulianDay_ ) ) + 1;
+
+    years_.resize( numberOfDays );
+    julianDaysOnFirstOfJanuary_.resize( numberOfDays );
+    f107_.resize( numberOfDays );
+    f107a_.resize( numberOfDays );
+    apDaily_.resize( numberOfDays );
+    apVectors_.resize( numberOfDays );
+
+    SolarActivityDataMap::const_iterator activityIterator = solarActivityMap.begin( );
+    for( unsigned int i = 0; i < numberOfDays; i++ )
+    {
+        // Use data of current day, or first subsequent day if no data is available for current day
+        double julianDay = firstJulianDay_ + static_cast< double >( i );
+        while( activityIterator->first < julianDay )
+        {
+            activityIterator++;
+        }
+        SolarActivityDataPtr solarActivity = activityIterator->second;
+
+        years_[ i ] = solarActivity->year;
+        julianDaysOnFirstOfJanuary_[ i ] = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                    solarActivity->year, 1, 1, 0, 0, 0.0 );
+        if( solarActivity->fluxQualifier == 1 )
+        {
+            f107_[ i ] = solarActivity->solarRadioFlux107Adjusted;
+            f107a_[ i ] = solarActivity->centered81DaySolarRadioFlux107Adjusted;
+        }
+        else
+        {
+            f107_[ i ] = solarActivity->solarRadioFlux107Observed;
+            f107a_[ i ] = solarActivity->centered81DaySolarRadioFlux107Observed;
+        }
+        apDaily_[ i ] = solarActivity->planetaryEquivalentAmplitudeAverage;
+        apVectors_[ i ] = eigenToStlVector( solarActivity->planetaryEquivalentAmplitudeVector );
+    }
+}
+
+//! Function to retrieve the index in the table of a given day
+unsigned int NRLMSISE00SolarActivityTable::getDayIndex( const double julianDay ) const
+{
+    double daysSinceFirstDay = julianDay - firstJulianDay_;
+    if( !( daysSinceFirstDay > 0.0 ) )
+    {
+        return 0;
+    }
+    else if( daysSinceFirstDay > static_cast< double >( years_.size( ) - 1 ) )
+    {
+        throw std::runtime_error( "Error when retrieving solar activity data at JD" + std::to_string( julianDay ) +
+                                  ", no data available after JD" +
+                                  std::to_string( firstJulianDay_ + static_cast< double >( years_.size( ) - 1 ) ) );
+    }
+    return static_cast< unsigned int >( std::ceil( daysSinceFirstDay ) );
+}
+
+//! Function to update the NRLMSISE00 input for a given time and position
+void NRLMSISE00SolarActivityTable::updateNRLMSISE00Input(
+        NRLMSISE00Input& nrlmsiseInputData, const double longitude, const double time,
+        const bool adjustSolarTime, const double localSolarTime ) const
+{
+    // Julian dates
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
+    unsigned int dayIndex = getDayIndex( julianDay );
+
+    nrlmsiseInputData.year = years_[ dayIndex ];
+    nrlmsiseInputData.dayOfTheYear = julianDay - julianDaysOnFirstOfJanuary_[ dayIndex ] + 1;
+    nrlmsiseInputData.secondOfTheDay = time -
+            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                julianDay, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    nrlmsiseInputData.f107 = f107_[ dayIndex ];
+    nrlmsiseInputData.f107a = f107a_[ dayIndex ];
+    nrlmsiseInputData.apDaily = apDaily_[ dayIndex ];
+    nrlmsiseInputData.apVector = apVectors_[ dayIndex ];
+
+    // Compute local solar time
+    if( adjustSolarTime )
+    {
+        nrlmsiseInputData.localSolarTime = localSolarTime;
+    }
+    else
+    {
+        nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
+                + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+    }
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
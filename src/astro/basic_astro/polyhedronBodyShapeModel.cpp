@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <functional>
+#include <set>
+
 #include "tudat/astro/basic_astro/polyhedronBodyShapeModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 
@@ -34,85 +38,27 @@ double PolyhedronBodyShapeModel::getAltitude( const Eigen::Vector3d& bodyFixedPo
     // Compute altitude using distance to vertices, facets and edges
     else
     {
-        const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
-        const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows();
-
-        std::vector< unsigned int > verticesToTest;
         std::vector< unsigned int > edgesToTest;
         std::vector< unsigned int > facetsToTest;
 
-        // Select vertices connected to the closest vertex
-        for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
+        // Select the edges and facets that include any of the vertices connected to the closest vertex
+        for ( unsigned int vertex : verticesConnectedToEachVertex_.at( closestVertex ) )
         {
-            if ( closestVertex == static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 0) ) )
-            {
-                verticesToTest.push_back( verticesDefiningEachEdge_(edge, 1) );
-            }
-            else if ( closestVertex == static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 1) ) )
-            {
-                verticesToTest.push_back( verticesDefiningEachEdge_(edge, 0) );
-            }
+            edgesToTest.insert( edgesToTest.end( ), edgesContainingEachVertex_.at( vertex ).begin( ),
+                                edgesContainingEachVertex_.at( vertex ).end( ) );
+            facetsToTest.insert( facetsToTest.end( ), facetsContainingEachVertex_.at( vertex ).begin( ),
+                                 facetsContainingEachVertex_.at( vertex ).end( ) );
         }
 
-        // Loop over selected vertices
-        for ( unsigned int vertex : verticesToTest )
-        {
-            // Loop over the edges and select the ones that include the selected vertex
-            for ( unsigned int edge = 0; edge < numberOfEdges; ++edge )
-            {
-                // If the edge isn't in the list of edges to test, check whether it should be added to it
-                if ( std::count( edgesToTest.begin(), edgesToTest.end(), edge ) == 0)
-                {
-                    if ( static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 0) ) == vertex ||
-                         static_cast< unsigned int >( verticesDefiningEachEdge_(edge, 1) )  == vertex )
-                    {
-                        edgesToTest.push_back( edge );
-                    }
-                }
-            }
-
-            // Loop over the facets and select the ones that include the selected vertex
-            for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
-            {
-                // If the edge isn't in the list of edges to test, check whether it should be added to it
-                if ( std::count( facetsToTest.begin(), facetsToTest.end(), facet ) == 0)
-                {
-                    if ( static_cast< unsigned int >( verticesDefiningEachFacet_(facet, 0) == vertex )||
-                         static_cast< unsigned int >( verticesDefiningEachEdge_(facet, 1) == vertex ) ||
-                         static_cast< unsigned int >( verticesDefiningEachFacet_(facet, 2) == vertex ) )
-                    {
-                        facetsToTest.push_back( facet );
-                    }
-                }
-            }
-        }
-
-        // Create matrix with vertices defining each edge to be tested
-        Eigen::MatrixXi verticesDefiningEachEdgeToTest = Eigen::MatrixXi::Constant(
-                    edgesToTest.size( ), 2, -1 );
-        unsigned int counter = 0;
-        for ( unsigned int edge : edgesToTest )
-        {
-            verticesDefiningEachEdgeToTest(counter,0) = verticesDefiningEachEdge_(edge,0);
-            verticesDefiningEachEdgeToTest(counter,1) = verticesDefiningEachEdge_(edge,1);
-            ++counter;
-        }
-
-        // Create matrix with vertices defining each facet to be tested
-        Eigen::MatrixXi verticesDefiningEachFacetToTest = Eigen::MatrixXi::Constant(
-                    facetsToTest.size( ), 3, -1 );
-        counter = 0;
-        for ( unsigned int facet : facetsToTest )
-        {
-            verticesDefiningEachFacetToTest(counter,0) = verticesDefiningEachFacet_(facet,0);
-            verticesDefiningEachFacetToTest(counter,1) = verticesDefiningEachFacet_(facet,1);
-            verticesDefiningEachFacetToTest(counter,2) = verticesDefiningEachFacet_(facet,2);
-            ++counter;
-        }
+        // Remove repeated edges and facets
+        std::sort( edgesToTest.begin( ), edgesToTest.end( ) );
+        edgesToTest.erase( std::unique( edgesToTest.begin( ), edgesToTest.end( ) ), edgesToTest.end( ) );
+        std::sort( facetsToTest.begin( ), facetsToTest.end( ) );
+        facetsToTest.erase( std::unique( facetsToTest.begin( ), facetsToTest.end( ) ), facetsToTest.end( ) );
 
         // Compute distance to closest edge and facet, using limited set of edges and facets
-        double distanceToFacet = computeDistanceToClosestFacet(bodyFixedPosition, verticesDefiningEachFacetToTest);
-        double distanceToEdge = computeDistanceToClosestEdge(bodyFixedPosition, verticesDefiningEachEdgeToTest);
+        double distanceToFacet = computeDistanceToClosestFacet(bodyFixedPosition, facetsToTest);
+        double distanceToEdge = computeDistanceToClosestEdge(bodyFixedPosition, edgesToTest);
 
         // Altitude is the minimum distance to any of the polyhedrin features
         altitude = std::min({distanceToVertex, distanceToFacet, distanceToEdge});
@@ -149,40 +95,106 @@ double PolyhedronBodyShapeModel::computeDistanceToClosestVertex(
         const Eigen::Vector3d& bodyFixedPosition,
         unsigned int& closestVertexId )
 {
-    const unsigned int numberOfVertices = verticesCoordinates_.rows();
+    // Use closest vertex of previous call as initial guess, if available
+    int previousClosestVertexId = previousClosestVertexId_.load( std::memory_order_relaxed );
+    closestVertexId = ( previousClosestVertexId >= 0 ) ?
+                static_cast< unsigned int >( previousClosestVertexId ) : vertexSearchTree_.at( vertexSearchTree_.size( ) / 2 );
+    double squaredDistance = ( verticesCoordinates_.block<1,3>(closestVertexId, 0).transpose( ) -
+                               bodyFixedPosition ).squaredNorm( );
+
+    // Improve initial guess by moving to connected vertices that are closer to the field point (if connections are
+    // known), to reduce the part of the search tree that needs to be searched
+    if ( !justComputeDistanceToVertices_ )
+    {
+        bool isGuessImproved = true;
+        while ( isGuessImproved )
+        {
+            isGuessImproved = false;
+            for ( unsigned int vertex : verticesConnectedToEachVertex_.at( closestVertexId ) )
+            {
+                double squaredDistanceToVertex = ( verticesCoordinates_.block<1,3>(vertex, 0).transpose( ) -
+                                                   bodyFixedPosition ).squaredNorm( );
+                if ( squaredDistanceToVertex < squaredDistance )
+                {
+                    squaredDistance = squaredDistanceToVertex;
+                    closestVertexId = vertex;
+                    isGuessImproved = true;
+                }
+            }
+        }
+    }
+
+    // Search the tree for the closest vertex
+    searchClosestVertexInTree( bodyFixedPosition, 0, vertexSearchTree_.size( ), 0, squaredDistance, closestVertexId );
+
+    previousClosestVertexId_.store( static_cast< int >( closestVertexId ), std::memory_order_relaxed );
+
+    return std::sqrt( squaredDistance );
+}
 
-    // Initialize distance
-    double distance = std::numeric_limits< double >::infinity( );
+void PolyhedronBodyShapeModel::searchClosestVertexInTree(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const unsigned int startIndex,
+        const unsigned int endIndex,
+        const unsigned int splitDimension,
+        double& closestSquaredDistance,
+        unsigned int& closestVertexId )
+{
+    if ( startIndex >= endIndex )
+    {
+        return;
+    }
 
-    // Loop over vertices and select the one with smallest distance
-    for (unsigned int vertex = 0; vertex < numberOfVertices; ++vertex)
+    // Check root vertex of (sub)tree; for equal distance, select vertex with lowest index (as done for linear search)
+    const unsigned int medianIndex = startIndex + ( endIndex - startIndex ) / 2;
+    const unsigned int vertex = vertexSearchTree_[ medianIndex ];
+    double squaredDistanceToVertex = ( verticesCoordinates_.block<1,3>(vertex, 0).transpose( ) -
+                                       bodyFixedPosition ).squaredNorm( );
+    if ( squaredDistanceToVertex < closestSquaredDistance ||
+         ( squaredDistanceToVertex == closestSquaredDistance && vertex < closestVertexId ) )
     {
-        Eigen::Vector3d vertexCoordinates = verticesCoordinates_.block<1,3>(vertex, 0);
-        double distanceToVertex = ( vertexCoordinates - bodyFixedPosition ).norm( );
-        if ( distanceToVertex < distance )
+        closestSquaredDistance = squaredDistanceToVertex;
+        closestVertexId = vertex;
+    }
+
+    // Search subtree on side of the field point first, and the other subtree only if it may contain a closer vertex
+    const double distanceToSplitPlane = bodyFixedPosition( splitDimension ) -
+            verticesCoordinates_( vertex, splitDimension );
+    const unsigned int nextSplitDimension = ( splitDimension + 1 ) % 3;
+    if ( distanceToSplitPlane < 0.0 )
+    {
+        searchClosestVertexInTree( bodyFixedPosition, startIndex, medianIndex, nextSplitDimension,
+                                   closestSquaredDistance, closestVertexId );
+        if ( distanceToSplitPlane * distanceToSplitPlane <= closestSquaredDistance )
         {
-            distance = distanceToVertex;
-            closestVertexId = vertex;
+            searchClosestVertexInTree( bodyFixedPosition, medianIndex + 1, endIndex, nextSplitDimension,
+                                       closestSquaredDistance, closestVertexId );
+        }
+    }
+    else
+    {
+        searchClosestVertexInTree( bodyFixedPosition, medianIndex + 1, endIndex, nextSplitDimension,
+                                   closestSquaredDistance, closestVertexId );
+        if ( distanceToSplitPlane * distanceToSplitPlane <= closestSquaredDistance )
+        {
+            searchClosestVertexInTree( bodyFixedPosition, startIndex, medianIndex, nextSplitDimension,
+                                       closestSquaredDistance, closestVertexId );
         }
     }
-
-    return distance;
 }
 
 double PolyhedronBodyShapeModel::computeDistanceToClosestFacet (
         const Eigen::Vector3d& bodyFixedPosition,
-        const Eigen::MatrixXi& verticesDefiningEachFacetToEvaluate )
+        const std::vector< unsigned int >& facetsToEvaluate )
 {
-    const unsigned int numberOfFacets = verticesDefiningEachFacetToEvaluate.rows();
-
     // Initialize distance: initial value set to NAN
     double distance = TUDAT_NAN;
 
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    for ( unsigned int facet : facetsToEvaluate )
     {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,1),0);
-        Eigen::Vector3d vertex2 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacetToEvaluate(facet,2),0);
+        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,1),0);
+        Eigen::Vector3d vertex2 = verticesCoordinates_.block<1,3>(verticesDefiningEachFacet_(facet,2),0);
 
         // Compute outward-pointing vector normal to facet
         Eigen::Vector3d facetNormal = ((vertex1 - vertex0).cross(vertex2 - vertex1)).normalized();
@@ -222,17 +234,15 @@ double PolyhedronBodyShapeModel::computeDistanceToClosestFacet (
 
 double PolyhedronBodyShapeModel::computeDistanceToClosestEdge (
         const Eigen::Vector3d& bodyFixedPosition,
-        const Eigen::MatrixXi& verticesDefiningEachEdgeToEvaluate )
+        const std::vector< unsigned int >& edgesToEvaluate )
 {
-    const unsigned int numberOfEdges = verticesDefiningEachEdgeToEvaluate.rows();
-
     // Initialize distance: initial value set to NAN
     double distance = TUDAT_NAN;
 
-    for (unsigned int edge = 0; edge < numberOfEdges; ++edge)
+    for ( unsigned int edge : edgesToEvaluate )
     {
-        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdgeToEvaluate(edge,0),0);
-        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdgeToEvaluate(edge,1),0);
+        Eigen::Vector3d vertex0 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates_.block<1,3>(verticesDefiningEachEdge_(edge,1),0);
 
         Eigen::Vector3d r_v0_p = bodyFixedPosition - vertex0;
         Eigen::Vector3d r_v0_v1 = vertex1 - vertex0;
@@ -269,55 +279,92 @@ void PolyhedronBodyShapeModel::computeVerticesDefiningEachEdge( )
 
     verticesDefiningEachEdge_ = Eigen::MatrixXi::Constant( numberOfEdges, 2, -1 );
 
+    // Set of inserted edges, each defined by its vertex indices in ascending order
+    std::set< std::pair< int, int > > insertedEdges;
+
     unsigned int numberOfInsertedEdges = 0;
     for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
     {
-        // Extract edges from face
-        std::vector< std::vector< int > > edgesToInsert;
-        const int vertex0 = verticesDefiningEachFacet_(facet,0);
-        const int vertex1 = verticesDefiningEachFacet_(facet,1);
-        const int vertex2 = verticesDefiningEachFacet_(facet,2);
-        edgesToInsert.push_back( { vertex0, vertex1 } );
-        edgesToInsert.push_back( { vertex1, vertex2 } );
-        edgesToInsert.push_back( { vertex2, vertex0 } );
-
-        // Check if all edges of the facet have been included in verticesDefiningEachEdge. If so, remove the edge from
-        // the edgesToInsert vector and add the facet to facetsDefiningEachEdge
-        for ( unsigned int edge = 0; edge < numberOfInsertedEdges and !edgesToInsert.empty(); ++edge )
+        // Loop over edges of the facet, and add the ones that have not been inserted yet
+        for ( unsigned int i = 0; i < 3; ++i )
         {
-            // Loop over edges of current facet still to be inserted
-            for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
+            const int vertex0 = verticesDefiningEachFacet_(facet,i);
+            const int vertex1 = verticesDefiningEachFacet_(facet,(i + 1) % 3);
+            if ( insertedEdges.insert( std::make_pair( std::min( vertex0, vertex1 ),
+                                                       std::max( vertex0, vertex1 ) ) ).second )
             {
-                if ( ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 0) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 1) ) ||
-                        ( edgesToInsert.at(i).at(0) == verticesDefiningEachEdge_(edge, 1) && edgesToInsert.at(i).at(1) == verticesDefiningEachEdge_(edge, 0) ) )
+                if ( numberOfInsertedEdges >= numberOfEdges )
                 {
-                    edgesToInsert.erase(edgesToInsert.begin() + i);
+                    throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
                 }
+                verticesDefiningEachEdge_(numberOfInsertedEdges,0) = vertex0;
+                verticesDefiningEachEdge_(numberOfInsertedEdges,1) = vertex1;
+                ++numberOfInsertedEdges;
             }
         }
-
-        // Check if any of the facet's edges still needs to be added to verticesDefiningEachEdge, and add it/them if so
-        for ( unsigned int i = 0; i < edgesToInsert.size(); ++i)
-        {
-            verticesDefiningEachEdge_(numberOfInsertedEdges,0) = edgesToInsert.at(i).at(0);
-            verticesDefiningEachEdge_(numberOfInsertedEdges,1) = edgesToInsert.at(i).at(1);
-            ++numberOfInsertedEdges;
-        }
     }
 
-    // Sanity checks
+    // Sanity check
     if ( numberOfInsertedEdges != numberOfEdges )
     {
         throw std::runtime_error( "Extracted number of polyhedron edges not correct." );
     }
-    for ( unsigned int i = 0; i < numberOfEdges; ++i )
+}
+
+void PolyhedronBodyShapeModel::buildVertexSearchTree( )
+{
+    const unsigned int numberOfVertices = verticesCoordinates_.rows();
+
+    vertexSearchTree_.resize( numberOfVertices );
+    for ( unsigned int vertex = 0; vertex < numberOfVertices; ++vertex )
+    {
+        vertexSearchTree_.at( vertex ) = vertex;
+    }
+
+    // Recursively place the median vertex (along the split dimension) of each subtree at the center of its range
+    std::function< void( const unsigned int, const unsigned int, const unsigned int ) > buildSubtree =
+            [ & ]( const unsigned int startIndex, const unsigned int endIndex, const unsigned int splitDimension )
     {
-        for (unsigned int j : {0,1} )
+        if ( endIndex - startIndex < 2 )
         {
-            if ( verticesDefiningEachEdge_(i,j) != verticesDefiningEachEdge_(i,j) )
-            {
-                throw std::runtime_error( "The vertices defining some edge were not selected." );
-            }
+            return;
+        }
+        const unsigned int medianIndex = startIndex + ( endIndex - startIndex ) / 2;
+        std::nth_element( vertexSearchTree_.begin( ) + startIndex, vertexSearchTree_.begin( ) + medianIndex,
+                          vertexSearchTree_.begin( ) + endIndex,
+                          [ & ]( const unsigned int vertex0, const unsigned int vertex1 )
+        {
+            return verticesCoordinates_( vertex0, splitDimension ) < verticesCoordinates_( vertex1, splitDimension );
+        } );
+        buildSubtree( startIndex, medianIndex, ( splitDimension + 1 ) % 3 );
+        buildSubtree( medianIndex + 1, endIndex, ( splitDimension + 1 ) % 3 );
+    };
+    buildSubtree( 0, numberOfVertices, 0 );
+}
+
+void PolyhedronBodyShapeModel::computeFeaturesConnectedToEachVertex( )
+{
+    const unsigned int numberOfVertices = verticesCoordinates_.rows();
+
+    verticesConnectedToEachVertex_.assign( numberOfVertices, std::vector< unsigned int >( ) );
+    edgesContainingEachVertex_.assign( numberOfVertices, std::vector< unsigned int >( ) );
+    facetsContainingEachVertex_.assign( numberOfVertices, std::vector< unsigned int >( ) );
+
+    for ( unsigned int edge = 0; edge < verticesDefiningEachEdge_.rows(); ++edge )
+    {
+        const unsigned int vertex0 = verticesDefiningEachEdge_(edge,0);
+        const unsigned int vertex1 = verticesDefiningEachEdge_(edge,1);
+        verticesConnectedToEachVertex_.at( vertex0 ).push_back( vertex1 );
+        verticesConnectedToEachVertex_.at( vertex1 ).push_back( vertex0 );
+        edgesContainingEachVertex_.at( vertex0 ).push_back( edge );
+        edgesContainingEachVertex_.at( vertex1 ).push_back( edge );
+    }
+
+    for ( unsigned int facet = 0; facet < verticesDefiningEachFacet_.rows(); ++facet )
+    {
+        for ( unsigned int i = 0; i < 3; ++i )
+        {
+            facetsContainingEachVertex_.at( verticesDefiningEachFacet_(facet,i) ).push_back( facet );
         }
     }
 }
@@ -9,7 +9,13 @@
  *
  */
 
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/math/basic/legendrePolynomials.h"
 #include "tudat/math/basic/polyhedron.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
@@ -191,5 +197,120 @@ Eigen::Matrix3d computePolyhedronInertiaTensor (const Eigen::MatrixXd& verticesC
     return computePolyhedronInertiaTensor( verticesCoordinates, verticesDefiningEachFacet, density );
 }
 
+double computePolyhedronBrillouinSphereRadius( const Eigen::MatrixXd& verticesCoordinates )
+{
+    return verticesCoordinates.rowwise( ).norm( ).maxCoeff( );
+}
+
+void computePolyhedronSphericalHarmonicCoefficients( const Eigen::MatrixXd& verticesCoordinates,
+                                                     const Eigen::MatrixXi& verticesDefiningEachFacet,
+                                                     const int maximumDegree,
+                                                     const double referenceRadius,
+                                                     Eigen::MatrixXd& cosineCoefficients,
+                                                     Eigen::MatrixXd& sineCoefficients )
+{
+    // Check if inputs are valid
+    basic_mathematics::checkValidityOfPolyhedronSettings ( verticesCoordinates, verticesDefiningEachFacet );
+    if ( maximumDegree < 0 )
+    {
+        throw std::runtime_error( "Error when computing spherical harmonic coefficients of polyhedron, maximum degree (" +
+                                  std::to_string( maximumDegree ) + ") is negative." );
+    }
+
+    // Compute barycentric coordinates and weights of Grundmann-Moller rule on the unit tetrahedron, with degree
+    // 2 * s + 1 (at least equal to the maximum degree)
+    const int s = maximumDegree / 2;
+    const int ruleDegree = 2 * s + 1;
+    std::vector< Eigen::Vector4d > quadratureBarycentricCoordinates;
+    std::vector< double > quadratureWeights;
+    for ( int i = 0; i <= s; ++i )
+    {
+        double weight = std::pow( 2.0, -2 * s ) * std::pow( static_cast< double >( ruleDegree + 3 - 2 * i ), ruleDegree ) /
+                ( std::tgamma( i + 1.0 ) * std::tgamma( ruleDegree + 4.0 - i ) );
+        if ( i % 2 == 1 )
+        {
+            weight = -weight;
+        }
+
+        // Loop over all combinations of 4 non-negative integers with sum s - i
+        const int sumOfIndices = s - i;
+        for ( int index0 = 0; index0 <= sumOfIndices; ++index0 )
+        {
+            for ( int index1 = 0; index1 <= sumOfIndices - index0; ++index1 )
+            {
+                for ( int index2 = 0; index2 <= sumOfIndices - index0 - index1; ++index2 )
+                {
+                    const int index3 = sumOfIndices - index0 - index1 - index2;
+                    quadratureBarycentricCoordinates.push_back(
+                                ( Eigen::Vector4d( 2 * index0 + 1, 2 * index1 + 1, 2 * index2 + 1, 2 * index3 + 1 ) /
+                                  static_cast< double >( ruleDegree + 3 - 2 * i ) ) );
+                    quadratureWeights.push_back( weight );
+                }
+            }
+        }
+    }
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+    Eigen::VectorXd cosineOfOrderTimesLongitude( maximumDegree + 1 );
+    Eigen::VectorXd sineOfOrderTimesLongitude( maximumDegree + 1 );
+
+    // Loop over tetrahedra formed by each facet and the origin, integrating the solid harmonics over each
+    const unsigned int numberOfFacets = verticesDefiningEachFacet.rows();
+    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    {
+        Eigen::Vector3d vertex0 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,0),0);
+        Eigen::Vector3d vertex1 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,1),0);
+        Eigen::Vector3d vertex2 = verticesCoordinates.block<1,3>(verticesDefiningEachFacet(facet,2),0);
+
+        // Signed volume of tetrahedron, times 6
+        const double jacobianDeterminant = vertex0.dot( vertex1.cross( vertex2 ) );
+        if ( jacobianDeterminant == 0.0 )
+        {
+            continue;
+        }
+
+        for ( unsigned int point = 0; point < quadratureWeights.size( ); ++point )
+        {
+            const Eigen::Vector3d position = quadratureBarycentricCoordinates.at( point )( 1 ) * vertex0 +
+                    quadratureBarycentricCoordinates.at( point )( 2 ) * vertex1 +
+                    quadratureBarycentricCoordinates.at( point )( 3 ) * vertex2;
+            const double radius = position.norm( );
+            const double longitude = std::atan2( position( 1 ), position( 0 ) );
+            legendreCache.update( position( 2 ) / radius );
+
+            for ( int order = 0; order <= maximumDegree; ++order )
+            {
+                cosineOfOrderTimesLongitude( order ) = std::cos( order * longitude );
+                sineOfOrderTimesLongitude( order ) = std::sin( order * longitude );
+            }
+
+            double scaledRadiusPower = jacobianDeterminant * quadratureWeights.at( point );
+            for ( int degree = 0; degree <= maximumDegree; ++degree )
+            {
+                for ( int order = 0; order <= degree; ++order )
+                {
+                    const double legendrePolynomial = legendreCache.getLegendrePolynomial( degree, order );
+                    cosineCoefficients( degree, order ) +=
+                            scaledRadiusPower * legendrePolynomial * cosineOfOrderTimesLongitude( order );
+                    sineCoefficients( degree, order ) +=
+                            scaledRadiusPower * legendrePolynomial * sineOfOrderTimesLongitude( order );
+                }
+                scaledRadiusPower *= radius / referenceRadius;
+            }
+        }
+    }
+
+    // Normalize coefficients by the volume (i.e. mass for unit density) of the polyhedron
+    const double volume = computePolyhedronVolume( verticesCoordinates, verticesDefiningEachFacet );
+    for ( int degree = 0; degree <= maximumDegree; ++degree )
+    {
+        cosineCoefficients.row( degree ) /= ( volume * ( 2.0 * degree + 1.0 ) );
+        sineCoefficients.row( degree ) /= ( volume * ( 2.0 * degree + 1.0 ) );
+    }
+}
+
 } // namespace basic_astrodynamics
 } // namespace tudat
\ No newline at end of file
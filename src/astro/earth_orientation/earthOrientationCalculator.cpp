@@ -93,6 +93,141 @@ std::shared_ptr< EarthOrientationAnglesCalculator > createStandardEarthOrientati
                 polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
 }
 
+//! Constructor
+TabulatedEarthOrientationAnglesCalculator::TabulatedEarthOrientationAnglesCalculator(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator,
+        const basic_astrodynamics::TimeScales inputTimeScale,
+        const double timeStep,
+        const int numberOfInterpolationPoints ):
+    anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ), timeStep_( timeStep ),
+    numberOfInterpolationPoints_( numberOfInterpolationPoints ), firstTabulatedIndex_( 0 )
+{
+    if( !( timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated Earth orientation angles, time step must be positive, provided value is " +
+                                  std::to_string( timeStep_ ) );
+    }
+
+    if( numberOfInterpolationPoints_ < 2 || numberOfInterpolationPoints_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when creating tabulated Earth orientation angles, number of interpolation points must be even and at least 2, provided value is " +
+                                  std::to_string( numberOfInterpolationPoints_ ) );
+    }
+
+    // Precompute Lagrange denominators for uniform grid: prod_{k != j}( j - k )
+    lagrangeDenominators_.resize( numberOfInterpolationPoints_ );
+    for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+    {
+        lagrangeDenominators_[ j ] = 1.0;
+        for( int k = 0; k < numberOfInterpolationPoints_; k++ )
+        {
+            if( k != j )
+            {
+                lagrangeDenominators_[ j ] *= static_cast< double >( j - k );
+            }
+        }
+    }
+}
+
+//! Function to compute the rotation angles from ITRS to GCRS at a given time, by interpolation
+std::pair< Eigen::Vector5d, double > TabulatedEarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs(
+        const double timeValue )
+{
+    // Determine grid points used for interpolation, centered on requested time
+    const double scaledTime = timeValue / timeStep_;
+    const long firstIndex = static_cast< long >( std::floor( scaledTime ) ) - ( numberOfInterpolationPoints_ / 2 - 1 );
+    const long lastIndex = firstIndex + numberOfInterpolationPoints_ - 1;
+
+    // Interpolate existing data if possible, extend grid (under exclusive lock) otherwise
+    Eigen::Matrix< double, 6, 1 > interpolatedValue;
+    {
+        std::shared_lock< std::shared_mutex > readLock( tabulationMutex_ );
+        if( areValuesTabulated( firstIndex, lastIndex ) )
+        {
+            interpolatedValue = interpolateTabulatedValues( scaledTime, firstIndex );
+            return std::make_pair( interpolatedValue.segment< 5 >( 0 ), interpolatedValue( 5 ) + timeValue );
+        }
+    }
+
+    std::unique_lock< std::shared_mutex > writeLock( tabulationMutex_ );
+    extendTabulatedValues( firstIndex, lastIndex );
+    interpolatedValue = interpolateTabulatedValues( scaledTime, firstIndex );
+    return std::make_pair( interpolatedValue.segment< 5 >( 0 ), interpolatedValue( 5 ) + timeValue );
+}
+
+//! Function to interpolate the tabulated data, starting at the given grid index (data must be tabulated).
+Eigen::Matrix< double, 6, 1 > TabulatedEarthOrientationAnglesCalculator::interpolateTabulatedValues(
+        const double scaledTime, const long firstIndex )
+{
+    // Compute Lagrange polynomials at requested time
+    const double localTime = scaledTime - static_cast< double >( firstIndex );
+    Eigen::Matrix< double, 6, 1 > interpolatedValue = Eigen::Matrix< double, 6, 1 >::Zero( );
+    for( int j = 0; j < numberOfInterpolationPoints_; j++ )
+    {
+        double lagrangePolynomial = 1.0 / lagrangeDenominators_[ j ];
+        for( int k = 0; k < numberOfInterpolationPoints_; k++ )
+        {
+            if( k != j )
+            {
+                lagrangePolynomial *= ( localTime - static_cast< double >( k ) );
+            }
+        }
+        interpolatedValue += lagrangePolynomial * tabulatedValues_[ firstIndex - firstTabulatedIndex_ + j ];
+    }
+    return interpolatedValue;
+}
+
+//! Function to ensure that rotation data is tabulated on all grid points in the given interval of indices.
+void TabulatedEarthOrientationAnglesCalculator::extendTabulatedValues(
+        const long firstRequiredIndex, const long lastRequiredIndex )
+{
+    // Extend grid in blocks, to limit the number of extensions when the requested time moves monotonically
+    const long minimumNumberOfNewPoints = 64;
+
+    if( tabulatedValues_.size( ) == 0 )
+    {
+        firstTabulatedIndex_ = firstRequiredIndex;
+        for( long i = firstRequiredIndex; i <= lastRequiredIndex + minimumNumberOfNewPoints; i++ )
+        {
+            tabulatedValues_.push_back( computeTabulatedValue( i ) );
+        }
+        return;
+    }
+
+    if( firstRequiredIndex < firstTabulatedIndex_ )
+    {
+        const long newFirstIndex = std::min( firstRequiredIndex, firstTabulatedIndex_ - minimumNumberOfNewPoints );
+        for( long i = firstTabulatedIndex_ - 1; i >= newFirstIndex; i-- )
+        {
+            tabulatedValues_.push_front( computeTabulatedValue( i ) );
+        }
+        firstTabulatedIndex_ = newFirstIndex;
+    }
+
+    const long lastTabulatedIndex = firstTabulatedIndex_ + static_cast< long >( tabulatedValues_.size( ) ) - 1;
+    if( lastRequiredIndex > lastTabulatedIndex )
+    {
+        const long newLastIndex = std::max( lastRequiredIndex, lastTabulatedIndex + minimumNumberOfNewPoints );
+        for( long i = lastTabulatedIndex + 1; i <= newLastIndex; i++ )
+        {
+            tabulatedValues_.push_back( computeTabulatedValue( i ) );
+        }
+    }
+}
+
+//! Function to compute the rotation data at a given grid point.
+Eigen::Matrix< double, 6, 1 > TabulatedEarthOrientationAnglesCalculator::computeTabulatedValue( const long gridIndex )
+{
+    const double gridTime = static_cast< double >( gridIndex ) * timeStep_;
+    std::pair< Eigen::Vector5d, double > rotationAngles =
+            anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( gridTime, inputTimeScale_ );
+
+    Eigen::Matrix< double, 6, 1 > tabulatedValue;
+    tabulatedValue.segment< 5 >( 0 ) = rotationAngles.first;
+    tabulatedValue( 5 ) = rotationAngles.second - gridTime;
+    return tabulatedValue;
+}
+
 ////! Function to create an interpolator for the Earth orientation angles
 //std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, 6,1 > > >
 //createInterpolatorForItrsToGcrsAngles(
@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class constructor, fits the Chebyshev polynomials to the state function.
+ChebyshevEphemeris::ChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const double maximumSegmentDuration,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation,
+        const int maximumNumberOfBisections ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    stateFunction_( stateFunction ),
+    positionTolerance_( positionTolerance ),
+    velocityTolerance_( velocityTolerance ),
+    polynomialDegree_( polynomialDegree )
+{
+    if( !( finalTime > initialTime ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, final time (" + std::to_string( finalTime ) +
+                                  ") must be larger than initial time (" + std::to_string( initialTime ) + ")" );
+    }
+
+    if( polynomialDegree_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1, provided value is " +
+                                  std::to_string( polynomialDegree_ ) );
+    }
+
+    if( !( maximumSegmentDuration > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, maximum segment duration must be larger than 0, provided value is " +
+                                  std::to_string( maximumSegmentDuration ) );
+    }
+
+    // Divide time interval into segments, bisecting each segment until the fit meets the tolerances.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > coefficients;
+    double segmentStartTime = initialTime;
+    segmentBoundaries_.push_back( segmentStartTime );
+    while( segmentStartTime < finalTime )
+    {
+        double segmentEndTime = std::min( segmentStartTime + maximumSegmentDuration, finalTime );
+
+        int numberOfBisections = 0;
+        while( !fitSegment( segmentStartTime, segmentEndTime, coefficients ) )
+        {
+            if( numberOfBisections >= maximumNumberOfBisections )
+            {
+                throw std::runtime_error( "Error when creating Chebyshev ephemeris, could not meet tolerances on segment starting at " +
+                                          std::to_string( segmentStartTime ) + " after " +
+                                          std::to_string( maximumNumberOfBisections ) + " bisections" );
+            }
+            segmentEndTime = segmentStartTime + 0.5 * ( segmentEndTime - segmentStartTime );
+            numberOfBisections++;
+        }
+
+        segmentCoefficients_.push_back( coefficients );
+        segmentBoundaries_.push_back( segmentEndTime );
+        segmentStartTime = segmentEndTime;
+    }
+
+    // State function is no longer needed (and may not be thread-safe), release it.
+    stateFunction_ = nullptr;
+}
+
+//! Function to get state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState(
+        const double secondsSinceEpoch )
+{
+    if( secondsSinceEpoch < segmentBoundaries_.front( ) || secondsSinceEpoch > segmentBoundaries_.back( ) )
+    {
+        throw std::runtime_error( "Error when evaluating Chebyshev ephemeris, requested time " +
+                                  std::to_string( secondsSinceEpoch ) + " is outside of valid interval [" +
+                                  std::to_string( segmentBoundaries_.front( ) ) + ", " +
+                                  std::to_string( segmentBoundaries_.back( ) ) + "]" );
+    }
+
+    // Find segment in which requested time lies (final boundary belongs to last segment).
+    unsigned int segmentIndex = std::min(
+                static_cast< unsigned int >(
+                    std::upper_bound( segmentBoundaries_.begin( ), segmentBoundaries_.end( ), secondsSinceEpoch ) -
+                    segmentBoundaries_.begin( ) ) - 1,
+                static_cast< unsigned int >( segmentCoefficients_.size( ) ) - 1 );
+
+    const double segmentStartTime = segmentBoundaries_[ segmentIndex ];
+    const double segmentEndTime = segmentBoundaries_[ segmentIndex + 1 ];
+    const double scaledTime =
+            ( 2.0 * secondsSinceEpoch - segmentStartTime - segmentEndTime ) / ( segmentEndTime - segmentStartTime );
+
+    return evaluateChebyshevSeries( segmentCoefficients_[ segmentIndex ], scaledTime );
+}
+
+//! Function to fit the Chebyshev polynomials on a single segment.
+bool ChebyshevEphemeris::fitSegment( const double segmentStartTime,
+                                     const double segmentEndTime,
+                                     Eigen::Matrix< double, 6, Eigen::Dynamic >& coefficients )
+{
+    const int numberOfNodes = polynomialDegree_ + 1;
+    const double segmentMidTime = 0.5 * ( segmentStartTime + segmentEndTime );
+    const double segmentHalfDuration = 0.5 * ( segmentEndTime - segmentStartTime );
+
+    // Compute coefficients from states at the Chebyshev nodes (discrete orthogonality of Chebyshev polynomials).
+    coefficients.setZero( 6, numberOfNodes );
+    for( int k = 0; k < numberOfNodes; k++ )
+    {
+        const double nodeAngle = mathematical_constants::PI * ( static_cast< double >( k ) + 0.5 ) /
+                static_cast< double >( numberOfNodes );
+        const Eigen::Vector6d nodeState = stateFunction_( segmentMidTime + segmentHalfDuration * std::cos( nodeAngle ) );
+        for( int j = 0; j < numberOfNodes; j++ )
+        {
+            coefficients.col( j ) += nodeState * std::cos( static_cast< double >( j ) * nodeAngle );
+        }
+    }
+    coefficients *= 2.0 / static_cast< double >( numberOfNodes );
+    coefficients.col( 0 ) *= 0.5;
+
+    // Verify fit at extrema of highest-degree Chebyshev polynomial (including segment boundaries).
+    for( int k = 0; k <= polynomialDegree_; k++ )
+    {
+        const double scaledTime = std::cos( mathematical_constants::PI * static_cast< double >( k ) /
+                                            static_cast< double >( polynomialDegree_ ) );
+        const Eigen::Vector6d stateError =
+                evaluateChebyshevSeries( coefficients, scaledTime ) -
+                stateFunction_( segmentMidTime + segmentHalfDuration * scaledTime );
+        if( !( stateError.segment( 0, 3 ).norm( ) <= positionTolerance_ ) ||
+                !( stateError.segment( 3, 3 ).norm( ) <= velocityTolerance_ ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Function to evaluate the Chebyshev polynomials of a segment, using Clenshaw's recurrence.
+Eigen::Vector6d ChebyshevEphemeris::evaluateChebyshevSeries(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& coefficients,
+        const double scaledTime )
+{
+    Eigen::Vector6d currentTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d previousTerm = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d nextTerm;
+    for( int j = coefficients.cols( ) - 1; j > 0; j-- )
+    {
+        nextTerm = 2.0 * scaledTime * currentTerm - previousTerm + coefficients.col( j );
+        previousTerm = currentTerm;
+        currentTerm = nextTerm;
+    }
+    return scaledTime * currentTerm - previousTerm + coefficients.col( 0 );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
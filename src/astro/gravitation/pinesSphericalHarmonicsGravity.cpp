@@ -0,0 +1,697 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Pines, S. Uniform representation of the gravitational potential and its derivatives, AIAA Journal, 11(11),
+ *          1508-1511, 1973.
+ *      Lundberg, J.B., Schutz, B.E. Recursion formulas of Legendre functions for use with nonsingular geopotential
+ *          models, Journal of Guidance, Control, and Dynamics, 11(1), 31-38, 1988.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/gravitation/pinesSphericalHarmonicsGravity.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to retrieve the factor k in the geodesy normalization (1 for order 0, 2 otherwise)
+inline double getNormalizationOrderFactor( const int order )
+{
+    return ( order == 0 ) ? 1.0 : 2.0;
+}
+
+//! Constructor
+PinesRecursionCoefficients::PinesRecursionCoefficients( const int maximumDegree ):
+    maximumDegree_( maximumDegree )
+{
+    // The derived Legendre functions are required up to one degree and order beyond the gravity field.
+    const int highestDegree = maximumDegree_ + 1;
+    const int numberOfCoefficients = ( highestDegree + 1 ) * ( highestDegree + 2 ) / 2;
+
+    // Compute diagonal values and sub-diagonal recursion coefficients
+    diagonalLegendreFunctions_.resize( highestDegree + 1 );
+    subDiagonalRecursionCoefficients_.resize( highestDegree + 1 );
+    diagonalLegendreFunctions_[ 0 ] = 1.0;
+    subDiagonalRecursionCoefficients_[ 0 ] = 0.0;
+    for( int degree = 1; degree <= highestDegree; degree++ )
+    {
+        const double currentDegree = static_cast< double >( degree );
+        diagonalLegendreFunctions_[ degree ] = diagonalLegendreFunctions_[ degree - 1 ] * std::sqrt(
+                    ( 2.0 * currentDegree + 1.0 ) * getNormalizationOrderFactor( degree ) /
+                    ( 2.0 * currentDegree * getNormalizationOrderFactor( degree - 1 ) ) );
+        subDiagonalRecursionCoefficients_[ degree ] = std::sqrt(
+                    2.0 * currentDegree * getNormalizationOrderFactor( degree - 1 ) /
+                    getNormalizationOrderFactor( degree ) );
+    }
+
+    // Compute coefficients of column-wise recursion, and normalization ratios
+    firstColumnRecursionCoefficients_.resize( numberOfCoefficients, 0.0 );
+    secondColumnRecursionCoefficients_.resize( numberOfCoefficients, 0.0 );
+    sameDegreeNormalizationRatios_.resize( numberOfCoefficients, 0.0 );
+    nextDegreeNormalizationRatios_.resize( numberOfCoefficients, 0.0 );
+    for( int degree = 0; degree <= highestDegree; degree++ )
+    {
+        const double n = static_cast< double >( degree );
+        for( int order = 0; order <= degree; order++ )
+        {
+            const double m = static_cast< double >( order );
+            const int index = getCoefficientIndex( degree, order );
+            if( degree >= order + 2 )
+            {
+                firstColumnRecursionCoefficients_[ index ] = std::sqrt(
+                            ( 2.0 * n + 1.0 ) * ( 2.0 * n - 1.0 ) / ( ( n - m ) * ( n + m ) ) );
+                secondColumnRecursionCoefficients_[ index ] = std::sqrt(
+                            ( n + m - 1.0 ) * ( 2.0 * n + 1.0 ) * ( n - m - 1.0 ) /
+                            ( ( n + m ) * ( n - m ) * ( 2.0 * n - 3.0 ) ) );
+            }
+            sameDegreeNormalizationRatios_[ index ] = std::sqrt(
+                        ( n - m ) * getNormalizationOrderFactor( order ) * ( n + m + 1.0 ) /
+                        getNormalizationOrderFactor( order + 1 ) );
+            nextDegreeNormalizationRatios_[ index ] = std::sqrt(
+                        ( n + m + 1.0 ) * ( n + m + 2.0 ) * ( 2.0 * n + 1.0 ) * getNormalizationOrderFactor( order ) /
+                        ( ( 2.0 * n + 3.0 ) * getNormalizationOrderFactor( order + 1 ) ) );
+        }
+    }
+}
+
+//! Function to check whether degree and order of a Pines gravity computation object are valid
+void checkPinesMaximumDegreeAndOrder( const int maximumDegree, const int maximumOrder )
+{
+    if( maximumDegree < 0 || maximumOrder < 0 )
+    {
+        throw std::runtime_error( "Error when creating Pines spherical harmonic gravity object, degree and order "
+                                  "must be non-negative" );
+    }
+}
+
+//! Function to check whether the size of a set of coefficient matrices is consistent with a maximum degree and order
+void checkPinesCoefficientSizes( const Eigen::MatrixXd& cosineCoefficients, const Eigen::MatrixXd& sineCoefficients,
+                                 const int maximumDegree, const int maximumOrder )
+{
+    if( cosineCoefficients.rows( ) != sineCoefficients.rows( ) || cosineCoefficients.cols( ) != sineCoefficients.cols( ) )
+    {
+        throw std::runtime_error( "Error when computing Pines spherical harmonic gravity, cosine and sine coefficients "
+                                  "are of inconsistent size" );
+    }
+    else if( cosineCoefficients.rows( ) - 1 > maximumDegree ||
+             std::min( cosineCoefficients.cols( ), cosineCoefficients.rows( ) ) - 1 > maximumOrder )
+    {
+        throw std::runtime_error( "Error when computing Pines spherical harmonic gravity, coefficients up to D/O " +
+                                  std::to_string( cosineCoefficients.rows( ) - 1 ) + "/" +
+                                  std::to_string( cosineCoefficients.cols( ) - 1 ) + " provided, but maximum is " +
+                                  std::to_string( maximumDegree ) + "/" + std::to_string( maximumOrder ) );
+    }
+}
+
+//! Constructor
+PinesSphericalHarmonicsGravityCalculator::PinesSphericalHarmonicsGravityCalculator(
+        const int maximumDegree, const int maximumOrder ):
+    maximumDegree_( maximumDegree ), maximumOrder_( std::min( maximumOrder, maximumDegree ) ),
+    recursionCoefficients_( std::max( maximumDegree, 0 ) )
+{
+    checkPinesMaximumDegreeAndOrder( maximumDegree_, maximumOrder_ );
+
+    // Allocate work arrays
+    const int highestDegree = maximumDegree_ + 1;
+    currentOrderLegendreFunctions_.resize( ( highestDegree + 1 ) * blockSize );
+    nextOrderLegendreFunctions_.resize( ( highestDegree + 1 ) * blockSize );
+    degreeScalingFactors_.resize( ( highestDegree + 1 ) * blockSize );
+}
+
+//! Function to compute the gravitational accelerations at a list of positions
+void PinesSphericalHarmonicsGravityCalculator::computeAccelerations(
+        const Eigen::Matrix< double, 3, Eigen::Dynamic >& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        Eigen::Matrix< double, 3, Eigen::Dynamic >& accelerations )
+{
+    checkPinesCoefficientSizes( cosineCoefficients, sineCoefficients, maximumDegree_, maximumOrder_ );
+
+    const int numberOfPositions = bodyFixedPositions.cols( );
+    accelerations.resize( 3, numberOfPositions );
+
+    // Compute accelerations for all full blocks directly from/to input/output.
+    const int numberOfFullBlocks = numberOfPositions / blockSize;
+    for( int i = 0; i < numberOfFullBlocks; i++ )
+    {
+        computeBlockAccelerations(
+                    bodyFixedPositions.data( ) + 3 * i * blockSize, gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, accelerations.data( ) + 3 * i * blockSize );
+    }
+
+    // Compute accelerations for remaining positions, padding the block with the last position
+    const int numberOfRemainingPositions = numberOfPositions - numberOfFullBlocks * blockSize;
+    if( numberOfRemainingPositions > 0 )
+    {
+        Eigen::Matrix< double, 3, blockSize > blockPositions;
+        Eigen::Matrix< double, 3, blockSize > blockAccelerations;
+        for( int i = 0; i < blockSize; i++ )
+        {
+            blockPositions.col( i ) = bodyFixedPositions.col(
+                        numberOfFullBlocks * blockSize + std::min( i, numberOfRemainingPositions - 1 ) );
+        }
+        computeBlockAccelerations(
+                    blockPositions.data( ), gravitationalParameter, referenceRadius,
+                    cosineCoefficients, sineCoefficients, blockAccelerations.data( ) );
+        accelerations.rightCols( numberOfRemainingPositions ) = blockAccelerations.leftCols( numberOfRemainingPositions );
+    }
+}
+
+//! Function to compute the gravitational acceleration at a single position
+Eigen::Vector3d PinesSphericalHarmonicsGravityCalculator::computeAcceleration(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients )
+{
+    Eigen::Matrix< double, 3, Eigen::Dynamic > acceleration;
+    computeAccelerations( bodyFixedPosition, gravitationalParameter, referenceRadius,
+                          cosineCoefficients, sineCoefficients, acceleration );
+    return acceleration.col( 0 );
+}
+
+//! Function to compute a single column (fixed order) of the derived Legendre functions, for all positions in a block.
+void PinesSphericalHarmonicsGravityCalculator::computeLegendreFunctionColumn(
+        const int order, const int highestDegree, double* column )
+{
+    const double* sineOfLatitude = directionCosines_[ 2 ];
+    const std::vector< double >& diagonalLegendreFunctions = recursionCoefficients_.getDiagonalLegendreFunctions( );
+    const std::vector< double >& subDiagonalRecursionCoefficients =
+            recursionCoefficients_.getSubDiagonalRecursionCoefficients( );
+    const std::vector< double >& firstColumnRecursionCoefficients =
+            recursionCoefficients_.getFirstColumnRecursionCoefficients( );
+    const std::vector< double >& secondColumnRecursionCoefficients =
+            recursionCoefficients_.getSecondColumnRecursionCoefficients( );
+
+    // Set diagonal (position-independent) and sub-diagonal terms
+    for( int i = 0; i < blockSize; i++ )
+    {
+        column[ order * blockSize + i ] = diagonalLegendreFunctions[ order ];
+    }
+
+    if( order + 1 <= highestDegree )
+    {
+        const double subDiagonalFactor =
+                subDiagonalRecursionCoefficients[ order + 1 ] * diagonalLegendreFunctions[ order + 1 ];
+        for( int i = 0; i < blockSize; i++ )
+        {
+            column[ ( order + 1 ) * blockSize + i ] = subDiagonalFactor * sineOfLatitude[ i ];
+        }
+    }
+
+    // Compute remaining terms by recursion in degree
+    for( int degree = order + 2; degree <= highestDegree; degree++ )
+    {
+        const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+        const double firstCoefficient = firstColumnRecursionCoefficients[ index ];
+        const double secondCoefficient = secondColumnRecursionCoefficients[ index ];
+
+        double* currentTerms = column + degree * blockSize;
+        const double* previousTerms = column + ( degree - 1 ) * blockSize;
+        const double* secondPreviousTerms = column + ( degree - 2 ) * blockSize;
+        for( int i = 0; i < blockSize; i++ )
+        {
+            currentTerms[ i ] = firstCoefficient * sineOfLatitude[ i ] * previousTerms[ i ] -
+                    secondCoefficient * secondPreviousTerms[ i ];
+        }
+    }
+}
+
+//! Function to compute the accelerations for a single block of positions
+void PinesSphericalHarmonicsGravityCalculator::computeBlockAccelerations(
+        const double* positions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        double* accelerations )
+{
+    const int highestDegree = cosineCoefficients.rows( ) - 1;
+    const int highestOrder = std::min( cosineCoefficients.cols( ) - 1, cosineCoefficients.rows( ) - 1 );
+    const std::vector< double >& sameDegreeNormalizationRatios =
+            recursionCoefficients_.getSameDegreeNormalizationRatios( );
+    const std::vector< double >& nextDegreeNormalizationRatios =
+            recursionCoefficients_.getNextDegreeNormalizationRatios( );
+
+    // Compute direction cosines and scaling factors per degree
+    const double gravitationalParameterByRadiusSquared = gravitationalParameter / ( referenceRadius * referenceRadius );
+    double radiusRatio[ blockSize ];
+    for( int i = 0; i < blockSize; i++ )
+    {
+        const double distance = std::sqrt( positions[ 3 * i ] * positions[ 3 * i ] +
+                positions[ 3 * i + 1 ] * positions[ 3 * i + 1 ] + positions[ 3 * i + 2 ] * positions[ 3 * i + 2 ] );
+        directionCosines_[ 0 ][ i ] = positions[ 3 * i ] / distance;
+        directionCosines_[ 1 ][ i ] = positions[ 3 * i + 1 ] / distance;
+        directionCosines_[ 2 ][ i ] = positions[ 3 * i + 2 ] / distance;
+        radiusRatio[ i ] = referenceRadius / distance;
+        degreeScalingFactors_[ i ] = gravitationalParameterByRadiusSquared * radiusRatio[ i ] * radiusRatio[ i ];
+    }
+
+    for( int degree = 1; degree <= highestDegree; degree++ )
+    {
+        for( int i = 0; i < blockSize; i++ )
+        {
+            degreeScalingFactors_[ degree * blockSize + i ] =
+                    degreeScalingFactors_[ ( degree - 1 ) * blockSize + i ] * radiusRatio[ i ];
+        }
+    }
+
+    // Initialize real/imaginary parts of (s + i t)^m, and acceleration terms
+    double realPart[ blockSize ], imaginaryPart[ blockSize ], previousRealPart[ blockSize ], previousImaginaryPart[ blockSize ];
+    double firstTerm[ blockSize ], secondTerm[ blockSize ], thirdTerm[ blockSize ], fourthTerm[ blockSize ];
+    for( int i = 0; i < blockSize; i++ )
+    {
+        realPart[ i ] = 1.0;
+        imaginaryPart[ i ] = 0.0;
+        previousRealPart[ i ] = 0.0;
+        previousImaginaryPart[ i ] = 0.0;
+        firstTerm[ i ] = 0.0;
+        secondTerm[ i ] = 0.0;
+        thirdTerm[ i ] = 0.0;
+        fourthTerm[ i ] = 0.0;
+    }
+
+    // Iterate over all orders, computing two columns of derived Legendre functions at a time
+    double* currentOrderTerms = currentOrderLegendreFunctions_.data( );
+    double* nextOrderTerms = nextOrderLegendreFunctions_.data( );
+    computeLegendreFunctionColumn( 0, highestDegree + 1, currentOrderTerms );
+    for( int order = 0; order <= highestOrder; order++ )
+    {
+        computeLegendreFunctionColumn( order + 1, highestDegree + 1, nextOrderTerms );
+
+        const double currentOrder = static_cast< double >( order );
+        for( int degree = order; degree <= highestDegree; degree++ )
+        {
+            const double cosineCoefficient = cosineCoefficients( degree, order );
+            const double sineCoefficient = sineCoefficients( degree, order );
+            if( cosineCoefficient == 0.0 && sineCoefficient == 0.0 )
+            {
+                continue;
+            }
+
+            const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+            const double sameDegreeRatio = sameDegreeNormalizationRatios[ index ];
+            const double nextDegreeRatio = nextDegreeNormalizationRatios[ index ];
+
+            const double* scalingFactors = degreeScalingFactors_.data( ) + degree * blockSize;
+            const double* legendreFunctions = currentOrderTerms + degree * blockSize;
+            const double* nextOrderLegendreFunctions = nextOrderTerms + degree * blockSize;
+            const double* nextDegreeAndOrderLegendreFunctions = nextOrderTerms + ( degree + 1 ) * blockSize;
+
+            // Add contributions to third and fourth terms (and first and second terms for non-zero order)
+            if( order > 0 )
+            {
+                for( int i = 0; i < blockSize; i++ )
+                {
+                    const double previousOrderCosineTerm =
+                            cosineCoefficient * previousRealPart[ i ] + sineCoefficient * previousImaginaryPart[ i ];
+                    const double previousOrderSineTerm =
+                            sineCoefficient * previousRealPart[ i ] - cosineCoefficient * previousImaginaryPart[ i ];
+                    const double scaledLegendreFunction = scalingFactors[ i ] * currentOrder * legendreFunctions[ i ];
+                    firstTerm[ i ] += scaledLegendreFunction * previousOrderCosineTerm;
+                    secondTerm[ i ] += scaledLegendreFunction * previousOrderSineTerm;
+                }
+            }
+
+            if( order < degree )
+            {
+                for( int i = 0; i < blockSize; i++ )
+                {
+                    thirdTerm[ i ] += scalingFactors[ i ] * sameDegreeRatio * nextOrderLegendreFunctions[ i ] *
+                            ( cosineCoefficient * realPart[ i ] + sineCoefficient * imaginaryPart[ i ] );
+                }
+            }
+
+            for( int i = 0; i < blockSize; i++ )
+            {
+                fourthTerm[ i ] -= scalingFactors[ i ] * nextDegreeRatio * nextDegreeAndOrderLegendreFunctions[ i ] *
+                        ( cosineCoefficient * realPart[ i ] + sineCoefficient * imaginaryPart[ i ] );
+            }
+        }
+
+        // Update (s + i t)^m to next order, and swap columns of derived Legendre functions
+        for( int i = 0; i < blockSize; i++ )
+        {
+            previousRealPart[ i ] = realPart[ i ];
+            previousImaginaryPart[ i ] = imaginaryPart[ i ];
+            realPart[ i ] = directionCosines_[ 0 ][ i ] * previousRealPart[ i ] -
+                    directionCosines_[ 1 ][ i ] * previousImaginaryPart[ i ];
+            imaginaryPart[ i ] = directionCosines_[ 0 ][ i ] * previousImaginaryPart[ i ] +
+                    directionCosines_[ 1 ][ i ] * previousRealPart[ i ];
+        }
+        std::swap( currentOrderTerms, nextOrderTerms );
+    }
+
+    // Combine terms into Cartesian acceleration
+    for( int i = 0; i < blockSize; i++ )
+    {
+        accelerations[ 3 * i ] = firstTerm[ i ] + directionCosines_[ 0 ][ i ] * fourthTerm[ i ];
+        accelerations[ 3 * i + 1 ] = secondTerm[ i ] + directionCosines_[ 1 ][ i ] * fourthTerm[ i ];
+        accelerations[ 3 * i + 2 ] = thirdTerm[ i ] + directionCosines_[ 2 ][ i ] * fourthTerm[ i ];
+    }
+}
+
+//! Constructor
+PinesSphericalHarmonicsCache::PinesSphericalHarmonicsCache( const int maximumDegree, const int maximumOrder ):
+    maximumDegree_( maximumDegree ), maximumOrder_( std::min( maximumOrder, maximumDegree ) ),
+    recursionCoefficients_( std::max( maximumDegree, 0 ) ), currentDistance_( TUDAT_NAN )
+{
+    checkPinesMaximumDegreeAndOrder( maximumDegree_, maximumOrder_ );
+
+    const int highestDegree = maximumDegree_ + 1;
+    legendreFunctions_.resize( ( highestDegree + 1 ) * ( highestDegree + 2 ) / 2, 0.0 );
+    realParts_.resize( maximumOrder_ + 3 );
+    imaginaryParts_.resize( maximumOrder_ + 3 );
+    degreeScalingFactors_.resize( highestDegree + 1 );
+}
+
+//! Function to update the cache to a new position
+void PinesSphericalHarmonicsCache::update( const Eigen::Vector3d& bodyFixedPosition, const double referenceRadius )
+{
+    const std::vector< double >& diagonalLegendreFunctions = recursionCoefficients_.getDiagonalLegendreFunctions( );
+    const std::vector< double >& subDiagonalRecursionCoefficients =
+            recursionCoefficients_.getSubDiagonalRecursionCoefficients( );
+    const std::vector< double >& firstColumnRecursionCoefficients =
+            recursionCoefficients_.getFirstColumnRecursionCoefficients( );
+    const std::vector< double >& secondColumnRecursionCoefficients =
+            recursionCoefficients_.getSecondColumnRecursionCoefficients( );
+
+    // Compute direction cosines and scaling factors per degree
+    currentDistance_ = bodyFixedPosition.norm( );
+    directionCosines_ = bodyFixedPosition / currentDistance_;
+
+    const int highestDegree = maximumDegree_ + 1;
+    const double radiusRatio = referenceRadius / currentDistance_;
+    degreeScalingFactors_[ 0 ] = 1.0 / ( currentDistance_ * currentDistance_ );
+    for( int degree = 1; degree <= highestDegree; degree++ )
+    {
+        degreeScalingFactors_[ degree ] = degreeScalingFactors_[ degree - 1 ] * radiusRatio;
+    }
+
+    // Compute real/imaginary parts of (s + i t)^m
+    realParts_[ 0 ] = 1.0;
+    imaginaryParts_[ 0 ] = 0.0;
+    for( unsigned int order = 1; order < realParts_.size( ); order++ )
+    {
+        realParts_[ order ] = directionCosines_.x( ) * realParts_[ order - 1 ] -
+                directionCosines_.y( ) * imaginaryParts_[ order - 1 ];
+        imaginaryParts_[ order ] = directionCosines_.x( ) * imaginaryParts_[ order - 1 ] +
+                directionCosines_.y( ) * realParts_[ order - 1 ];
+    }
+
+    // Compute derived Legendre functions, column-wise
+    const double sineOfLatitude = directionCosines_.z( );
+    const int highestOrder = std::min( maximumOrder_ + 2, highestDegree );
+    for( int order = 0; order <= highestOrder; order++ )
+    {
+        legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( order, order ) ] =
+                diagonalLegendreFunctions[ order ];
+        if( order + 1 <= highestDegree )
+        {
+            legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( order + 1, order ) ] =
+                    subDiagonalRecursionCoefficients[ order + 1 ] * diagonalLegendreFunctions[ order + 1 ] *
+                    sineOfLatitude;
+        }
+
+        for( int degree = order + 2; degree <= highestDegree; degree++ )
+        {
+            const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+            legendreFunctions_[ index ] =
+                    firstColumnRecursionCoefficients[ index ] * sineOfLatitude *
+                    legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( degree - 1, order ) ] -
+                    secondColumnRecursionCoefficients[ index ] *
+                    legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( degree - 2, order ) ];
+        }
+    }
+}
+
+//! Function to compute the gravitational acceleration at the current position
+Eigen::Vector3d PinesSphericalHarmonicsCache::computeAcceleration(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients )
+{
+    checkPinesCoefficientSizes( cosineCoefficients, sineCoefficients, maximumDegree_, maximumOrder_ );
+
+    const std::vector< double >& sameDegreeNormalizationRatios =
+            recursionCoefficients_.getSameDegreeNormalizationRatios( );
+    const std::vector< double >& nextDegreeNormalizationRatios =
+            recursionCoefficients_.getNextDegreeNormalizationRatios( );
+
+    double firstTerm = 0.0, secondTerm = 0.0, thirdTerm = 0.0, fourthTerm = 0.0;
+    for( int degree = 0; degree < cosineCoefficients.rows( ); degree++ )
+    {
+        const double scalingFactor = degreeScalingFactors_[ degree ];
+        for( int order = 0; order <= degree && order < cosineCoefficients.cols( ); order++ )
+        {
+            const double cosineCoefficient = cosineCoefficients( degree, order );
+            const double sineCoefficient = sineCoefficients( degree, order );
+            const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+            const double currentOrderTerm = scalingFactor * (
+                        cosineCoefficient * realParts_[ order ] + sineCoefficient * imaginaryParts_[ order ] );
+
+            if( order > 0 )
+            {
+                const double scaledLegendreFunction =
+                        scalingFactor * static_cast< double >( order ) * legendreFunctions_[ index ];
+                firstTerm += scaledLegendreFunction * (
+                            cosineCoefficient * realParts_[ order - 1 ] + sineCoefficient * imaginaryParts_[ order - 1 ] );
+                secondTerm += scaledLegendreFunction * (
+                            sineCoefficient * realParts_[ order - 1 ] - cosineCoefficient * imaginaryParts_[ order - 1 ] );
+            }
+            thirdTerm += sameDegreeNormalizationRatios[ index ] * getLegendreFunction( degree, order + 1 ) *
+                    currentOrderTerm;
+            fourthTerm -= nextDegreeNormalizationRatios[ index ] * getLegendreFunction( degree + 1, order + 1 ) *
+                    currentOrderTerm;
+        }
+    }
+
+    return gravitationalParameter * ( Eigen::Vector3d( firstTerm, secondTerm, thirdTerm ) +
+                                      fourthTerm * directionCosines_ );
+}
+
+//! Function to compute the gravitational potential at the current position
+double PinesSphericalHarmonicsCache::computePotential(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients )
+{
+    checkPinesCoefficientSizes( cosineCoefficients, sineCoefficients, maximumDegree_, maximumOrder_ );
+
+    double potential = 0.0;
+    for( int degree = 0; degree < cosineCoefficients.rows( ); degree++ )
+    {
+        double singleDegreeTerm = 0.0;
+        for( int order = 0; order <= degree && order < cosineCoefficients.cols( ); order++ )
+        {
+            singleDegreeTerm += legendreFunctions_[ PinesRecursionCoefficients::getCoefficientIndex( degree, order ) ] *
+                    ( cosineCoefficients( degree, order ) * realParts_[ order ] +
+                      sineCoefficients( degree, order ) * imaginaryParts_[ order ] );
+        }
+        potential += degreeScalingFactors_[ degree ] * singleDegreeTerm;
+    }
+    return gravitationalParameter * currentDistance_ * potential;
+}
+
+//! Function to compute the partial derivative of the gravitational acceleration w.r.t. the position
+Eigen::Matrix3d PinesSphericalHarmonicsCache::computeAccelerationPartialWrtPosition(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients )
+{
+    checkPinesCoefficientSizes( cosineCoefficients, sineCoefficients, maximumDegree_, maximumOrder_ );
+
+    const std::vector< double >& sameDegreeNormalizationRatios =
+            recursionCoefficients_.getSameDegreeNormalizationRatios( );
+
+    // The potential is written as U(r,s,t,u), with the direction cosines s,t,u treated as independent variables. The
+    // acceleration is then g = h + ( dU/dr - e.h ) e, with h = (1/r) dU/d(s,t,u), and e the vector of direction cosines.
+    // Below, the derivatives of h and dU/dr w.r.t. r and s,t,u are computed.
+    Eigen::Vector3d gradientTerms = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d gradientTermsRadialDerivative = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d radialDerivativeDirectionDerivatives = Eigen::Vector3d::Zero( );
+    Eigen::Matrix3d gradientTermsDirectionDerivatives = Eigen::Matrix3d::Zero( );
+    double radialDerivative = 0.0;
+    double secondRadialDerivative = 0.0;
+
+    for( int degree = 0; degree < cosineCoefficients.rows( ); degree++ )
+    {
+        const double scalingFactor = degreeScalingFactors_[ degree ];
+        const double currentDegree = static_cast< double >( degree );
+        for( int order = 0; order <= degree && order < cosineCoefficients.cols( ); order++ )
+        {
+            const double cosineCoefficient = cosineCoefficients( degree, order );
+            const double sineCoefficient = sineCoefficients( degree, order );
+            const double currentOrder = static_cast< double >( order );
+            const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+
+            const double legendreFunction = legendreFunctions_[ index ];
+            const double scaledDerivativeLegendreFunction =
+                    sameDegreeNormalizationRatios[ index ] * getLegendreFunction( degree, order + 1 );
+
+            // Compute terms of current order (D), and derivatives w.r.t. s (E) and t (F), divided by order
+            const double currentOrderTerm = cosineCoefficient * realParts_[ order ] +
+                    sineCoefficient * imaginaryParts_[ order ];
+            double cosineDerivativeTerm = 0.0, sineDerivativeTerm = 0.0;
+            if( order > 0 )
+            {
+                cosineDerivativeTerm = cosineCoefficient * realParts_[ order - 1 ] +
+                        sineCoefficient * imaginaryParts_[ order - 1 ];
+                sineDerivativeTerm = sineCoefficient * realParts_[ order - 1 ] -
+                        cosineCoefficient * imaginaryParts_[ order - 1 ];
+            }
+
+            // Contributions to h
+            const Eigen::Vector3d currentGradientTerms =
+                    scalingFactor * Eigen::Vector3d(
+                        currentOrder * legendreFunction * cosineDerivativeTerm,
+                        currentOrder * legendreFunction * sineDerivativeTerm,
+                        scaledDerivativeLegendreFunction * currentOrderTerm );
+            gradientTerms += currentGradientTerms;
+            gradientTermsRadialDerivative -= ( currentDegree + 2.0 ) * currentGradientTerms;
+            radialDerivativeDirectionDerivatives -= ( currentDegree + 1.0 ) * currentGradientTerms;
+
+            // Contributions to dU/dr
+            const double currentPotentialTerm = scalingFactor * legendreFunction * currentOrderTerm;
+            radialDerivative -= ( currentDegree + 1.0 ) * currentPotentialTerm;
+            secondRadialDerivative += ( currentDegree + 1.0 ) * ( currentDegree + 2.0 ) * currentPotentialTerm;
+
+            // Contributions to derivatives of h w.r.t. s,t,u
+            if( order > 1 )
+            {
+                const double secondOrderFactor =
+                        scalingFactor * currentOrder * ( currentOrder - 1.0 ) * legendreFunction;
+                const double secondCosineDerivativeTerm = cosineCoefficient * realParts_[ order - 2 ] +
+                        sineCoefficient * imaginaryParts_[ order - 2 ];
+                const double secondSineDerivativeTerm = sineCoefficient * realParts_[ order - 2 ] -
+                        cosineCoefficient * imaginaryParts_[ order - 2 ];
+                gradientTermsDirectionDerivatives( 0, 0 ) += secondOrderFactor * secondCosineDerivativeTerm;
+                gradientTermsDirectionDerivatives( 0, 1 ) += secondOrderFactor * secondSineDerivativeTerm;
+            }
+            gradientTermsDirectionDerivatives( 0, 2 ) +=
+                    scalingFactor * currentOrder * scaledDerivativeLegendreFunction * cosineDerivativeTerm;
+            gradientTermsDirectionDerivatives( 1, 2 ) +=
+                    scalingFactor * currentOrder * scaledDerivativeLegendreFunction * sineDerivativeTerm;
+            if( order + 1 < degree )
+            {
+                gradientTermsDirectionDerivatives( 2, 2 ) +=
+                        scalingFactor * sameDegreeNormalizationRatios[ index ] *
+                        sameDegreeNormalizationRatios[ index + 1 ] * getLegendreFunction( degree, order + 2 ) *
+                        currentOrderTerm;
+            }
+        }
+    }
+    gradientTermsDirectionDerivatives( 1, 1 ) = -gradientTermsDirectionDerivatives( 0, 0 );
+    gradientTermsDirectionDerivatives( 1, 0 ) = gradientTermsDirectionDerivatives( 0, 1 );
+    gradientTermsDirectionDerivatives( 2, 0 ) = gradientTermsDirectionDerivatives( 0, 2 );
+    gradientTermsDirectionDerivatives( 2, 1 ) = gradientTermsDirectionDerivatives( 1, 2 );
+    gradientTermsRadialDerivative /= currentDistance_;
+    secondRadialDerivative /= currentDistance_;
+
+    // Compute derivatives of acceleration w.r.t. r and s,t,u (independent)
+    const Eigen::Vector3d& directionCosines = directionCosines_;
+    const double radialTerm = radialDerivative - directionCosines.dot( gradientTerms );
+    const Eigen::Vector3d accelerationRadialDerivative =
+            gradientTermsRadialDerivative +
+            ( secondRadialDerivative - directionCosines.dot( gradientTermsRadialDerivative ) ) * directionCosines;
+    const Eigen::Matrix3d accelerationDirectionDerivatives =
+            gradientTermsDirectionDerivatives +
+            directionCosines * ( radialDerivativeDirectionDerivatives - gradientTerms -
+                                 gradientTermsDirectionDerivatives.transpose( ) * directionCosines ).transpose( ) +
+            radialTerm * Eigen::Matrix3d::Identity( );
+
+    // Convert to derivative w.r.t. Cartesian position, using dr/dx = e^T and de/dx = ( I - e e^T ) / r
+    return gravitationalParameter * (
+                accelerationRadialDerivative * directionCosines.transpose( ) +
+                accelerationDirectionDerivatives *
+                ( Eigen::Matrix3d::Identity( ) - directionCosines * directionCosines.transpose( ) ) / currentDistance_ );
+}
+
+//! Function to compute the partial derivative of the gravitational acceleration w.r.t. a single coefficient
+Eigen::Vector3d PinesSphericalHarmonicsCache::computeAccelerationPartialWrtCoefficient(
+        const double gravitationalParameter,
+        const int degree,
+        const int order,
+        const bool isCosineCoefficient )
+{
+    if( degree > maximumDegree_ || order > maximumOrder_ || order > degree )
+    {
+        throw std::runtime_error( "Error when computing Pines spherical harmonic gravity partial, degree/order " +
+                                  std::to_string( degree ) + "/" + std::to_string( order ) + " is not supported" );
+    }
+
+    const int index = PinesRecursionCoefficients::getCoefficientIndex( degree, order );
+    const double scalingFactor = degreeScalingFactors_[ degree ];
+
+    // Set the terms of (s + i t)^m and (s + i t)^(m-1) multiplying the coefficient.
+    double currentOrderTerm, cosineDerivativeTerm = 0.0, sineDerivativeTerm = 0.0;
+    if( isCosineCoefficient )
+    {
+        currentOrderTerm = realParts_[ order ];
+        if( order > 0 )
+        {
+            cosineDerivativeTerm = realParts_[ order - 1 ];
+            sineDerivativeTerm = -imaginaryParts_[ order - 1 ];
+        }
+    }
+    else
+    {
+        currentOrderTerm = imaginaryParts_[ order ];
+        if( order > 0 )
+        {
+            cosineDerivativeTerm = imaginaryParts_[ order - 1 ];
+            sineDerivativeTerm = realParts_[ order - 1 ];
+        }
+    }
+
+    const double scaledLegendreFunction =
+            scalingFactor * static_cast< double >( order ) * legendreFunctions_[ index ];
+    const double fourthTerm = -scalingFactor * recursionCoefficients_.getNextDegreeNormalizationRatios( )[ index ] *
+            getLegendreFunction( degree + 1, order + 1 ) * currentOrderTerm;
+    return gravitationalParameter * (
+                Eigen::Vector3d( scaledLegendreFunction * cosineDerivativeTerm,
+                                 scaledLegendreFunction * sineDerivativeTerm,
+                                 scalingFactor * recursionCoefficients_.getSameDegreeNormalizationRatios( )[ index ] *
+                                 getLegendreFunction( degree, order + 1 ) * currentOrderTerm ) +
+                fourthTerm * directionCosines_ );
+}
+
+//! Function to compute the spherical harmonic gravitational accelerations at a list of positions
+Eigen::Matrix< double, 3, Eigen::Dynamic > computeGeodesyNormalizedGravitationalAccelerations(
+        const Eigen::Matrix< double, 3, Eigen::Dynamic >& bodyFixedPositions,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients )
+{
+    PinesSphericalHarmonicsGravityCalculator gravityCalculator(
+                cosineCoefficients.rows( ) - 1, cosineCoefficients.cols( ) - 1 );
+
+    Eigen::Matrix< double, 3, Eigen::Dynamic > accelerations;
+    gravityCalculator.computeAccelerations(
+                bodyFixedPositions, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                accelerations );
+    return accelerations;
+}
+
+} // namespace gravitation
+
+} // namespace tudat
@@ -9,7 +9,10 @@
  *
  */
 
+#include <algorithm>
+
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/basics/parallelExecution.h"
 
 namespace tudat
 {
@@ -27,16 +30,73 @@ void PolyhedronGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosi
         basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
                 currentVerticesCoordinatesRelativeToFieldPoint_, currentBodyFixedPosition_, verticesCoordinates_);
 
-        // Compute per-facet factor
-        basic_mathematics::calculatePolyhedronPerFacetFactor(
-                currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_);
+        if ( factorComputationThreads_ == nullptr )
+        {
+            // Compute per-facet factor
+            basic_mathematics::calculatePolyhedronPerFacetFactor(
+                    currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachFacet_);
 
-        // Compute per-edge factor
-        basic_mathematics::calculatePolyhedronPerEdgeFactor(
-                currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_);
+            // Compute per-edge factor
+            basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                    currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_, verticesDefiningEachEdge_);
+        }
+        else
+        {
+            // Compute per-facet and per-edge factors in blocks, distributed over the worker threads
+            factorComputationThreads_->executeTasks( 2 * numberOfFactorComputationBlocks_, factorComputationBlockFunction_ );
+        }
     }
 }
 
+void PolyhedronGravityCache::setNumberOfThreads( const unsigned int numberOfThreads )
+{
+    numberOfThreads_ = numberOfThreads;
+
+    const unsigned int numberOfFacets = verticesDefiningEachFacet_.rows();
+    const unsigned int numberOfEdges = verticesDefiningEachEdge_.rows();
+    const unsigned int numberOfThreadsToUse = utilities::getNumberOfThreadsToUse(
+                numberOfThreads_, numberOfFacets + numberOfEdges );
+    if ( numberOfThreadsToUse <= 1 )
+    {
+        factorComputationThreads_ = nullptr;
+        factorComputationBlockFunction_ = nullptr;
+        return;
+    }
+
+    if ( factorComputationThreads_ == nullptr || factorComputationThreads_->getNumberOfThreads() != numberOfThreadsToUse )
+    {
+        factorComputationThreads_ = std::make_shared< utilities::ParallelTaskPool >( numberOfThreadsToUse );
+    }
+    currentPerFacetFactor_.resize( numberOfFacets );
+    currentPerEdgeFactor_.resize( numberOfEdges );
+
+    // Define blocks of facets and edges, each of which is computed by a single thread
+    numberOfFactorComputationBlocks_ = 4 * numberOfThreadsToUse;
+    const unsigned int numberOfBlocks = numberOfFactorComputationBlocks_;
+    const unsigned int facetsPerBlock = ( numberOfFacets + numberOfBlocks - 1 ) / numberOfBlocks;
+    const unsigned int edgesPerBlock = ( numberOfEdges + numberOfBlocks - 1 ) / numberOfBlocks;
+    factorComputationBlockFunction_ = [ this, numberOfBlocks, facetsPerBlock, edgesPerBlock, numberOfFacets, numberOfEdges ](
+            const unsigned int blockIndex )
+    {
+        if ( blockIndex < numberOfBlocks )
+        {
+            const unsigned int firstFacet = std::min( blockIndex * facetsPerBlock, numberOfFacets );
+            basic_mathematics::calculatePolyhedronPerFacetFactor(
+                    currentPerFacetFactor_, currentVerticesCoordinatesRelativeToFieldPoint_,
+                    verticesDefiningEachFacet_, firstFacet,
+                    std::min( facetsPerBlock, numberOfFacets - firstFacet ) );
+        }
+        else
+        {
+            const unsigned int firstEdge = std::min( ( blockIndex - numberOfBlocks ) * edgesPerBlock, numberOfEdges );
+            basic_mathematics::calculatePolyhedronPerEdgeFactor(
+                    currentPerEdgeFactor_, currentVerticesCoordinatesRelativeToFieldPoint_,
+                    verticesDefiningEachEdge_, firstEdge,
+                    std::min( edgesPerBlock, numberOfEdges - firstEdge ) );
+        }
+    };
+}
+
 void PolyhedronGravityField::computeVerticesAndFacetsDefiningEachEdge ( )
 {
     const unsigned int numberOfVertices = verticesCoordinates_.rows();
@@ -9,7 +9,12 @@
  *
  */
 
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
 #include "tudat/astro/gravitation/polyhedronGravityModel.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
 
 
 namespace tudat
@@ -31,16 +36,51 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
 
         currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
 
+        // Use spherical harmonic expansion outside of far-field switch radius
+        if ( currentRelativePosition_.norm( ) > farFieldSwitchRadius_ )
+        {
+            currentAccelerationInBodyFixedFrame_ = computeGeodesyNormalizedGravitationalAccelerationSum(
+                    currentRelativePosition_,
+                    gravitationalParameterFunction_( ),
+                    farFieldReferenceRadius_,
+                    farFieldCosineCoefficients_,
+                    farFieldSineCoefficients_,
+                    farFieldSphericalHarmonicsCache_,
+                    farFieldAccelerationPerTerm_ );
+
+            currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
+
+            // Compute the current gravitational potential
+            if ( updatePotential_ )
+            {
+                currentPotential_ = calculateSphericalHarmonicGravitationalPotential(
+                        currentRelativePosition_,
+                        gravitationalParameterFunction_( ),
+                        farFieldReferenceRadius_,
+                        farFieldCosineCoefficients_,
+                        farFieldSineCoefficients_,
+                        farFieldSphericalHarmonicsCache_ );
+            }
+
+            // Laplacian is zero outside of the body
+            if ( updateLaplacianOfPotential_ )
+            {
+                currentLaplacianOfPotential_ = 0.0;
+            }
+
+            return;
+        }
+
         polyhedronCache_->update( currentRelativePosition_ );
 
         // Compute the current acceleration
         currentAccelerationInBodyFixedFrame_ = basic_mathematics::calculatePolyhedronGradientOfGravitationalPotential(
                 gravitationalParameterFunction_() / volumeFunction_(),
                 polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint(),
-                getVerticesDefiningEachFacet_(),
-                getVerticesDefiningEachEdge_(),
-                getFacetDyads_(),
-                getEdgeDyads_(),
+                verticesDefiningEachFacet_,
+                verticesDefiningEachEdge_,
+                facetDyads_,
+                edgeDyads_,
                 polyhedronCache_->getPerFacetFactor(),
                 polyhedronCache_->getPerEdgeFactor() );
 
@@ -52,10 +92,10 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
             currentPotential_ = basic_mathematics::calculatePolyhedronGravitationalPotential(
                     gravitationalParameterFunction_( ) / volumeFunction_( ),
                     polyhedronCache_->getVerticesCoordinatesRelativeToFieldPoint( ),
-                    getVerticesDefiningEachFacet_( ),
-                    getVerticesDefiningEachEdge_( ),
-                    getFacetDyads_( ),
-                    getEdgeDyads_( ),
+                    verticesDefiningEachFacet_,
+                    verticesDefiningEachEdge_,
+                    facetDyads_,
+                    edgeDyads_,
                     polyhedronCache_->getPerFacetFactor( ),
                     polyhedronCache_->getPerEdgeFactor( ) );
         }
@@ -70,6 +110,28 @@ void PolyhedronGravitationalAccelerationModel::updateMembers( const double curre
     }
 }
 
+void PolyhedronGravitationalAccelerationModel::setFarFieldSphericalHarmonicExpansion(
+        const int maximumDegree, const double switchRadiusRatio )
+{
+    if ( !( switchRadiusRatio > 1.0 ) )
+    {
+        throw std::runtime_error( "Error when setting far-field expansion of polyhedron gravity, switch radius ratio (" +
+                                  std::to_string( switchRadiusRatio ) + ") must be larger than 1." );
+    }
+
+    const Eigen::MatrixXd verticesCoordinates = getVerticesCoordinates_( );
+    farFieldReferenceRadius_ = basic_astrodynamics::computePolyhedronBrillouinSphereRadius( verticesCoordinates );
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+                verticesCoordinates, verticesDefiningEachFacet_, maximumDegree, farFieldReferenceRadius_,
+                farFieldCosineCoefficients_, farFieldSineCoefficients_ );
+    farFieldSphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >(
+                maximumDegree + 1, maximumDegree + 1 );
+    farFieldSwitchRadius_ = switchRadiusRatio * farFieldReferenceRadius_;
+
+    // Reset current time, to ensure that the acceleration is recomputed
+    this->currentTime_ = TUDAT_NAN;
+}
+
 
 } // namespace gravitation
 
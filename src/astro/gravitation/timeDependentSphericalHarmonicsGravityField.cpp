@@ -47,14 +47,14 @@ void TimeDependentSphericalHarmonicsGravityField::clearVariations( )
 void TimeDependentSphericalHarmonicsGravityField::update( const double time )
 {
     // Initialize current coefficients to nominal values.
-    sineCoefficients_ = nominalSineCoefficients_;
-    cosineCoefficients_ = nominalCosineCoefficients_;
+    *sineCoefficients_ = nominalSineCoefficients_;
+    *cosineCoefficients_ = nominalCosineCoefficients_;
 
     // Iterate over all corrections.
     for( unsigned int i = 0; i < correctionFunctions_.size( ); i++ )
     {
         // Add correction of this iteration to current coefficients.
-        correctionFunctions_[ i ]( time, sineCoefficients_, cosineCoefficients_ );
+        correctionFunctions_[ i ]( time, *sineCoefficients_, *cosineCoefficients_ );
     }
 }
 
@@ -12,6 +12,7 @@
 
 #include "tudat/astro/low_thrust/shape_based/hodographicShapingLeg.h"
 #include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/quadrature/gaussianQuadrature.h"
 
 namespace tudat
 {
@@ -33,6 +34,8 @@ HodographicShapingLeg::HodographicShapingLeg(
     centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
     departureVelocityFunction_( departureVelocityFunction ),
     arrivalVelocityFunction_( arrivalVelocityFunction ),
+    numberOfQuadratureNodes_( 64 ),
+    tabulatedTimeOfFlight_( TUDAT_NAN ),
     numberOfFreeRadialCoefficients_( radialVelocityFunctionComponents.size( ) - 3 ),
     numberOfFreeNormalCoefficients_( normalVelocityFunctionComponents.size( ) - 3 ),
     numberOfFreeAxialCoefficients_( axialVelocityFunctionComponents.size( ) - 3 )
@@ -59,7 +62,8 @@ HodographicShapingLeg::HodographicShapingLeg(
                 axialVelocityFunctionComponents, fullCoefficientsAxialVelocityFunction_ );
 
     // Define numerical quadrature settings, required to compute the current polar angle and final deltaV.
-    quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings< double > >( 0.0, 64 );
+    quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings< double > >(
+                0.0, numberOfQuadratureNodes_ );
 
 }
 
@@ -87,6 +91,9 @@ void HodographicShapingLeg::computeTransfer( )
         throw std::runtime_error( "Error when updating hodographic shaping object, number of inputs is inconsistent" );
     }
 
+    // Remove thrust accelerations computed for previous leg parameters
+    thrustAccelerationVectorCache_.clear( );
+
     updateFreeCoefficients( );
     satisfyBoundaryConditions( );
     legTotalDeltaV_ = computeDeltaV( );
@@ -157,6 +164,9 @@ void HodographicShapingLeg::satisfyBoundaryConditions( )
     axialBoundaryConditions_.push_back( initialCylindricalState[ 5 ] );
     axialBoundaryConditions_.push_back( finalCylindricalState[ 5 ] );
 
+    // Retrieve values of velocity function components at quadrature nodes (recomputed only if time of flight has changed).
+    updateTabulatedVelocityFunctionComponents( );
+
     // Compute inverse of matrices containing boundary values.
     inverseMatrixRadialBoundaryValues_ = computeInverseMatrixRadialOrAxialBoundaries( radialVelocityFunction_ );
     inverseMatrixNormalBoundaryValues_ = computeInverseMatrixNormalBoundaries( normalVelocityFunction_ );
@@ -164,6 +174,7 @@ void HodographicShapingLeg::satisfyBoundaryConditions( )
 
     // Satisfy boundary conditions.
     satisfyRadialBoundaryConditions( fullCoefficientsRadialVelocityFunction_.segment(3, numberOfFreeRadialCoefficients_ ) );
+    computeTabulatedRadialDistances( );
     satisfyNormalBoundaryConditions( fullCoefficientsNormalVelocityFunction_.segment(3, numberOfFreeNormalCoefficients_ ) );
     satisfyAxialBoundaryConditions( fullCoefficientsAxialVelocityFunction_.segment(3, numberOfFreeAxialCoefficients_ ) );
 }
@@ -252,6 +263,7 @@ void HodographicShapingLeg::satisfyRadialBoundaryConditions( const Eigen::Vector
     }
 
     // Set the coefficients of the radial velocity function.
+    fullCoefficientsRadialVelocityFunction_ = radialVelocityFunctionCoefficients;
     radialVelocityFunction_->resetCompositeFunctionCoefficients( radialVelocityFunctionCoefficients );
 
 }
@@ -293,6 +305,7 @@ void HodographicShapingLeg::satisfyAxialBoundaryConditions( const Eigen::VectorX
         axialVelocityFunctionCoefficients << fixedCoefficientsAxial, freeCoefficients;
     }
     // Set the coefficients of the axial velocity function.
+    fullCoefficientsAxialVelocityFunction_ = axialVelocityFunctionCoefficients;
     axialVelocityFunction_->resetCompositeFunctionCoefficients( axialVelocityFunctionCoefficients );
 
 }
@@ -338,50 +351,11 @@ void HodographicShapingLeg::satisfyNormalBoundaryConditions( const Eigen::Vector
     }
 
     // Set the coefficients of the normal velocity function.
+    fullCoefficientsNormalVelocityFunction_ = normalVelocityFunctionCoefficients;
     normalVelocityFunction_->resetCompositeFunctionCoefficients( normalVelocityFunctionCoefficients );
 
 }
 
-// Define angular velocity due to the third component of the composite function only.
-double HodographicShapingLeg::computeDerivativePolarAngleDueToThirdComponent(
-        const double timeSinceDeparture, const Eigen::Vector2d& matrixK )
-{
-
-    double angularVelocityDueToThirdComponent = (
-                matrixK( 0 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 0, timeSinceDeparture )
-                + matrixK( 1 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 1, timeSinceDeparture )
-                + normalVelocityFunction_->getComponentFunctionCurrentValue( 2, timeSinceDeparture ) ) /
-            computeCurrentRadialDistance( timeSinceDeparture );
-
-    return angularVelocityDueToThirdComponent;
-
-}
-
-
-// Define the angular velocity due to all the other components of the composite function, once combined.
-double HodographicShapingLeg::computeDerivativePolarAngleDueToOtherComponents(
-        const double timeSinceDeparture, const Eigen::Vector2d& matrixL, const Eigen::VectorXd& freeCoefficients )
-{
-
-    // Compute angular velocity associated with free coefficients
-    double angularVelocityDueToFreeCoefficients = 0.0;
-    for(int j = 0 ; j < numberOfFreeNormalCoefficients_ ; j++ )
-    {
-        angularVelocityDueToFreeCoefficients += freeCoefficients( j )
-                * normalVelocityFunction_->getComponentFunctionCurrentValue( j + 3 , timeSinceDeparture );
-    }
-    angularVelocityDueToFreeCoefficients = angularVelocityDueToFreeCoefficients / computeCurrentRadialDistance( timeSinceDeparture );
-
-    // Compute angular velocity associated with fixed coefficients (first and second coefficient)
-    double angularVelocityDueToFirstAndSecondCoefficients =
-            ( matrixL( 0 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 0 , timeSinceDeparture )
-            + matrixL( 1 ) * normalVelocityFunction_->getComponentFunctionCurrentValue( 1 , timeSinceDeparture ) ) /
-            computeCurrentRadialDistance( timeSinceDeparture );
-
-    return angularVelocityDueToFreeCoefficients + angularVelocityDueToFirstAndSecondCoefficients;
-
-}
-
 double HodographicShapingLeg::computeThirdFixedCoefficientAxialVelocity ( const Eigen::VectorXd& freeCoefficients ){
 
     // Compute the third fixed coefficient of the normal velocity composite function, so that the condition on the final
@@ -416,23 +390,20 @@ double HodographicShapingLeg::computeThirdFixedCoefficientAxialVelocity ( const
     matrixK = inverseMatrixNormalBoundaryValues_ * initialAndFinalValuesThirdComponentFunction;
 
 
-    // Define angular velocity due to the third component of the composite function only.
-    std::function< double( const double ) > derivativePolarAngleDueToThirdComponent =
-            std::bind( &HodographicShapingLeg::computeDerivativePolarAngleDueToThirdComponent, this, std::placeholders::_1, matrixK );
-
-    // Define the angular velocity due to all the other components of the composite function, once combined.
-    std::function< double( const double ) > derivativePolarAngleDueToOtherComponents  =
-            std::bind( &HodographicShapingLeg::computeDerivativePolarAngleDueToOtherComponents, this, std::placeholders::_1, matrixL, freeCoefficients );
-
-    // Define numerical quadratures.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > integratorPolarAngleDueToThirdComponent =
-            numerical_quadrature::createQuadrature( derivativePolarAngleDueToThirdComponent, quadratureSettings_, timeOfFlight_ );
-
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > integratorPolarAngleDueToOtherComponents =
-            numerical_quadrature::createQuadrature( derivativePolarAngleDueToOtherComponents, quadratureSettings_, timeOfFlight_ );
+    // Compute angular velocity due to the third component of the composite function only, and due to all the other
+    // components of the composite function (once combined), at the quadrature nodes.
+    const Eigen::MatrixXd& normalComponentValues = tabulatedNormalVelocityComponents_.values_;
+    Eigen::ArrayXd derivativePolarAngleDueToThirdComponent =
+            ( matrixK( 0 ) * normalComponentValues.col( 0 ) + matrixK( 1 ) * normalComponentValues.col( 1 )
+              + normalComponentValues.col( 2 ) ).array( ) / tabulatedRadialDistances_;
+    Eigen::ArrayXd derivativePolarAngleDueToOtherComponents =
+            ( normalComponentValues.rightCols( numberOfFreeNormalCoefficients_ ) * freeCoefficients
+              + matrixL( 0 ) * normalComponentValues.col( 0 ) + matrixL( 1 ) * normalComponentValues.col( 1 ) ).array( )
+            / tabulatedRadialDistances_;
 
-    return ( normalBoundaryConditions_[ 2 ] - integratorPolarAngleDueToOtherComponents->getQuadrature() )
-           / integratorPolarAngleDueToThirdComponent->getQuadrature();
+    // Integrate both angular velocities over the time of flight.
+    return ( normalBoundaryConditions_[ 2 ] - 0.5 * timeOfFlight_ * ( quadratureWeights_ * derivativePolarAngleDueToOtherComponents ).sum( ) )
+            / ( 0.5 * timeOfFlight_ * ( quadratureWeights_ * derivativePolarAngleDueToThirdComponent ).sum( ) );
 
 }
 
@@ -621,16 +592,106 @@ Eigen::Vector3d HodographicShapingLeg::computeThrustAccelerationDirection(
 //! Compute DeltaV.
 double HodographicShapingLeg::computeDeltaV( )
 {
-    // Define the derivative of the deltaV, ie thrust acceleration function, as a function of time.
-    std::function< double( const double ) > derivativeFunctionDeltaV =
-            std::bind(&HodographicShapingLeg::computeThrustAccelerationMagnitude, this,
-                      std::placeholders::_1 );
+    // Compute velocity components, and their time derivatives, at the quadrature nodes.
+    Eigen::ArrayXd radialVelocities =
+            ( tabulatedRadialVelocityComponents_.values_ * fullCoefficientsRadialVelocityFunction_ ).array( );
+    Eigen::ArrayXd normalVelocities =
+            ( tabulatedNormalVelocityComponents_.values_ * fullCoefficientsNormalVelocityFunction_ ).array( );
+    Eigen::ArrayXd derivativesRadialVelocity =
+            ( tabulatedRadialVelocityComponents_.derivatives_ * fullCoefficientsRadialVelocityFunction_ ).array( );
+    Eigen::ArrayXd derivativesNormalVelocity =
+            ( tabulatedNormalVelocityComponents_.derivatives_ * fullCoefficientsNormalVelocityFunction_ ).array( );
+    Eigen::ArrayXd derivativesAxialVelocity =
+            ( tabulatedAxialVelocityComponents_.derivatives_ * fullCoefficientsAxialVelocityFunction_ ).array( );
+
+    // Compute axial distance at the quadrature nodes (radial distance has been computed when satisfying the boundary
+    // conditions).
+    Eigen::ArrayXd axialDistances =
+            ( tabulatedAxialVelocityComponents_.integrals_ * fullCoefficientsAxialVelocityFunction_ ).array( )
+            - tabulatedAxialVelocityComponents_.initialIntegrals_.dot( fullCoefficientsAxialVelocityFunction_ )
+            + axialBoundaryConditions_[ 0 ];
+
+    // Compute angular velocity, and gravitational acceleration divided by distance from the central body.
+    Eigen::ArrayXd angularVelocities = normalVelocities / tabulatedRadialDistances_;
+    Eigen::ArrayXd gravitationalAccelerationsPerUnitDistance = centralBodyGravitationalParameter_
+            / ( tabulatedRadialDistances_.square( ) + axialDistances.square( ) ).pow( 1.5 );
+
+    // Compute magnitude of thrust acceleration (equal to the norm of its cylindrical components, see
+    // computeThrustAccelerationInCylindricalCoordinates) at the quadrature nodes.
+    Eigen::ArrayXd thrustAccelerationMagnitudes =
+            ( ( derivativesRadialVelocity - angularVelocities * normalVelocities
+                + gravitationalAccelerationsPerUnitDistance * tabulatedRadialDistances_ ).square( )
+              + ( derivativesNormalVelocity + angularVelocities * radialVelocities ).square( )
+              + ( derivativesAxialVelocity + gravitationalAccelerationsPerUnitDistance * axialDistances ).square( ) ).sqrt( );
+
+    // Integrate thrust acceleration magnitude over the time of flight.
+    return 0.5 * timeOfFlight_ * ( quadratureWeights_ * thrustAccelerationMagnitudes ).sum( );
+}
 
-    // Define numerical quadrature.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > quadrature =
-            numerical_quadrature::createQuadrature(derivativeFunctionDeltaV, quadratureSettings_, timeOfFlight_ );
+//! Tabulate the components of a velocity function at the given quadrature nodes.
+void HodographicShapingLeg::tabulateVelocityFunctionComponents(
+        const std::shared_ptr< CompositeFunctionHodographicShaping > velocityFunction,
+        const Eigen::VectorXd& quadratureNodes,
+        TabulatedVelocityFunctionComponents& tabulatedComponents )
+{
+    int numberOfComponents = velocityFunction->getNumberOfCompositeFunctionComponents( );
+    tabulatedComponents.values_.resize( quadratureNodes.rows( ), numberOfComponents );
+    tabulatedComponents.derivatives_.resize( quadratureNodes.rows( ), numberOfComponents );
+    tabulatedComponents.integrals_.resize( quadratureNodes.rows( ), numberOfComponents );
+    tabulatedComponents.initialIntegrals_.resize( numberOfComponents );
+
+    for( int j = 0; j < numberOfComponents; j++ )
+    {
+        for( int i = 0; i < quadratureNodes.rows( ); i++ )
+        {
+            tabulatedComponents.values_( i, j ) =
+                    velocityFunction->getComponentFunctionCurrentValue( j, quadratureNodes( i ) );
+            tabulatedComponents.derivatives_( i, j ) =
+                    velocityFunction->getComponentFunctionDerivativeCurrentValue( j, quadratureNodes( i ) );
+            tabulatedComponents.integrals_( i, j ) =
+                    velocityFunction->getComponentFunctionIntegralCurrentValue( j, quadratureNodes( i ) );
+        }
+        tabulatedComponents.initialIntegrals_( j ) = velocityFunction->getComponentFunctionIntegralCurrentValue( j, 0.0 );
+    }
+}
+
+//! Update the quadrature nodes and weights, and the tabulated velocity function components.
+void HodographicShapingLeg::updateTabulatedVelocityFunctionComponents( )
+{
+    // The base functions do not depend on the leg parameters, so that the tabulated values only need to be
+    // recomputed when the time of flight changes.
+    if( !( timeOfFlight_ == tabulatedTimeOfFlight_ ) )
+    {
+        std::shared_ptr< numerical_quadrature::GaussQuadratureNodesAndWeights< double > > gaussQuadratureNodesAndWeights =
+                numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( );
 
-    return quadrature->getQuadrature( );
+        // Change of variable -> from range [-1, 1] to range [0, time of flight], as done by GaussianQuadrature
+        Eigen::VectorXd quadratureNodes =
+                ( 0.5 * ( timeOfFlight_ * gaussQuadratureNodesAndWeights->getNodes( numberOfQuadratureNodes_ )
+                          + timeOfFlight_ ) ).matrix( );
+        quadratureWeights_ = gaussQuadratureNodesAndWeights->getWeights( numberOfQuadratureNodes_ );
+
+        tabulateVelocityFunctionComponents( radialVelocityFunction_, quadratureNodes, tabulatedRadialVelocityComponents_ );
+        tabulateVelocityFunctionComponents( normalVelocityFunction_, quadratureNodes, tabulatedNormalVelocityComponents_ );
+        tabulateVelocityFunctionComponents( axialVelocityFunction_, quadratureNodes, tabulatedAxialVelocityComponents_ );
+
+        tabulatedTimeOfFlight_ = timeOfFlight_;
+    }
+}
+
+//! Compute the radial distance at the quadrature nodes.
+void HodographicShapingLeg::computeTabulatedRadialDistances( )
+{
+    tabulatedRadialDistances_ =
+            ( tabulatedRadialVelocityComponents_.integrals_ * fullCoefficientsRadialVelocityFunction_ ).array( )
+            - tabulatedRadialVelocityComponents_.initialIntegrals_.dot( fullCoefficientsRadialVelocityFunction_ )
+            + radialBoundaryConditions_[ 0 ];
+
+    // Check if computed radial distances are valid
+    if( ( tabulatedRadialDistances_ < 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Error when computing radial distance in hodographic shaping: computed distance is negative." );
+    }
 }
 
 
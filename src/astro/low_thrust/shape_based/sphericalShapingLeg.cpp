@@ -12,6 +12,7 @@
 
 #include "tudat/astro/basic_astro/celestialBodyConstants.h"
 #include "tudat/math/basic/coordinateConversions.h"
+#include "tudat/math/quadrature/gaussianQuadrature.h"
 #include "tudat/astro/low_thrust/shape_based/sphericalShapingLeg.h"
 
 namespace tudat
@@ -33,7 +34,10 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
     initialValueFreeCoefficient_( initialValueFreeCoefficient ),
     lowerBoundFreeCoefficient_( lowerBoundFreeCoefficient ),
     upperBoundFreeCoefficient_( upperBoundFreeCoefficient ),
-    timeToAzimuthInterpolatorStepSize_(timeToAzimuthInterpolatorStepSize)
+    timeToAzimuthInterpolatorStepSize_(timeToAzimuthInterpolatorStepSize),
+    numberOfQuadratureNodes_( 16 ),
+    tabulatedInitialAzimuthAngle_( TUDAT_NAN ),
+    tabulatedFinalAzimuthAngle_( TUDAT_NAN )
 {
     // Normalize the gravitational parameter of the central body.
     centralBodyGravitationalParameter_ = centralBodyGravitationalParameter * std::pow( physical_constants::JULIAN_YEAR, 2.0 )
@@ -48,6 +52,12 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
     elevationAngleCompositeFunction_ = std::make_shared< CompositeElevationFunctionSphericalShaping >(
                 Eigen::VectorXd( coefficientsElevationAngleFunction_ ) );
 
+    // Retrieve Gauss quadrature nodes and weights, to be used to compute time of flight and deltaV.
+    quadratureNodes_ = numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( )->getNodes(
+                numberOfQuadratureNodes_ );
+    quadratureWeights_ = numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( )->getWeights(
+                numberOfQuadratureNodes_ );
+
     // Define functions that return the departure and arrival velocities
     departureVelocityFunction_ = [=]( ){ return departureBodyState_.segment( 3, 3 ); };
     arrivalVelocityFunction_ = [=]( ){ return arrivalBodyState_.segment( 3, 3 ); };
@@ -71,7 +81,10 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
         initialValueFreeCoefficient_( initialValueFreeCoefficient ),
         lowerBoundFreeCoefficient_( lowerBoundFreeCoefficient ),
         upperBoundFreeCoefficient_( upperBoundFreeCoefficient ),
-        timeToAzimuthInterpolatorStepSize_(timeToAzimuthInterpolatorStepSize)
+        timeToAzimuthInterpolatorStepSize_(timeToAzimuthInterpolatorStepSize),
+        numberOfQuadratureNodes_( 16 ),
+        tabulatedInitialAzimuthAngle_( TUDAT_NAN ),
+        tabulatedFinalAzimuthAngle_( TUDAT_NAN )
 {
     // Normalize the gravitational parameter of the central body.
     centralBodyGravitationalParameter_ = centralBodyGravitationalParameter * std::pow( physical_constants::JULIAN_YEAR, 2.0 )
@@ -86,6 +99,12 @@ SphericalShapingLeg::SphericalShapingLeg(const std::shared_ptr<ephemerides::Ephe
     elevationAngleCompositeFunction_ = std::make_shared< CompositeElevationFunctionSphericalShaping >(
             Eigen::VectorXd( coefficientsElevationAngleFunction_ ) );
 
+    // Retrieve Gauss quadrature nodes and weights, to be used to compute time of flight and deltaV.
+    quadratureNodes_ = numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( )->getNodes(
+            numberOfQuadratureNodes_ );
+    quadratureWeights_ = numerical_quadrature::getGaussQuadratureNodesAndWeights< double >( )->getWeights(
+            numberOfQuadratureNodes_ );
+
 }
 
 void SphericalShapingLeg::computeTransfer( )
@@ -97,6 +116,9 @@ void SphericalShapingLeg::computeTransfer( )
 
     updateDepartureAndArrivalBodies( legParameters_( 0 ), legParameters_( 1 ) );
 
+    // Remove thrust accelerations computed for previous leg parameters
+    thrustAccelerationVectorCache_.clear( );
+
     // Update number of revolutions, after testing if value is valid
     if ( legParameters_(2) < 0 )
     {
@@ -166,7 +188,11 @@ void SphericalShapingLeg::computeTransfer( )
             finalStateSphericalCoordinates_[ 5 ] / finalDerivativeAzimuthAngle ).finished();
 
     // Define settings for numerical quadrature, to be used to compute time of flight and final deltaV.
-    quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings < double > >( initialAzimuthAngle_, 16 );
+    quadratureSettings_ = std::make_shared< numerical_quadrature::GaussianQuadratureSettings < double > >(
+                initialAzimuthAngle_, numberOfQuadratureNodes_ );
+
+    // Retrieve values of base functions at quadrature nodes (recomputed only if initial or final azimuth has changed).
+    updateTabulatedBaseFunctionValues( );
 
     // Update value of boundary conditions of free coefficient a2
     // computeFreeCoefficientBoundaries();
@@ -181,10 +207,13 @@ void SphericalShapingLeg::computeTransfer( )
             Eigen::VectorXd::LinSpaced( std::ceil( computeNormalizedTimeOfFlight() * physical_constants::JULIAN_YEAR / timeToAzimuthInterpolatorStepSize_ ),
                                         initialAzimuthAngle_, finalAzimuthAngle_ );
 
+    Eigen::VectorXd normalizedTimesAssociatedWithAzimuthAngles =
+            convertAzimuthAnglesToNormalizedTimes( azimuthAnglesToComputeAssociatedEpochs );
+
     std::map< double, double > dataToInterpolate;
     for ( int i = 0 ; i < azimuthAnglesToComputeAssociatedEpochs.size() ; i++ )
     {
-        dataToInterpolate[ convertAzimuthToTime( azimuthAnglesToComputeAssociatedEpochs[ i ] ) * physical_constants::JULIAN_YEAR ]
+        dataToInterpolate[ normalizedTimesAssociatedWithAzimuthAngles[ i ] * physical_constants::JULIAN_YEAR ]
                 = azimuthAnglesToComputeAssociatedEpochs[ i ];
     }
 
@@ -425,7 +454,15 @@ double SphericalShapingLeg::computeDerivativeScalarFunctionD(double currentAzimu
 
 double SphericalShapingLeg::computeNormalizedTimeOfFlight()
 {
-    return convertAzimuthToTime(finalAzimuthAngle_);
+    // Integrate the derivative of the time w.r.t. azimuth angle, using the base function values at the quadrature nodes.
+    double normalizedTimeOfFlight = 0.5 * ( finalAzimuthAngle_ - initialAzimuthAngle_ ) * ( quadratureWeights_ *
+            computeDerivativesOfTimeWrtAzimuthAngle( tabulatedRadialBaseFunctionValues_, tabulatedElevationBaseFunctionValues_ ) ).sum( );
+    if( normalizedTimeOfFlight != normalizedTimeOfFlight )
+    {
+        throw std::runtime_error( "Error in spherical shaping, converting azimuth to time resulted in NaN value, this could be a result of poorly defined ephemerides or gravitational parameter." );
+    }
+
+    return normalizedTimeOfFlight;
 }
 
 
@@ -685,25 +722,278 @@ Eigen::Vector3d SphericalShapingLeg::computeThrustAccelerationDirection (const d
 
 double SphericalShapingLeg::computeDeltaV( )
 {
-    // Define function to integrate: time derivative of the deltaV multiplied by a factor which changes the variable of
-    // integration from the time to the azimuth
-    std::function< double( const double ) > derivativeFunctionDeltaV = [ = ] ( const double currentAzimuthAngle )
+    // Integrate the derivative of the deltaV w.r.t. azimuth angle, using the base function values at the quadrature nodes.
+    double normalizedDeltaV = 0.5 * ( finalAzimuthAngle_ - initialAzimuthAngle_ ) * ( quadratureWeights_ *
+            computeDerivativesOfDeltaVWrtAzimuthAngle( tabulatedRadialBaseFunctionValues_, tabulatedElevationBaseFunctionValues_ ) ).sum( );
+
+    // Return dimensional deltaV
+    return normalizedDeltaV * physical_constants::ASTRONOMICAL_UNIT / physical_constants::JULIAN_YEAR;
+}
+
+void SphericalShapingLeg::computeBaseFunctionValues( const Eigen::VectorXd& azimuthAngles,
+                                                     std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+                                                     std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues,
+                                                     const unsigned int maximumDerivativeOrder )
+{
+    if( maximumDerivativeOrder > 3 )
     {
-        double thrustAcceleration = computeNormalizedThrustAccelerationInSphericalCoordinates(currentAzimuthAngle).norm();
-        double derivativeOfTimeWithRespectToAzimuth = std::sqrt(computeScalarFunctionD(currentAzimuthAngle)
-                * std::pow( radialDistanceCompositeFunction_->evaluateCompositeFunction( currentAzimuthAngle ), 2.0 )
-                / centralBodyGravitationalParameter_ );
+        throw std::runtime_error( "Error when computing spherical shaping base functions, derivatives of order " +
+                                  std::to_string( maximumDerivativeOrder ) + " are not supported" );
+    }
 
-        return thrustAcceleration * derivativeOfTimeWithRespectToAzimuth;
+    radialBaseFunctionValues.resize( maximumDerivativeOrder + 1 );
+    elevationBaseFunctionValues.resize( maximumDerivativeOrder + 1 );
+    for( unsigned int i = 0; i <= maximumDerivativeOrder; i++ )
+    {
+        radialBaseFunctionValues[ i ].resize( azimuthAngles.rows( ), coefficientsRadialDistanceFunction_.rows( ) );
+        elevationBaseFunctionValues[ i ].resize( azimuthAngles.rows( ), coefficientsElevationAngleFunction_.rows( ) );
+    }
 
-    };
+    // Evaluate radial distance base functions.
+    for( int j = 0; j < coefficientsRadialDistanceFunction_.rows( ); j++ )
+    {
+        for( int i = 0; i < azimuthAngles.rows( ); i++ )
+        {
+            radialBaseFunctionValues[ 0 ]( i, j ) = radialDistanceCompositeFunction_->getComponentFunctionCurrentValue( j, azimuthAngles( i ) );
+            if( maximumDerivativeOrder > 0 )
+            {
+                radialBaseFunctionValues[ 1 ]( i, j ) = radialDistanceCompositeFunction_->getComponentFunctionFirstDerivative( j, azimuthAngles( i ) );
+            }
+            if( maximumDerivativeOrder > 1 )
+            {
+                radialBaseFunctionValues[ 2 ]( i, j ) = radialDistanceCompositeFunction_->getComponentFunctionSecondDerivative( j, azimuthAngles( i ) );
+            }
+            if( maximumDerivativeOrder > 2 )
+            {
+                radialBaseFunctionValues[ 3 ]( i, j ) = radialDistanceCompositeFunction_->getComponentFunctionThirdDerivative( j, azimuthAngles( i ) );
+            }
+        }
+    }
 
-    // Define numerical quadrature from quadrature settings.
-    std::shared_ptr< numerical_quadrature::NumericalQuadrature< double, double > > quadrature =
-            numerical_quadrature::createQuadrature( derivativeFunctionDeltaV, quadratureSettings_, finalAzimuthAngle_ );
+    // Evaluate elevation angle base functions.
+    for( int j = 0; j < coefficientsElevationAngleFunction_.rows( ); j++ )
+    {
+        for( int i = 0; i < azimuthAngles.rows( ); i++ )
+        {
+            elevationBaseFunctionValues[ 0 ]( i, j ) = elevationAngleCompositeFunction_->getComponentFunctionCurrentValue( j, azimuthAngles( i ) );
+            if( maximumDerivativeOrder > 0 )
+            {
+                elevationBaseFunctionValues[ 1 ]( i, j ) = elevationAngleCompositeFunction_->getComponentFunctionFirstDerivative( j, azimuthAngles( i ) );
+            }
+            if( maximumDerivativeOrder > 1 )
+            {
+                elevationBaseFunctionValues[ 2 ]( i, j ) = elevationAngleCompositeFunction_->getComponentFunctionSecondDerivative( j, azimuthAngles( i ) );
+            }
+            if( maximumDerivativeOrder > 2 )
+            {
+                elevationBaseFunctionValues[ 3 ]( i, j ) = elevationAngleCompositeFunction_->getComponentFunctionThirdDerivative( j, azimuthAngles( i ) );
+            }
+        }
+    }
+}
 
-    // Return dimensional deltaV
-    return quadrature->getQuadrature( ) * physical_constants::ASTRONOMICAL_UNIT / physical_constants::JULIAN_YEAR;
+void SphericalShapingLeg::computeShapingFunctionValues( const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+                                                        const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues,
+                                                        std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                                        std::vector< Eigen::ArrayXd >& elevationAngleValues )
+{
+    unsigned int numberOfDerivatives = radialBaseFunctionValues.size( );
+    radialDistanceValues.resize( numberOfDerivatives );
+    elevationAngleValues.resize( numberOfDerivatives );
+
+    // Compute weighted sum of the radial base functions (and their derivatives); the radial distance is its inverse.
+    std::vector< Eigen::ArrayXd > radialFunctionSums( numberOfDerivatives );
+    for( unsigned int i = 0; i < numberOfDerivatives; i++ )
+    {
+        radialFunctionSums[ i ] = ( radialBaseFunctionValues[ i ] * coefficientsRadialDistanceFunction_ ).array( );
+        elevationAngleValues[ i ] = ( elevationBaseFunctionValues[ i ] * coefficientsElevationAngleFunction_ ).array( );
+    }
+
+    // Compute radial distance and its derivatives, as done by CompositeRadialFunctionSphericalShaping.
+    radialDistanceValues[ 0 ] = radialFunctionSums[ 0 ].inverse( );
+    if( numberOfDerivatives > 1 )
+    {
+        radialDistanceValues[ 1 ] = - radialFunctionSums[ 1 ] * radialDistanceValues[ 0 ].square( );
+    }
+    if( numberOfDerivatives > 2 )
+    {
+        radialDistanceValues[ 2 ] = - radialFunctionSums[ 2 ] * radialDistanceValues[ 0 ].square( )
+                + 2.0 * radialFunctionSums[ 0 ] * radialDistanceValues[ 1 ].square( );
+    }
+    if( numberOfDerivatives > 3 )
+    {
+        radialDistanceValues[ 3 ] = - radialFunctionSums[ 3 ] * radialDistanceValues[ 0 ].square( )
+                - 2.0 * radialDistanceValues[ 0 ] * radialDistanceValues[ 1 ] * radialFunctionSums[ 2 ]
+                + 2.0 * radialFunctionSums[ 1 ] * radialDistanceValues[ 1 ].square( )
+                + 4.0 * radialFunctionSums[ 0 ] * radialDistanceValues[ 1 ] * radialDistanceValues[ 2 ];
+    }
+}
+
+Eigen::ArrayXd SphericalShapingLeg::computeScalarFunctionD( const std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                                            const std::vector< Eigen::ArrayXd >& elevationAngleValues )
+{
+    const Eigen::ArrayXd& radialFunctionValue = radialDistanceValues[ 0 ];
+    const Eigen::ArrayXd& firstDerivativeRadialFunction = radialDistanceValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeRadialFunction = radialDistanceValues[ 2 ];
+
+    const Eigen::ArrayXd& elevationFunctionValue = elevationAngleValues[ 0 ];
+    const Eigen::ArrayXd& firstDerivativeElevationFunction = elevationAngleValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeElevationFunction = elevationAngleValues[ 2 ];
+
+    Eigen::ArrayXd cosineElevation = elevationFunctionValue.cos( );
+    Eigen::ArrayXd squaredAngularRates = firstDerivativeElevationFunction.square( ) + cosineElevation.square( );
+
+    return - secondDerivativeRadialFunction + 2.0 * firstDerivativeRadialFunction.square( ) / radialFunctionValue
+            + firstDerivativeRadialFunction * firstDerivativeElevationFunction
+            * ( secondDerivativeElevationFunction - elevationFunctionValue.sin( ) * cosineElevation ) / squaredAngularRates
+            + radialFunctionValue * squaredAngularRates;
+}
+
+Eigen::ArrayXd SphericalShapingLeg::computeDerivativeScalarFunctionD( const std::vector< Eigen::ArrayXd >& radialDistanceValues,
+                                                                      const std::vector< Eigen::ArrayXd >& elevationAngleValues )
+{
+    const Eigen::ArrayXd& radialFunctionValue = radialDistanceValues[ 0 ];
+    const Eigen::ArrayXd& firstDerivativeRadialFunction = radialDistanceValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeRadialFunction = radialDistanceValues[ 2 ];
+    const Eigen::ArrayXd& thirdDerivativeRadialFunction = radialDistanceValues[ 3 ];
+
+    const Eigen::ArrayXd& elevationFunctionValue = elevationAngleValues[ 0 ];
+    const Eigen::ArrayXd& firstDerivativeElevationFunction = elevationAngleValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeElevationFunction = elevationAngleValues[ 2 ];
+    const Eigen::ArrayXd& thirdDerivativeElevationFunction = elevationAngleValues[ 3 ];
+
+    // Define constants F1, F2, F3 and F4 (as in the computation for a single azimuth angle).
+    Eigen::ArrayXd sineTwiceElevation = ( 2.0 * elevationFunctionValue ).sin( );
+    Eigen::ArrayXd cosineTwiceElevation = ( 2.0 * elevationFunctionValue ).cos( );
+    Eigen::ArrayXd F1 = firstDerivativeElevationFunction.square( ) + elevationFunctionValue.cos( ).square( );
+    Eigen::ArrayXd F2 = secondDerivativeElevationFunction - sineTwiceElevation / 2.0;
+    Eigen::ArrayXd F3 = cosineTwiceElevation + 2.0 * firstDerivativeElevationFunction.square( ) + 1.0;
+    Eigen::ArrayXd F4 = 2.0 * secondDerivativeElevationFunction - sineTwiceElevation;
+
+    return  F1 * firstDerivativeRadialFunction - thirdDerivativeRadialFunction
+            - 2.0 * firstDerivativeRadialFunction.cube( ) / radialFunctionValue.square( )
+            + 4.0 * firstDerivativeRadialFunction * secondDerivativeRadialFunction / radialFunctionValue
+            + F4 * firstDerivativeElevationFunction * radialFunctionValue
+            + 2.0 * firstDerivativeElevationFunction * firstDerivativeRadialFunction
+            * ( thirdDerivativeElevationFunction - firstDerivativeElevationFunction * cosineTwiceElevation ) / F3
+            + F2 * firstDerivativeElevationFunction * secondDerivativeRadialFunction / F1
+            + F2 * firstDerivativeRadialFunction * secondDerivativeElevationFunction / F1
+            - 4.0 * F4 * F2 * firstDerivativeElevationFunction.square( ) * firstDerivativeRadialFunction / F3.square( );
+}
+
+Eigen::ArrayXd SphericalShapingLeg::computeDerivativesOfTimeWrtAzimuthAngle(
+        const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+        const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues )
+{
+    std::vector< Eigen::ArrayXd > radialDistanceValues, elevationAngleValues;
+    computeShapingFunctionValues( radialBaseFunctionValues, elevationBaseFunctionValues, radialDistanceValues, elevationAngleValues );
+
+    Eigen::ArrayXd scalarFunctionTimeEquation = computeScalarFunctionD( radialDistanceValues, elevationAngleValues );
+
+    // Check that the trajectory is feasible, ie curved toward the central body.
+    if ( ( scalarFunctionTimeEquation < 0.0 ).any( ) )
+    {
+        throw std::runtime_error ( "Error, trajectory not curved toward the central body, and thus not feasible." );
+    }
+
+    return ( scalarFunctionTimeEquation * radialDistanceValues[ 0 ].square( ) / centralBodyGravitationalParameter_ ).sqrt( );
+}
+
+Eigen::ArrayXd SphericalShapingLeg::computeDerivativesOfDeltaVWrtAzimuthAngle(
+        const std::vector< Eigen::MatrixXd >& radialBaseFunctionValues,
+        const std::vector< Eigen::MatrixXd >& elevationBaseFunctionValues )
+{
+    std::vector< Eigen::ArrayXd > radialDistanceValues, elevationAngleValues;
+    computeShapingFunctionValues( radialBaseFunctionValues, elevationBaseFunctionValues, radialDistanceValues, elevationAngleValues );
+
+    const Eigen::ArrayXd& radialDistance = radialDistanceValues[ 0 ];
+    const Eigen::ArrayXd& firstDerivativeRadialDistance = radialDistanceValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeRadialDistance = radialDistanceValues[ 2 ];
+    const Eigen::ArrayXd& firstDerivativeElevationAngle = elevationAngleValues[ 1 ];
+    const Eigen::ArrayXd& secondDerivativeElevationAngle = elevationAngleValues[ 2 ];
+    Eigen::ArrayXd cosineElevation = elevationAngleValues[ 0 ].cos( );
+    Eigen::ArrayXd sineElevation = elevationAngleValues[ 0 ].sin( );
+
+    // Compute first and second derivatives of the azimuth angle w.r.t. time.
+    Eigen::ArrayXd scalarFunctionTimeEquation = computeScalarFunctionD( radialDistanceValues, elevationAngleValues );
+    Eigen::ArrayXd derivativeScalarFunctionTimeEquation = computeDerivativeScalarFunctionD( radialDistanceValues, elevationAngleValues );
+    Eigen::ArrayXd firstDerivativeAzimuthAngleWrtTime =
+            ( centralBodyGravitationalParameter_ / ( scalarFunctionTimeEquation * radialDistance.square( ) ) ).sqrt( );
+    Eigen::ArrayXd secondDerivativeAzimuthAngleWrtTime = - firstDerivativeAzimuthAngleWrtTime.square( )
+            * ( derivativeScalarFunctionTimeEquation / ( 2.0 * scalarFunctionTimeEquation ) + firstDerivativeRadialDistance / radialDistance );
+
+    // Compute thrust acceleration in spherical coordinates, from the velocity and acceleration parametrized by the azimuth
+    // angle (see computeNormalizedThrustAccelerationInSphericalCoordinates).
+    Eigen::ArrayXd squaredFirstDerivativeAzimuthAngleWrtTime = firstDerivativeAzimuthAngleWrtTime.square( );
+    Eigen::ArrayXd radialThrustAcceleration = squaredFirstDerivativeAzimuthAngleWrtTime
+            * ( secondDerivativeRadialDistance - radialDistance * ( firstDerivativeElevationAngle.square( ) + cosineElevation.square( ) ) )
+            + secondDerivativeAzimuthAngleWrtTime * firstDerivativeRadialDistance
+            + centralBodyGravitationalParameter_ / radialDistance.cube( ) * radialDistance;
+    Eigen::ArrayXd azimuthalThrustAcceleration = squaredFirstDerivativeAzimuthAngleWrtTime
+            * ( 2.0 * firstDerivativeRadialDistance * cosineElevation - 2.0 * radialDistance * firstDerivativeElevationAngle * sineElevation )
+            + secondDerivativeAzimuthAngleWrtTime * radialDistance * cosineElevation;
+    Eigen::ArrayXd elevationThrustAcceleration = squaredFirstDerivativeAzimuthAngleWrtTime
+            * ( 2.0 * firstDerivativeRadialDistance * firstDerivativeElevationAngle
+                + radialDistance * ( secondDerivativeElevationAngle + sineElevation * cosineElevation ) )
+            + secondDerivativeAzimuthAngleWrtTime * radialDistance * firstDerivativeElevationAngle;
+
+    // Multiply thrust acceleration magnitude by derivative of time w.r.t. azimuth angle.
+    return ( radialThrustAcceleration.square( ) + azimuthalThrustAcceleration.square( ) + elevationThrustAcceleration.square( ) ).sqrt( )
+            * ( scalarFunctionTimeEquation * radialDistance.square( ) / centralBodyGravitationalParameter_ ).sqrt( );
+}
+
+void SphericalShapingLeg::updateTabulatedBaseFunctionValues( )
+{
+    // The base functions do not depend on the leg parameters, so that the tabulated values only need to be recomputed
+    // when the initial or final azimuth angle changes.
+    if( !( initialAzimuthAngle_ == tabulatedInitialAzimuthAngle_ && finalAzimuthAngle_ == tabulatedFinalAzimuthAngle_ ) )
+    {
+        // Change of variable -> from range [-1, 1] to range [initial azimuth, final azimuth], as done by GaussianQuadrature
+        Eigen::VectorXd quadratureNodeAzimuthAngles =
+                ( 0.5 * ( ( finalAzimuthAngle_ - initialAzimuthAngle_ ) * quadratureNodes_
+                          + finalAzimuthAngle_ + initialAzimuthAngle_ ) ).matrix( );
+        computeBaseFunctionValues( quadratureNodeAzimuthAngles, tabulatedRadialBaseFunctionValues_,
+                                   tabulatedElevationBaseFunctionValues_ );
+
+        tabulatedInitialAzimuthAngle_ = initialAzimuthAngle_;
+        tabulatedFinalAzimuthAngle_ = finalAzimuthAngle_;
+    }
+}
+
+Eigen::VectorXd SphericalShapingLeg::convertAzimuthAnglesToNormalizedTimes( const Eigen::VectorXd& azimuthAngles )
+{
+    // Compute quadrature nodes for the integral of the time equation from the initial azimuth to each of the azimuth angles.
+    Eigen::VectorXd quadratureNodeAzimuthAngles( azimuthAngles.rows( ) * numberOfQuadratureNodes_ );
+    for( int i = 0; i < azimuthAngles.rows( ); i++ )
+    {
+        if ( azimuthAngles( i ) < initialAzimuthAngle_ || azimuthAngles( i ) > finalAzimuthAngle_ )
+        {
+            throw std::runtime_error( "Error when converting azimuth to time, requested azimuth is outside bounds" );
+        }
+        quadratureNodeAzimuthAngles.segment( i * numberOfQuadratureNodes_, numberOfQuadratureNodes_ ) =
+                ( 0.5 * ( ( azimuthAngles( i ) - initialAzimuthAngle_ ) * quadratureNodes_
+                          + azimuthAngles( i ) + initialAzimuthAngle_ ) ).matrix( );
+    }
+
+    // Evaluate derivative of the time w.r.t. azimuth angle at all quadrature nodes at once.
+    std::vector< Eigen::MatrixXd > radialBaseFunctionValues, elevationBaseFunctionValues;
+    computeBaseFunctionValues( quadratureNodeAzimuthAngles, radialBaseFunctionValues, elevationBaseFunctionValues, 2 );
+    Eigen::ArrayXd derivativesOfTimeWrtAzimuthAngle =
+            computeDerivativesOfTimeWrtAzimuthAngle( radialBaseFunctionValues, elevationBaseFunctionValues );
+
+    // Integrate time equation for each of the azimuth angles.
+    Eigen::VectorXd normalizedTimes( azimuthAngles.rows( ) );
+    for( int i = 0; i < azimuthAngles.rows( ); i++ )
+    {
+        normalizedTimes( i ) = 0.5 * ( azimuthAngles( i ) - initialAzimuthAngle_ ) * ( quadratureWeights_ *
+                derivativesOfTimeWrtAzimuthAngle.segment( i * numberOfQuadratureNodes_, numberOfQuadratureNodes_ ) ).sum( );
+        if( normalizedTimes( i ) != normalizedTimes( i ) )
+        {
+            throw std::runtime_error( "Error in spherical shaping, converting azimuth to time resulted in NaN value, this could be a result of poorly defined ephemerides or gravitational parameter." );
+        }
+    }
+
+    return normalizedTimes;
 }
 
 
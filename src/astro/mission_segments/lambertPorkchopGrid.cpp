@@ -0,0 +1,90 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+#include "tudat/astro/mission_segments/lambertPorkchopGrid.h"
+#include "tudat/astro/mission_segments/lambertRoutines.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Compute the departure and arrival delta V's of Lambert transfers on a grid of departure and arrival times.
+void computeLambertPorkchopGrid( const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+                                 const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+                                 const double centralBodyGravitationalParameter,
+                                 const std::vector< double >& departureTimes,
+                                 const std::vector< double >& arrivalTimes,
+                                 Eigen::MatrixXd& deltaVsAtDeparture,
+                                 Eigen::MatrixXd& deltaVsAtArrival,
+                                 const unsigned int numberOfThreads,
+                                 const bool isRetrograde )
+{
+    // Retrieve states of departure and arrival bodies (on calling thread, as ephemerides need not be thread-safe)
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureBodyStates( 6, departureTimes.size( ) );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        departureBodyStates.col( i ) = departureBodyEphemeris->getCartesianState( departureTimes.at( i ) );
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalBodyStates( 6, arrivalTimes.size( ) );
+    for( unsigned int i = 0; i < arrivalTimes.size( ); i++ )
+    {
+        arrivalBodyStates.col( i ) = arrivalBodyEphemeris->getCartesianState( arrivalTimes.at( i ) );
+    }
+
+    // Solve Lambert problems per departure time, starting each from the solution at the previous arrival time
+    deltaVsAtDeparture.setConstant( departureTimes.size( ), arrivalTimes.size( ), TUDAT_NAN );
+    deltaVsAtArrival.setConstant( departureTimes.size( ), arrivalTimes.size( ), TUDAT_NAN );
+    utilities::executeInParallel( departureTimes.size( ), [ & ]( const unsigned int i )
+    {
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+        double xParameter = TUDAT_NAN;
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            double timeOfFlight = arrivalTimes.at( j ) - departureTimes.at( i );
+            if( timeOfFlight > 0.0 )
+            {
+                if( solveLambertProblemIzzoWithInitialGuess(
+                            departureBodyStates.block< 3, 1 >( 0, i ), arrivalBodyStates.block< 3, 1 >( 0, j ),
+                            timeOfFlight, centralBodyGravitationalParameter,
+                            velocityAtDeparture, velocityAtArrival, xParameter, isRetrograde ) )
+                {
+                    deltaVsAtDeparture( i, j ) =
+                            ( velocityAtDeparture - departureBodyStates.block< 3, 1 >( 3, i ) ).norm( );
+                    deltaVsAtArrival( i, j ) =
+                            ( velocityAtArrival - arrivalBodyStates.block< 3, 1 >( 3, j ) ).norm( );
+                }
+            }
+        }
+    }, numberOfThreads );
+}
+
+//! Compute the total delta V of Lambert transfers on a grid of departure and arrival times.
+Eigen::MatrixXd computeLambertPorkchopGrid( const std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris,
+                                            const std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris,
+                                            const double centralBodyGravitationalParameter,
+                                            const std::vector< double >& departureTimes,
+                                            const std::vector< double >& arrivalTimes,
+                                            const unsigned int numberOfThreads,
+                                            const bool isRetrograde )
+{
+    Eigen::MatrixXd deltaVsAtDeparture, deltaVsAtArrival;
+    computeLambertPorkchopGrid( departureBodyEphemeris, arrivalBodyEphemeris, centralBodyGravitationalParameter,
+                                departureTimes, arrivalTimes, deltaVsAtDeparture, deltaVsAtArrival,
+                                numberOfThreads, isRetrograde );
+    return deltaVsAtDeparture + deltaVsAtArrival;
+}
+
+} // namespace mission_segments
+} // namespace tudat
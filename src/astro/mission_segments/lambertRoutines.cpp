@@ -16,6 +16,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -28,6 +29,7 @@ using namespace boost::placeholders;
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
@@ -41,16 +43,25 @@ namespace mission_segments
 
 using namespace root_finders;
 
-//! Solve Lambert Problem using Izzo's algorithm.
-void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
-                              const Eigen::Vector3d& cartesianPositionAtArrival,
-                              const double timeOfFlight,
-                              const double gravitationalParameter,
-                              Eigen::Vector3d& cartesianVelocityAtDeparture,
-                              Eigen::Vector3d& cartesianVelocityAtArrival,
-                              const bool isRetrograde,
-                              const double convergenceTolerance,
-                              const unsigned int maximumNumberOfIterations )
+//! Solve Lambert Problem using Izzo's algorithm, starting the root finder from two given values of the x-parameter.
+/*!
+ * Solve Lambert Problem using Izzo's algorithm, starting the root finder from two given values of the x-parameter
+ * (see solveLambertProblemIzzo for other input).
+ * \param firstInitialGuess First initial guess of the x-parameter (must be larger than -1).
+ * \param secondInitialGuess Second initial guess of the x-parameter (must be larger than -1).
+ * \return Converged x-parameter.
+ */
+double solveLambertProblemIzzoFromInitialGuesses( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                                  const Eigen::Vector3d& cartesianPositionAtArrival,
+                                                  const double timeOfFlight,
+                                                  const double gravitationalParameter,
+                                                  Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                                  Eigen::Vector3d& cartesianVelocityAtArrival,
+                                                  const bool isRetrograde,
+                                                  const double convergenceTolerance,
+                                                  const unsigned int maximumNumberOfIterations,
+                                                  const double firstInitialGuess,
+                                                  const double secondInitialGuess )
 {
     // Sanity check for specified time-of-flight.
     if ( timeOfFlight <= 0.0 )
@@ -117,13 +128,13 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
 
     // Secant Method.
     // Define initial guesses for abcissae (x) and ordinates (y).
-    double x1 = std::log( 0.5 ), x2 = std::log( 1.5 );
+    double x1 = std::log( 1.0 + firstInitialGuess ), x2 = std::log( 1.0 + secondInitialGuess );
 
-    double y1 = std::log( computeTimeOfFlightIzzo( -0.5, semiPerimeter, chord, isLongway,
+    double y1 = std::log( computeTimeOfFlightIzzo( firstInitialGuess, semiPerimeter, chord, isLongway,
                                                    semiMajorAxisOfTheMinimumEnergyEllipse ) )
             - logarithmOfTheSpecifiedTimeOfFlight;
 
-    double y2 = std::log( computeTimeOfFlightIzzo( 0.5, semiPerimeter, chord, isLongway,
+    double y2 = std::log( computeTimeOfFlightIzzo( secondInitialGuess, semiPerimeter, chord, isLongway,
                                                    semiMajorAxisOfTheMinimumEnergyEllipse ) )
             - logarithmOfTheSpecifiedTimeOfFlight;
 
@@ -295,6 +306,214 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
     cartesianVelocityAtDeparture *= velocityNormalizingValue;
     cartesianVelocityAtArrival *= velocityNormalizingValue;
 
+    return xParameter;
+}
+
+//! Solve Lambert Problem using Izzo's algorithm.
+void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                              const double timeOfFlight,
+                              const double gravitationalParameter,
+                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                              const bool isRetrograde,
+                              const double convergenceTolerance,
+                              const unsigned int maximumNumberOfIterations )
+{
+    solveLambertProblemIzzoFromInitialGuesses(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, gravitationalParameter,
+                cartesianVelocityAtDeparture, cartesianVelocityAtArrival, isRetrograde,
+                convergenceTolerance, maximumNumberOfIterations, -0.5, 0.5 );
+}
+
+//! Solve Lambert Problem using Izzo's algorithm, with an initial guess from a neighbouring solution.
+bool solveLambertProblemIzzoWithInitialGuess( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter,
+                                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                                              double& xParameter,
+                                              const bool isRetrograde,
+                                              const double convergenceTolerance,
+                                              const unsigned int maximumNumberOfIterations )
+{
+    if( timeOfFlight > 0.0 && std::isfinite( timeOfFlight ) )
+    {
+        // Start from neighbouring solution, perturbed by 1% (in the logarithm of x + 1) for the second secant point.
+        if( std::isfinite( xParameter ) && xParameter > -1.0 )
+        {
+            try
+            {
+                xParameter = solveLambertProblemIzzoFromInitialGuesses(
+                            cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight,
+                            gravitationalParameter, cartesianVelocityAtDeparture, cartesianVelocityAtArrival,
+                            isRetrograde, convergenceTolerance, maximumNumberOfIterations,
+                            xParameter, xParameter + 0.01 * ( 1.0 + xParameter ) );
+                if( std::isfinite( xParameter ) )
+                {
+                    return true;
+                }
+            }
+            catch( const std::runtime_error& )
+            { }
+        }
+
+        // Use default initial guesses if no (converged) solution is obtained from neighbouring solution.
+        try
+        {
+            xParameter = solveLambertProblemIzzoFromInitialGuesses(
+                        cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight,
+                        gravitationalParameter, cartesianVelocityAtDeparture, cartesianVelocityAtArrival,
+                        isRetrograde, convergenceTolerance, maximumNumberOfIterations, -0.5, 0.5 );
+            if( std::isfinite( xParameter ) )
+            {
+                return true;
+            }
+        }
+        catch( const std::runtime_error& )
+        { }
+    }
+
+    xParameter = TUDAT_NAN;
+    cartesianVelocityAtDeparture.setConstant( TUDAT_NAN );
+    cartesianVelocityAtArrival.setConstant( TUDAT_NAN );
+    return false;
+}
+
+//! Number of consecutive problems that are solved sequentially (with warm starts) by a single thread in a batch.
+static const unsigned int LAMBERT_BATCH_BLOCK_SIZE = 64;
+
+//! Function to solve a batch of Lambert problems with Izzo's algorithm, in blocks of consecutive problems.
+/*!
+ * Function to solve a batch of Lambert problems with Izzo's algorithm, in blocks of consecutive problems. The blocks
+ * are distributed over the threads, and the problems in a block are solved sequentially, each starting from the
+ * solution of the previous problem in the block (if useWarmStart is true). Since the blocks do not depend on the
+ * number of threads, the results do not either.
+ * \param numberOfProblems Number of Lambert problems.
+ * \param getProblem Function that sets the departure position, arrival position and time of flight of the problem with
+ * the given index (last three arguments, returned by reference).
+ * \param saveSolution Function that stores the departure and arrival velocity of the problem with the given index.
+ * \param gravitationalParameter Gravitational parameter of the central body.
+ * \param numberOfThreads Number of threads to use (0 for number of hardware threads).
+ * \param useWarmStart Boolean denoting whether problems are started from the solution of the previous problem.
+ * \param isRetrograde Boolean flag to indicate direction of motion.
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ */
+template< typename ProblemFunction, typename SolutionFunction >
+void solveLambertProblemBatchIzzo( const unsigned int numberOfProblems,
+                                   const ProblemFunction& getProblem,
+                                   const SolutionFunction& saveSolution,
+                                   const double gravitationalParameter,
+                                   const unsigned int numberOfThreads,
+                                   const bool useWarmStart,
+                                   const bool isRetrograde,
+                                   const double convergenceTolerance,
+                                   const unsigned int maximumNumberOfIterations )
+{
+    unsigned int numberOfBlocks = ( numberOfProblems + LAMBERT_BATCH_BLOCK_SIZE - 1 ) / LAMBERT_BATCH_BLOCK_SIZE;
+    utilities::executeInParallel( numberOfBlocks, [ & ]( const unsigned int blockIndex )
+    {
+        Eigen::Vector3d positionAtDeparture, positionAtArrival, velocityAtDeparture, velocityAtArrival;
+        double timeOfFlight;
+        double xParameter = TUDAT_NAN;
+
+        unsigned int lastProblemIndex = std::min( ( blockIndex + 1 ) * LAMBERT_BATCH_BLOCK_SIZE, numberOfProblems );
+        for( unsigned int i = blockIndex * LAMBERT_BATCH_BLOCK_SIZE; i < lastProblemIndex; i++ )
+        {
+            getProblem( i, positionAtDeparture, positionAtArrival, timeOfFlight );
+            if( !useWarmStart )
+            {
+                xParameter = TUDAT_NAN;
+            }
+            solveLambertProblemIzzoWithInitialGuess(
+                        positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                        velocityAtDeparture, velocityAtArrival, xParameter, isRetrograde,
+                        convergenceTolerance, maximumNumberOfIterations );
+            saveSolution( i, velocityAtDeparture, velocityAtArrival );
+        }
+    }, numberOfThreads );
+}
+
+//! Solve a batch of Lambert problems using Izzo's algorithm.
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const unsigned int numberOfThreads,
+                               const bool useWarmStart,
+                               const bool isRetrograde,
+                               const double convergenceTolerance,
+                               const unsigned int maximumNumberOfIterations )
+{
+    const unsigned int numberOfProblems = timesOfFlight.rows( );
+    if( cartesianPositionsAtDeparture.cols( ) != numberOfProblems ||
+            cartesianPositionsAtArrival.cols( ) != numberOfProblems )
+    {
+        throw std::runtime_error( "Error when solving Lambert problems, inconsistent number of departure positions (" +
+                                  std::to_string( cartesianPositionsAtDeparture.cols( ) ) + "), arrival positions (" +
+                                  std::to_string( cartesianPositionsAtArrival.cols( ) ) + ") and times of flight (" +
+                                  std::to_string( numberOfProblems ) + ")" );
+    }
+
+    cartesianVelocitiesAtDeparture.resize( 3, numberOfProblems );
+    cartesianVelocitiesAtArrival.resize( 3, numberOfProblems );
+    solveLambertProblemBatchIzzo(
+                numberOfProblems,
+                [ & ]( const unsigned int i, Eigen::Vector3d& positionAtDeparture, Eigen::Vector3d& positionAtArrival,
+                double& timeOfFlight )
+    {
+        positionAtDeparture = cartesianPositionsAtDeparture.col( i );
+        positionAtArrival = cartesianPositionsAtArrival.col( i );
+        timeOfFlight = timesOfFlight( i );
+    },
+    [ & ]( const unsigned int i, const Eigen::Vector3d& velocityAtDeparture, const Eigen::Vector3d& velocityAtArrival )
+    {
+        cartesianVelocitiesAtDeparture.col( i ) = velocityAtDeparture;
+        cartesianVelocitiesAtArrival.col( i ) = velocityAtArrival;
+    }, gravitationalParameter, numberOfThreads, useWarmStart, isRetrograde,
+    convergenceTolerance, maximumNumberOfIterations );
+}
+
+//! Compute the departure and arrival delta V's of a batch of Lambert transfers between given states.
+void computeLambertTransferDeltaVs( const Eigen::Matrix< double, 6, Eigen::Dynamic >& statesAtDeparture,
+                                    const Eigen::Matrix< double, 6, Eigen::Dynamic >& statesAtArrival,
+                                    const Eigen::VectorXd& timesOfFlight,
+                                    const double gravitationalParameter,
+                                    Eigen::VectorXd& deltaVsAtDeparture,
+                                    Eigen::VectorXd& deltaVsAtArrival,
+                                    const unsigned int numberOfThreads,
+                                    const bool useWarmStart,
+                                    const bool isRetrograde )
+{
+    const unsigned int numberOfProblems = timesOfFlight.rows( );
+    if( statesAtDeparture.cols( ) != numberOfProblems || statesAtArrival.cols( ) != numberOfProblems )
+    {
+        throw std::runtime_error( "Error when computing Lambert delta V's, inconsistent number of departure states (" +
+                                  std::to_string( statesAtDeparture.cols( ) ) + "), arrival states (" +
+                                  std::to_string( statesAtArrival.cols( ) ) + ") and times of flight (" +
+                                  std::to_string( numberOfProblems ) + ")" );
+    }
+
+    deltaVsAtDeparture.resize( numberOfProblems );
+    deltaVsAtArrival.resize( numberOfProblems );
+    solveLambertProblemBatchIzzo(
+                numberOfProblems,
+                [ & ]( const unsigned int i, Eigen::Vector3d& positionAtDeparture, Eigen::Vector3d& positionAtArrival,
+                double& timeOfFlight )
+    {
+        positionAtDeparture = statesAtDeparture.block< 3, 1 >( 0, i );
+        positionAtArrival = statesAtArrival.block< 3, 1 >( 0, i );
+        timeOfFlight = timesOfFlight( i );
+    },
+    [ & ]( const unsigned int i, const Eigen::Vector3d& velocityAtDeparture, const Eigen::Vector3d& velocityAtArrival )
+    {
+        deltaVsAtDeparture( i ) = ( velocityAtDeparture - statesAtDeparture.block< 3, 1 >( 3, i ) ).norm( );
+        deltaVsAtArrival( i ) = ( velocityAtArrival - statesAtArrival.block< 3, 1 >( 3, i ) ).norm( );
+    }, gravitationalParameter, numberOfThreads, useWarmStart, isRetrograde, 1.0E-9, 50 );
 }
 
 //! Compute time-of-flight using Lagrange's equation.
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "tudat/astro/mission_segments/transferTrajectory.h"
 #include "tudat/astro/low_thrust/shape_based/hodographicShapingLeg.h"
 
@@ -16,25 +18,22 @@ void TransferTrajectory::evaluateTrajectory(
     totalDeltaV_ = 0.0;
     totalTimeOfFlight_ = 0.0;
 
-    std::vector< bool > legEvaluated ( legs_.size( ), false );
-    std::vector< bool > nodeEvaluated ( nodes_.size( ), false );
-
-    Eigen::VectorXd legTotalParameters;
-    Eigen::VectorXd nodeTotalParameters;
+    std::fill( legEvaluated_.begin( ), legEvaluated_.end( ), false );
+    std::fill( nodeEvaluated_.begin( ), nodeEvaluated_.end( ), false );
 
     // Loop over nodes and legs until all are defined
     unsigned int iteration = 0;
-    while ( ( std::find(legEvaluated.begin(), legEvaluated.end(), false) != legEvaluated.end() ) ||
-            ( std::find(nodeEvaluated.begin(), nodeEvaluated.end(), false) != nodeEvaluated.end() ) )
+    while ( ( std::find(legEvaluated_.begin(), legEvaluated_.end(), false) != legEvaluated_.end() ) ||
+            ( std::find(nodeEvaluated_.begin(), nodeEvaluated_.end(), false) != nodeEvaluated_.end() ) )
     {
         ++iteration;
 
         // First node
-        if ( !nodeEvaluated.at( 0 ) && ( nodes_.at( 0 )->nodeComputesOutgoingVelocity( ) || legEvaluated.at( 0 ) ) )
+        if ( !nodeEvaluated_.at( 0 ) && ( nodes_.at( 0 )->nodeComputesOutgoingVelocity( ) || legEvaluated_.at( 0 ) ) )
         {
-            getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( 0 ), 0, nodeTotalParameters );
-            nodes_.at( 0 )->updateNodeParameters( nodeTotalParameters );
-            nodeEvaluated.at( 0 ) = true;
+            getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( 0 ), 0, nodeTotalParameters_.at( 0 ) );
+            nodes_.at( 0 )->updateNodeParameters( nodeTotalParameters_.at( 0 ) );
+            nodeEvaluated_.at( 0 ) = true;
             totalDeltaV_ += nodes_.at( 0 )->getNodeDeltaV( );
         }
 
@@ -42,12 +41,12 @@ void TransferTrajectory::evaluateTrajectory(
         for( unsigned int i = 0; i < legs_.size( ); i++ )
         {
             // Evaluate leg i
-            if ( !legEvaluated.at( i ) && (!nodes_.at( i )->nodeComputesOutgoingVelocity( ) || nodeEvaluated.at( i ) ) &&
-                 (!nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || nodeEvaluated.at( i+1 ) ) )
+            if ( !legEvaluated_.at( i ) && (!nodes_.at( i )->nodeComputesOutgoingVelocity( ) || nodeEvaluated_.at( i ) ) &&
+                 (!nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || nodeEvaluated_.at( i+1 ) ) )
             {
-                getLegTotalParameters( nodeTimes, legFreeParameters.at( i ), i, legTotalParameters );
-                legs_.at( i )->updateLegParameters( legTotalParameters );
-                legEvaluated.at( i ) = true;
+                getLegTotalParameters( nodeTimes, legFreeParameters.at( i ), i, legTotalParameters_.at( i ) );
+                legs_.at( i )->updateLegParameters( legTotalParameters_.at( i ) );
+                legEvaluated_.at( i ) = true;
                 totalDeltaV_ += legs_.at( i )->getLegDeltaV( );
                 totalTimeOfFlight_ += legs_.at( i )->getLegTimeOfFlight( );
             }
@@ -55,24 +54,24 @@ void TransferTrajectory::evaluateTrajectory(
             // Evaluate node i+1 (as long as it isn't the last node)
             if ( i < legs_.size( ) - 1 )
             {
-                if ( !nodeEvaluated.at( i+1 ) && (nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || legEvaluated.at(i) ) &&
-                     (nodes_.at( i+1 )->nodeComputesOutgoingVelocity( ) || legEvaluated.at(i+1) ) )
+                if ( !nodeEvaluated_.at( i+1 ) && (nodes_.at( i+1 )->nodeComputesIncomingVelocity( ) || legEvaluated_.at(i) ) &&
+                     (nodes_.at( i+1 )->nodeComputesOutgoingVelocity( ) || legEvaluated_.at(i+1) ) )
                 {
-                    getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( i+1 ), i+1, nodeTotalParameters );
-                    nodes_.at( i+1 )->updateNodeParameters( nodeTotalParameters );
-                    nodeEvaluated.at( i+1 ) = true;
+                    getNodeTotalParameters( nodeTimes, nodeFreeParameters.at( i+1 ), i+1, nodeTotalParameters_.at( i+1 ) );
+                    nodes_.at( i+1 )->updateNodeParameters( nodeTotalParameters_.at( i+1 ) );
+                    nodeEvaluated_.at( i+1 ) = true;
                     totalDeltaV_ += nodes_.at( i+1 )->getNodeDeltaV( );
                 }
             }
         }
 
         // Last node
-        if ( !nodeEvaluated.at( legs_.size( ) ) && ( nodes_.at( legs_.size( ) )->nodeComputesIncomingVelocity( ) ||
-                                                     legEvaluated.at( legs_.size( )-1 ) ) )
+        if ( !nodeEvaluated_.at( legs_.size( ) ) && ( nodes_.at( legs_.size( ) )->nodeComputesIncomingVelocity( ) ||
+                                                     legEvaluated_.at( legs_.size( )-1 ) ) )
         {
-            getNodeTotalParameters(nodeTimes, nodeFreeParameters.at( legs_.size( ) ), legs_.size( ), nodeTotalParameters );
-            nodes_.at( legs_.size( ) )->updateNodeParameters( nodeTotalParameters );
-            nodeEvaluated.at( legs_.size( ) ) = true;
+            getNodeTotalParameters(nodeTimes, nodeFreeParameters.at( legs_.size( ) ), legs_.size( ), nodeTotalParameters_.at( legs_.size( ) ) );
+            nodes_.at( legs_.size( ) )->updateNodeParameters( nodeTotalParameters_.at( legs_.size( ) ) );
+            nodeEvaluated_.at( legs_.size( ) ) = true;
             totalDeltaV_ += nodes_.at( legs_.size( ) )->getNodeDeltaV( );
         }
 
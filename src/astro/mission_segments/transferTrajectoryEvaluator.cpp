@@ -0,0 +1,191 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+
+#include "tudat/basics/parallelExecution.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+#include "tudat/astro/mission_segments/transferTrajectoryEvaluator.h"
+
+namespace tudat
+{
+
+namespace mission_segments
+{
+
+//! Constructor
+TransferTrajectoryEvaluator::TransferTrajectoryEvaluator(
+        const std::function< simulation_setup::SystemOfBodies( const unsigned int ) > bodiesCreationFunction,
+        const std::vector< std::shared_ptr< TransferLegSettings > >& legSettings,
+        const std::vector< std::shared_ptr< TransferNodeSettings > >& nodeSettings,
+        const std::vector< std::string >& nodeIds,
+        const std::string& centralBody,
+        const unsigned int numberOfWorkspaces )
+{
+    getParameterVectorDecompositionIndices(
+                legSettings, nodeSettings, legParameterIndices_, nodeParameterIndices_ );
+
+    // Determine total number of parameters
+    numberOfParameters_ = nodeSettings.size( );
+    for( unsigned int i = 0; i < legParameterIndices_.size( ); i++ )
+    {
+        numberOfParameters_ = std::max(
+                    numberOfParameters_, legParameterIndices_.at( i ).first + legParameterIndices_.at( i ).second );
+    }
+    for( unsigned int i = 0; i < nodeParameterIndices_.size( ); i++ )
+    {
+        numberOfParameters_ = std::max(
+                    numberOfParameters_, nodeParameterIndices_.at( i ).first + nodeParameterIndices_.at( i ).second );
+    }
+
+    // Create workspaces, with input vectors of the correct size
+    unsigned int numberOfWorkspacesToUse = utilities::getNumberOfThreadsToUse(
+                numberOfWorkspaces, std::numeric_limits< unsigned int >::max( ) );
+    for( unsigned int i = 0; i < numberOfWorkspacesToUse; i++ )
+    {
+        std::shared_ptr< TransferTrajectoryWorkspace > currentWorkspace =
+                std::make_shared< TransferTrajectoryWorkspace >( );
+        currentWorkspace->transferTrajectory_ = createTransferTrajectory(
+                    bodiesCreationFunction( i ), legSettings, nodeSettings, nodeIds, centralBody );
+        currentWorkspace->nodeTimes_.resize( nodeSettings.size( ) );
+        for( unsigned int j = 0; j < legParameterIndices_.size( ); j++ )
+        {
+            currentWorkspace->legFreeParameters_.push_back(
+                        Eigen::VectorXd::Zero( legParameterIndices_.at( j ).second ) );
+        }
+        for( unsigned int j = 0; j < nodeParameterIndices_.size( ); j++ )
+        {
+            currentWorkspace->nodeFreeParameters_.push_back(
+                        Eigen::VectorXd::Zero( nodeParameterIndices_.at( j ).second ) );
+        }
+
+        workspaces_.push_back( currentWorkspace );
+        availableWorkspaces_.push_back( i );
+    }
+}
+
+//! Function to compute the total Delta V of the trajectory for a given parameter vector, using any free workspace
+double TransferTrajectoryEvaluator::computeTotalDeltaV( const Eigen::VectorXd& trajectoryParameters )
+{
+    unsigned int workspaceIndex = acquireWorkspace( );
+    double totalDeltaV;
+    try
+    {
+        totalDeltaV = computeTotalDeltaV( trajectoryParameters, workspaceIndex );
+    }
+    catch( ... )
+    {
+        releaseWorkspace( workspaceIndex );
+        throw;
+    }
+    releaseWorkspace( workspaceIndex );
+    return totalDeltaV;
+}
+
+//! Function to compute the total Delta V of the trajectory for a given parameter vector, using a given workspace
+double TransferTrajectoryEvaluator::computeTotalDeltaV( const Eigen::VectorXd& trajectoryParameters,
+                                                        const unsigned int workspaceIndex )
+{
+    if( trajectoryParameters.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when evaluating transfer trajectory, expected " +
+                                  std::to_string( numberOfParameters_ ) + " parameters, but " +
+                                  std::to_string( trajectoryParameters.rows( ) ) + " are provided." );
+    }
+
+    // Copy parameters into preallocated input of workspace
+    TransferTrajectoryWorkspace& workspace = *workspaces_.at( workspaceIndex );
+    for( unsigned int i = 0; i < workspace.nodeTimes_.size( ); i++ )
+    {
+        workspace.nodeTimes_[ i ] = trajectoryParameters( i );
+    }
+    for( unsigned int i = 0; i < legParameterIndices_.size( ); i++ )
+    {
+        workspace.legFreeParameters_[ i ] = trajectoryParameters.segment(
+                    legParameterIndices_[ i ].first, legParameterIndices_[ i ].second );
+    }
+    for( unsigned int i = 0; i < nodeParameterIndices_.size( ); i++ )
+    {
+        workspace.nodeFreeParameters_[ i ] = trajectoryParameters.segment(
+                    nodeParameterIndices_[ i ].first, nodeParameterIndices_[ i ].second );
+    }
+
+    workspace.transferTrajectory_->evaluateTrajectory(
+                workspace.nodeTimes_, workspace.legFreeParameters_, workspace.nodeFreeParameters_ );
+    return workspace.transferTrajectory_->getTotalDeltaV( );
+}
+
+//! Function to compute the total Delta V of the trajectory for a batch of parameter vectors (e.g. a population)
+void TransferTrajectoryEvaluator::computeTotalDeltaVs( const Eigen::MatrixXd& trajectoryParameters,
+                                                       Eigen::VectorXd& totalDeltaVs )
+{
+    unsigned int numberOfTrajectories = trajectoryParameters.cols( );
+    totalDeltaVs.setConstant( numberOfTrajectories, TUDAT_NAN );
+
+    std::atomic< unsigned int > nextTrajectoryIndex( 0 );
+    std::atomic< bool > isEvaluationStopped( false );
+    utilities::executeInParallel(
+                workspaces_.size( ), [ & ]( const unsigned int )
+    {
+        unsigned int workspaceIndex = acquireWorkspace( );
+        unsigned int currentTrajectoryIndex;
+        try
+        {
+            while( ( !isEvaluationStopped ) &&
+                   ( ( currentTrajectoryIndex = nextTrajectoryIndex++ ) < numberOfTrajectories ) )
+            {
+                totalDeltaVs( currentTrajectoryIndex ) = computeTotalDeltaV(
+                            trajectoryParameters.col( currentTrajectoryIndex ), workspaceIndex );
+            }
+        }
+        catch( ... )
+        {
+            isEvaluationStopped = true;
+            releaseWorkspace( workspaceIndex );
+            throw;
+        }
+        releaseWorkspace( workspaceIndex );
+    }, workspaces_.size( ) );
+}
+
+//! Function to compute the total Delta V of the trajectory for a batch of parameter vectors (e.g. a population)
+Eigen::VectorXd TransferTrajectoryEvaluator::computeTotalDeltaVs( const Eigen::MatrixXd& trajectoryParameters )
+{
+    Eigen::VectorXd totalDeltaVs;
+    computeTotalDeltaVs( trajectoryParameters, totalDeltaVs );
+    return totalDeltaVs;
+}
+
+//! Function to retrieve the index of a workspace that is not in use, waiting for one if all are in use
+unsigned int TransferTrajectoryEvaluator::acquireWorkspace( )
+{
+    std::unique_lock< std::mutex > workspaceLock( workspaceMutex_ );
+    workspaceAvailableCondition_.wait( workspaceLock, [ & ]( ){ return !availableWorkspaces_.empty( ); } );
+    unsigned int workspaceIndex = availableWorkspaces_.back( );
+    availableWorkspaces_.pop_back( );
+    return workspaceIndex;
+}
+
+//! Function to mark a workspace as no longer in use
+void TransferTrajectoryEvaluator::releaseWorkspace( const unsigned int workspaceIndex )
+{
+    {
+        std::lock_guard< std::mutex > workspaceLock( workspaceMutex_ );
+        availableWorkspaces_.push_back( workspaceIndex );
+    }
+    workspaceAvailableCondition_.notify_one( );
+}
+
+} // namespace mission_segments
+
+} // namespace tudat
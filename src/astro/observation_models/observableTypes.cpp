@@ -547,11 +547,17 @@ std::vector< LinkEndType > getLinkEndTypesForGivenLinkEndId(
     return linkEndTypeList;
 }
 
+//! Function to check whether residuals of an observable type may contain (2 pi) discontinuities that are to be corrected
+bool isResidualDiscontinuityCheckRequired( const ObservableType observableType )
+{
+    return ( observableType == angular_position || observableType == euler_angle_313_observable );
+}
+
 void checkObservationResidualDiscontinuities(
         Eigen::Block< Eigen::VectorXd > observationResidualBlock,
         const ObservableType observableType )
 {
-    if( observableType == angular_position || observableType == euler_angle_313_observable )
+    if( isResidualDiscontinuityCheckRequired( observableType ) )
     {
         for( int i = 1; i < observationResidualBlock.rows( ); i++ )
         {
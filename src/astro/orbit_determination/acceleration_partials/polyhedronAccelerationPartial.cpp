@@ -29,6 +29,8 @@ PolyhedronGravityPartial::PolyhedronGravityPartial (
     polyhedronCache_( accelerationModel->getPolyhedronCache() ),
     facetDyads_( accelerationModel->getFacetDyadsFunction( )( ) ),
     edgeDyads_( accelerationModel->getEdgeDyadsFunction( )( ) ),
+    bodyFixedRelativePositionFunction_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
+                                                   getCurrentRelativePosition, accelerationModel ) ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::PolyhedronGravitationalAccelerationModel::
@@ -62,6 +64,9 @@ void PolyhedronGravityPartial::update( const double currentTime )
         bodyFixedSphericalPosition_ = convertCartesianToSpherical( bodyFixedPosition_ );
         bodyFixedSphericalPosition_( 1 ) = mathematical_constants::PI / 2.0 - bodyFixedSphericalPosition_( 1 );
 
+        // Update polyhedron cache, in case the acceleration model used its far-field expansion (no effect otherwise)
+        polyhedronCache_->update( bodyFixedRelativePositionFunction_( ) );
+
         // Calculate partial of acceleration wrt position of body undergoing acceleration.
         currentBodyFixedPartialWrtPosition_ = basic_mathematics::calculatePolyhedronHessianOfGravitationalPotential(
                 gravitationalParameterFunction_() / volumeFunction_(),
@@ -36,6 +36,7 @@ SphericalHarmonicsGravityPartial::SphericalHarmonicsGravityPartial(
     cosineCoefficients_( accelerationModel->getCosineHarmonicCoefficientsFunction( ) ),
     sineCoefficients_( accelerationModel->getSineHarmonicCoefficientsFunction( ) ),
     sphericalHarmonicCache_( accelerationModel->getSphericalHarmonicsCache( ) ),
+    pinesSphericalHarmonicsCache_( accelerationModel->getPinesSphericalHarmonicsCache( ) ),
     positionFunctionOfAcceleratedBody_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
                                                    getCurrentPositionOfBodySubjectToAcceleration, accelerationModel ) ),
     positionFunctionOfAcceleratingBody_( std::bind( &gravitation::SphericalHarmonicsGravitationalAccelerationModel::
@@ -333,15 +334,25 @@ void SphericalHarmonicsGravityPartial::update( const double currentTime )
         currentCosineCoefficients_ = cosineCoefficients_( );
         currentSineCoefficients_ = sineCoefficients_( );
 
-        // Update trogonometric functions of multiples of longitude.
-        sphericalHarmonicCache_->update(
-                    bodyFixedSphericalPosition_( 0 ), std::sin( bodyFixedSphericalPosition_( 1 ) ),
-                    bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
-
-        // Calculate partial of acceleration wrt position of body undergoing acceleration.
-        currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
-                    bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                    currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+        if( pinesSphericalHarmonicsCache_ != nullptr )
+        {
+            // Calculate partial of acceleration wrt position of body undergoing acceleration, using Pines formulation.
+            pinesSphericalHarmonicsCache_->update( bodyFixedPosition_, bodyReferenceRadius_( ) );
+            currentBodyFixedPartialWrtPosition_ = pinesSphericalHarmonicsCache_->computeAccelerationPartialWrtPosition(
+                        gravitationalParameterFunction_( ), currentCosineCoefficients_, currentSineCoefficients_ );
+        }
+        else
+        {
+            // Update trogonometric functions of multiples of longitude.
+            sphericalHarmonicCache_->update(
+                        bodyFixedSphericalPosition_( 0 ), std::sin( bodyFixedSphericalPosition_( 1 ) ),
+                        bodyFixedSphericalPosition_( 2 ), bodyReferenceRadius_( ) );
+
+            // Calculate partial of acceleration wrt position of body undergoing acceleration.
+            currentBodyFixedPartialWrtPosition_ = computePartialDerivativeOfBodyFixedSphericalHarmonicAcceleration(
+                        bodyFixedPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
+                        currentCosineCoefficients_, currentSineCoefficients_, sphericalHarmonicCache_ );
+        }
 
         currentPartialWrtVelocity_.setZero( );
         currentPartialWrtPosition_.setZero( );
@@ -407,6 +418,12 @@ void SphericalHarmonicsGravityPartial::wrtCosineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
+    if( pinesSphericalHarmonicsCache_ != nullptr )
+    {
+        wrtCoefficientBlockUsingPinesFormulation( blockIndices, true, partialDerivatives );
+        return;
+    }
+
     calculateSphericalHarmonicGravityWrtCCoefficients(
                 bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                 sphericalHarmonicCache_,
@@ -420,6 +437,12 @@ void SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock(
         const std::vector< std::pair< int, int > >& blockIndices,
         Eigen::MatrixXd& partialDerivatives )
 {
+    if( pinesSphericalHarmonicsCache_ != nullptr )
+    {
+        wrtCoefficientBlockUsingPinesFormulation( blockIndices, false, partialDerivatives );
+        return;
+    }
+
     calculateSphericalHarmonicGravityWrtSCoefficients(
                 bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
                 sphericalHarmonicCache_,
@@ -428,6 +451,35 @@ void SphericalHarmonicsGravityPartial::wrtSineCoefficientBlock(
                 maximumDegree_, maximumOrder_ );
 }
 
+//! Function to calculate the partial of the acceleration wrt a set of coefficients, using the Pines formulation.
+void SphericalHarmonicsGravityPartial::wrtCoefficientBlockUsingPinesFormulation(
+        const std::vector< std::pair< int, int > >& blockIndices,
+        const bool areCosineCoefficients,
+        Eigen::MatrixXd& partialDerivatives )
+{
+    const double gravitationalParameter = gravitationalParameterFunction_( );
+    const Eigen::Matrix3d bodyFixedToIntegrationFrame = fromBodyFixedToIntegrationFrameRotation_( );
+
+    int degree, order;
+    for( unsigned int i = 0; i < blockIndices.size( ); i++ )
+    {
+        degree = blockIndices.at( i ).first;
+        order = blockIndices.at( i ).second;
+
+        // Calculate and set partial of current degree and order.
+        if( degree <= maximumDegree_ && order <= maximumOrder_ )
+        {
+            partialDerivatives.block( 0, i, 3, 1 ) = bodyFixedToIntegrationFrame *
+                    pinesSphericalHarmonicsCache_->computeAccelerationPartialWrtCoefficient(
+                        gravitationalParameter, degree, order, areCosineCoefficients );
+        }
+        else
+        {
+            partialDerivatives.block( 0, i, 3, 1 ).setZero( );
+        }
+    }
+}
+
 //! Function to calculate an acceleration partial wrt a rotational parameter.
 void SphericalHarmonicsGravityPartial::wrtRotationModelParameter(
         Eigen::MatrixXd& accelerationPartial,
@@ -482,46 +534,26 @@ void SphericalHarmonicsGravityPartial::wrtTidalModelParameter(
         // Compute acceleration w.r.t. C and S coefficients, and multiply with partials of C,S coefficients w.r.t. parameter
         if( sumOrders )
         {
-            calculateSphericalHarmonicGravityWrtCCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtCosineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 0, 0, 1, singleOrderPartialSize );
 
 
             blockIndices[ 0 ] = std::make_pair( degree, orders.at( i ) );
-            calculateSphericalHarmonicGravityWrtSCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtSineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, 0, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 1, 0, 1, singleOrderPartialSize );
         }
         else
         {
-            calculateSphericalHarmonicGravityWrtCCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtCosineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 0, 0, 1, singleOrderPartialSize );
 
-            calculateSphericalHarmonicGravityWrtSCoefficients(
-                        bodyFixedSphericalPosition_, bodyReferenceRadius_( ), gravitationalParameterFunction_( ),
-                        sphericalHarmonicCache_,
-                        blockIndices, coordinate_conversions::getSphericalToCartesianGradientMatrix(
-                            bodyFixedPosition_ ), fromBodyFixedToIntegrationFrameRotation_( ), currentPartialContribution,
-                        maximumDegree_, maximumOrder_  );
+            wrtSineCoefficientBlock( blockIndices, currentPartialContribution );
 
             partialMatrix.block( 0, i * singleOrderPartialSize, 3, singleOrderPartialSize ) +=
                     currentPartialContribution * coefficientPartialsPerOrder_.at( i ).block( 1, 0, 1, singleOrderPartialSize );
@@ -0,0 +1,76 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/propagators/dependentVariableListEvaluator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to add a scalar dependent variable to the end of the list
+void DependentVariableListEvaluator::addScalarVariable( const std::function< double( ) >& variableFunction )
+{
+    scalarFunctions_.push_back( variableFunction );
+    vectorFunctions_.push_back( nullptr );
+    startIndices_.push_back( totalSize_ );
+    variableSizes_.push_back( 1 );
+    totalSize_ += 1;
+}
+
+//! Function to add a vector dependent variable to the end of the list
+void DependentVariableListEvaluator::addVectorVariable(
+        const std::function< void( Eigen::Ref< Eigen::VectorXd > ) >& variableFunction, const int variableSize )
+{
+    scalarFunctions_.push_back( nullptr );
+    vectorFunctions_.push_back( variableFunction );
+    startIndices_.push_back( totalSize_ );
+    variableSizes_.push_back( variableSize );
+    totalSize_ += variableSize;
+}
+
+//! Function to evaluate all dependent variables, and write them into the given vector
+void DependentVariableListEvaluator::evaluate( Eigen::Ref< Eigen::VectorXd > dependentVariables ) const
+{
+    if( dependentVariables.rows( ) != totalSize_ )
+    {
+        throw std::runtime_error( "Error when evaluating dependent variables, output size is inconsistent: " +
+                                  std::to_string( dependentVariables.rows( ) ) + " and " +
+                                  std::to_string( totalSize_ ) );
+    }
+
+    for( unsigned int i = 0; i < startIndices_.size( ); i++ )
+    {
+        if( scalarFunctions_[ i ] != nullptr )
+        {
+            dependentVariables( startIndices_[ i ] ) = scalarFunctions_[ i ]( );
+        }
+        else
+        {
+            vectorFunctions_[ i ]( dependentVariables.segment( startIndices_[ i ], variableSizes_[ i ] ) );
+        }
+    }
+}
+
+//! Function to evaluate all dependent variables, and return them as a single vector
+Eigen::VectorXd DependentVariableListEvaluator::evaluate( ) const
+{
+    Eigen::VectorXd dependentVariables = Eigen::VectorXd::Zero( totalSize_ );
+    evaluate( dependentVariables );
+    return dependentVariables;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -20,6 +20,12 @@ namespace tudat {
 namespace spice_interface {
 using Eigen::Vector6d;
 
+//! Retrieve the mutex that serialises all calls to the Spice toolkit.
+std::recursive_mutex &getSpiceMutex() {
+    static std::recursive_mutex spiceMutex;
+    return spiceMutex;
+}
+
 std::string getCorrectedTargetBodyName(
         const std::string &targetBodyName )
 {
@@ -55,6 +61,7 @@ double convertEphemerisTimeToJulianDate(const double ephemerisTime) {
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime(const std::string &dateString) {
     double ephemerisTime = 0.0;
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     str2et_c(dateString.c_str(), &ephemerisTime);
     return ephemerisTime;
 }
@@ -74,6 +81,7 @@ Vector6d getBodyCartesianStateAtEpoch(
     double stateAtEpoch[6];
     double lightTime;
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function to calculate state and light-time.
     spkezr_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
              aberrationCorrections.c_str(),
@@ -106,6 +114,7 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch(const std::string &targetBodyNam
     double positionAtEpoch[3];
     double lightTime;
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function to calculate position and light-time.
     spkpos_c(getCorrectedTargetBodyName( targetBodyName ).c_str(), ephemerisTime, referenceFrameName.c_str(),
              aberrationCorrections.c_str(),
@@ -149,6 +158,7 @@ Vector6d getCartesianStateFromTleAtEpoch(double epoch, std::shared_ptr<ephemerid
     elements[8] = tle->getMeanMotion();
     elements[9] = tle->getEpoch();// TLE ephemeris epoch in seconds since J2000
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function. Return value is always 0, so no need to save it.
     ev2lin_(&epoch, physicalConstants, elements, stateAtEpoch);
 
@@ -174,6 +184,7 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames(const std::string &ori
     // Declare rotation matrix.
     double rotationArray[3][3];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Calculate rotation matrix.
     pxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, rotationArray);
 
@@ -209,6 +220,7 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames(const std::string &
 
     double stateTransition[6][6];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Calculate state transition matrix.
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
@@ -235,6 +247,7 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame(const std::string
 
     double stateTransition[6][6];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Calculate state transition matrix.
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
@@ -256,6 +269,7 @@ std::pair<Eigen::Quaterniond, Eigen::Matrix3d> computeRotationQuaternionAndRotat
         throw std::invalid_argument( "Error when retrieving rotational state from Spice, input time is " + std::to_string(ephemerisTime) );
     }
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     sxform_c(originalFrame.c_str(), newFrame.c_str(), ephemerisTime, stateTransition);
 
     Eigen::Matrix3d matrixDerivative;
@@ -276,6 +290,7 @@ std::vector<double> getBodyProperties(const std::string &body, const std::string
     // Delcare variable in which raw result is to be put by Spice function.
     double propertyArray[maximumNumberOfValues];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function to retrieve property.
     SpiceInt numberOfReturnedParameters;
     bodvrd_c(body.c_str(), property.c_str(), maximumNumberOfValues, &numberOfReturnedParameters,
@@ -295,6 +310,7 @@ double getBodyGravitationalParameter(const std::string &body) {
     // Delcare variable in which raw result is to be put by Spice function.
     double gravitationalParameter[1];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
     bodvrd_c(body.c_str(), "GM", 1, &numberOfReturnedParameters, gravitationalParameter);
@@ -311,6 +327,7 @@ double getAverageRadius(const std::string &body) {
     // Delcare variable in which raw result is to be put by Spice function.
     double radii[3];
 
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Call Spice function to retrieve gravitational parameter.
     SpiceInt numberOfReturnedParameters;
     bodvrd_c(body.c_str(), "RADII", 3, &numberOfReturnedParameters, radii);
@@ -323,6 +340,7 @@ double getAverageRadius(const std::string &body) {
 
 //! Convert a body name to its NAIF identification number.
 int convertBodyNameToNaifId(const std::string &bodyName) {
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Convert body name to NAIF ID number.
     SpiceInt bodyNaifId;
     SpiceBoolean isIdFound;
@@ -334,6 +352,7 @@ int convertBodyNameToNaifId(const std::string &bodyName) {
 
 //! Check if a certain property of a body is in the kernel pool.
 bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::string &bodyProperty) {
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     // Convert body name to NAIF ID.
     const int naifId = convertBodyNameToNaifId(bodyName);
 
@@ -344,18 +363,23 @@ bool checkBodyPropertyInKernelPool(const std::string &bodyName, const std::strin
 
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat(const std::string &fileName) {
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     furnsh_c(fileName.c_str());
 }
 
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded() {
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
     SpiceInt count;
     ktotal_c("ALL", &count);
     return count;
 }
 
 //! Clear all Spice kernels.
-void clearSpiceKernels() { kclear_c(); }
+void clearSpiceKernels() {
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
+    kclear_c();
+}
 
 //! Get all standard Spice kernels used in tudat.
 std::vector<std::string> getStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels) {
@@ -377,6 +401,8 @@ std::vector<std::string> getStandardSpiceKernels(const std::vector<std::string>
 }
 
 void loadStandardSpiceKernels(const std::vector<std::string> alternativeEphemerisKernels) {
+    // Load all kernels in a single locked block, so that no other thread sees a partially loaded kernel pool.
+    std::lock_guard<std::recursive_mutex> spiceLock(getSpiceMutex());
 
     std::string kernelPath = paths::getSpiceKernelPath();
     loadSpiceKernelInTudat(kernelPath + "/pck00010.tpc");
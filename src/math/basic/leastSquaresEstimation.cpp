@@ -9,8 +9,11 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 #include <Eigen/LU>
 
@@ -57,6 +60,66 @@ Eigen::VectorXd solveSystemOfEquationsWithSvd( const Eigen::MatrixXd matrixToInv
     return svdDecomposition.solve( rightHandSideVector );
 }
 
+//! Solve symmetric positive definite system of equations with Cholesky decomposition, with SVD as fallback
+Eigen::VectorXd solveSymmetricSystemOfEquationsWithCholesky( const Eigen::MatrixXd& matrixToInvert,
+                                                             const Eigen::VectorXd& rightHandSideVector,
+                                                             const bool checkConditionNumber,
+                                                             const double maximumAllowedConditionNumber )
+{
+    Eigen::LLT< Eigen::MatrixXd, Eigen::Lower > choleskyDecomposition( matrixToInvert );
+    if( choleskyDecomposition.info( ) != Eigen::Success )
+    {
+        std::cerr << "Warning when performing least squares, matrix is not positive definite, using SVD instead of Cholesky decomposition" << std::endl;
+        return solveSystemOfEquationsWithSvd(
+                    matrixToInvert, rightHandSideVector, checkConditionNumber, maximumAllowedConditionNumber );
+    }
+
+    if( checkConditionNumber )
+    {
+        double conditionNumber = 1.0 / choleskyDecomposition.rcond( );
+        if( conditionNumber > maximumAllowedConditionNumber )
+        {
+            std::cerr << "Warning when performing least squares, condition number is estimated as " << conditionNumber << std::endl;
+        }
+    }
+    return choleskyDecomposition.solve( rightHandSideVector );
+}
+
+//! Function to add the weighted product of an information matrix with itself to a (symmetric) normal matrix
+void addWeightedRankUpdateToNormalMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        Eigen::MatrixXd& normalMatrix )
+{
+    // Number of rows of the information matrix processed at once, limiting the size of the scaled copy
+    const int maximumBlockSize = 256;
+
+    Eigen::MatrixXd scaledInformationMatrixBlock;
+    for( int blockStart = 0; blockStart < informationMatrix.rows( ); blockStart += maximumBlockSize )
+    {
+        int blockSize = std::min( maximumBlockSize, static_cast< int >( informationMatrix.rows( ) ) - blockStart );
+        Eigen::VectorXd::ConstSegmentReturnType weightsBlock = diagonalOfWeightMatrix.segment( blockStart, blockSize );
+
+        // Add sqrt(W)*H block as rank update (only possible for non-negative weights)
+        if( weightsBlock.minCoeff( ) >= 0.0 )
+        {
+            scaledInformationMatrixBlock.noalias( ) =
+                    weightsBlock.cwiseSqrt( ).asDiagonal( ) * informationMatrix.middleRows( blockStart, blockSize );
+            normalMatrix.selfadjointView< Eigen::Lower >( ).rankUpdate( scaledInformationMatrixBlock.transpose( ) );
+        }
+        else
+        {
+            scaledInformationMatrixBlock.noalias( ) =
+                    weightsBlock.asDiagonal( ) * informationMatrix.middleRows( blockStart, blockSize );
+            normalMatrix.triangularView< Eigen::Lower >( ) +=
+                    informationMatrix.middleRows( blockStart, blockSize ).transpose( ) * scaledInformationMatrixBlock;
+        }
+    }
+
+    // Set upper triangular part from lower triangular part
+    normalMatrix.triangularView< Eigen::StrictlyUpper >( ) = normalMatrix.transpose( );
+}
+
 //! Function to multiply information matrix by diagonal weights matrix
 Eigen::MatrixXd multiplyInformationMatrixByDiagonalWeightMatrix(
         const Eigen::MatrixXd& informationMatrix,
@@ -79,8 +142,16 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::VectorXd& diagonalOfWeightMatrix,
         const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix )
 {
-    return inverseOfAPrioriCovarianceMatrix + informationMatrix.transpose( ) * multiplyInformationMatrixByDiagonalWeightMatrix(
-                informationMatrix, diagonalOfWeightMatrix );
+    if( informationMatrix.rows( ) != diagonalOfWeightMatrix.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing inverse covariance, number of partials (" +
+                                  std::to_string( informationMatrix.rows( ) ) + ") and weights (" +
+                                  std::to_string( diagonalOfWeightMatrix.rows( ) ) + ") is inconsistent" );
+    }
+
+    Eigen::MatrixXd inverseOfUpdatedCovarianceMatrix = inverseOfAPrioriCovarianceMatrix;
+    addWeightedRankUpdateToNormalMatrix( informationMatrix, diagonalOfWeightMatrix, inverseOfUpdatedCovarianceMatrix );
+    return inverseOfUpdatedCovarianceMatrix;
 }
 
 //! Function to compute inverse of covariance matrix at current iteration
@@ -93,27 +164,44 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
                 Eigen::MatrixXd::Zero( informationMatrix.cols( ), informationMatrix.cols( ) ) );
 }
 
-//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
-//! information
-std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
-        const Eigen::MatrixXd& informationMatrix,
-        const Eigen::VectorXd& observationResiduals,
-        const Eigen::VectorXd& diagonalOfWeightMatrix,
-        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+//! Function to add the contribution of a block of observations to the normal equations
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide )
+{
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of partials (" +
+                                  std::to_string( informationMatrixBlock.rows( ) ) + "), residuals (" +
+                                  std::to_string( observationResidualsBlock.rows( ) ) + ") and weights (" +
+                                  std::to_string( diagonalOfWeightMatrixBlock.rows( ) ) + ") is inconsistent" );
+    }
+
+    if( ( normalMatrix.rows( ) != informationMatrixBlock.cols( ) ) || ( normalMatrix.cols( ) != informationMatrixBlock.cols( ) ) ||
+            ( normalRightHandSide.rows( ) != informationMatrixBlock.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, size of normal equations is inconsistent with partials" );
+    }
+
+    addWeightedRankUpdateToNormalMatrix( informationMatrixBlock, diagonalOfWeightMatrixBlock, normalMatrix );
+    normalRightHandSide.noalias( ) += informationMatrixBlock.transpose( ) *
+            ( diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to perform an iteration of least squares estimation from the normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
         const bool checkConditionNumber,
         const double maximumAllowedConditionNumber,
         const Eigen::MatrixXd& constraintMultiplier,
-        const Eigen::VectorXd& constraintRightHandside )
+        const Eigen::VectorXd& constraintRightHandside,
+        const NormalEquationsSolverType solverType )
 {
-//    std::cout<<"Residuals "<<observationResiduals.transpose( )<<std::endl;
-//    std::cout<<"Weight diag. "<<diagonalOfWeightMatrix.transpose( )<<std::endl;
-//    std::cout<<"Partials "<<informationMatrix.transpose( )<<std::endl;
-
-    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
-            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
-    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
-                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
-
     // Add constraints to inverse covariance matrix if required
     if( constraintMultiplier.rows( ) != 0 )
     {
@@ -122,7 +210,7 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != informationMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -130,26 +218,63 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         int numberOfConstraints = constraintMultiplier.rows( );
         int numberOfParameters = constraintMultiplier.cols( );
 
-        inverseOfCovarianceMatrix.conservativeResize(
+        Eigen::MatrixXd constrainedInverseOfCovarianceMatrix = inverseOfCovarianceMatrix;
+        constrainedInverseOfCovarianceMatrix.conservativeResize(
                     numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
-        inverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
+        constrainedInverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
                constraintMultiplier;
-        inverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
+        constrainedInverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
                constraintMultiplier.transpose( );
-        inverseOfCovarianceMatrix.block(
+        constrainedInverseOfCovarianceMatrix.block(
                     numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
 
-        rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
-        rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+        Eigen::VectorXd constrainedRightHandSide = normalRightHandSide;
+        constrainedRightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        constrainedRightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+
+        return std::make_pair( solveSystemOfEquationsWithSvd(
+                                   constrainedInverseOfCovarianceMatrix, constrainedRightHandSide,
+                                   checkConditionNumber, maximumAllowedConditionNumber ),
+                               constrainedInverseOfCovarianceMatrix );
     }
 
-//    std::cout<<"RHS "<<rightHandSide.transpose( )<<std::endl;
-//    std::cout<<"Inv cov "<<inverseOfCovarianceMatrix<<std::endl;
+    switch( solverType )
+    {
+    case svd_normal_equations_solver:
+        return std::make_pair( solveSystemOfEquationsWithSvd(
+                                   inverseOfCovarianceMatrix, normalRightHandSide, checkConditionNumber, maximumAllowedConditionNumber ),
+                               inverseOfCovarianceMatrix );
+    case cholesky_normal_equations_solver:
+        return std::make_pair( solveSymmetricSystemOfEquationsWithCholesky(
+                                   inverseOfCovarianceMatrix, normalRightHandSide, checkConditionNumber, maximumAllowedConditionNumber ),
+                               inverseOfCovarianceMatrix );
+    default:
+        throw std::runtime_error( "Error when performing least squares, normal equations solver type " +
+                                  std::to_string( solverType ) + " not recognized" );
+    }
+}
 
-    return std::make_pair( solveSystemOfEquationsWithSvd(
-                               inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber ),
-                           inverseOfCovarianceMatrix );
+//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
+//! information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside,
+        const NormalEquationsSolverType solverType )
+{
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
+            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
 
+    return performLeastSquaresAdjustmentFromNormalEquations(
+                inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber,
+                constraintMultiplier, constraintRightHandside, solverType );
 }
 
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
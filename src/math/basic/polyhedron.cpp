@@ -86,7 +86,18 @@ void calculatePolyhedronPerFacetFactor (
     const unsigned int numberOfFacets = verticesDefiningEachFacet.rows();
     perFacetFactor.resize(numberOfFacets);
 
-    for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
+    calculatePolyhedronPerFacetFactor(
+                perFacetFactor, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet, 0, numberOfFacets );
+}
+
+void calculatePolyhedronPerFacetFactor (
+        Eigen::VectorXd& perFacetFactor,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const unsigned int firstFacet,
+        const unsigned int numberOfFacetsToCompute )
+{
+    for ( unsigned int facet = firstFacet; facet < firstFacet + numberOfFacetsToCompute; ++facet )
     {
         // Rename position vectors of each facet's vertices relative to field point
         const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,0),0);
@@ -100,9 +111,12 @@ void calculatePolyhedronPerFacetFactor (
         }
         else
         {
+            const double normI = relPosI.norm();
+            const double normJ = relPosJ.norm();
+            const double normK = relPosK.norm();
             perFacetFactor(facet) = 2.0 * atan2( numerator,
-                ( relPosI.norm() * relPosJ.norm() * relPosK.norm() + relPosI.norm() * relPosJ.dot(relPosK) +
-                  relPosJ.norm() * relPosK.dot(relPosI) + relPosK.norm() * relPosI.dot(relPosJ) ) );
+                ( normI * normJ * normK + normI * relPosJ.dot(relPosK) +
+                  normJ * relPosK.dot(relPosI) + normK * relPosI.dot(relPosJ) ) );
         }
 
     }
@@ -117,7 +131,18 @@ void calculatePolyhedronPerEdgeFactor (
     const unsigned int numberOfEdges = verticesDefiningEachEdge.rows();
     perEdgeFactor.resize(numberOfEdges);
 
-    for ( unsigned int edge = 0; edge < numberOfEdges; ++edge )
+    calculatePolyhedronPerEdgeFactor(
+                perEdgeFactor, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachEdge, 0, numberOfEdges );
+}
+
+void calculatePolyhedronPerEdgeFactor (
+        Eigen::VectorXd& perEdgeFactor,
+        const Eigen::MatrixXd& verticesCoordinatesRelativeToFieldPoint,
+        const Eigen::MatrixXi& verticesDefiningEachEdge,
+        const unsigned int firstEdge,
+        const unsigned int numberOfEdgesToCompute )
+{
+    for ( unsigned int edge = firstEdge; edge < firstEdge + numberOfEdgesToCompute; ++edge )
     {
         // Rename position vectors of each edge's vertices relative to field point
         const Eigen::Vector3d relPosI = verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,0),0);
@@ -129,14 +154,16 @@ void calculatePolyhedronPerEdgeFactor (
         // Selection of the edgeFactor to be 0 is only valid when computing the potential and the derivative of the
         // potential, not when computing the 2nd derivative! See "The solid angle hidden in polyhedron gravitation
         // formulations", Werner (2017), appendix C1
-        const double denominator = relPosI.norm() + relPosJ.norm() - eIJ.norm();
+        const double normsSum = relPosI.norm() + relPosJ.norm();
+        const double edgeLength = eIJ.norm();
+        const double denominator = normsSum - edgeLength;
         if ( std::abs(denominator) <  1e-18 )
         {
             perEdgeFactor(edge) = 0;
         }
         else
         {
-            perEdgeFactor(edge) = log( (relPosI.norm() + relPosJ.norm() + eIJ.norm()) / denominator );
+            perEdgeFactor(edge) = log( (normsSum + edgeLength) / denominator );
         }
 
     }
@@ -162,7 +189,7 @@ double calculatePolyhedronGravitationalPotential(
         const Eigen::Vector3d toEdgeVector =
                 verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,0),0);
 
-        perEdgeSum += (toEdgeVector.transpose() * edgeDyads.at(edge) * toEdgeVector * perEdgeFactor(edge) )(0,0);
+        perEdgeSum += (toEdgeVector.transpose() * edgeDyads.at(edge).block<3,3>(0,0) * toEdgeVector * perEdgeFactor(edge) )(0,0);
     }
 
     // Loop over facets
@@ -171,7 +198,7 @@ double calculatePolyhedronGravitationalPotential(
         const Eigen::Vector3d toFacetVector =
                 verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,0),0);
 
-        perFacetSum += ( toFacetVector.transpose() * facetDyads.at(facet) * toFacetVector * perFacetFactor(facet) )(0,0);
+        perFacetSum += ( toFacetVector.transpose() * facetDyads.at(facet).block<3,3>(0,0) * toFacetVector * perFacetFactor(facet) )(0,0);
     }
 
     return 0.5 * gravitationalConstantTimesDensity * ( perEdgeSum - perFacetSum);
@@ -200,7 +227,7 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
              verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,0),0) +
              verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachEdge(edge,1),0) ) / 2;
 
-        perEdgeSum += edgeDyads.at(edge) * toEdgeVector * perEdgeFactor(edge);
+        perEdgeSum += edgeDyads.at(edge).block<3,3>(0,0) * toEdgeVector * perEdgeFactor(edge);
     }
 
     // Loop over facets
@@ -212,7 +239,7 @@ Eigen::Vector3d calculatePolyhedronGradientOfGravitationalPotential(
           verticesCoordinatesRelativeToFieldPoint.block<1,3>(verticesDefiningEachFacet(facet,2),0)
           ) / 3.0;
 
-        perFacetSum += facetDyads.at(facet) * toFacetVector * perFacetFactor(facet);
+        perFacetSum += facetDyads.at(facet).block<3,3>(0,0) * toFacetVector * perFacetFactor(facet);
     }
 
     return - gravitationalConstantTimesDensity * (perEdgeSum - perFacetSum);
@@ -240,13 +267,13 @@ Eigen::Matrix3d calculatePolyhedronHessianOfGravitationalPotential(
             // calculatePolyhedronPerEdgeFactor, and reference within). This is not valid when computing the hessian matrix!
             throw std::runtime_error( "Computation of hessian matrix has a singularity for points at edges." );
         }
-        perEdgeSum += edgeDyads.at(edge) * perEdgeFactor(edge);
+        perEdgeSum += edgeDyads.at(edge).block<3,3>(0,0) * perEdgeFactor(edge);
     }
 
     // Loop over facets
     for ( unsigned int facet = 0; facet < numberOfFacets; ++facet )
     {
-        perFacetSum += facetDyads.at(facet) * perFacetFactor(facet);
+        perFacetSum += facetDyads.at(facet).block<3,3>(0,0) * perFacetFactor(facet);
     }
 
     return gravitationalConstantTimesDensity * (perEdgeSum - perFacetSum);
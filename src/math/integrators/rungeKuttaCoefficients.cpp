@@ -18,6 +18,8 @@
  *
  */
 
+#include <map>
+
 #include <Eigen/Core>
 
 #include "tudat/math/integrators/rungeKuttaCoefficients.h"
@@ -2132,184 +2134,95 @@ void initializeRungeKuttaFeagin1412Coefficients(
     rungeKutta1412Coefficients.name = "Runge-Kutta-Feagin 14/12";
 }
 
-const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
-        CoefficientSets coefficientSet )
+//! Function to create all predefined coefficient sets.
+std::map< CoefficientSets, RungeKuttaCoefficients > createPredefinedCoefficientSets( )
 {
-    static RungeKuttaCoefficients forwardEulerCoefficients,
-                                  rungeKutta4Coefficients,
-                                  explicitMidPointCoefficients,
-                                  explicitTrapezoidRuleCoefficients,
-                                  ralstonCoefficients,
-                                  rungeKutta3Coefficients,
-                                  ralston3Coefficients,
-                                  SSPRK3Coefficients,
-                                  ralston4Coefficients,
-                                  threeEighthRuleRK4Coefficients,
-                                  heunEulerCoefficients,
-                                  rungeKuttaFehlberg12Coefficients,
-                                  rungeKuttaFehlberg45Coefficients,
-                                  rungeKuttaFehlberg56Coefficients,
-                                  rungeKuttaFehlberg78Coefficients,
-                                  rungeKutta87DormandPrinceCoefficients,
-                                  rungeKuttaFehlberg89Coefficients,
-                                  rungeKuttaVerner89Coefficients,
-                                  rungeKuttaFeagin108Coefficients,
-                                  rungeKuttaFeagin1210Coefficients,
-                                  rungeKuttaFeagin1412Coefficients;
-
-    switch ( coefficientSet )
+    std::map< CoefficientSets, RungeKuttaCoefficients > coefficientSets;
+
+    initializeForwardEulerCoefficients( coefficientSets[ forwardEuler ] );
+    initializeRungeKutta4Coefficients( coefficientSets[ rungeKutta4Classic ] );
+    initializeExplicitMidpointCoefficients( coefficientSets[ explicitMidPoint ] );
+    initializeExplicitTrapezoidRuleCoefficients( coefficientSets[ explicitTrapezoidRule ] );
+    initializeRalstonCoefficients( coefficientSets[ ralston ] );
+    initializeRungeKutta3Coefficients( coefficientSets[ rungeKutta3 ] );
+    initializeRalston3Coefficients( coefficientSets[ ralston3 ] );
+    initializeSSPRK3Coefficients( coefficientSets[ SSPRK3 ] );
+    initializeRalston4Coefficients( coefficientSets[ ralston4 ] );
+    initializeThreeEighthRuleRK4Coefficients( coefficientSets[ threeEighthRuleRK4 ] );
+    initializeHeunEulerCoefficients( coefficientSets[ heunEuler ] );
+    initializeRungeKuttaFehlberg12Coefficients( coefficientSets[ rungeKuttaFehlberg12 ] );
+    initializeRungeKuttaFehlberg45Coefficients( coefficientSets[ rungeKuttaFehlberg45 ] );
+    initializeRungeKuttaFehlberg56Coefficients( coefficientSets[ rungeKuttaFehlberg56 ] );
+    initializeRungeKuttaFehlberg78Coefficients( coefficientSets[ rungeKuttaFehlberg78 ] );
+    initializeRungeKutta87DormandPrinceCoefficients( coefficientSets[ rungeKutta87DormandPrince ] );
+    initializeRungeKuttaFehlberg89Coefficients( coefficientSets[ rungeKuttaFehlberg89 ] );
+    initializeRungeKuttaVerner89Coefficients( coefficientSets[ rungeKuttaVerner89 ] );
+    initializeRungeKuttaFeagin108Coefficients( coefficientSets[ rungeKuttaFeagin108 ] );
+    initializeRungeKuttaFeagin1210Coefficients( coefficientSets[ rungeKuttaFeagin1210 ] );
+    initializeRungeKuttaFeagin1412Coefficients( coefficientSets[ rungeKuttaFeagin1412 ] );
+
+    for( auto& coefficientSet : coefficientSets )
     {
-        
-    case forwardEuler:
-        if ( !(forwardEulerCoefficients.isFixedStepSize) )
-        {
-            initializeForwardEulerCoefficients( forwardEulerCoefficients );
-        }
-        return forwardEulerCoefficients;
-
-    case rungeKutta4Classic:
-        if ( !(rungeKutta4Coefficients.isFixedStepSize) )
-        {
-            initializeRungeKutta4Coefficients( rungeKutta4Coefficients );
-        }
-        return rungeKutta4Coefficients;
-
-    case explicitMidPoint:
-        if ( !(explicitMidPointCoefficients.isFixedStepSize) )
-        {
-            initializeExplicitMidpointCoefficients( explicitMidPointCoefficients );
-        }
-        return explicitMidPointCoefficients;
-
-    case explicitTrapezoidRule:
-        if ( !(explicitTrapezoidRuleCoefficients.isFixedStepSize) )
-        {
-            initializeExplicitTrapezoidRuleCoefficients( explicitTrapezoidRuleCoefficients );
-        }
-        return explicitTrapezoidRuleCoefficients;
-
-    case ralston:
-        if ( !(ralstonCoefficients.isFixedStepSize) )
-        {
-            initializeRalstonCoefficients( ralstonCoefficients );
-        }
-        return ralstonCoefficients;
-
-    case rungeKutta3:
-        if ( !(rungeKutta3Coefficients.isFixedStepSize) )
-        {
-            initializeRungeKutta3Coefficients( rungeKutta3Coefficients );
-        }
-        return rungeKutta3Coefficients;
-
-    case ralston3:
-        if ( !(ralston3Coefficients.isFixedStepSize) )
-        {
-            initializeRalston3Coefficients( ralston3Coefficients );
-        }
-        return ralston3Coefficients;
-
-    case SSPRK3:
-        if ( !(SSPRK3Coefficients.isFixedStepSize) )
-        {
-            initializeSSPRK3Coefficients( SSPRK3Coefficients );
-        }
-        return SSPRK3Coefficients;
-
-    case ralston4:
-        if ( !(ralston4Coefficients.isFixedStepSize) )
-        {
-            initializeRalston4Coefficients( ralston4Coefficients );
-        }
-        return ralston4Coefficients;
-
-    case threeEighthRuleRK4:
-        if ( !(threeEighthRuleRK4Coefficients.isFixedStepSize) )
-        {
-            initializeThreeEighthRuleRK4Coefficients( threeEighthRuleRK4Coefficients );
-        }
-        return threeEighthRuleRK4Coefficients;
-
-    case heunEuler:
-        if ( heunEulerCoefficients.higherOrder != 2 )
-        {
-            initializeHeunEulerCoefficients( heunEulerCoefficients );
-        }
-        return heunEulerCoefficients;
-
-    case rungeKuttaFehlberg12:
-        if ( rungeKuttaFehlberg12Coefficients.higherOrder != 2 )
-        {
-            initializeRungeKuttaFehlberg12Coefficients( rungeKuttaFehlberg12Coefficients );
-        }
-        return rungeKuttaFehlberg12Coefficients;
-
-    case rungeKuttaFehlberg45:
-        if ( rungeKuttaFehlberg45Coefficients.higherOrder != 5 )
-        {
-            initializeRungeKuttaFehlberg45Coefficients( rungeKuttaFehlberg45Coefficients );
-        }
-        return rungeKuttaFehlberg45Coefficients;
-
-    case rungeKuttaFehlberg56:
-        if ( rungeKuttaFehlberg56Coefficients.higherOrder != 6 )
-        {
-            initializeRungeKuttaFehlberg56Coefficients( rungeKuttaFehlberg56Coefficients );
-        }
-        return rungeKuttaFehlberg56Coefficients;
+        coefficientSet.second.computeDerivedProperties( );
+    }
 
-    case rungeKuttaFehlberg78:
-        if ( rungeKuttaFehlberg78Coefficients.higherOrder != 8 )
-        {
-            initializeRungeKuttaFehlberg78Coefficients( rungeKuttaFehlberg78Coefficients );
-        }
-        return rungeKuttaFehlberg78Coefficients;
+    return coefficientSets;
+}
 
-    case rungeKutta87DormandPrince:
-        if ( rungeKutta87DormandPrinceCoefficients.higherOrder != 7 )
-        {
-            initializeRungeKutta87DormandPrinceCoefficients(
-                        rungeKutta87DormandPrinceCoefficients );
-        }
-        return rungeKutta87DormandPrinceCoefficients;
+//! Get coefficients for a specified coefficient set.
+const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
+        CoefficientSets coefficientSet )
+{
+    // Create all coefficient sets once; initialization of a static local variable is thread-safe.
+    static const std::map< CoefficientSets, RungeKuttaCoefficients > predefinedCoefficientSets =
+            createPredefinedCoefficientSets( );
 
-    case rungeKuttaFehlberg89:
-        if ( rungeKuttaFehlberg89Coefficients.higherOrder != 9 )
-        {
-            initializeRungeKuttaFehlberg89Coefficients( rungeKuttaFehlberg89Coefficients );
-        }
-        return rungeKuttaFehlberg89Coefficients;
+    std::map< CoefficientSets, RungeKuttaCoefficients >::const_iterator coefficientSetIterator =
+            predefinedCoefficientSets.find( coefficientSet );
+    if( coefficientSetIterator == predefinedCoefficientSets.end( ) )
+    {
+        throw RungeKuttaCoefficients( );
+    }
+    return coefficientSetIterator->second;
+}
 
-    case rungeKuttaVerner89:
-        if ( rungeKuttaVerner89Coefficients.higherOrder != 9 )
-        {
-            initializeRungeKuttaVerner89Coefficients( rungeKuttaVerner89Coefficients );
-        }
-        return rungeKuttaVerner89Coefficients;
-    
-    case rungeKuttaFeagin108:
-        if ( rungeKuttaFeagin108Coefficients.higherOrder != 10 )
-        {
-            initializeRungeKuttaFeagin108Coefficients( rungeKuttaFeagin108Coefficients );
-        }
-        return rungeKuttaFeagin108Coefficients;
+//! Function to compute the properties derived from the Butcher tableau.
+void RungeKuttaCoefficients::computeDerivedProperties( )
+{
+    const int numberOfStages = cCoefficients.rows( );
 
-    case rungeKuttaFeagin1210:
-        if ( rungeKuttaFeagin1210Coefficients.higherOrder != 12 )
+    // Find non-zero a-coefficients of each stage.
+    nonZeroACoefficientIndices.clear( );
+    nonZeroACoefficientIndices.resize( numberOfStages );
+    for( int stage = 0; stage < numberOfStages && stage < aCoefficients.rows( ); stage++ )
+    {
+        for( int column = 0; column < stage && column < aCoefficients.cols( ); column++ )
         {
-            initializeRungeKuttaFeagin1210Coefficients( rungeKuttaFeagin1210Coefficients );
+            if( aCoefficients( stage, column ) != 0.0 )
+            {
+                nonZeroACoefficientIndices[ stage ].push_back( column );
+            }
         }
-        return rungeKuttaFeagin1210Coefficients;
+    }
 
-    case rungeKuttaFeagin1412:
-        if ( rungeKuttaFeagin1412Coefficients.higherOrder != 14 )
+    // Check if the last stage is evaluated at the integrated state: c_s = 1, a_sj = b_j and b_s = 0.
+    isFirstSameAsLast = false;
+    if( numberOfStages > 1 && aCoefficients.rows( ) >= numberOfStages && bCoefficients.rows( ) > 0 &&
+            bCoefficients.cols( ) >= numberOfStages )
+    {
+        const int integratedOrderRow = ( orderEstimateToIntegrate == higher && bCoefficients.rows( ) > 1 ) ? 1 : 0;
+        if( cCoefficients( numberOfStages - 1 ) == 1.0 &&
+                bCoefficients( integratedOrderRow, numberOfStages - 1 ) == 0.0 )
         {
-            initializeRungeKuttaFeagin1412Coefficients( rungeKuttaFeagin1412Coefficients );
+            isFirstSameAsLast = true;
+            for( int column = 0; column < numberOfStages - 1; column++ )
+            {
+                if( aCoefficients( numberOfStages - 1, column ) != bCoefficients( integratedOrderRow, column ) )
+                {
+                    isFirstSameAsLast = false;
+                }
+            }
         }
-        return rungeKuttaFeagin1412Coefficients;
-
-    default: // The default case will never occur because CoefficientsSet is an enum.
-        throw RungeKuttaCoefficients( );
     }
 }
 
@@ -168,6 +168,16 @@ void setAreBodiesInPropagation( const SystemOfBodies& bodies,
     }
 }
 
+//! Function to set whether the ephemeris states of the bodies may be requested by multiple threads concurrently
+void setAreEphemerisStatesRequestedConcurrently( const SystemOfBodies& bodies,
+                                                 const bool areEphemerisStatesRequestedConcurrently )
+{
+    for( auto bodyIterator : bodies.getMap( )  )
+    {
+        bodyIterator.second->setAreEphemerisStatesRequestedConcurrently( areEphemerisStatesRequestedConcurrently );
+    }
+}
+
 
 } // namespace simulation_setup
 
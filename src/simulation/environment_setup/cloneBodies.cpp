@@ -0,0 +1,384 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <functional>
+#include <typeinfo>
+
+#include <boost/core/demangle.hpp>
+
+#include "tudat/astro/aerodynamics/customAerodynamicCoefficientInterface.h"
+#if TUDAT_BUILD_WITH_NRLMSISE
+#include "tudat/astro/aerodynamics/nrlmsise00Atmosphere.h"
+#endif
+#include "tudat/astro/ephemerides/approximatePlanetPositions.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/customEphemeris.h"
+#include "tudat/astro/ephemerides/directionBasedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/ephemerides/multiArcEphemeris.h"
+#include "tudat/astro/ephemerides/synchronousRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tleEphemeris.h"
+#include "tudat/interface/spice/spiceEphemeris.h"
+#include "tudat/simulation/environment_setup/cloneBodies.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Function to create an independent copy of a gravity field model
+std::shared_ptr< gravitation::GravityFieldModel > cloneGravityFieldModel(
+        const std::shared_ptr< gravitation::GravityFieldModel > originalGravityField,
+        const std::shared_ptr< Body > clonedBody,
+        const std::string& bodyName )
+{
+    std::shared_ptr< gravitation::GravityFieldModel > clonedGravityField;
+    bool updateInertiaTensor = ( originalGravityField->getUpdateInertiaTensorFunction( ) != nullptr );
+
+    if( std::dynamic_pointer_cast< gravitation::TimeDependentSphericalHarmonicsGravityField >(
+                originalGravityField ) != nullptr )
+    {
+        throw std::runtime_error( "Error when cloning gravity field of body " + bodyName +
+                                  ", time-dependent spherical harmonic gravity field not supported" );
+    }
+    else if( std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( originalGravityField ) != nullptr )
+    {
+        std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sphericalHarmonicGravityField =
+                std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( originalGravityField );
+
+        std::function< void( ) > inertiaTensorUpdateFunction;
+        if( updateInertiaTensor )
+        {
+            inertiaTensorUpdateFunction =
+                    std::bind( &Body::setBodyInertiaTensorFromGravityFieldAndExistingMeanMoment, clonedBody, true );
+        }
+
+        // Share coefficients with original field; a field creates its own copy when its coefficients are reset
+        // (e.g. when they are estimated), so that the original and cloned fields remain independent.
+        clonedGravityField = std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                    sphericalHarmonicGravityField->getGravitationalParameter( ),
+                    sphericalHarmonicGravityField->getReferenceRadius( ),
+                    sphericalHarmonicGravityField->getSharedCosineCoefficients( ),
+                    sphericalHarmonicGravityField->getSharedSineCoefficients( ),
+                    sphericalHarmonicGravityField->getFixedReferenceFrame( ),
+                    inertiaTensorUpdateFunction );
+    }
+    else if( std::dynamic_pointer_cast< gravitation::PolyhedronGravityField >( originalGravityField ) != nullptr )
+    {
+        std::shared_ptr< gravitation::PolyhedronGravityField > polyhedronGravityField =
+                std::dynamic_pointer_cast< gravitation::PolyhedronGravityField >( originalGravityField );
+
+        std::function< void( ) > inertiaTensorUpdateFunction;
+        if( updateInertiaTensor )
+        {
+            inertiaTensorUpdateFunction =
+                    std::bind( &Body::setBodyInertiaTensorFromGravityFieldAndExistingDensity, clonedBody );
+        }
+
+        clonedGravityField = std::make_shared< gravitation::PolyhedronGravityField >(
+                    polyhedronGravityField->getGravitationalParameter( ),
+                    polyhedronGravityField->getVerticesCoordinates( ),
+                    polyhedronGravityField->getVerticesDefiningEachFacet( ),
+                    polyhedronGravityField->getFixedReferenceFrame( ),
+                    inertiaTensorUpdateFunction );
+    }
+    else if( typeid( *originalGravityField ) == typeid( gravitation::GravityFieldModel ) )
+    {
+        clonedGravityField = std::make_shared< gravitation::GravityFieldModel >(
+                    originalGravityField->getGravitationalParameter( ) );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when cloning gravity field of body " + bodyName + ", gravity field type " +
+                                  boost::core::demangle( typeid( *originalGravityField ).name( ) ) + " not supported" );
+    }
+
+    return clonedGravityField;
+}
+
+//! Function to create a copy of a tabulated ephemeris with given template arguments (nullptr if type does not match)
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< ephemerides::Ephemeris > cloneTabulatedEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > originalEphemeris )
+{
+    std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > > tabulatedEphemeris =
+            std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                originalEphemeris );
+    if( tabulatedEphemeris == nullptr )
+    {
+        return nullptr;
+    }
+    return std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                *tabulatedEphemeris );
+}
+
+//! Function to create a copy of an ephemeris model for use in a cloned body
+std::shared_ptr< ephemerides::Ephemeris > cloneEphemeris(
+        const std::shared_ptr< ephemerides::Ephemeris > originalEphemeris,
+        const std::string& bodyName )
+{
+    std::shared_ptr< ephemerides::Ephemeris > clonedEphemeris;
+    if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( originalEphemeris ) != nullptr )
+    {
+        std::shared_ptr< ephemerides::MultiArcEphemeris > multiArcEphemeris =
+                std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( originalEphemeris );
+
+        // Copy the constituent arc ephemerides, and the lookup scheme used to select them
+        std::vector< std::shared_ptr< ephemerides::Ephemeris > > singleArcEphemerides =
+                multiArcEphemeris->getSingleArcEphemerides( );
+        for( unsigned int i = 0; i < singleArcEphemerides.size( ); i++ )
+        {
+            singleArcEphemerides[ i ] = cloneEphemeris( singleArcEphemerides.at( i ), bodyName );
+        }
+        std::vector< double > arcStartTimes = multiArcEphemeris->getArcSplitTimes( );
+        arcStartTimes.pop_back( );
+
+        std::shared_ptr< ephemerides::MultiArcEphemeris > clonedMultiArcEphemeris =
+                std::make_shared< ephemerides::MultiArcEphemeris >( *multiArcEphemeris );
+        clonedMultiArcEphemeris->resetSingleArcEphemerides( singleArcEphemerides, arcStartTimes );
+        clonedEphemeris = clonedMultiArcEphemeris;
+    }
+    else if( ephemerides::isTabulatedEphemeris( originalEphemeris ) )
+    {
+        if( ( clonedEphemeris = cloneTabulatedEphemeris< double, double >( originalEphemeris ) ) == nullptr &&
+                ( clonedEphemeris = cloneTabulatedEphemeris< long double, double >( originalEphemeris ) ) == nullptr &&
+                ( clonedEphemeris = cloneTabulatedEphemeris< double, Time >( originalEphemeris ) ) == nullptr )
+        {
+            clonedEphemeris = cloneTabulatedEphemeris< long double, Time >( originalEphemeris );
+        }
+    }
+    // Ephemerides that store no state when evaluated are shared (Spice calls are serialised by the interface)
+    else if( ( std::dynamic_pointer_cast< ephemerides::ConstantEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::KeplerEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::ApproximateGtopEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::CustomEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::TleEphemeris >( originalEphemeris ) != nullptr ) ||
+             ( std::dynamic_pointer_cast< ephemerides::SpiceEphemeris >( originalEphemeris ) != nullptr ) )
+    {
+        clonedEphemeris = originalEphemeris;
+    }
+    else
+    {
+        throw std::runtime_error( "Error when cloning ephemeris of body " + bodyName + ", ephemeris type " +
+                                  boost::core::demangle( typeid( *originalEphemeris ).name( ) ) + " not supported" );
+    }
+    return clonedEphemeris;
+}
+
+//! Function to create a copy of a tabulated rotation model with given template arguments (nullptr if type does not match)
+template< typename StateScalarType, typename TimeType >
+std::shared_ptr< ephemerides::RotationalEphemeris > cloneTabulatedRotationalEphemeris(
+        const std::shared_ptr< ephemerides::RotationalEphemeris > originalRotationModel )
+{
+    std::shared_ptr< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > > tabulatedRotationModel =
+            std::dynamic_pointer_cast< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > >(
+                originalRotationModel );
+    if( tabulatedRotationModel == nullptr )
+    {
+        return nullptr;
+    }
+    return std::make_shared< ephemerides::TabulatedRotationalEphemeris< StateScalarType, TimeType > >(
+                *tabulatedRotationModel );
+}
+
+//! Function to create a copy of a rotation model for use in a cloned body
+std::shared_ptr< ephemerides::RotationalEphemeris > cloneRotationalEphemeris(
+        const std::shared_ptr< ephemerides::RotationalEphemeris > originalRotationModel,
+        const std::string& bodyName )
+{
+    std::shared_ptr< ephemerides::RotationalEphemeris > clonedRotationModel;
+    if( ( std::dynamic_pointer_cast< ephemerides::SynchronousRotationalEphemeris >( originalRotationModel ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::DirectionBasedRotationalEphemeris >( originalRotationModel ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< ephemerides::AerodynamicAngleRotationalEphemeris >( originalRotationModel ) != nullptr ) )
+    {
+        throw std::runtime_error( "Error when cloning rotation model of body " + bodyName +
+                                  ", rotation models depending on the state of the bodies are not supported" );
+    }
+    else if( ( clonedRotationModel = cloneTabulatedRotationalEphemeris< double, double >( originalRotationModel ) ) == nullptr &&
+             ( clonedRotationModel = cloneTabulatedRotationalEphemeris< long double, double >( originalRotationModel ) ) == nullptr &&
+             ( clonedRotationModel = cloneTabulatedRotationalEphemeris< double, Time >( originalRotationModel ) ) == nullptr &&
+             ( clonedRotationModel = cloneTabulatedRotationalEphemeris< long double, Time >( originalRotationModel ) ) == nullptr )
+    {
+        clonedRotationModel = originalRotationModel;
+    }
+    return clonedRotationModel;
+}
+
+//! Function to create a copy of an atmosphere model for use in a cloned body
+std::shared_ptr< aerodynamics::AtmosphereModel > cloneAtmosphereModel(
+        const std::shared_ptr< aerodynamics::AtmosphereModel > originalAtmosphereModel )
+{
+#if TUDAT_BUILD_WITH_NRLMSISE
+    if( std::dynamic_pointer_cast< aerodynamics::NRLMSISE00Atmosphere >( originalAtmosphereModel ) != nullptr )
+    {
+        return std::make_shared< aerodynamics::NRLMSISE00Atmosphere >(
+                    *std::dynamic_pointer_cast< aerodynamics::NRLMSISE00Atmosphere >( originalAtmosphereModel ) );
+    }
+#endif
+    return originalAtmosphereModel;
+}
+
+//! Function to create an independent copy of an aerodynamic coefficient interface
+std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > cloneAerodynamicCoefficientInterface(
+        const std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > originalCoefficientInterface,
+        const std::string& bodyName )
+{
+    std::shared_ptr< aerodynamics::CustomAerodynamicCoefficientInterface > customCoefficientInterface =
+            std::dynamic_pointer_cast< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                originalCoefficientInterface );
+    if( customCoefficientInterface == nullptr )
+    {
+        throw std::runtime_error( "Error when cloning aerodynamic coefficient interface of body " + bodyName +
+                                  ", only custom coefficient interfaces are supported" );
+    }
+    else if( customCoefficientInterface->getNumberOfControlSurfaces( ) > 0 )
+    {
+        throw std::runtime_error( "Error when cloning aerodynamic coefficient interface of body " + bodyName +
+                                  ", control surfaces are not supported" );
+    }
+    return std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >( *customCoefficientInterface );
+}
+
+//! Function to create an independent copy of a radiation pressure interface, coupled to the cloned bodies
+std::shared_ptr< electromagnetism::RadiationPressureInterface > cloneRadiationPressureInterface(
+        const std::shared_ptr< electromagnetism::RadiationPressureInterface > originalRadiationPressureInterface,
+        const std::string& sourceBodyName,
+        const std::string& bodyName,
+        const SystemOfBodies& clonedBodies )
+{
+    if( ( std::dynamic_pointer_cast< electromagnetism::PanelledRadiationPressureInterface >(
+              originalRadiationPressureInterface ) != nullptr ) ||
+            ( std::dynamic_pointer_cast< electromagnetism::SolarSailingRadiationPressureInterface >(
+                  originalRadiationPressureInterface ) != nullptr ) )
+    {
+        throw std::runtime_error( "Error when cloning radiation pressure interface of body " + bodyName +
+                                  ", only cannonball radiation pressure is supported" );
+    }
+
+    // Retrieve position functions of occulting bodies from cloned bodies
+    std::vector< std::string > occultingBodies = originalRadiationPressureInterface->getOccultingBodies( );
+    if( occultingBodies.size( ) != originalRadiationPressureInterface->getOccultingBodyRadii( ).size( ) )
+    {
+        throw std::runtime_error( "Error when cloning radiation pressure interface of body " + bodyName +
+                                  ", names of occulting bodies not defined" );
+    }
+    std::vector< std::function< Eigen::Vector3d( ) > > occultingBodyPositions;
+    for( unsigned int i = 0; i < occultingBodies.size( ); i++ )
+    {
+        occultingBodyPositions.push_back( std::bind( &Body::getPosition, clonedBodies.at( occultingBodies.at( i ) ) ) );
+    }
+
+    return std::make_shared< electromagnetism::RadiationPressureInterface >(
+                originalRadiationPressureInterface->getSourcePowerFunction( ),
+                std::bind( &Body::getPosition, clonedBodies.at( sourceBodyName ) ),
+                std::bind( &Body::getPosition, clonedBodies.at( bodyName ) ),
+                originalRadiationPressureInterface->getRadiationPressureCoefficientFunction( ),
+                originalRadiationPressureInterface->getArea( ),
+                occultingBodyPositions,
+                originalRadiationPressureInterface->getOccultingBodyRadii( ),
+                originalRadiationPressureInterface->getSourceRadius( ),
+                occultingBodies );
+}
+
+//! Function to create a deep copy of a system of bodies
+SystemOfBodies cloneSystemOfBodies( const SystemOfBodies& originalBodies )
+{
+    SystemOfBodies clonedBodies( originalBodies.getFrameOrigin( ), originalBodies.getFrameOrientation( ) );
+
+    // Create all bodies first, so that models can be coupled to any of the cloned bodies
+    for( auto bodyIterator : originalBodies.getMap( ) )
+    {
+        clonedBodies.createEmptyBody( bodyIterator.first, false );
+    }
+
+    for( auto bodyIterator : originalBodies.getMap( ) )
+    {
+        const std::string& bodyName = bodyIterator.first;
+        std::shared_ptr< Body > originalBody = bodyIterator.second;
+        std::shared_ptr< Body > clonedBody = clonedBodies.at( bodyName );
+
+        if( originalBody->getGravityFieldVariationSet( ) != nullptr )
+        {
+            throw std::runtime_error( "Error when cloning body " + bodyName + ", gravity field variations are not supported" );
+        }
+
+        if( originalBody->getVehicleSystems( ) != nullptr )
+        {
+            if( originalBody->getVehicleSystems( )->getEngineModels( ).size( ) > 0 )
+            {
+                throw std::runtime_error( "Error when cloning body " + bodyName + ", engine models are not supported" );
+            }
+            clonedBody->setVehicleSystems(
+                        std::make_shared< system_models::VehicleSystems >( *originalBody->getVehicleSystems( ) ) );
+        }
+
+        if( originalBody->getEphemeris( ) != nullptr )
+        {
+            clonedBody->setEphemeris( cloneEphemeris( originalBody->getEphemeris( ), bodyName ) );
+        }
+
+        if( originalBody->getRotationalEphemeris( ) != nullptr )
+        {
+            clonedBody->setRotationalEphemeris(
+                        cloneRotationalEphemeris( originalBody->getRotationalEphemeris( ), bodyName ) );
+        }
+
+        clonedBody->setShapeModel( originalBody->getShapeModel( ) );
+
+        if( originalBody->getAtmosphereModel( ) != nullptr )
+        {
+            clonedBody->setAtmosphereModel( cloneAtmosphereModel( originalBody->getAtmosphereModel( ) ) );
+        }
+
+        // Set gravity field before mass properties, as gravity field resets the mass of the body
+        if( originalBody->getGravityFieldModel( ) != nullptr )
+        {
+            clonedBody->setGravityFieldModel(
+                        cloneGravityFieldModel( originalBody->getGravityFieldModel( ), clonedBody, bodyName ) );
+        }
+        clonedBody->setMassPropertiesFromBody( originalBody );
+
+        if( originalBody->getAerodynamicCoefficientInterface( ) != nullptr )
+        {
+            clonedBody->setAerodynamicCoefficientInterface(
+                        cloneAerodynamicCoefficientInterface(
+                            originalBody->getAerodynamicCoefficientInterface( ), bodyName ) );
+        }
+
+        for( auto radiationPressureIterator : originalBody->getRadiationPressureInterfaces( ) )
+        {
+            clonedBody->setRadiationPressureInterface(
+                        radiationPressureIterator.first,
+                        cloneRadiationPressureInterface(
+                            radiationPressureIterator.second, radiationPressureIterator.first, bodyName,
+                            clonedBodies ) );
+        }
+
+        for( auto stationIterator : originalBody->getGroundStationMap( ) )
+        {
+            createGroundStation( clonedBody, stationIterator.first,
+                                 std::make_shared< ground_stations::GroundStationState >(
+                                     *stationIterator.second->getNominalStationState( ) ) );
+        }
+    }
+
+    clonedBodies.processBodyFrameDefinitions( );
+
+    return clonedBodies;
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
@@ -11,6 +11,7 @@
 #include <boost/lambda/lambda.hpp>
 
 #include "tudat/interface/spice/spiceEphemeris.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
 #include "tudat/astro/ephemerides/customEphemeris.h"
 #include "tudat/astro/ephemerides/keplerEphemeris.h"
 #include "tudat/astro/ephemerides/multiArcEphemeris.h"
@@ -128,6 +129,42 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_spice:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevSpiceEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevSpiceEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected Chebyshev spice ephemeris settings for body " + bodyName );
+            }
+            else
+            {
+                std::string inputName = ( chebyshevEphemerisSettings->getBodyNameOverride( ) == "" ) ?
+                            bodyName : chebyshevEphemerisSettings->getBodyNameOverride( );
+
+                // Create Spice ephemeris to which polynomials are fitted (only used during creation).
+                std::shared_ptr< SpiceEphemeris > spiceEphemeris = std::make_shared< SpiceEphemeris >(
+                            inputName,
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            false, false, false,
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+
+                // Create corresponding ephemeris object.
+                ephemeris = std::make_shared< ChebyshevEphemeris >(
+                            [ = ]( const double time ){ return spiceEphemeris->getCartesianState( time ); },
+                            chebyshevEphemerisSettings->getInitialTime( ),
+                            chebyshevEphemerisSettings->getFinalTime( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ),
+                            chebyshevEphemerisSettings->getVelocityTolerance( ),
+                            chebyshevEphemerisSettings->getPolynomialDegree( ),
+                            chebyshevEphemerisSettings->getMaximumSegmentDuration( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ) );
+            }
+            break;
+        }
         case tabulated_ephemeris:
         {
             // Check consistency of type and class.
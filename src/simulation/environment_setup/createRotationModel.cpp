@@ -515,7 +515,9 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ),
+                        gcrsToItrsRotationSettings->getAnglesInterpolationTimeStep( ),
+                        gcrsToItrsRotationSettings->getNumberOfAnglesInterpolationPoints( ) );
 
             break;
         }
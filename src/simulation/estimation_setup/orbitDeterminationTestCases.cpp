@@ -31,7 +31,10 @@ template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double, double
         const double startTime,
         const int numberOfDaysOfData,
         const int numberOfIterations,
-        const bool useFullParameterSet );
+        const bool useFullParameterSet,
+        const bool accumulateNormalEquations,
+        const std::string& partialsFileName,
+        const unsigned int numberOfThreads );
 
 template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation< double, double >(
         const bool estimateRangeBiases,
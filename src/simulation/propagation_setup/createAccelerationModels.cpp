@@ -99,7 +99,8 @@ std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > cre
                 bodyExertingAcceleration,
                 nameOfBodyUndergoingAcceleration,
                 nameOfBodyExertingAcceleration,
-                sumGravitationalParameters);
+                sumGravitationalParameters,
+                accelerationSettings );
         break;
     default:
 
@@ -417,6 +418,7 @@ createSphericalHarmonicsGravityAcceleration(
                     std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
                                  bodyExertingAcceleration ), useMutualAttraction );
+            accelerationModel->setGravityFormulation( sphericalHarmonicsSettings->formulation_ );
         }
     }
     return accelerationModel;
@@ -553,7 +555,8 @@ createPolyhedronGravityAcceleration(
         const std::shared_ptr< Body > bodyExertingAcceleration,
         const std::string& nameOfBodyUndergoingAcceleration,
         const std::string& nameOfBodyExertingAcceleration,
-        const bool useCentralBodyFixedFrame)
+        const bool useCentralBodyFixedFrame,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings )
 {
 
     // Declare pointer to return object
@@ -644,6 +647,19 @@ createPolyhedronGravityAcceleration(
                         std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
                         useCentralBodyFixedFrame );
 
+        // Set far-field expansion and number of threads, if provided
+        std::shared_ptr< PolyhedronAccelerationSettings > polyhedronAccelerationSettings =
+                std::dynamic_pointer_cast< PolyhedronAccelerationSettings >( accelerationSettings );
+        if( polyhedronAccelerationSettings != nullptr )
+        {
+            if( polyhedronAccelerationSettings->farFieldMaximumDegree_ >= 0 )
+            {
+                accelerationModel->setFarFieldSphericalHarmonicExpansion(
+                            polyhedronAccelerationSettings->farFieldMaximumDegree_,
+                            polyhedronAccelerationSettings->farFieldSwitchRadiusRatio_ );
+            }
+            accelerationModel->setNumberOfThreads( polyhedronAccelerationSettings->numberOfThreads_ );
+        }
     }
     return accelerationModel;
 }
@@ -18,10 +18,10 @@ namespace propagators
 {
 
 //! Get the vector representation of a rotation matrix.
-Eigen::VectorXd getVectorRepresentationForRotationMatrix(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationMatrix(
         const Eigen::Matrix3d& currentRotationMatrix )
 {
-    Eigen::VectorXd vectorRepresentation = Eigen::VectorXd( 9 );
+    Eigen::Matrix< double, 9, 1 > vectorRepresentation;
     for( unsigned int i = 0; i < 3; i++ )
     {
         for( unsigned int j = 0; j < 3; j++ )
@@ -33,14 +33,14 @@ Eigen::VectorXd getVectorRepresentationForRotationMatrix(
 }
 
 //! Get the vector representation of a rotation matrix.
-Eigen::VectorXd getVectorRepresentationForRotationMatrixFunction(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationMatrixFunction(
         const std::function< Eigen::Matrix3d( ) > rotationFunction )
 {
     return getVectorRepresentationForRotationMatrix( rotationFunction( ) );
 }
 
 //! Get the vector representation of a quaternion.
-Eigen::VectorXd getVectorRepresentationForRotationQuaternion(
+Eigen::Matrix< double, 9, 1 > getVectorRepresentationForRotationQuaternion(
         const std::function< Eigen::Quaterniond( ) > rotationFunction )
 {
     return getVectorRepresentationForRotationMatrix( rotationFunction( ).toRotationMatrix( ) );
@@ -127,41 +127,6 @@ double computeEquilibriumFayRiddellHeatFluxFromProperties(
                 vehicleSystems->getNoseRadius( ), vehicleSystems->getWallEmissivity( ) );
 }
 
-
-//! Function to return a vector containing only one value given by doubleFunction
-Eigen::VectorXd getVectorFromDoubleFunction( const std::function< double( ) >& doubleFunction )
-{
-    Eigen::VectorXd vector( 1 );
-    vector << doubleFunction( );
-    return vector;
-}
-
-//! Function to evaluate a set of vector-returning functions and concatenate the results.
-Eigen::VectorXd evaluateListOfVectorFunctions(
-        const std::vector< std::pair< std::function< Eigen::VectorXd( ) >, int > > vectorFunctionList,
-        const int totalSize )
-{
-    Eigen::VectorXd variableList = Eigen::VectorXd::Zero( totalSize );
-    int currentIndex = 0;
-
-    for( std::pair< std::function< Eigen::VectorXd( ) >, int > vectorFunction: vectorFunctionList )
-    {
-        variableList.segment( currentIndex, vectorFunction.second ) = vectorFunction.first( );
-        currentIndex += vectorFunction.second;
-    }
-
-    // Check consistency with input
-    if( currentIndex != totalSize )
-    {
-        std::string errorMessage = "Error when evaluating lists of functions, sizes are inconsistent: " +
-                std::to_string( currentIndex ) + " and " +
-                std::to_string( totalSize );
-        throw std::runtime_error( errorMessage );
-    }
-
-    return variableList;
-}
-
 Eigen::VectorXd getNormsOfAccelerationDifferencesFromLists(
                        const std::function< Eigen::VectorXd( ) > firstAccelerationFunction,
                        const std::function< Eigen::VectorXd( ) > secondAccelerationFunction )
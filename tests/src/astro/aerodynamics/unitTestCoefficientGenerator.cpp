@@ -17,6 +17,7 @@
 #define BOOST_TEST_MAIN
 
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <boost/test/tools/floating_point_comparison.hpp>
@@ -245,7 +246,9 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1, const std::string& coefficientCacheDirectory = "",
+        const double momentReferencePointX = -0.6624 )
 {
 
     // Create test capsule.
@@ -272,7 +275,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     invertOrders[ 3 ] = 0;
 
     Eigen::Vector3d momentReference;
-    momentReference( 0 ) = -0.6624;
+    momentReference( 0 ) = momentReferencePointX;
     momentReference( 1 ) = 0.0;
     momentReference( 2 ) = -0.1369;
 
@@ -303,7 +306,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, false, numberOfThreads, coefficientCacheDirectory );
 }
 
 //! Apollo capsule test case.
@@ -392,6 +395,75 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test generation of coefficients using multiple threads, and reading/writing of coefficients from/to cache files
+BOOST_AUTO_TEST_CASE( testParallelAndCachedCoefficientGeneration )
+{
+    // Create cache directory
+    boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "tudat_hlia_cache_%%%%%%%%" );
+
+    // Generate coefficients using single thread, multiple threads, and using (empty) cache directory
+    boost::multi_array< Vector6d, 3 > serialCoefficients =
+            getApolloCoefficientInterface( )->getAerodynamicCoefficientsTables( );
+    boost::multi_array< Vector6d, 3 > parallelCoefficients =
+            getApolloCoefficientInterface( 3 )->getAerodynamicCoefficientsTables( );
+    boost::multi_array< Vector6d, 3 > generatedCachedCoefficients =
+            getApolloCoefficientInterface( 0, cacheDirectory.string( ) )->getAerodynamicCoefficientsTables( );
+
+    // Check that cache file has been created
+    std::vector< boost::filesystem::path > cacheFiles;
+    for( boost::filesystem::directory_iterator fileIterator( cacheDirectory );
+         fileIterator != boost::filesystem::directory_iterator( ); fileIterator++ )
+    {
+        cacheFiles.push_back( fileIterator->path( ) );
+    }
+    BOOST_CHECK_EQUAL( cacheFiles.size( ), 1 );
+
+    // Read coefficients from cache file
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > cachedCoefficientInterface =
+            getApolloCoefficientInterface( 1, cacheDirectory.string( ) );
+    boost::multi_array< Vector6d, 3 > readCachedCoefficients =
+            cachedCoefficientInterface->getAerodynamicCoefficientsTables( );
+
+    // Check that all coefficients are identical
+    BOOST_CHECK_EQUAL( serialCoefficients.num_elements( ), 84 );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), parallelCoefficients.data( )[ i ]( j ) );
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), generatedCachedCoefficients.data( )[ i ]( j ) );
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), readCachedCoefficients.data( )[ i ]( j ) );
+        }
+    }
+
+    // Check interpolation of coefficients read from cache file
+    boost::array< int, 3 > independentVariables = { { 5, 6, 0 } };
+    std::vector< double > independentVariablesVector = {
+        cachedCoefficientInterface->getIndependentVariablePoint( 0, 5 ),
+        cachedCoefficientInterface->getIndependentVariablePoint( 1, 6 ),
+        cachedCoefficientInterface->getIndependentVariablePoint( 2, 0 ) };
+    cachedCoefficientInterface->updateCurrentCoefficients( independentVariablesVector );
+    for( unsigned int j = 0; j < 6; j++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( cachedCoefficientInterface->getCurrentAerodynamicCoefficients( )( j ),
+                                    serialCoefficients( independentVariables )( j ),
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that modified settings lead to new cache file
+    getApolloCoefficientInterface( 1, cacheDirectory.string( ), -0.5 );
+    unsigned int numberOfCacheFiles = 0;
+    for( boost::filesystem::directory_iterator fileIterator( cacheDirectory );
+         fileIterator != boost::filesystem::directory_iterator( ); fileIterator++ )
+    {
+        numberOfCacheFiles++;
+    }
+    BOOST_CHECK_EQUAL( numberOfCacheFiles, 2 );
+
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
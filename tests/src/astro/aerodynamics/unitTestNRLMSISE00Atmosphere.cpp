@@ -1137,6 +1137,192 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_FullFileLoad )
 
 }
 
+//! Function to create synthetic solar activity data, with a number of days without data
+tudat::input_output::solar_activity::SolarActivityDataMap getTestSolarActivityData( )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    SolarActivityDataMap solarActivityData;
+    for( int day = 1; day <= 40; day++ )
+    {
+        if( day == 10 || day == 11 || day == 25 )
+        {
+            continue;
+        }
+        SolarActivityDataPtr currentSolarActivity = std::make_shared< SolarActivityData >( );
+        currentSolarActivity->year = ( day <= 31 ) ? 2019 : 2020;
+        currentSolarActivity->month = ( day <= 31 ) ? 12 : 1;
+        currentSolarActivity->day = ( day <= 31 ) ? day : day - 31;
+        currentSolarActivity->fluxQualifier = day % 2;
+        currentSolarActivity->solarRadioFlux107Adjusted = 120.0 + day;
+        currentSolarActivity->centered81DaySolarRadioFlux107Adjusted = 130.0 + 0.5 * day;
+        currentSolarActivity->solarRadioFlux107Observed = 125.0 + day;
+        currentSolarActivity->centered81DaySolarRadioFlux107Observed = 135.0 + 0.5 * day;
+        currentSolarActivity->planetaryEquivalentAmplitudeAverage = 4.0 + day % 5;
+        for( unsigned int i = 0; i < 8; i++ )
+        {
+            currentSolarActivity->planetaryEquivalentAmplitudeVector( i ) = 3.0 + i + day % 3;
+        }
+
+        solarActivityData[ tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                    currentSolarActivity->year, currentSolarActivity->month, currentSolarActivity->day,
+                    0, 0, 0.0 ) ] = currentSolarActivity;
+    }
+    return solarActivityData;
+}
+
+//! Test whether solar activity table provides the same model input as the solar activity data map.
+BOOST_AUTO_TEST_CASE( test_nrlmise_SolarActivityTable )
+{
+    using namespace tudat::aerodynamics;
+
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData = getTestSolarActivityData( );
+    NRLMSISE00SolarActivityTable solarActivityTable( solarActivityData );
+    BOOST_CHECK_EQUAL( solarActivityTable.getNumberOfDays( ), 40 );
+
+    // Compare input at various times (including days without data, and times before first day with data)
+    double firstTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                solarActivityData.begin( )->first, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    for( int i = -5; i < 40 * 24; i++ )
+    {
+        double time = firstTime + 3600.0 * static_cast< double >( i ) + 120.0;
+        double longitude = 0.1 * static_cast< double >( i % 60 ) - 3.0;
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            NRLMSISE00Input mapInput = nrlmsiseInputFunction(
+                        400.0E3, longitude, 0.2, time, solarActivityData, j == 1, 16.0 );
+            NRLMSISE00Input tableInput = solarActivityTable.getNRLMSISE00Input(
+                        400.0E3, longitude, 0.2, time, j == 1, 16.0 );
+
+            BOOST_CHECK_EQUAL( mapInput.year, tableInput.year );
+            BOOST_CHECK_EQUAL( mapInput.dayOfTheYear, tableInput.dayOfTheYear );
+            BOOST_CHECK_EQUAL( mapInput.secondOfTheDay, tableInput.secondOfTheDay );
+            BOOST_CHECK_EQUAL( mapInput.localSolarTime, tableInput.localSolarTime );
+            BOOST_CHECK_EQUAL( mapInput.f107, tableInput.f107 );
+            BOOST_CHECK_EQUAL( mapInput.f107a, tableInput.f107a );
+            BOOST_CHECK_EQUAL( mapInput.apDaily, tableInput.apDaily );
+            BOOST_CHECK( mapInput.apVector == tableInput.apVector );
+            BOOST_CHECK( mapInput.switches == tableInput.switches );
+        }
+    }
+
+    // Check that times after last day with data are rejected
+    BOOST_CHECK_THROW( solarActivityTable.getNRLMSISE00Input( 400.0E3, 0.0, 0.0, firstTime + 41.0 * 86400.0 ),
+                       std::runtime_error );
+}
+
+//! Counter for the number of calls to the input function of the model.
+unsigned int numberOfInputFunctionCalls = 0;
+
+//! Test whether properties of recently computed states are reused, and recomputed after resetting the model.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereStoredStates )
+{
+    numberOfInputFunctionCalls = 0;
+    data = gen_data;
+    NRLMSISE00Atmosphere model( [ ]( double altitude, double longitude, double latitude, double time )
+    {
+        numberOfInputFunctionCalls++;
+        return nrlmsiseTestFunction( altitude, longitude, latitude, time, false, false );
+    } );
+
+    // Compute properties at a number of states
+    std::vector< double > densities;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        densities.push_back( model.getDensity( 300.0E3 + 50.0E3 * i, 0.1, 0.2, 0.0 ) );
+    }
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 4 );
+
+    // Retrieve properties of previous states, and check that they are not recomputed
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        std::pair< std::vector< double >, std::vector< double > > output =
+                model.getFullOutput( 300.0E3 + 50.0E3 * i, 0.1, 0.2, 0.0 );
+        BOOST_CHECK_EQUAL( model.getDensity( 300.0E3 + 50.0E3 * i, 0.1, 0.2, 0.0 ), densities.at( i ) );
+        BOOST_CHECK_EQUAL( output.first[ 5 ] * 1000.0, densities.at( i ) );
+        BOOST_CHECK_EQUAL( model.getNRLMSISE00Input( ).f107, gen_data.f107 );
+    }
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 4 );
+
+    // Check that only the most recent states are stored
+    model.setNumberOfStoredStates( 2 );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( model.getDensity( 300.0E3 + 50.0E3 * i, 0.1, 0.2, 0.0 ), densities.at( i ) );
+    }
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 8 );
+    model.getDensity( 300.0E3 + 50.0E3 * 2, 0.1, 0.2, 0.0 );
+    model.getDensity( 300.0E3 + 50.0E3 * 3, 0.1, 0.2, 0.0 );
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 8 );
+    model.getDensity( 300.0E3, 0.1, 0.2, 0.0 );
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 9 );
+
+    // Check that states are recomputed after model is reset
+    data.f107 = 180.0;
+    model.resetHashKey( );
+    BOOST_CHECK_PREDICATE( std::not_equal_to< double >( ),
+                           ( model.getDensity( 300.0E3, 0.1, 0.2, 0.0 ) )( densities.at( 0 ) ) );
+    BOOST_CHECK_EQUAL( numberOfInputFunctionCalls, 10 );
+
+    BOOST_CHECK_THROW( model.setNumberOfStoredStates( 0 ), std::runtime_error );
+}
+
+//! Test accuracy of the tabulated approximation of the model
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereTabulation )
+{
+    using namespace tudat::aerodynamics;
+
+    // Create model input from solar activity data, with universal time and longitude effects switched off
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData = getTestSolarActivityData( );
+    std::shared_ptr< NRLMSISE00SolarActivityTable > solarActivityTable =
+            std::make_shared< NRLMSISE00SolarActivityTable >( solarActivityData );
+    NRLMSISE00Atmosphere::NRLMSISE00InputFunction inputFunction =
+            [ = ]( double altitude, double longitude, double latitude, double time )
+    {
+        NRLMSISE00Input input = solarActivityTable->getNRLMSISE00Input( altitude, longitude, latitude, time );
+        input.switches[ 10 ] = 0;
+        return input;
+    };
+    NRLMSISE00Atmosphere fullModel( inputFunction );
+    NRLMSISE00Atmosphere tabulatedModel( inputFunction );
+
+    double maximumRelativeDensityError = 1.0E-2;
+    tabulatedModel.setTabulationSettings( std::make_shared< NRLMSISE00TabulationSettings >(
+                                              200.0E3, 600.0E3, 5.0E3, 1.0, 5.0 * PI / 180.0,
+                                              maximumRelativeDensityError ) );
+    BOOST_CHECK( tabulatedModel.getTabulationSettings( ) != nullptr );
+
+    // Compare models at a range of states on two days (at single time of day)
+    double firstTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                solarActivityData.begin( )->first, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 ) + 20000.0;
+    for( unsigned int day = 0; day < 2; day++ )
+    {
+        double time = firstTime + 86400.0 * static_cast< double >( day );
+        for( unsigned int i = 0; i < 500; i++ )
+        {
+            double altitude = 180.0E3 + 451.0 * static_cast< double >( i * 7 % 1000 );
+            double longitude = -PI + 0.0631 * static_cast< double >( i );
+            double latitude = -1.5 + 0.0173 * static_cast< double >( i % 173 );
+
+            double fullDensity = fullModel.getDensity( altitude, longitude, latitude, time );
+            double tabulatedDensity = tabulatedModel.getDensity( altitude, longitude, latitude, time );
+            if( altitude < 200.0E3 || altitude > 600.0E3 )
+            {
+                BOOST_CHECK_EQUAL( fullDensity, tabulatedDensity );
+            }
+            else
+            {
+                BOOST_CHECK_CLOSE_FRACTION( fullDensity, tabulatedDensity, 2.0 * maximumRelativeDensityError );
+            }
+        }
+    }
+
+    // Remove tabulation, and check that full model is used
+    tabulatedModel.setTabulationSettings( nullptr );
+    BOOST_CHECK_EQUAL( fullModel.getDensity( 400.0E3, 0.1, 0.2, firstTime ),
+                       tabulatedModel.getDensity( 400.0E3, 0.1, 0.2, firstTime ) );
+}
+
 }
 
 } // namespace unit_tests
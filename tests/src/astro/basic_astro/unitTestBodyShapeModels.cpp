@@ -15,6 +15,9 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <limits>
+#include <map>
+
 #include <boost/make_shared.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/test/unit_test.hpp>
@@ -289,6 +292,140 @@ BOOST_AUTO_TEST_CASE( testPolyhedronShapeModel )
 
 }
 
+//! Test altitude computation for a polyhedron with a larger number of vertices, for which the closest vertex is found using
+//! the vertex search tree, against a brute-force search.
+BOOST_AUTO_TEST_CASE( testPolyhedronShapeModelVertexSearch )
+{
+    using namespace tudat::basic_astrodynamics;
+
+    // Create polyhedron by subdividing an octahedron, projecting the vertices onto a sphere, and scaling it to a triaxial
+    // ellipsoid
+    std::vector< Eigen::Vector3d > vertices = {
+        Eigen::Vector3d::UnitX( ), -Eigen::Vector3d::UnitX( ),
+        Eigen::Vector3d::UnitY( ), -Eigen::Vector3d::UnitY( ),
+        Eigen::Vector3d::UnitZ( ), -Eigen::Vector3d::UnitZ( ) };
+    std::vector< Eigen::Vector3i > facets;
+    for ( int signX : { 1, -1 } )
+    {
+        for ( int signY : { 1, -1 } )
+        {
+            for ( int signZ : { 1, -1 } )
+            {
+                int vertexX = ( signX > 0 ) ? 0 : 1;
+                int vertexY = ( signY > 0 ) ? 2 : 3;
+                int vertexZ = ( signZ > 0 ) ? 4 : 5;
+                facets.push_back( ( signX * signY * signZ > 0 ) ? Eigen::Vector3i( vertexX, vertexY, vertexZ ) :
+                                                                  Eigen::Vector3i( vertexX, vertexZ, vertexY ) );
+            }
+        }
+    }
+
+    for ( unsigned int subdivision = 0; subdivision < 3; ++subdivision )
+    {
+        std::map< std::pair< int, int >, int > midpointVertices;
+        auto getMidpointVertex = [ & ]( const int vertex0, const int vertex1 )
+        {
+            std::pair< int, int > edge( std::min( vertex0, vertex1 ), std::max( vertex0, vertex1 ) );
+            if ( midpointVertices.count( edge ) == 0 )
+            {
+                vertices.push_back( ( vertices.at( vertex0 ) + vertices.at( vertex1 ) ).normalized( ) );
+                midpointVertices[ edge ] = vertices.size( ) - 1;
+            }
+            return midpointVertices.at( edge );
+        };
+
+        std::vector< Eigen::Vector3i > subdividedFacets;
+        for ( const Eigen::Vector3i& facet : facets )
+        {
+            int midpoint01 = getMidpointVertex( facet( 0 ), facet( 1 ) );
+            int midpoint12 = getMidpointVertex( facet( 1 ), facet( 2 ) );
+            int midpoint20 = getMidpointVertex( facet( 2 ), facet( 0 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( facet( 0 ), midpoint01, midpoint20 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( facet( 1 ), midpoint12, midpoint01 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( facet( 2 ), midpoint20, midpoint12 ) );
+            subdividedFacets.push_back( Eigen::Vector3i( midpoint01, midpoint12, midpoint20 ) );
+        }
+        facets = subdividedFacets;
+    }
+
+    const Eigen::Vector3d semiAxes( 30.0, 20.0, 10.0 );
+    Eigen::MatrixXd verticesCoordinates( vertices.size( ), 3 );
+    for ( unsigned int i = 0; i < vertices.size( ); ++i )
+    {
+        verticesCoordinates.block< 1, 3 >( i, 0 ) = vertices.at( i ).cwiseProduct( semiAxes ).transpose( );
+    }
+    Eigen::MatrixXi verticesDefiningEachFacet( facets.size( ), 3 );
+    for ( unsigned int i = 0; i < facets.size( ); ++i )
+    {
+        verticesDefiningEachFacet.block< 1, 3 >( i, 0 ) = facets.at( i ).transpose( );
+    }
+    BOOST_CHECK_EQUAL( verticesCoordinates.rows( ), 258 );
+
+    // Create test points, along a spiral passing through and around the polyhedron
+    std::vector< Eigen::Vector3d > testPositions;
+    for ( unsigned int i = 0; i < 500; ++i )
+    {
+        double angle = 0.1 * static_cast< double >( i );
+        double scaling = 0.5 + 1.5 * static_cast< double >( i ) / 500.0;
+        testPositions.push_back( Eigen::Vector3d(
+                                     scaling * semiAxes( 0 ) * std::cos( angle ) * std::cos( 0.03 * angle ),
+                                     scaling * semiAxes( 1 ) * std::sin( angle ) * std::cos( 0.03 * angle ),
+                                     scaling * semiAxes( 2 ) * std::sin( 0.03 * angle ) ) );
+    }
+
+    // Compute altitude wrt vertices, and compare to brute-force computation
+    {
+        PolyhedronBodyShapeModel shapeModel = PolyhedronBodyShapeModel (
+            verticesCoordinates, verticesDefiningEachFacet, false, true );
+
+        for ( const Eigen::Vector3d& testPosition : testPositions )
+        {
+            double expectedAltitude = ( verticesCoordinates.rowwise( ) - testPosition.transpose( ) ).rowwise( ).norm( ).minCoeff( );
+            BOOST_CHECK_CLOSE_FRACTION( shapeModel.getAltitude( testPosition ), expectedAltitude, 1.0E-15 );
+        }
+    }
+
+    // Compute altitude wrt all features, and compare to computation without initial guess from previous call
+    {
+        PolyhedronBodyShapeModel shapeModel = PolyhedronBodyShapeModel (
+            verticesCoordinates, verticesDefiningEachFacet, true, false );
+
+        for ( const Eigen::Vector3d& testPosition : testPositions )
+        {
+            PolyhedronBodyShapeModel newShapeModel = PolyhedronBodyShapeModel (
+                verticesCoordinates, verticesDefiningEachFacet, true, false );
+            double altitude = shapeModel.getAltitude( testPosition );
+            BOOST_CHECK_EQUAL( altitude, newShapeModel.getAltitude( testPosition ) );
+
+            // Check that altitude is not larger than distance to closest vertex, and (for points outside the polyhedron)
+            // not smaller than the distance to any of the facet planes
+            double distanceToClosestVertex =
+                    ( verticesCoordinates.rowwise( ) - testPosition.transpose( ) ).rowwise( ).norm( ).minCoeff( );
+            BOOST_CHECK( std::fabs( altitude ) <= distanceToClosestVertex * ( 1.0 + 1.0E-15 ) );
+
+            double maximumDistanceToFacetPlane = -std::numeric_limits< double >::infinity( );
+            for ( unsigned int facet = 0; facet < verticesDefiningEachFacet.rows( ); ++facet )
+            {
+                Eigen::Vector3d vertex0 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 0 ), 0 );
+                Eigen::Vector3d vertex1 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 1 ), 0 );
+                Eigen::Vector3d vertex2 = verticesCoordinates.block< 1, 3 >( verticesDefiningEachFacet( facet, 2 ), 0 );
+                Eigen::Vector3d facetNormal = ( ( vertex1 - vertex0 ).cross( vertex2 - vertex1 ) ).normalized( );
+                maximumDistanceToFacetPlane = std::max(
+                            maximumDistanceToFacetPlane, ( testPosition - vertex0 ).dot( facetNormal ) );
+            }
+
+            if ( maximumDistanceToFacetPlane > 0.0 )
+            {
+                BOOST_CHECK( altitude >= maximumDistanceToFacetPlane - 1.0E-12 );
+            }
+            else
+            {
+                BOOST_CHECK( altitude <= 0.0 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( testHybridShapeModel )
 {
     using namespace tudat::basic_astrodynamics;
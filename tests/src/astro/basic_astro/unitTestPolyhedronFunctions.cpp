@@ -12,6 +12,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <limits>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
@@ -124,6 +125,90 @@ BOOST_AUTO_TEST_CASE( testPolyhedronUtilities )
 
 }
 
+//! Test computation of the spherical harmonic expansion of the gravity field of a polyhedron.
+BOOST_AUTO_TEST_CASE( testPolyhedronSphericalHarmonicCoefficients )
+{
+    // Define cuboid polyhedron
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    // Define tolerance
+    const double tolerance = 1e-14;
+
+    // Brillouin sphere radius
+    double referenceRadius = basic_astrodynamics::computePolyhedronBrillouinSphereRadius( verticesCoordinates );
+    BOOST_CHECK_CLOSE_FRACTION( std::sqrt( l * l + w * w + h * h ), referenceRadius, tolerance );
+
+    // Degree 0 and 1 coefficients are defined by the centroid
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+            verticesCoordinates, verticesDefiningEachFacet, 4, referenceRadius, cosineCoefficients, sineCoefficients );
+    BOOST_CHECK_EQUAL( cosineCoefficients.rows( ), 5 );
+    BOOST_CHECK_EQUAL( sineCoefficients.cols( ), 5 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 0, 0 ), 1.0, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 0 ), h / 2.0 / ( std::sqrt( 3.0 ) * referenceRadius ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 1 ), l / 2.0 / ( std::sqrt( 3.0 ) * referenceRadius ), tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( sineCoefficients( 1, 1 ), w / 2.0 / ( std::sqrt( 3.0 ) * referenceRadius ), tolerance );
+
+    // Degree 2 coefficients of cuboid with centroid at origin follow from its principal moments of inertia
+    Eigen::MatrixXd centeredVerticesCoordinates = basic_astrodynamics::modifyPolyhedronCentroidPosition(
+            verticesCoordinates, verticesDefiningEachFacet, Eigen::Vector3d::Zero( ) );
+    referenceRadius = basic_astrodynamics::computePolyhedronBrillouinSphereRadius( centeredVerticesCoordinates );
+    BOOST_CHECK_CLOSE_FRACTION( std::sqrt( l * l + w * w + h * h ) / 2.0, referenceRadius, tolerance );
+
+    basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+            centeredVerticesCoordinates, verticesDefiningEachFacet, 4, referenceRadius,
+            cosineCoefficients, sineCoefficients );
+    double expectedC20 = ( 2.0 * h * h - l * l - w * w ) / ( 24.0 * referenceRadius * referenceRadius ) /
+            std::sqrt( 5.0 );
+    double expectedC22 = ( l * l - w * w ) / ( 48.0 * referenceRadius * referenceRadius ) / std::sqrt( 5.0 / 12.0 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 2, 0 ), expectedC20, tolerance );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 2, 2 ), expectedC22, tolerance );
+
+    // Coefficients that vanish due to symmetry of the cuboid
+    for( unsigned int degree = 1; degree <= 4; degree++ )
+    {
+        for( unsigned int order = 0; order <= degree; order++ )
+        {
+            BOOST_CHECK_SMALL( sineCoefficients( degree, order ), tolerance );
+            if( degree % 2 == 1 || order % 2 == 1 )
+            {
+                BOOST_CHECK_SMALL( cosineCoefficients( degree, order ), tolerance );
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW( basic_astrodynamics::computePolyhedronSphericalHarmonicCoefficients(
+            centeredVerticesCoordinates, verticesDefiningEachFacet, -1, referenceRadius,
+            cosineCoefficients, sineCoefficients ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
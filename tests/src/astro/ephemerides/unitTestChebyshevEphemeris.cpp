@@ -0,0 +1,103 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <memory>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/ephemerides/chebyshevEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_chebyshevEphemeris )
+
+//! Test whether Chebyshev ephemeris reproduces a Kepler orbit to within the requested tolerances.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisAccuracy )
+{
+    using namespace orbital_element_conversions;
+
+    // Create Kepler ephemeris of eccentric Earth orbit, used as reference.
+    const double earthGravitationalParameter = 398600.4415e9;
+    Eigen::Vector6d keplerianElements;
+    keplerianElements << 12000.0E3, 0.3, 0.4, 1.2, 0.3, 0.0;
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris =
+            std::make_shared< ephemerides::KeplerEphemeris >( keplerianElements, 0.0, earthGravitationalParameter );
+
+    const double initialTime = 0.0;
+    const double finalTime = 5.0 * 86400.0;
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Use loose and tight tolerances, the latter requiring bisection of the segments.
+        const double positionTolerance = ( test == 0 ) ? 1.0 : 1.0E-3;
+        const double velocityTolerance = ( test == 0 ) ? 1.0E-3 : 1.0E-6;
+
+        ephemerides::ChebyshevEphemeris chebyshevEphemeris(
+                    [ = ]( const double time ){ return keplerEphemeris->getCartesianState( time ); },
+                    initialTime, finalTime, positionTolerance, velocityTolerance, 10, 3600.0, "Earth", "J2000" );
+
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getInitialTime( ), initialTime );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getFinalTime( ), finalTime );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getReferenceFrameOrigin( ), "Earth" );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getReferenceFrameOrientation( ), "J2000" );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getSegmentBoundaries( ).size( ),
+                           chebyshevEphemeris.getNumberOfSegments( ) + 1 );
+        BOOST_CHECK( chebyshevEphemeris.getNumberOfSegments( ) >= 120 );
+
+        // Check segment boundaries are increasing and no longer than the maximum duration.
+        for( unsigned int i = 0; i < chebyshevEphemeris.getNumberOfSegments( ); i++ )
+        {
+            const double segmentDuration = chebyshevEphemeris.getSegmentBoundaries( ).at( i + 1 ) -
+                    chebyshevEphemeris.getSegmentBoundaries( ).at( i );
+            BOOST_CHECK( segmentDuration > 0.0 );
+            BOOST_CHECK( segmentDuration <= 3600.0 );
+        }
+
+        // Compare to reference at (non-node) times throughout interval, including boundaries.
+        for( double time = initialTime; time <= finalTime; time += 1234.5 )
+        {
+            Eigen::Vector6d stateDifference =
+                    chebyshevEphemeris.getCartesianState( time ) - keplerEphemeris->getCartesianState( time );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 10.0 * positionTolerance );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 10.0 * velocityTolerance );
+        }
+
+        Eigen::Vector6d stateDifference =
+                chebyshevEphemeris.getCartesianState( finalTime ) - keplerEphemeris->getCartesianState( finalTime );
+        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), positionTolerance );
+        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), velocityTolerance );
+
+        // Check that evaluation outside of valid interval is not allowed.
+        BOOST_CHECK_THROW( chebyshevEphemeris.getCartesianState( initialTime - 1.0 ), std::runtime_error );
+        BOOST_CHECK_THROW( chebyshevEphemeris.getCartesianState( finalTime + 1.0 ), std::runtime_error );
+    }
+
+    // Check that unattainable tolerances result in an exception.
+    BOOST_CHECK_THROW( ephemerides::ChebyshevEphemeris(
+                           [ = ]( const double time ){ return keplerEphemeris->getCartesianState( time ); },
+                           initialTime, finalTime, 0.0, 0.0, 10, 3600.0, "Earth", "J2000", 5 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
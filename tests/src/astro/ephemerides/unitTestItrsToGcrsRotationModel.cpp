@@ -173,6 +173,61 @@ BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationAgainstSofaCookbook )
     }
 }
 
+//! Test ITRS <-> GCRS rotation with tabulated Earth orientation angles against direct computation
+BOOST_AUTO_TEST_CASE( test_ItrsToGcrsRotationWithTabulatedAngles )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > anglesCalculator =
+            earth_orientation::createStandardEarthOrientationCalculator( );
+
+    // Create rotation models with direct and interpolated angles
+    std::shared_ptr< GcrsToItrsRotationModel > directRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator );
+    std::shared_ptr< GcrsToItrsRotationModel > tabulatedRotationModel =
+            std::make_shared< GcrsToItrsRotationModel >( anglesCalculator, tdb_scale, "GCRS", 3600.0, 8 );
+    BOOST_CHECK( directRotationModel->getTabulatedAnglesCalculator( ) == nullptr );
+    BOOST_CHECK( tabulatedRotationModel->getTabulatedAnglesCalculator( ) != nullptr );
+
+    // Compare rotations over several days, first moving forward, then backward in time (extending grid both ways). Tolerance
+    // corresponds to 1 mm on Earth surface.
+    const double tolerance = 1.0E-3 / 6378.0E3;
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        testTimes.push_back( 1.0E8 + static_cast< double >( i ) * 1234.567 );
+    }
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        testTimes.push_back( 1.0E8 - static_cast< double >( i ) * 987.654 );
+    }
+
+    for( unsigned test = 0; test < testTimes.size( ); test++ )
+    {
+        Eigen::Matrix3d directRotation =
+                directRotationModel->getRotationToBaseFrame( testTimes.at( test ) ).toRotationMatrix( );
+        Eigen::Matrix3d tabulatedRotation =
+                tabulatedRotationModel->getRotationToBaseFrame( testTimes.at( test ) ).toRotationMatrix( );
+        Eigen::Matrix3d directRotationDerivative =
+                directRotationModel->getDerivativeOfRotationToBaseFrame( testTimes.at( test ) );
+        Eigen::Matrix3d tabulatedRotationDerivative =
+                tabulatedRotationModel->getDerivativeOfRotationToBaseFrame( testTimes.at( test ) );
+
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( tabulatedRotation( i, j ) - directRotation( i, j ), tolerance );
+                BOOST_CHECK_SMALL( tabulatedRotationDerivative( i, j ) - directRotationDerivative( i, j ),
+                                   tolerance * 1.0E-4 );
+            }
+        }
+    }
+
+    // Check that grid is only computed where needed
+    int numberOfTabulatedPoints =
+            tabulatedRotationModel->getTabulatedAnglesCalculator( )->getNumberOfTabulatedPoints( );
+    BOOST_CHECK( numberOfTabulatedPoints < ( 200.0 * ( 1234.567 + 987.654 ) ) / 3600.0 + 2 * 64 + 16 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
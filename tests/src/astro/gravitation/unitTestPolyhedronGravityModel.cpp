@@ -15,7 +15,10 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
@@ -174,6 +177,121 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
     }
 }
 
+//! Test computation of the gravity field using the far-field spherical harmonic expansion, and using multiple threads
+BOOST_AUTO_TEST_CASE( testFarFieldAndParallelGravityComputation )
+{
+    // Define cuboid polyhedron dimensions
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    // Define parameters
+    const double gravitationalConstant = 6.67259e-11;
+    const double density = 2670;
+    const double volume = w * h * l;
+    const double gravitationalParameter = gravitationalConstant * density * volume;
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    gravitation::PolyhedronGravityField gravityField = gravitation::PolyhedronGravityField(
+        gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet);
+
+    Eigen::Vector3d bodyFixedPosition;
+    std::function< void( Eigen::Vector3d& ) > bodyFixedPositionFunction =
+            [ & ]( Eigen::Vector3d& positionOfBodySubjectToAcceleration ){
+        positionOfBodySubjectToAcceleration = bodyFixedPosition; };
+
+    // Create exact gravity model, gravity model with far-field expansion, and gravity model using multiple threads
+    std::vector< std::shared_ptr< gravitation::PolyhedronGravitationalAccelerationModel > > gravityModels;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        gravityModels.push_back( std::make_shared< gravitation::PolyhedronGravitationalAccelerationModel >(
+                    bodyFixedPositionFunction, gravitationalParameter, volume, verticesCoordinates,
+                    verticesDefiningEachFacet, gravityField.getVerticesDefiningEachEdge(),
+                    gravityField.getFacetDyads(), gravityField.getEdgeDyads() ) );
+        gravityModels.at( i )->resetUpdatePotential( true );
+        gravityModels.at( i )->resetUpdateLaplacianOfPotential( true );
+    }
+    gravityModels.at( 1 )->setFarFieldSphericalHarmonicExpansion( 12, 2.0 );
+    gravityModels.at( 2 )->setNumberOfThreads( 3 );
+
+    // Check settings of far-field expansion
+    const double brillouinSphereRadius = std::sqrt( l * l + w * w + h * h );
+    BOOST_CHECK_CLOSE_FRACTION( gravityModels.at( 1 )->getFarFieldReferenceRadius( ), brillouinSphereRadius,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( gravityModels.at( 1 )->getFarFieldSwitchRadius( ), 2.0 * brillouinSphereRadius,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( gravityModels.at( 1 )->getFarFieldCosineCoefficients( ).rows( ), 13 );
+    BOOST_CHECK_THROW( gravityModels.at( 0 )->setFarFieldSphericalHarmonicExpansion( 12, 1.0 ), std::runtime_error );
+
+    std::vector< Eigen::Vector3d > testPositions = {
+        ( Eigen::Vector3d( ) << 5.0, 3.0, 2.0 ).finished( ),
+        ( Eigen::Vector3d( ) << -30.0, 25.0, 20.0 ).finished( ),
+        ( Eigen::Vector3d( ) << 60.0, -40.0, 30.0 ).finished( ),
+        ( Eigen::Vector3d( ) << -100.0, 80.0, -150.0 ).finished( ),
+        ( Eigen::Vector3d( ) << 10.0, 5.0, 400.0 ).finished( ) };
+
+    for( unsigned int positionId = 0; positionId < testPositions.size( ); positionId++ )
+    {
+        bodyFixedPosition = testPositions.at( positionId );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            gravityModels.at( i )->resetCurrentTime( );
+            gravityModels.at( i )->updateMembers( static_cast< double >( positionId ) );
+        }
+
+        Eigen::Vector3d exactAcceleration = gravityModels.at( 0 )->getAcceleration( );
+        double exactPotential = gravityModels.at( 0 )->getCurrentPotential( );
+
+        // Check that evaluation with multiple threads gives (almost) identical results
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( exactAcceleration, gravityModels.at( 2 )->getAcceleration( ), 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( exactPotential, gravityModels.at( 2 )->getCurrentPotential( ), 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( gravityModels.at( 0 )->getCurrentLaplacianOfPotential( ),
+                                    gravityModels.at( 2 )->getCurrentLaplacianOfPotential( ), 1.0E-14 );
+
+        // Check far-field expansion: identical inside switch radius, close to exact value outside of it
+        if( bodyFixedPosition.norm( ) < gravityModels.at( 1 )->getFarFieldSwitchRadius( ) )
+        {
+            BOOST_CHECK_EQUAL( exactPotential, gravityModels.at( 1 )->getCurrentPotential( ) );
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( exactAcceleration( j ), gravityModels.at( 1 )->getAcceleration( )( j ) );
+            }
+        }
+        else
+        {
+            BOOST_CHECK_SMALL( ( exactAcceleration - gravityModels.at( 1 )->getAcceleration( ) ).norm( ) /
+                               exactAcceleration.norm( ), 1.0E-7 );
+            BOOST_CHECK_CLOSE_FRACTION( exactPotential, gravityModels.at( 1 )->getCurrentPotential( ), 1.0E-7 );
+            BOOST_CHECK_EQUAL( gravityModels.at( 1 )->getCurrentLaplacianOfPotential( ), 0.0 );
+        }
+    }
+}
+
 //! Test the functionality of the polyhedron gravity field class.
 BOOST_AUTO_TEST_SUITE( test_polyhedron_gravity_model )
 
@@ -300,6 +300,210 @@ BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationWrapperCla
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, acceleration, 1.0e-15 );
 }
 
+// Check the computation of accelerations at multiple positions simultaneously, using the Pines formulation.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationBatch )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define (arbitrary) geodesy-normalized coefficients up to degree and order 30.
+    const int maximumDegree = 30;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 3.0 * degree + order ) / degree;
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 * std::cos( degree + 5.0 * order ) / degree;
+            }
+        }
+    }
+
+    // Define positions, with the number of positions not a multiple of the block size, and including a pole.
+    const int numberOfPositions = 3 * PinesSphericalHarmonicsGravityCalculator::blockSize + 3;
+    Eigen::Matrix< double, 3, Eigen::Dynamic > positions =
+            Eigen::Matrix< double, 3, Eigen::Dynamic >::Zero( 3, numberOfPositions );
+    for( int i = 0; i < numberOfPositions - 1; i++ )
+    {
+        positions.col( i ) << std::cos( 0.7 * i ) * std::cos( 0.3 * i - 1.5 ),
+                std::sin( 0.7 * i ) * std::cos( 0.3 * i - 1.5 ), std::sin( 0.3 * i - 1.5 );
+        positions.col( i ) *= ( 7.0e6 + 1.0e5 * i );
+    }
+    positions.col( numberOfPositions - 1 ) << 0.0, 0.0, -7.0e6;
+
+    Eigen::Matrix< double, 3, Eigen::Dynamic > batchAccelerations = computeGeodesyNormalizedGravitationalAccelerations(
+                positions, gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients );
+
+    // Compare with accelerations computed one at a time, using the spherical formulation.
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 1 );
+    std::map< std::pair< int, int >, Eigen::Vector3d > dummyAccelerationPerTerm;
+    for( int i = 0; i < numberOfPositions - 1; i++ )
+    {
+        Eigen::Vector3d expectedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                    positions.col( i ), gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                    sphericalHarmonicsCache, dummyAccelerationPerTerm );
+        Eigen::Vector3d computedAcceleration = batchAccelerations.col( i );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, computedAcceleration, 1.0E-13 );
+    }
+
+    // Check acceleration at pole (for which spherical formulation is singular) against acceleration at nearby position
+    Eigen::Vector3d nearPolePosition = positions.col( numberOfPositions - 1 ) + Eigen::Vector3d::UnitX( );
+    Eigen::Vector3d nearPoleAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                nearPolePosition, gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache, dummyAccelerationPerTerm );
+    BOOST_CHECK_SMALL( ( nearPoleAcceleration - batchAccelerations.col( numberOfPositions - 1 ) ).norm( ) /
+                       nearPoleAcceleration.norm( ), 1.0E-6 );
+
+    // Check batch evaluation through acceleration model, and evaluation at single position
+    SphericalHarmonicsGravitationalAccelerationModelPointer gravityModel
+            = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( Eigen::Vector3d& input ){ input = positions.col( 0 ); }, gravitationalParameter, planetaryRadius,
+                cosineCoefficients, sineCoefficients );
+    Eigen::Matrix< double, 3, Eigen::Dynamic > modelAccelerations =
+            gravityModel->getBodyFixedAccelerationsAtPositions( positions );
+    PinesSphericalHarmonicsGravityCalculator gravityCalculator( maximumDegree, maximumDegree );
+    for( int i = 0; i < numberOfPositions; i++ )
+    {
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( modelAccelerations( j, i ), batchAccelerations( j, i ) );
+        }
+
+        Eigen::Vector3d singleAcceleration = gravityCalculator.computeAcceleration(
+                    positions.col( i ), gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients );
+        Eigen::Vector3d expectedSingleAcceleration = batchAccelerations.col( i );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedSingleAcceleration, singleAcceleration, 1.0E-15 );
+    }
+
+    // Check that too large gravity fields are rejected
+    PinesSphericalHarmonicsGravityCalculator smallGravityCalculator( 10, 10 );
+    BOOST_CHECK_THROW( smallGravityCalculator.computeAcceleration(
+                           positions.col( 0 ), gravitationalParameter, planetaryRadius, cosineCoefficients,
+                           sineCoefficients ), std::runtime_error );
+}
+
+// Check the acceleration model using the Pines formulation against the formulation in spherical coordinates.
+BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalAccelerationPinesFormulation )
+{
+    // Short-cuts.
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define (arbitrary) geodesy-normalized coefficients up to degree 20 and order 15.
+    const int maximumDegree = 20;
+    const int maximumOrder = 15;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; ( order <= degree ) && ( order <= maximumOrder ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 3.0 * degree + order ) / degree;
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 * std::cos( degree + 5.0 * order ) / degree;
+            }
+        }
+    }
+
+    // Define rotation from body-fixed to inertial frame, and position of body undergoing acceleration
+    const Eigen::Quaterniond rotationToInertialFrame = Eigen::Quaterniond(
+                Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitZ( ) ) * Eigen::AngleAxisd( -1.1, Eigen::Vector3d::UnitX( ) ) );
+    Eigen::Vector3d position( 7.0e6, -3.0e6, 4.5e6 );
+
+    // Create acceleration models for both formulations
+    std::vector< SphericalHarmonicsGravitationalAccelerationModelPointer > gravityModels;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        gravityModels.push_back( std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                    [ & ]( Eigen::Vector3d& input ){ input = position; },
+                    [ = ]( ){ return gravitationalParameter; }, planetaryRadius,
+                    [ = ]( ){ return cosineCoefficients; }, [ = ]( ){ return sineCoefficients; },
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                    [ = ]( ){ return rotationToInertialFrame; }, false ) );
+        gravityModels.at( i )->setSaveSphericalHarmonicTermsSeparately( true );
+    }
+    gravityModels.at( 1 )->setGravityFormulation( pines_formulation );
+    BOOST_CHECK_EQUAL( gravityModels.at( 0 )->getGravityFormulation( ), spherical_coordinates_formulation );
+    BOOST_CHECK_EQUAL( gravityModels.at( 1 )->getGravityFormulation( ), pines_formulation );
+    BOOST_CHECK( gravityModels.at( 0 )->getPinesSphericalHarmonicsCache( ) == nullptr );
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        gravityModels.at( i )->updateMembers( 0.0 );
+    }
+
+    // Compare total acceleration
+    Eigen::Vector3d expectedAcceleration = gravityModels.at( 0 )->getAcceleration( );
+    Eigen::Vector3d computedAcceleration = gravityModels.at( 1 )->getAcceleration( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, computedAcceleration, 1.0E-14 );
+
+    expectedAcceleration = gravityModels.at( 0 )->getAccelerationInBodyFixedFrame( );
+    computedAcceleration = gravityModels.at( 1 )->getAccelerationInBodyFixedFrame( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, computedAcceleration, 1.0E-14 );
+
+    // Compare accelerations per term, and with alternative coefficients
+    std::vector< std::pair< int, int > > coefficientIndices = { { 0, 0 }, { 2, 0 }, { 2, 2 }, { 7, 3 }, { 20, 15 } };
+    Eigen::VectorXd expectedAccelerationComponents =
+            gravityModels.at( 0 )->getConcatenatedAccelerationComponents( coefficientIndices );
+    Eigen::VectorXd computedAccelerationComponents =
+            gravityModels.at( 1 )->getConcatenatedAccelerationComponents( coefficientIndices );
+    for( unsigned int i = 0; i < coefficientIndices.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( ( expectedAccelerationComponents.segment( 3 * i, 3 ) -
+                             computedAccelerationComponents.segment( 3 * i, 3 ) ).norm( ) /
+                           expectedAccelerationComponents.segment( 3 * i, 3 ).norm( ), 1.0E-12 );
+    }
+
+    Eigen::MatrixXd alternativeCosineCoefficients = 2.0 * cosineCoefficients;
+    expectedAcceleration = gravityModels.at( 0 )->getAccelerationWithAlternativeCoefficients(
+                alternativeCosineCoefficients, sineCoefficients );
+    computedAcceleration = gravityModels.at( 1 )->getAccelerationWithAlternativeCoefficients(
+                alternativeCosineCoefficients, sineCoefficients );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, computedAcceleration, 1.0E-14 );
+
+    // Check acceleration directly over the pole (for which the spherical formulation is singular) against the
+    // acceleration at a nearby position
+    Eigen::Vector3d polePosition = rotationToInertialFrame * Eigen::Vector3d( 0.0, 0.0, 7.0e6 );
+    position = polePosition + rotationToInertialFrame * Eigen::Vector3d::UnitX( );
+    gravityModels.at( 0 )->updateMembers( 1.0 );
+    position = polePosition;
+    gravityModels.at( 1 )->updateMembers( 1.0 );
+    expectedAcceleration = gravityModels.at( 0 )->getAcceleration( );
+    computedAcceleration = gravityModels.at( 1 )->getAcceleration( );
+    BOOST_CHECK( computedAcceleration.allFinite( ) );
+    BOOST_CHECK_SMALL( ( expectedAcceleration - computedAcceleration ).norm( ) / expectedAcceleration.norm( ), 1.0E-6 );
+
+    // Compare potential
+    PinesSphericalHarmonicsCache pinesCache( maximumDegree, maximumOrder );
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::Vector3d bodyFixedPosition( -2.0e6, 3.0e6, 6.5e6 );
+    pinesCache.update( bodyFixedPosition, planetaryRadius );
+    double expectedPotential = calculateSphericalHarmonicGravitationalPotential(
+                bodyFixedPosition, gravitationalParameter, planetaryRadius, cosineCoefficients, sineCoefficients,
+                sphericalHarmonicsCache );
+    BOOST_CHECK_CLOSE_FRACTION( pinesCache.computePotential( gravitationalParameter, cosineCoefficients, sineCoefficients ),
+                                expectedPotential, 1.0E-14 );
+
+    // Check that too large gravity fields are rejected
+    PinesSphericalHarmonicsCache smallPinesCache( 10, 10 );
+    smallPinesCache.update( bodyFixedPosition, planetaryRadius );
+    BOOST_CHECK_THROW( smallPinesCache.computeAcceleration( gravitationalParameter, cosineCoefficients, sineCoefficients ),
+                       std::runtime_error );
+}
+
 // Test the computation of the potential using the wrapper class, for harmonics terms up to degree 0 and order 0.
 BOOST_AUTO_TEST_CASE( test_SphericalHarmonicsGravitationalPotentialWrapperClass )
 {
@@ -36,8 +36,11 @@
 #include "tudat/astro/basic_astro/orbitalElementConversions.h"
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/basics/basicTypedefs.h"
 
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/mission_segments/lambertPorkchopGrid.h"
 #include "tudat/astro/mission_segments/lambertRoutines.h"
 
 namespace tudat
@@ -564,6 +567,181 @@ BOOST_AUTO_TEST_CASE( testsolveLambertProblemGoodingElliptical )
     BOOST_CHECK_SMALL( testInertialVelocityAtArrival.z( ), tolerance );
 }
 
+
+//! Test the batch Izzo Lambert solver and the porkchop grid generator.
+BOOST_AUTO_TEST_CASE( testBatchLambertSolverIzzo )
+{
+    // Set heliocentric orbits of departure and arrival body (roughly Earth and Mars).
+    const double sunGravitationalParameter = 1.32712440018e20;
+    const double astronomicalUnit = 1.495978707e11;
+    const double day = 86400.0;
+    Eigen::Vector6d departureBodyKeplerElements, arrivalBodyKeplerElements;
+    departureBodyKeplerElements << astronomicalUnit, 0.0167, 0.0, 0.0, 0.0, 0.0;
+    arrivalBodyKeplerElements << 1.524 * astronomicalUnit, 0.0934, convertDegreesToRadians( 1.85 ),
+            convertDegreesToRadians( 286.5 ), convertDegreesToRadians( 49.6 ), convertDegreesToRadians( 20.0 );
+    std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris =
+            std::make_shared< ephemerides::KeplerEphemeris >(
+                departureBodyKeplerElements, 0.0, sunGravitationalParameter );
+    std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris =
+            std::make_shared< ephemerides::KeplerEphemeris >(
+                arrivalBodyKeplerElements, 0.0, sunGravitationalParameter );
+
+    // Set grid of departure and arrival times (including arrival times before departure).
+    std::vector< double > departureTimes, arrivalTimes;
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        departureTimes.push_back( static_cast< double >( 10 * i ) * day );
+    }
+    for( unsigned int j = 0; j < 25; j++ )
+    {
+        arrivalTimes.push_back( static_cast< double >( 100 + 15 * j ) * day );
+    }
+
+    // Set batch of Lambert problems from grid.
+    unsigned int numberOfProblems = departureTimes.size( ) * arrivalTimes.size( );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > statesAtDeparture( 6, numberOfProblems );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > statesAtArrival( 6, numberOfProblems );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            unsigned int index = i * arrivalTimes.size( ) + j;
+            statesAtDeparture.col( index ) = departureBodyEphemeris->getCartesianState( departureTimes.at( i ) );
+            statesAtArrival.col( index ) = arrivalBodyEphemeris->getCartesianState( arrivalTimes.at( j ) );
+            timesOfFlight( index ) = arrivalTimes.at( j ) - departureTimes.at( i );
+        }
+    }
+
+    // Solve problems one by one.
+    Eigen::Matrix3Xd expectedVelocitiesAtDeparture = Eigen::Matrix3Xd::Constant( 3, numberOfProblems, TUDAT_NAN );
+    Eigen::Matrix3Xd expectedVelocitiesAtArrival = Eigen::Matrix3Xd::Constant( 3, numberOfProblems, TUDAT_NAN );
+    for( unsigned int i = 0; i < numberOfProblems; i++ )
+    {
+        if( timesOfFlight( i ) > 0.0 )
+        {
+            Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+            mission_segments::solveLambertProblemIzzo(
+                        statesAtDeparture.block< 3, 1 >( 0, i ), statesAtArrival.block< 3, 1 >( 0, i ),
+                        timesOfFlight( i ), sunGravitationalParameter, velocityAtDeparture, velocityAtArrival );
+            expectedVelocitiesAtDeparture.col( i ) = velocityAtDeparture;
+            expectedVelocitiesAtArrival.col( i ) = velocityAtArrival;
+        }
+    }
+
+    // Check batch solution without warm start (identical to single solutions), and with warm start, for different
+    // numbers of threads.
+    Eigen::Matrix3Xd serialVelocitiesAtDeparture, serialVelocitiesAtArrival;
+    for( unsigned int useWarmStart = 0; useWarmStart < 2; useWarmStart++ )
+    {
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 3; numberOfThreads += 2 )
+        {
+            Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+            mission_segments::solveLambertProblemsIzzo(
+                        statesAtDeparture.topRows( 3 ), statesAtArrival.topRows( 3 ), timesOfFlight,
+                        sunGravitationalParameter, velocitiesAtDeparture, velocitiesAtArrival,
+                        numberOfThreads, useWarmStart );
+            if( numberOfThreads == 1 )
+            {
+                serialVelocitiesAtDeparture = velocitiesAtDeparture;
+                serialVelocitiesAtArrival = velocitiesAtArrival;
+            }
+
+            for( unsigned int i = 0; i < numberOfProblems; i++ )
+            {
+                if( timesOfFlight( i ) > 0.0 )
+                {
+                    for( unsigned int k = 0; k < 3; k++ )
+                    {
+                        if( useWarmStart )
+                        {
+                            BOOST_CHECK_SMALL( velocitiesAtDeparture( k, i ) - expectedVelocitiesAtDeparture( k, i ),
+                                               1.0E-4 );
+                            BOOST_CHECK_SMALL( velocitiesAtArrival( k, i ) - expectedVelocitiesAtArrival( k, i ),
+                                               1.0E-4 );
+                        }
+                        else
+                        {
+                            BOOST_CHECK_EQUAL( velocitiesAtDeparture( k, i ), expectedVelocitiesAtDeparture( k, i ) );
+                            BOOST_CHECK_EQUAL( velocitiesAtArrival( k, i ), expectedVelocitiesAtArrival( k, i ) );
+                        }
+
+                        // Check that results do not depend on number of threads.
+                        BOOST_CHECK_EQUAL( velocitiesAtDeparture( k, i ), serialVelocitiesAtDeparture( k, i ) );
+                        BOOST_CHECK_EQUAL( velocitiesAtArrival( k, i ), serialVelocitiesAtArrival( k, i ) );
+                    }
+                }
+                else
+                {
+                    BOOST_CHECK( velocitiesAtDeparture.col( i ).hasNaN( ) );
+                    BOOST_CHECK( velocitiesAtArrival.col( i ).hasNaN( ) );
+                }
+            }
+        }
+    }
+
+    // Check porkchop grid against single solutions.
+    Eigen::MatrixXd deltaVsAtDeparture, deltaVsAtArrival;
+    mission_segments::computeLambertPorkchopGrid(
+                departureBodyEphemeris, arrivalBodyEphemeris, sunGravitationalParameter,
+                departureTimes, arrivalTimes, deltaVsAtDeparture, deltaVsAtArrival, 3 );
+    Eigen::MatrixXd totalDeltaVs = mission_segments::computeLambertPorkchopGrid(
+                departureBodyEphemeris, arrivalBodyEphemeris, sunGravitationalParameter,
+                departureTimes, arrivalTimes );
+    BOOST_CHECK_EQUAL( deltaVsAtDeparture.rows( ), departureTimes.size( ) );
+    BOOST_CHECK_EQUAL( deltaVsAtDeparture.cols( ), arrivalTimes.size( ) );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            unsigned int index = i * arrivalTimes.size( ) + j;
+            if( timesOfFlight( index ) > 0.0 )
+            {
+                double expectedDeltaVAtDeparture =
+                        ( expectedVelocitiesAtDeparture.col( index ) - statesAtDeparture.block< 3, 1 >( 3, index ) ).norm( );
+                double expectedDeltaVAtArrival =
+                        ( expectedVelocitiesAtArrival.col( index ) - statesAtArrival.block< 3, 1 >( 3, index ) ).norm( );
+                BOOST_CHECK_SMALL( deltaVsAtDeparture( i, j ) - expectedDeltaVAtDeparture, 1.0E-4 );
+                BOOST_CHECK_SMALL( deltaVsAtArrival( i, j ) - expectedDeltaVAtArrival, 1.0E-4 );
+                BOOST_CHECK_EQUAL( totalDeltaVs( i, j ), deltaVsAtDeparture( i, j ) + deltaVsAtArrival( i, j ) );
+            }
+            else
+            {
+                BOOST_CHECK( std::isnan( deltaVsAtDeparture( i, j ) ) );
+                BOOST_CHECK( std::isnan( totalDeltaVs( i, j ) ) );
+            }
+        }
+    }
+
+    // Check delta V computation from batch of states.
+    Eigen::VectorXd batchDeltaVsAtDeparture, batchDeltaVsAtArrival;
+    mission_segments::computeLambertTransferDeltaVs(
+                statesAtDeparture, statesAtArrival, timesOfFlight, sunGravitationalParameter,
+                batchDeltaVsAtDeparture, batchDeltaVsAtArrival, 2 );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            unsigned int index = i * arrivalTimes.size( ) + j;
+            if( timesOfFlight( index ) > 0.0 )
+            {
+                BOOST_CHECK_SMALL( batchDeltaVsAtDeparture( index ) - deltaVsAtDeparture( i, j ), 1.0E-4 );
+                BOOST_CHECK_SMALL( batchDeltaVsAtArrival( index ) - deltaVsAtArrival( i, j ), 1.0E-4 );
+            }
+            else
+            {
+                BOOST_CHECK( std::isnan( batchDeltaVsAtDeparture( index ) ) );
+            }
+        }
+    }
+
+    // Check inconsistent input sizes.
+    Eigen::VectorXd tooShortDeltaVs;
+    BOOST_CHECK_THROW( mission_segments::computeLambertTransferDeltaVs(
+                           statesAtDeparture, statesAtArrival, timesOfFlight.segment( 0, 10 ),
+                           sunGravitationalParameter, tooShortDeltaVs, tooShortDeltaVs ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
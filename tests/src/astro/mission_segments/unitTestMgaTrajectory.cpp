@@ -39,6 +39,8 @@
 #include "tudat/astro/ephemerides/constantEphemeris.h"
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 #include "tudat/astro/mission_segments/createTransferTrajectory.h"
+#include "tudat/astro/mission_segments/transferTrajectoryEvaluator.h"
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/simulation/environment_setup/body.h"
 #include "tudat/simulation/environment_setup/createBodies.h"
 #include "tudat/simulation/environment_setup/defaultBodies.h"
@@ -1111,6 +1113,95 @@ BOOST_AUTO_TEST_CASE( testMgaMultipleSphericalShapingLegs )
     }
 }
 
+// Test checks that the Delta V of a hodographic and a spherical shaping leg that is evaluated repeatedly (so that the base
+// function values tabulated at the quadrature nodes are reused, or recomputed if the time of flight or azimuth range
+// changes) is identical to that of a newly created leg, and that the thrust acceleration is not retrieved from a
+// previous evaluation.
+BOOST_AUTO_TEST_CASE( testShapingLegReevaluation )
+{
+    int numberOfRevolutions = 1;
+    double JD = physical_constants::JULIAN_DAY;
+    double departureDate = 8174.5 * JD;
+    double timeOfFlight = 580.0 * JD;
+    double frequency = 2.0 * mathematical_constants::PI / timeOfFlight;
+    double scaleFactor = 1.0 / timeOfFlight;
+
+    // Create environment
+    tudat::simulation_setup::SystemOfBodies bodies = createSimplifiedSystemOfBodies( );
+    std::shared_ptr< ephemerides::Ephemeris > departureBodyEphemeris = bodies.at( "Earth" )->getEphemeris( );
+    std::shared_ptr< ephemerides::Ephemeris > arrivalBodyEphemeris = bodies.at( "Mars" )->getEphemeris( );
+    double centralBodyGravitationalParameter = bodies.at( "Sun" )->getGravityFieldModel( )->getGravitationalParameter( );
+
+    // Define list of leg parameters: the second has the same time of flight as the first (identical quadrature node
+    // times for hodographic shaping), the third a different time of flight, and the fourth is equal to the first.
+    std::vector< Eigen::Vector3d > legParametersList;
+    legParametersList.push_back( ( Eigen::Vector3d( ) << departureDate, departureDate + timeOfFlight, numberOfRevolutions ).finished( ) );
+    legParametersList.push_back( ( Eigen::Vector3d( ) << departureDate + 10.0 * JD, departureDate + 10.0 * JD + timeOfFlight,
+                                   numberOfRevolutions ).finished( ) );
+    legParametersList.push_back( ( Eigen::Vector3d( ) << departureDate, departureDate + timeOfFlight + 10.0 * JD,
+                                   numberOfRevolutions ).finished( ) );
+    legParametersList.push_back( legParametersList.at( 0 ) );
+
+    // Define velocity functions, using the leg parameters that are currently evaluated
+    Eigen::Vector3d currentLegParameters;
+    std::function< Eigen::Vector3d( ) > departureVelocityFunction = [ & ]( )
+    {
+        return Eigen::Vector3d( departureBodyEphemeris->getCartesianState( currentLegParameters( 0 ) ).segment< 3 >( 3 ) );
+    };
+    std::function< Eigen::Vector3d( ) > arrivalVelocityFunction = [ & ]( )
+    {
+        return Eigen::Vector3d( arrivalBodyEphemeris->getCartesianState( currentLegParameters( 1 ) ).segment< 3 >( 3 ) );
+    };
+
+    // Define functions to create hodographic and spherical shaping legs
+    shape_based_methods::HodographicBasisFunctionList radialVelocityFunctionComponents =
+            createHodographicShapingDefaultRadialFunction( scaleFactor, frequency );
+    shape_based_methods::HodographicBasisFunctionList normalVelocityFunctionComponents =
+            createHodographicShapingDefaultNormalFunction( scaleFactor, frequency );
+    shape_based_methods::HodographicBasisFunctionList axialVelocityFunctionComponents =
+            createHodographicShapingDefaultAxialFunction( scaleFactor, frequency, numberOfRevolutions );
+    std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings =
+            tudat::root_finders::bisectionRootFinderSettings( 1.0E-6, TUDAT_NAN, TUDAT_NAN, 30 );
+
+    std::vector< std::function< std::shared_ptr< TransferLeg >( ) > > legCreationFunctions;
+    legCreationFunctions.push_back( [ & ]( )
+    {
+        return std::make_shared< shape_based_methods::HodographicShapingLeg >(
+                    departureBodyEphemeris, arrivalBodyEphemeris, centralBodyGravitationalParameter,
+                    departureVelocityFunction, arrivalVelocityFunction,
+                    radialVelocityFunctionComponents, normalVelocityFunctionComponents, axialVelocityFunctionComponents );
+    } );
+    legCreationFunctions.push_back( [ & ]( )
+    {
+        return std::make_shared< shape_based_methods::SphericalShapingLeg >(
+                    departureBodyEphemeris, arrivalBodyEphemeris, centralBodyGravitationalParameter,
+                    departureVelocityFunction, arrivalVelocityFunction, rootFinderSettings, 1.0e-6, 1.0e-1 );
+    } );
+
+    for( unsigned int legType = 0; legType < legCreationFunctions.size( ); legType++ )
+    {
+        std::shared_ptr< TransferLeg > reusedLeg = legCreationFunctions.at( legType )( );
+        for( unsigned int i = 0; i < legParametersList.size( ); i++ )
+        {
+            currentLegParameters = legParametersList.at( i );
+            double thrustEvaluationTime = currentLegParameters( 0 ) + 100.0 * JD;
+
+            reusedLeg->updateLegParameters( currentLegParameters );
+            std::shared_ptr< TransferLeg > newLeg = legCreationFunctions.at( legType )( );
+            newLeg->updateLegParameters( currentLegParameters );
+
+            BOOST_CHECK_EQUAL( reusedLeg->getLegDeltaV( ), newLeg->getLegDeltaV( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( reusedLeg->getThrustAccelerationAlongTrajectory( thrustEvaluationTime ),
+                                               newLeg->getThrustAccelerationAlongTrajectory( thrustEvaluationTime ),
+                                               1.0E-14 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( reusedLeg->getStateAlongTrajectory( thrustEvaluationTime ),
+                                               newLeg->getStateAlongTrajectory( thrustEvaluationTime ),
+                                               1.0E-14 );
+        }
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE( testMGATrajectory_New )
 {
     // Expected test result based on the ideal Cassini 1 trajectory as modelled by GTOP software
@@ -1487,6 +1578,141 @@ BOOST_AUTO_TEST_CASE( testMGA1DSMVFTrajectory2 )
 }
 
 
+//! Test evaluation of a transfer trajectory using independent workspaces, for single and batch evaluations.
+BOOST_AUTO_TEST_CASE( testTransferTrajectoryEvaluator )
+{
+    // Set transfer with DSM legs (ideal Cassini 2 trajectory, see testMGA1DSMVFTrajectory2)
+    std::vector< std::string > bodyOrder = { "Earth", "Venus", "Venus",  "Earth", "Jupiter", "Saturn" };
+    int numberOfNodes = bodyOrder.size( );
+
+    std::vector< std::shared_ptr< TransferLegSettings > > transferLegSettings;
+    std::vector< std::shared_ptr< TransferNodeSettings > > transferNodeSettings;
+    for( int i = 0; i < numberOfNodes - 1; i++ )
+    {
+        transferLegSettings.push_back( dsmVelocityBasedLeg( ) );
+    }
+    transferNodeSettings.push_back( escapeAndDepartureNode( std::numeric_limits< double >::infinity( ), 0.0 ) );
+    for( int i = 1; i < numberOfNodes - 1; i++ )
+    {
+        transferNodeSettings.push_back( swingbyNode( ) );
+    }
+    transferNodeSettings.push_back( captureAndInsertionNode( std::numeric_limits< double >::infinity( ), 0.0 ) );
+
+    double JD = physical_constants::JULIAN_DAY;
+    std::vector< double > nodeTimes;
+    nodeTimes.push_back( ( -779.046753814506 - 0.5 ) * JD );
+    nodeTimes.push_back( nodeTimes.at( 0 ) + 167.378952534645 * JD );
+    nodeTimes.push_back( nodeTimes.at( 1 ) + 424.028254165204 * JD );
+    nodeTimes.push_back( nodeTimes.at( 2 ) + 53.2897409769205  * JD );
+    nodeTimes.push_back( nodeTimes.at( 3 ) + 589.766954923325 * JD );
+    nodeTimes.push_back( nodeTimes.at( 4 ) + 2200.00000000000 * JD );
+
+    std::vector< Eigen::VectorXd > transferLegFreeParameters;
+    transferLegFreeParameters.push_back( ( Eigen::VectorXd( 1 ) << 0.769483451363201 ).finished( ) );
+    transferLegFreeParameters.push_back( ( Eigen::VectorXd( 1 ) << 0.513289529822621 ).finished( ) );
+    transferLegFreeParameters.push_back( ( Eigen::VectorXd( 1 ) << 0.0274175362264024 ).finished( ) );
+    transferLegFreeParameters.push_back( ( Eigen::VectorXd( 1 ) << 0.263985256705873 ).finished( ) );
+    transferLegFreeParameters.push_back( ( Eigen::VectorXd( 1 ) << 0.599984695281461 ).finished( ) );
+
+    std::vector< Eigen::VectorXd > transferNodeFreeParameters;
+    transferNodeFreeParameters.push_back( ( Eigen::VectorXd( 3 ) << 3259.11446832345, 0.525976214695235 * 2 * 3.14159265358979,
+                                            std::acos(  2 * 0.38086496458657 - 1 ) - 3.14159265358979 / 2 ).finished( ) );
+    transferNodeFreeParameters.push_back( ( Eigen::VectorXd( 3 ) << 1.34877968657176 * 6.052e6, -1.5937371121191, 0.0  ).finished( ) );
+    transferNodeFreeParameters.push_back( ( Eigen::VectorXd( 3 ) << 1.05 * 6.052e6, -1.95952512232447, 0.0  ).finished( ) );
+    transferNodeFreeParameters.push_back( ( Eigen::VectorXd( 3 ) << 1.30730278372017 * 6.378e6, -1.55498859283059, 0.0  ).finished( ) );
+    transferNodeFreeParameters.push_back( ( Eigen::VectorXd( 3 ) << 69.8090142993495 * 7.1492e7, -1.5134625299674, 0.0  ).finished( ) );
+    transferNodeFreeParameters.push_back( Eigen::VectorXd( 0 ) );
+
+    // Create full parameter vector (node times, 3 free parameters for each node except the last, 1 per leg)
+    std::vector< std::pair< int, int > > legParameterIndices, nodeParameterIndices;
+    getParameterVectorDecompositionIndices(
+                transferLegSettings, transferNodeSettings, legParameterIndices, nodeParameterIndices );
+    Eigen::VectorXd nominalParameters = Eigen::VectorXd::Zero( numberOfNodes + 4 * ( numberOfNodes - 1 ) );
+    for( int i = 0; i < numberOfNodes; i++ )
+    {
+        nominalParameters( i ) = nodeTimes.at( i );
+        nominalParameters.segment( nodeParameterIndices.at( i ).first, nodeParameterIndices.at( i ).second ) =
+                transferNodeFreeParameters.at( i );
+    }
+    for( int i = 0; i < numberOfNodes - 1; i++ )
+    {
+        nominalParameters.segment( legParameterIndices.at( i ).first, legParameterIndices.at( i ).second ) =
+                transferLegFreeParameters.at( i );
+    }
+
+    // Create batch of parameter vectors, with modified DSM times
+    int numberOfTrajectories = 20;
+    Eigen::MatrixXd parameterBatch = nominalParameters.replicate( 1, numberOfTrajectories );
+    for( int j = 0; j < numberOfTrajectories; j++ )
+    {
+        for( int i = 0; i < numberOfNodes - 1; i++ )
+        {
+            parameterBatch( legParameterIndices.at( i ).first, j ) =
+                    0.05 + 0.9 * static_cast< double >( ( 7 * j + 3 * i ) % numberOfTrajectories ) /
+                    static_cast< double >( numberOfTrajectories );
+        }
+    }
+
+    // Compute Delta V's using a single transfer trajectory, as reference
+    std::shared_ptr< TransferTrajectory > transferTrajectory = createTransferTrajectory(
+                createSimplifiedSystemOfBodies( ), transferLegSettings, transferNodeSettings, bodyOrder, "Sun" );
+    transferTrajectory->evaluateTrajectory( nodeTimes, transferLegFreeParameters, transferNodeFreeParameters );
+    double nominalDeltaV = transferTrajectory->getTotalDeltaV( );
+    BOOST_CHECK_CLOSE_FRACTION( 8385.15784516116, nominalDeltaV, 1.0E-3 );
+
+    Eigen::VectorXd expectedDeltaVs = Eigen::VectorXd::Zero( numberOfTrajectories );
+    for( int j = 0; j < numberOfTrajectories; j++ )
+    {
+        for( int i = 0; i < numberOfNodes - 1; i++ )
+        {
+            transferLegFreeParameters[ i ]( 0 ) = parameterBatch( legParameterIndices.at( i ).first, j );
+        }
+        transferTrajectory->evaluateTrajectory( nodeTimes, transferLegFreeParameters, transferNodeFreeParameters );
+        expectedDeltaVs( j ) = transferTrajectory->getTotalDeltaV( );
+    }
+
+    for( unsigned int numberOfWorkspaces = 1; numberOfWorkspaces <= 3; numberOfWorkspaces += 2 )
+    {
+        // Create evaluator, with independent bodies per workspace (approximate planet positions are not thread-safe)
+        TransferTrajectoryEvaluator trajectoryEvaluator(
+                    [ ]( const unsigned int ){ return createSimplifiedSystemOfBodies( ); },
+                    transferLegSettings, transferNodeSettings, bodyOrder, "Sun", numberOfWorkspaces );
+        BOOST_CHECK_EQUAL( trajectoryEvaluator.getNumberOfWorkspaces( ), numberOfWorkspaces );
+        BOOST_CHECK_EQUAL( trajectoryEvaluator.getNumberOfParameters( ), nominalParameters.rows( ) );
+
+        // Check single evaluation, and that workspace contains evaluated trajectory
+        BOOST_CHECK_EQUAL( trajectoryEvaluator.computeTotalDeltaV( nominalParameters, 0 ), nominalDeltaV );
+        BOOST_CHECK_EQUAL( trajectoryEvaluator.getTransferTrajectory( 0 )->getTotalDeltaV( ), nominalDeltaV );
+
+        // Check batch evaluation (twice, to check reuse of workspaces)
+        for( int k = 0; k < 2; k++ )
+        {
+            Eigen::VectorXd computedDeltaVs = trajectoryEvaluator.computeTotalDeltaVs( parameterBatch );
+            for( int j = 0; j < numberOfTrajectories; j++ )
+            {
+                BOOST_CHECK_EQUAL( computedDeltaVs( j ), expectedDeltaVs( j ) );
+            }
+        }
+
+        // Check concurrent single evaluations, from more threads than there are workspaces
+        Eigen::VectorXd computedDeltaVs = Eigen::VectorXd::Zero( numberOfTrajectories );
+        utilities::executeInParallel( numberOfTrajectories, [ & ]( const unsigned int j )
+        {
+            computedDeltaVs( j ) = trajectoryEvaluator.computeTotalDeltaV( parameterBatch.col( j ) );
+        }, 4 );
+        for( int j = 0; j < numberOfTrajectories; j++ )
+        {
+            BOOST_CHECK_EQUAL( computedDeltaVs( j ), expectedDeltaVs( j ) );
+        }
+
+        // Check that incorrect parameter vector size is detected
+        BOOST_CHECK_THROW( trajectoryEvaluator.computeTotalDeltaV( nominalParameters.segment( 0, 10 ) ),
+                           std::runtime_error );
+        BOOST_CHECK_THROW( trajectoryEvaluator.computeTotalDeltaVs( parameterBatch.topRows( 10 ) ),
+                           std::runtime_error );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,164 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/simulation/estimation_setup/observations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_observation_collection )
+
+//! Test whether observation sets and collections correctly store observations in concatenated format
+BOOST_AUTO_TEST_CASE( testObservationCollectionStorage )
+{
+    LinkEnds firstLinkEnds;
+    firstLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    firstLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    LinkEnds secondLinkEnds;
+    secondLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station2" );
+    secondLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = std::make_pair( "Spacecraft", "" );
+
+    // Create range observations, for two link ends (with two sets for first link ends)
+    std::vector< Eigen::VectorXd > firstRangeObservations;
+    std::vector< double > firstRangeTimes;
+    std::vector< Eigen::VectorXd > firstRangeDependentVariables;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        firstRangeObservations.push_back( Eigen::VectorXd::Constant( 1, 1.0E3 + static_cast< double >( i ) ) );
+        firstRangeTimes.push_back( 10.0 * static_cast< double >( i ) );
+        firstRangeDependentVariables.push_back( Eigen::Vector2d( static_cast< double >( i ), -static_cast< double >( i ) ) );
+    }
+    std::shared_ptr< SingleObservationSet< > > firstRangeSet = std::make_shared< SingleObservationSet< > >(
+                one_way_range, firstLinkEnds, firstRangeObservations, firstRangeTimes, receiver,
+                firstRangeDependentVariables );
+
+    Eigen::VectorXd secondRangeObservationsVector = Eigen::VectorXd::Zero( 3 );
+    secondRangeObservationsVector << 2.0E3, 2.0E3 + 1.0, 2.0E3 + 2.0;
+    std::vector< double > secondRangeTimes = { 100.0, 110.0, 120.0 };
+    std::shared_ptr< SingleObservationSet< > > secondRangeSet = std::make_shared< SingleObservationSet< > >(
+                one_way_range, firstLinkEnds, secondRangeObservationsVector, secondRangeTimes, receiver );
+
+    std::vector< Eigen::VectorXd > thirdRangeObservations = { Eigen::VectorXd::Constant( 1, 3.0E3 ) };
+    std::vector< double > thirdRangeTimes = { 50.0 };
+    std::shared_ptr< SingleObservationSet< > > thirdRangeSet = std::make_shared< SingleObservationSet< > >(
+                one_way_range, secondLinkEnds, thirdRangeObservations, thirdRangeTimes, receiver );
+
+    // Create position observations
+    Eigen::VectorXd positionObservationsVector = Eigen::VectorXd::Zero( 6 );
+    positionObservationsVector << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+    std::vector< double > positionTimes = { 200.0, 210.0 };
+    std::shared_ptr< SingleObservationSet< > > positionSet = std::make_shared< SingleObservationSet< > >(
+                position_observable, positionLinkEnds, positionObservationsVector, positionTimes, observed_body );
+
+    // Check single observation set
+    BOOST_CHECK_EQUAL( firstRangeSet->getNumberOfObservables( ), 4 );
+    BOOST_CHECK_EQUAL( firstRangeSet->getSingleObservableSize( ), 1 );
+    BOOST_CHECK_EQUAL( positionSet->getSingleObservableSize( ), 3 );
+    BOOST_CHECK_EQUAL( positionSet->getObservationsVector( ).rows( ), 6 );
+    BOOST_CHECK( positionSet->getObservation( 1 ) == Eigen::Vector3d( 4.0, 5.0, 6.0 ) );
+    BOOST_CHECK( positionSet->getObservations( ).at( 0 ) == Eigen::Vector3d( 1.0, 2.0, 3.0 ) );
+    BOOST_CHECK( positionSet->getObservationsHistory( ).at( 210.0 ) == Eigen::Vector3d( 4.0, 5.0, 6.0 ) );
+    BOOST_CHECK_EQUAL( firstRangeSet->getObservationsDependentVariablesMatrix( ).rows( ), 2 );
+    BOOST_CHECK_EQUAL( firstRangeSet->getObservationsDependentVariablesMatrix( ).cols( ), 4 );
+    BOOST_CHECK( firstRangeSet->getDependentVariableHistory( ).at( 30.0 ) == Eigen::Vector2d( 3.0, -3.0 ) );
+    BOOST_CHECK( firstRangeSet->getObservationsDependentVariables( ).at( 2 ) == Eigen::Vector2d( 2.0, -2.0 ) );
+
+    // Check inconsistent input
+    BOOST_CHECK_THROW( std::make_shared< SingleObservationSet< > >(
+                           position_observable, positionLinkEnds, Eigen::VectorXd::Zero( 5 ), positionTimes, observed_body ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( std::make_shared< SingleObservationSet< > >(
+                           one_way_range, firstLinkEnds, secondRangeObservationsVector, secondRangeTimes, receiver,
+                           Eigen::MatrixXd::Zero( 2, 2 ) ), std::runtime_error );
+
+    // Create collection
+    ObservationCollection< >::SortedObservationSets sortedObservations;
+    sortedObservations[ one_way_range ][ firstLinkEnds ] = { firstRangeSet, secondRangeSet };
+    sortedObservations[ one_way_range ][ secondLinkEnds ] = { thirdRangeSet };
+    sortedObservations[ position_observable ][ positionLinkEnds ] = { positionSet };
+    ObservationCollection< > observationCollection( sortedObservations );
+
+    BOOST_CHECK_EQUAL( observationCollection.getTotalObservableSize( ), 14 );
+    const Eigen::VectorXd& concatenatedObservations = observationCollection.getObservationVector( );
+    const std::vector< double >& concatenatedTimes = observationCollection.getConcatenatedTimeVector( );
+    const std::vector< int >& concatenatedLinkEndIds = observationCollection.getConcatenatedLinkEndIds( );
+    const std::vector< ObservableType >& concatenatedObservableTypes = observationCollection.getConcatenatedObservableTypes( );
+    BOOST_CHECK_EQUAL( concatenatedObservations.rows( ), 14 );
+    BOOST_CHECK_EQUAL( concatenatedTimes.size( ), 14 );
+    BOOST_CHECK_EQUAL( concatenatedLinkEndIds.size( ), 14 );
+    BOOST_CHECK_EQUAL( concatenatedObservableTypes.size( ), 14 );
+
+    // Check index ranges, and consistency of concatenated data with observation sets
+    const std::map< ObservableType, std::map< LinkEnds, std::vector< std::pair< int, int > > > >& setStartAndSize =
+            observationCollection.getObservationSetStartAndSize( );
+    const std::map< LinkEnds, int >& linkEndIds = observationCollection.getLinkEndIdentifierMap( );
+    std::vector< LinkEnds > concatenatedLinkEndIdNames = observationCollection.getConcatenatedLinkEndIdNames( );
+    for( const auto& observableIterator : sortedObservations )
+    {
+        int observableSize = getObservableSize( observableIterator.first );
+        for( const auto& linkEndIterator : observableIterator.second )
+        {
+            for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+            {
+                std::pair< int, int > startAndSize = setStartAndSize.at( observableIterator.first ).at( linkEndIterator.first ).at( i );
+                const std::shared_ptr< SingleObservationSet< > >& currentSet = linkEndIterator.second.at( i );
+                BOOST_CHECK_EQUAL( startAndSize.second, currentSet->getObservationsVector( ).rows( ) );
+                BOOST_CHECK( concatenatedObservations.segment( startAndSize.first, startAndSize.second ) ==
+                             currentSet->getObservationsVector( ) );
+                for( int j = 0; j < startAndSize.second; j++ )
+                {
+                    int index = startAndSize.first + j;
+                    BOOST_CHECK_EQUAL( concatenatedTimes.at( index ), currentSet->getObservationTimes( ).at( j / observableSize ) );
+                    BOOST_CHECK_EQUAL( concatenatedLinkEndIds.at( index ), linkEndIds.at( linkEndIterator.first ) );
+                    BOOST_CHECK( concatenatedLinkEndIdNames.at( index ) == linkEndIterator.first );
+                    BOOST_CHECK_EQUAL( concatenatedObservableTypes.at( index ), observableIterator.first );
+                }
+            }
+        }
+    }
+
+    // Check per-type and per-link ranges
+    BOOST_CHECK_EQUAL( observationCollection.getObservationTypeStartAndSize( ).at( one_way_range ).second, 8 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationTypeStartAndSize( ).at( position_observable ).second, 6 );
+    std::pair< int, int > firstLinkStartAndSize =
+            observationCollection.getSingleLinkStartAndSize( one_way_range, firstLinkEnds );
+    BOOST_CHECK_EQUAL( firstLinkStartAndSize.second, 7 );
+    BOOST_CHECK( observationCollection.getSingleLinkObservations( one_way_range, firstLinkEnds ) ==
+                 concatenatedObservations.segment( firstLinkStartAndSize.first, firstLinkStartAndSize.second ) );
+    std::vector< double > firstLinkTimes = observationCollection.getSingleLinkTimes( one_way_range, firstLinkEnds );
+    BOOST_CHECK_EQUAL( firstLinkTimes.size( ), 7 );
+    BOOST_CHECK_EQUAL( firstLinkTimes.at( 4 ), 100.0 );
+    BOOST_CHECK_THROW( observationCollection.getSingleLinkStartAndSize( one_way_doppler, firstLinkEnds ), std::runtime_error );
+    BOOST_CHECK_THROW( observationCollection.getSingleLinkStartAndSize( position_observable, firstLinkEnds ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
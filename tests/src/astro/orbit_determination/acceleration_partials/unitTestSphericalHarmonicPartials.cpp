@@ -938,6 +938,112 @@ BOOST_AUTO_TEST_CASE( testSphericalHarmonicAccelerationPartialWithSynchronousRot
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtEarthVelocity, partialWrtEarthVelocity, 1.0E-3 );
 
 }
+
+//! Test partials of spherical harmonic acceleration computed with the Pines formulation
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicAccelerationPartialPinesFormulation )
+{
+    const double gravitationalParameter = 3.986004418e14;
+    const double planetaryRadius = 6378137.0;
+
+    // Define (arbitrary) geodesy-normalized coefficients up to degree and order 12.
+    const int maximumDegree = 12;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-5 * std::sin( 3.0 * degree + order ) / degree;
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-5 * std::cos( degree + 5.0 * order ) / degree;
+            }
+        }
+    }
+
+    const Eigen::Quaterniond rotationToInertialFrame = Eigen::Quaterniond(
+                Eigen::AngleAxisd( 0.4, Eigen::Vector3d::UnitZ( ) ) * Eigen::AngleAxisd( -1.1, Eigen::Vector3d::UnitX( ) ) );
+    Eigen::Vector3d position( 7.0e6, -3.0e6, 4.5e6 );
+
+    // Create acceleration models and partials for formulation in spherical coordinates and Pines formulation
+    std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > gravityModels;
+    std::vector< std::shared_ptr< SphericalHarmonicsGravityPartial > > gravityPartials;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        gravityModels.push_back( std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                    [ & ]( Eigen::Vector3d& input ){ input = position; },
+                    [ = ]( ){ return gravitationalParameter; }, planetaryRadius,
+                    [ = ]( ){ return cosineCoefficients; }, [ = ]( ){ return sineCoefficients; },
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+                    [ = ]( ){ return rotationToInertialFrame; }, false ) );
+        if( i == 1 )
+        {
+            gravityModels.at( i )->setGravityFormulation( pines_formulation );
+        }
+        gravityPartials.push_back( std::make_shared< SphericalHarmonicsGravityPartial >(
+                                       "Vehicle", "Earth", gravityModels.at( i ),
+                                       observation_partials::RotationMatrixPartialNamedList( ),
+                                       std::vector< std::shared_ptr< TidalLoveNumberPartialInterface > >( ) ) );
+        gravityPartials.at( i )->update( 0.0 );
+    }
+
+    // Compare partials w.r.t. position
+    Eigen::Matrix3d expectedPartial = gravityPartials.at( 0 )->getCurrentPartialWrtPosition( );
+    Eigen::Matrix3d computedPartial = gravityPartials.at( 1 )->getCurrentPartialWrtPosition( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedPartial, computedPartial, 1.0E-12 );
+
+    // Compare partials w.r.t. coefficients
+    std::vector< std::pair< int, int > > cosineBlockIndices = { { 2, 0 }, { 2, 1 }, { 5, 3 }, { 12, 12 } };
+    std::vector< std::pair< int, int > > sineBlockIndices = { { 2, 1 }, { 3, 3 }, { 8, 2 }, { 12, 11 } };
+    std::vector< Eigen::MatrixXd > cosineCoefficientPartials, sineCoefficientPartials;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > cosineParameter =
+                std::make_shared< SphericalHarmonicsCosineCoefficients >(
+                    [ = ]( ){ return cosineCoefficients; }, [ ]( Eigen::MatrixXd ){ }, cosineBlockIndices, "Earth" );
+        std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > sineParameter =
+                std::make_shared< SphericalHarmonicsSineCoefficients >(
+                    [ = ]( ){ return sineCoefficients; }, [ ]( Eigen::MatrixXd ){ }, sineBlockIndices, "Earth" );
+
+        cosineCoefficientPartials.push_back( Eigen::MatrixXd::Zero( 3, cosineBlockIndices.size( ) ) );
+        gravityPartials.at( i )->getParameterPartialFunction( cosineParameter ).first(
+                    cosineCoefficientPartials.at( i ) );
+        sineCoefficientPartials.push_back( Eigen::MatrixXd::Zero( 3, sineBlockIndices.size( ) ) );
+        gravityPartials.at( i )->getParameterPartialFunction( sineParameter ).first(
+                    sineCoefficientPartials.at( i ) );
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( cosineCoefficientPartials.at( 0 ), cosineCoefficientPartials.at( 1 ), 1.0E-12 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( sineCoefficientPartials.at( 0 ), sineCoefficientPartials.at( 1 ), 1.0E-12 );
+
+    // Compare partial w.r.t. position directly over the pole (where the spherical formulation is singular) with
+    // numerical partial
+    const Eigen::Vector3d polePosition = rotationToInertialFrame * Eigen::Vector3d( 0.0, 0.0, 7.0e6 );
+    position = polePosition;
+    gravityPartials.at( 1 )->update( 1.0 );
+    computedPartial = gravityPartials.at( 1 )->getCurrentPartialWrtPosition( );
+
+    Eigen::Matrix3d numericalPartial;
+    const double positionPerturbation = 10.0;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        position = polePosition + positionPerturbation * Eigen::Vector3d::Unit( i );
+        gravityModels.at( 1 )->resetCurrentTime( );
+        gravityModels.at( 1 )->updateMembers( 2.0 );
+        Eigen::Vector3d upPerturbedAcceleration = gravityModels.at( 1 )->getAcceleration( );
+
+        position = polePosition - positionPerturbation * Eigen::Vector3d::Unit( i );
+        gravityModels.at( 1 )->resetCurrentTime( );
+        gravityModels.at( 1 )->updateMembers( 2.0 );
+        Eigen::Vector3d downPerturbedAcceleration = gravityModels.at( 1 )->getAcceleration( );
+
+        numericalPartial.block( 0, i, 3, 1 ) =
+                ( upPerturbedAcceleration - downPerturbedAcceleration ) / ( 2.0 * positionPerturbation );
+    }
+    BOOST_CHECK( computedPartial.allFinite( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedPartial, numericalPartial, 1.0E-6 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
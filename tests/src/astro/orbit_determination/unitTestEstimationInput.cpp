@@ -170,6 +170,75 @@ BOOST_AUTO_TEST_CASE( test_CovarianceAsFunctionOfTime )
     }
 }
 
+//! Test whether accumulating the normal equations per block of observations reproduces the estimation with the full
+//! matrix of partials
+BOOST_AUTO_TEST_CASE( test_NormalEquationsAccumulation )
+{
+    std::pair< std::shared_ptr< PodOutput< double > >, std::shared_ptr< PodInput< double, double > > > fullPartialsPodData;
+    std::pair< std::shared_ptr< PodOutput< double > >, std::shared_ptr< PodInput< double, double > > > accumulatedPodData;
+
+    std::string partialsFileName = "normalEquationsAccumulationPartials.dat";
+
+    // Perform estimation with full partials matrix, and with accumulated normal equations
+    executeEarthOrbiterParameterEstimation< double, double >(
+                fullPartialsPodData, 1.0E7, 1, 2, false );
+    executeEarthOrbiterParameterEstimation< double, double >(
+                accumulatedPodData, 1.0E7, 1, 2, false, true, partialsFileName );
+
+    std::shared_ptr< PodOutput< double > > fullPartialsOutput = fullPartialsPodData.first;
+    std::shared_ptr< PodOutput< double > > accumulatedOutput = accumulatedPodData.first;
+
+    // Check that results are consistent
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullPartialsOutput->informationMatrixTransformationDiagonal_,
+                                       accumulatedOutput->informationMatrixTransformationDiagonal_, 1.0E-14 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullPartialsOutput->getUnnormalizedInverseCovarianceMatrix( ),
+                                       accumulatedOutput->getUnnormalizedInverseCovarianceMatrix( ), 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullPartialsOutput->residuals_, accumulatedOutput->residuals_, 1.0E-8 );
+    for( int i = 0; i < fullPartialsOutput->parameterEstimate_.rows( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( fullPartialsOutput->parameterEstimate_( i ), accumulatedOutput->parameterEstimate_( i ), 1.0E-10 );
+    }
+
+    // Check that full partials are not stored, but can be retrieved from file
+    BOOST_CHECK_EQUAL( accumulatedOutput->normalizedInformationMatrix_.rows( ), 0 );
+    Eigen::MatrixXd fullPartials = fullPartialsOutput->getUnnormalizedInformationMatrix( );
+    int numberOfRowsToRead = fullPartials.rows( ) / 3;
+    Eigen::MatrixXd partialsFromFile = accumulatedOutput->getUnnormalizedInformationMatrixBlockFromFile(
+                numberOfRowsToRead, numberOfRowsToRead );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullPartials.block( numberOfRowsToRead, 0, numberOfRowsToRead, fullPartials.cols( ) ),
+                                       partialsFromFile, 1.0E-14 );
+    BOOST_CHECK_THROW( accumulatedOutput->getUnnormalizedInformationMatrixBlockFromFile( fullPartials.rows( ), 1 ),
+                       std::runtime_error );
+
+    std::remove( partialsFileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_CASE( test_ConcurrentObservationProcessing )
+{
+    std::pair< std::shared_ptr< PodOutput< double > >, std::shared_ptr< PodInput< double, double > > > serialPodData;
+    std::pair< std::shared_ptr< PodOutput< double > >, std::shared_ptr< PodInput< double, double > > > concurrentPodData;
+
+    for( unsigned int accumulationCase = 0; accumulationCase < 2; accumulationCase++ )
+    {
+        // Perform estimation with observations/partials computed on single thread, and on multiple threads
+        executeEarthOrbiterParameterEstimation< double, double >(
+                    serialPodData, 1.0E7, 1, 2, false, accumulationCase == 1, "", 1 );
+        executeEarthOrbiterParameterEstimation< double, double >(
+                    concurrentPodData, 1.0E7, 1, 2, false, accumulationCase == 1, "", 4 );
+
+        std::shared_ptr< PodOutput< double > > serialOutput = serialPodData.first;
+        std::shared_ptr< PodOutput< double > > concurrentOutput = concurrentPodData.first;
+
+        // Full partials matrix is written to disjoint rows, and accumulated normal equations are summed in task order,
+        // so results must be identical
+        BOOST_CHECK( serialOutput->residuals_ == concurrentOutput->residuals_ );
+        BOOST_CHECK( serialOutput->normalizedInformationMatrix_ == concurrentOutput->normalizedInformationMatrix_ );
+        BOOST_CHECK( serialOutput->getUnnormalizedInverseCovarianceMatrix( ) ==
+                     concurrentOutput->getUnnormalizedInverseCovarianceMatrix( ) );
+        BOOST_CHECK( serialOutput->parameterEstimate_ == concurrentOutput->parameterEstimate_ );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
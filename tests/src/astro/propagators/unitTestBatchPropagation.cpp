@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/astro/basic_astro/massRateModel.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup/batchPropagation.h"
+#include "tudat/simulation/propagation_setup/createAccelerationModels.h"
+
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::simulation_setup;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_batch_propagation )
+
+//! Function to create independent mass propagation setup for a batch propagation worker, in which the initial mass and
+//! (constant) mass rate of the vehicle are modified per sample.
+std::shared_ptr< SingleArcBatchPropagationWorkerSetup< > > createMassPropagationWorkerSetup( )
+{
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Vehicle" );
+
+    // Create mass rate model, with mass rate that is reset per sample
+    std::shared_ptr< double > currentMassRate = std::make_shared< double >( 0.0 );
+    std::map< std::string, std::vector< std::shared_ptr< basic_astrodynamics::MassRateModel > > > massRateModels;
+    massRateModels[ "Vehicle" ].push_back( std::make_shared< basic_astrodynamics::CustomMassRateModel >(
+                [ = ]( const double ){ return *currentMassRate; } ) );
+
+    std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            massPropagatorSettings< double >(
+                std::vector< std::string >{ "Vehicle" }, massRateModels, Eigen::VectorXd::Constant( 1, 500.0 ), 0.0,
+                std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 ),
+                std::make_shared< PropagationTimeTerminationSettings >( 1000.0 ) );
+
+    // Set initial mass and mass rate from sample index
+    std::function< void( const unsigned int ) > sampleSetupFunction = [ = ]( const unsigned int sampleIndex )
+    {
+        *currentMassRate = -0.01 * static_cast< double >( 1 + sampleIndex % 3 );
+        propagatorSettings->resetInitialStates(
+                    Eigen::VectorXd::Constant( 1, 500.0 + static_cast< double >( sampleIndex ) ) );
+    };
+
+    return std::make_shared< SingleArcBatchPropagationWorkerSetup< > >(
+                bodies, propagatorSettings, sampleSetupFunction );
+}
+
+//! Test whether batch propagation with multiple workers gives same results as propagation on a single worker
+BOOST_AUTO_TEST_CASE( testBatchMassPropagation )
+{
+    unsigned int numberOfSamples = 50;
+    std::map< unsigned int, std::map< double, Eigen::VectorXd > > serialResults;
+    std::map< unsigned int, std::map< double, Eigen::VectorXd > > parallelResults;
+    for( unsigned int numberOfWorkers = 1; numberOfWorkers <= 4; numberOfWorkers += 3 )
+    {
+        std::map< unsigned int, std::map< double, Eigen::VectorXd > >& currentResults =
+                ( numberOfWorkers == 1 ) ? serialResults : parallelResults;
+
+        SingleArcBatchPropagator< > batchPropagator(
+                    [ ]( const unsigned int ){ return createMassPropagationWorkerSetup( ); }, numberOfWorkers );
+        BOOST_CHECK_EQUAL( batchPropagator.getNumberOfWorkers( ), numberOfWorkers );
+
+        // Propagate twice, to check reuse of workers
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            unsigned int numberOfCollectedSamples = 0;
+            batchPropagator.propagateSamples(
+                        numberOfSamples, [ & ]( const unsigned int sampleIndex,
+                        const std::shared_ptr< SingleArcPropagatorResults< > > results )
+            {
+                BOOST_CHECK( results->integrationCompletedSuccessfully( ) );
+                currentResults[ sampleIndex ] = results->getEquationsOfMotionNumericalSolution( );
+                numberOfCollectedSamples++;
+            } );
+            BOOST_CHECK_EQUAL( numberOfCollectedSamples, numberOfSamples );
+            BOOST_CHECK_EQUAL( currentResults.size( ), numberOfSamples );
+        }
+    }
+
+    // Check results against analytical solution, and compare results of serial and parallel propagation
+    for( unsigned int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_EQUAL( serialResults.at( i ).size( ), 101 );
+        double massRate = -0.01 * static_cast< double >( 1 + i % 3 );
+        for( auto stateIterator : serialResults.at( i ) )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( stateIterator.second( 0 ),
+                                        500.0 + static_cast< double >( i ) + massRate * stateIterator.first, 1.0E-13 );
+        }
+        BOOST_CHECK( serialResults.at( i ) == parallelResults.at( i ) );
+    }
+}
+
+//! Test whether batch propagation with cloned bodies gives same results as propagation on a single worker
+BOOST_AUTO_TEST_CASE( testBatchTranslationalPropagationFromClonedBodies )
+{
+    const double earthGravitationalParameter = 3.986004418E14;
+
+    // Create environment
+    SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth" );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( earthGravitationalParameter ) );
+    bodies.createEmptyBody( "Vehicle" );
+
+    // Create acceleration models and propagator settings for original bodies
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::point_mass_gravity ) );
+    basic_astrodynamics::AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, std::vector< std::string >{ "Vehicle" },
+                std::vector< std::string >{ "Earth" } );
+
+    Eigen::VectorXd nominalInitialState = Eigen::VectorXd::Zero( 6 );
+    nominalInitialState << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 0.1E3;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                std::vector< std::string >{ "Earth" }, accelerationModels, std::vector< std::string >{ "Vehicle" },
+                nominalInitialState, 0.0, std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 ),
+                std::make_shared< PropagationTimeTerminationSettings >( 1000.0 ) );
+
+    // Set initial velocity from sample index
+    std::function< void( const unsigned int, SingleArcBatchPropagationWorkerSetup< >& ) > sampleSetupFunction =
+            [ = ]( const unsigned int sampleIndex, SingleArcBatchPropagationWorkerSetup< >& workerSetup )
+    {
+        Eigen::VectorXd initialState = nominalInitialState;
+        initialState( 4 ) += static_cast< double >( sampleIndex );
+        workerSetup.propagatorSettings_->resetInitialStates( initialState );
+    };
+
+    unsigned int numberOfSamples = 20;
+    std::map< unsigned int, std::map< double, Eigen::VectorXd > > serialResults;
+    std::map< unsigned int, std::map< double, Eigen::VectorXd > > parallelResults;
+    for( unsigned int numberOfWorkers = 1; numberOfWorkers <= 3; numberOfWorkers += 2 )
+    {
+        std::map< unsigned int, std::map< double, Eigen::VectorXd > >& currentResults =
+                ( numberOfWorkers == 1 ) ? serialResults : parallelResults;
+
+        SingleArcBatchPropagator< > batchPropagator(
+                    bodies, accelerationSettings, propagatorSettings, sampleSetupFunction, numberOfWorkers );
+        BOOST_CHECK_EQUAL( batchPropagator.getNumberOfWorkers( ), numberOfWorkers );
+
+        // Check that each worker has its own bodies and propagator settings
+        for( unsigned int i = 0; i < numberOfWorkers; i++ )
+        {
+            std::shared_ptr< SingleArcBatchPropagationWorkerSetup< > > workerSetup = batchPropagator.getWorkerSetup( i );
+            BOOST_CHECK( workerSetup->bodies_.at( "Vehicle" ) != bodies.at( "Vehicle" ) );
+            BOOST_CHECK( workerSetup->propagatorSettings_ != propagatorSettings );
+            for( unsigned int j = 0; j < i; j++ )
+            {
+                BOOST_CHECK( workerSetup->bodies_.at( "Earth" ) !=
+                             batchPropagator.getWorkerSetup( j )->bodies_.at( "Earth" ) );
+            }
+        }
+
+        batchPropagator.propagateSamples(
+                    numberOfSamples, [ & ]( const unsigned int sampleIndex,
+                    const std::shared_ptr< SingleArcPropagatorResults< > > results )
+        {
+            BOOST_CHECK( results->integrationCompletedSuccessfully( ) );
+            currentResults[ sampleIndex ] = results->getEquationsOfMotionNumericalSolution( );
+        } );
+        BOOST_CHECK_EQUAL( currentResults.size( ), numberOfSamples );
+    }
+
+    // Check conservation of energy, and compare results of serial and parallel propagation
+    for( unsigned int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_EQUAL( serialResults.at( i ).size( ), 101 );
+        BOOST_CHECK_CLOSE_FRACTION( serialResults.at( i ).begin( )->second( 4 ),
+                                    nominalInitialState( 4 ) + static_cast< double >( i ), 1.0E-15 );
+        double initialEnergy = 0.5 * serialResults.at( i ).begin( )->second.segment( 3, 3 ).squaredNorm( ) -
+                earthGravitationalParameter / serialResults.at( i ).begin( )->second.segment( 0, 3 ).norm( );
+        double finalEnergy = 0.5 * serialResults.at( i ).rbegin( )->second.segment( 3, 3 ).squaredNorm( ) -
+                earthGravitationalParameter / serialResults.at( i ).rbegin( )->second.segment( 0, 3 ).norm( );
+        BOOST_CHECK_CLOSE_FRACTION( initialEnergy, finalEnergy, 1.0E-8 );
+        BOOST_CHECK( serialResults.at( i ) == parallelResults.at( i ) );
+    }
+}
+
+//! Test whether exceptions thrown during batch propagation are propagated to the calling thread
+BOOST_AUTO_TEST_CASE( testBatchPropagationExceptions )
+{
+    SingleArcBatchPropagator< > batchPropagator(
+                [ ]( const unsigned int )
+    {
+        std::shared_ptr< SingleArcBatchPropagationWorkerSetup< > > workerSetup = createMassPropagationWorkerSetup( );
+        std::function< void( const unsigned int ) > originalSampleSetupFunction = workerSetup->sampleSetupFunction_;
+        workerSetup->sampleSetupFunction_ = [ = ]( const unsigned int sampleIndex )
+        {
+            if( sampleIndex == 5 )
+            {
+                throw std::runtime_error( "Invalid sample" );
+            }
+            originalSampleSetupFunction( sampleIndex );
+        };
+        return workerSetup;
+    }, 2 );
+
+    BOOST_CHECK_THROW( batchPropagator.propagateSamples(
+                           20, [ ]( const unsigned int, const std::shared_ptr< SingleArcPropagatorResults< > > ){ } ),
+                       std::runtime_error );
+
+    // Check that workers with identical settings are rejected
+    std::shared_ptr< SingleArcBatchPropagationWorkerSetup< > > sharedWorkerSetup = createMassPropagationWorkerSetup( );
+    BOOST_CHECK_THROW( SingleArcBatchPropagator< >(
+                           [ = ]( const unsigned int ){ return sharedWorkerSetup; }, 2 ), std::runtime_error );
+
+    // Check that workers with different settings, but shared bodies, are rejected
+    BOOST_CHECK_THROW( SingleArcBatchPropagator< >(
+                           [ = ]( const unsigned int )
+    {
+        std::shared_ptr< SingleArcBatchPropagationWorkerSetup< > > workerSetup = createMassPropagationWorkerSetup( );
+        return std::make_shared< SingleArcBatchPropagationWorkerSetup< > >(
+                    sharedWorkerSetup->bodies_, workerSetup->propagatorSettings_, workerSetup->sampleSetupFunction_ );
+    }, 2 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,142 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/propagators/dependentVariableListEvaluator.h"
+#include "tudat/astro/propagators/integrateEquations.h"
+#include "tudat/math/integrators/rungeKutta4Integrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_dependent_variable_list_evaluator )
+
+//! Test whether dependent variables are correctly concatenated, and directly written into a contiguous history
+BOOST_AUTO_TEST_CASE( testDependentVariableListEvaluator )
+{
+    double currentValue = 2.0;
+
+    DependentVariableListEvaluator evaluator;
+    evaluator.addScalarVariable( [ & ]( ){ return currentValue; } );
+    evaluator.addVectorVariable( [ & ]( Eigen::Ref< Eigen::VectorXd > variable ){ variable << 1.0, currentValue, 3.0; }, 3 );
+    evaluator.addScalarVariable( [ & ]( ){ return -currentValue; } );
+    BOOST_CHECK_EQUAL( evaluator.getTotalSize( ), 5 );
+
+    Eigen::VectorXd expectedValues = Eigen::VectorXd::Zero( 5 );
+    expectedValues << 2.0, 1.0, 2.0, 3.0, -2.0;
+    BOOST_CHECK( evaluator.evaluate( ) == expectedValues );
+
+    // Write values directly into history
+    utilities::ContiguousHistory< double, double > history;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        currentValue = static_cast< double >( i );
+        evaluator.evaluate( history.addEntry( currentValue, 5, 1 ) );
+    }
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        currentValue = static_cast< double >( i );
+        BOOST_CHECK( history.at( currentValue ) == evaluator.evaluate( ) );
+    }
+
+    // Check that inconsistent output size is detected
+    Eigen::VectorXd wrongSizeOutput = Eigen::VectorXd::Zero( 4 );
+    BOOST_CHECK_THROW( evaluator.evaluate( wrongSizeOutput ), std::runtime_error );
+    BOOST_CHECK_THROW( history.addEntry( 10.0, 4, 1 ), std::runtime_error );
+}
+
+//! Test whether integration with dependent variables evaluated in-place is identical to function-based evaluation
+BOOST_AUTO_TEST_CASE( testInPlaceDependentVariablesDuringIntegration )
+{
+    typedef numerical_integrators::RungeKutta4Integrator< double, Eigen::MatrixXd, Eigen::MatrixXd > IntegratorType;
+
+    // Harmonic oscillator, with dependent variables retrieved from last state derivative evaluation
+    Eigen::MatrixXd lastState;
+    std::function< Eigen::MatrixXd( const double, const Eigen::MatrixXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::MatrixXd& state )
+    {
+        lastState = state;
+        Eigen::MatrixXd stateDerivative = Eigen::MatrixXd::Zero( 2, 1 );
+        stateDerivative << state( 1, 0 ), -state( 0, 0 );
+        return stateDerivative;
+    };
+
+    std::shared_ptr< DependentVariableListEvaluator > evaluator = std::make_shared< DependentVariableListEvaluator >( );
+    evaluator->addScalarVariable( [ & ]( ){ return lastState( 0, 0 ) * lastState( 0, 0 ) + lastState( 1, 0 ) * lastState( 1, 0 ); } );
+    evaluator->addVectorVariable( [ & ]( Eigen::Ref< Eigen::VectorXd > variable ){ variable = -lastState.col( 0 ); }, 2 );
+
+    for( unsigned int exactTerminationCase = 0; exactTerminationCase < 2; exactTerminationCase++ )
+    {
+        Eigen::MatrixXd initialState = Eigen::MatrixXd::Zero( 2, 1 );
+        initialState << 1.0, 0.0;
+
+        // Propagate with function-based dependent variables into maps
+        std::map< double, Eigen::MatrixXd > stateHistory;
+        std::map< double, Eigen::VectorXd > dependentVariableHistory;
+        std::map< double, double > computationTimeHistory;
+        integrateEquationsFromIntegrator< Eigen::MatrixXd, double, double >(
+                    std::make_shared< IntegratorType >( stateDerivativeFunction, 0.0, initialState ), 0.1,
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 10.05, true, exactTerminationCase == 1 ),
+                    stateHistory, dependentVariableHistory, computationTimeHistory,
+                    std::bind( static_cast< Eigen::VectorXd( DependentVariableListEvaluator::* )( ) const >(
+                                   &DependentVariableListEvaluator::evaluate ), evaluator ),
+                    std::function< void( Eigen::MatrixXd& ) >( ), 1 );
+
+        // Propagate with dependent variables evaluated directly into contiguous histories
+        utilities::ContiguousHistory< double, double > contiguousStateHistory;
+        utilities::ContiguousHistory< double, double > contiguousDependentVariableHistory;
+        utilities::ContiguousHistory< double, double > contiguousComputationTimeHistory;
+        integrateEquationsFromIntegrator< Eigen::MatrixXd, double, double >(
+                    std::make_shared< IntegratorType >( stateDerivativeFunction, 0.0, initialState ), 0.1,
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 10.05, true, exactTerminationCase == 1 ),
+                    contiguousStateHistory, contiguousDependentVariableHistory, contiguousComputationTimeHistory,
+                    evaluator, std::function< void( Eigen::MatrixXd& ) >( ), 1 );
+
+        // Propagate with dependent variables evaluated directly into map entries
+        std::map< double, Eigen::MatrixXd > directStateHistory;
+        std::map< double, Eigen::VectorXd > directDependentVariableHistory;
+        std::map< double, double > directComputationTimeHistory;
+        integrateEquationsFromIntegratorToHistories(
+                    std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > >(
+                        std::make_shared< IntegratorType >( stateDerivativeFunction, 0.0, initialState ) ), 0.1,
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 10.05, true, exactTerminationCase == 1 ),
+                    directStateHistory, directDependentVariableHistory, directComputationTimeHistory,
+                    evaluator, std::function< void( Eigen::MatrixXd& ) >( ), 1, TUDAT_NAN,
+                    std::chrono::steady_clock::now( ), false );
+
+        BOOST_CHECK_EQUAL( contiguousDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+        BOOST_CHECK_EQUAL( directDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+        for( auto mapEntry : dependentVariableHistory )
+        {
+            BOOST_CHECK( contiguousDependentVariableHistory.at( mapEntry.first ) == mapEntry.second );
+            BOOST_CHECK( directDependentVariableHistory.at( mapEntry.first ) == mapEntry.second );
+            BOOST_CHECK( mapEntry.second.segment( 1, 2 ) == -stateHistory.at( mapEntry.first ).col( 0 ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
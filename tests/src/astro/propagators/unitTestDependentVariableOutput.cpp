@@ -35,6 +35,7 @@ using namespace boost::placeholders;
 #include <limits>
 #include <string>
 #include "tudat/astro/basic_astro/celestialBodyConstants.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
 
 #include <Eigen/Core>
 
@@ -1865,6 +1866,83 @@ BOOST_AUTO_TEST_CASE( test_ConstellationVariables )
 
 }
 
+//! Test whether propagation results stored in contiguous memory are identical to those stored in maps, for forward and
+//! backward propagation, and for propagators for which the propagated and conventional states differ
+BOOST_AUTO_TEST_CASE( testContiguousHistoryStorageOutput )
+{
+    // Create point mass Earth and vehicle
+    SystemOfBodies bodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Earth" );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ConstantEphemeris >(
+                                            Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodies.createEmptyBody( "Vehicle" );
+
+    SelectedAccelerationMap accelerationSettings;
+    accelerationSettings[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    AccelerationMap accelerationModels = createAccelerationModelsMap(
+                bodies, accelerationSettings, std::vector< std::string >{ "Vehicle" }, std::vector< std::string >{ "Earth" } );
+
+    Eigen::Vector6d initialState;
+    initialState << 7.0E6, 0.0, 0.0, 0.0, 7.5E3, 0.1E3;
+
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( relativePositionDependentVariable( "Vehicle", "Earth" ) );
+    dependentVariables.push_back( relativeDistanceDependentVariable( "Vehicle", "Earth" ) );
+
+    for( TranslationalPropagatorType propagatorType : { cowell, gauss_keplerian } )
+    {
+        for( double timeStep : { 10.0, -10.0 } )
+        {
+            std::vector< std::shared_ptr< SingleArcPropagatorResults< double, double > > > propagationResults;
+            for( bool useContiguousHistoryStorage : { false, true } )
+            {
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        translationalStatePropagatorSettings< double >(
+                            std::vector< std::string >{ "Earth" }, accelerationModels, std::vector< std::string >{ "Vehicle" },
+                            initialState, 0.0, std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, timeStep ),
+                            std::make_shared< PropagationTimeTerminationSettings >( 1000.0 * timeStep, true ),
+                            propagatorType, dependentVariables );
+                propagatorSettings->getOutputSettings( )->setUseContiguousHistoryStorage( useContiguousHistoryStorage );
+
+                SingleArcDynamicsSimulator< double, double > dynamicsSimulator( bodies, propagatorSettings );
+                propagationResults.push_back( dynamicsSimulator.getPropagationResults( ) );
+                BOOST_CHECK_EQUAL( propagationResults.back( )->isContiguousHistoryStorageUsed( ), useContiguousHistoryStorage );
+                BOOST_CHECK_EQUAL( propagationResults.back( )->getEquationsOfMotionNumericalSolutionContiguous( ).size( ),
+                                   ( useContiguousHistoryStorage ? 1001 : 0 ) );
+                BOOST_CHECK_EQUAL( propagationResults.back( )->getDependentVariableHistoryContiguous( ).size( ),
+                                   ( useContiguousHistoryStorage ? 1001 : 0 ) );
+            }
+
+            // Compare map and contiguous results
+            std::shared_ptr< SingleArcPropagatorResults< double, double > > mapResults = propagationResults.at( 0 );
+            std::shared_ptr< SingleArcPropagatorResults< double, double > > contiguousResults = propagationResults.at( 1 );
+            BOOST_CHECK_EQUAL( mapResults->getEquationsOfMotionNumericalSolution( ).size( ), 1001 );
+            BOOST_CHECK_EQUAL( contiguousResults->getEquationsOfMotionNumericalSolution( ).size( ), 1001 );
+            BOOST_CHECK_EQUAL( contiguousResults->getCumulativeComputationTimeHistory( ).size( ), 1001 );
+            for( auto stateIterator : mapResults->getEquationsOfMotionNumericalSolution( ) )
+            {
+                double currentTime = stateIterator.first;
+                for( int i = 0; i < 6; i++ )
+                {
+                    BOOST_CHECK_EQUAL( stateIterator.second( i ),
+                                       contiguousResults->getEquationsOfMotionNumericalSolution( ).at( currentTime )( i ) );
+                    BOOST_CHECK_EQUAL( stateIterator.second( i ),
+                                       contiguousResults->getEquationsOfMotionNumericalSolutionContiguous( ).at( currentTime )( i ) );
+                    BOOST_CHECK_EQUAL( mapResults->getEquationsOfMotionNumericalSolutionRaw( ).at( currentTime )( i ),
+                                       contiguousResults->getEquationsOfMotionNumericalSolutionRaw( ).at( currentTime )( i ) );
+                }
+                for( int i = 0; i < 4; i++ )
+                {
+                    BOOST_CHECK_EQUAL( mapResults->getDependentVariableHistory( ).at( currentTime )( i ),
+                                       contiguousResults->getDependentVariableHistory( ).at( currentTime )( i ) );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
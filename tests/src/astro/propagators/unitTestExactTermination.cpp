@@ -42,7 +42,9 @@ namespace unit_tests
 BOOST_AUTO_TEST_SUITE( test_exact_termination )
 
 //! Test exact termination conditions, to see if the propagation stops exactly (within tolerance) when it's supposed to.
-//! The test is run for an RK4 and RK7(8) integrator, with otherwise identical settings.
+//! The test is run for an RK4 and RK4(5) integrator, with otherwise identical settings. The RK4(5) integrator is run both with
+//! and without dense output, where the former locates the exact altitude from the dense output (the final state is computed
+//! by an integration step in both cases).
 //! Five types of termination conditions are used:
 //! 0) Termination on exact time
 //! 1) Termination on exact altitude
@@ -55,7 +57,7 @@ BOOST_AUTO_TEST_SUITE( test_exact_termination )
 //! The tests are run for forward and backward propagation
 BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
 {
-    for( unsigned int integratorCase = 0; integratorCase < 2; integratorCase++ )
+    for( unsigned int integratorCase = 0; integratorCase < 3; integratorCase++ )
     {
         for( unsigned int direction = 0; direction < 2; direction++ )
         {
@@ -240,6 +242,7 @@ BOOST_AUTO_TEST_CASE( testEnckePopagatorForSphericalHarmonicCentralBodies )
                             ( simulationStartEpoch, directionMultiplier * fixedStepSize,
                               CoefficientSets::rungeKuttaFehlberg45,
                               1.0E-3, 1.0E3, 1.0E-12, 1.0E-12 );
+                    integratorSettings->useDenseOutput_ = ( integratorCase == 2 );
                 }
 
                 // Propagate orbit with Cowell method
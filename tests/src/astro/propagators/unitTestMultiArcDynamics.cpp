@@ -255,6 +255,192 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     }
 }
 
+//! Test whether arcs that are propagated concurrently, each in their own environment, yield results identical to a serial
+//! propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcDynamics )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 2.0E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define body settings, from which the full environment and each arc environment are created
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    std::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings.at( "Moon" )->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings.at( "Moon" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    // Define arcs
+    std::vector< double > integrationArcStarts;
+    double arcDuration = 1.0E6;
+    for( int i = 0; i < 8; i++ )
+    {
+        integrationArcStarts.push_back( initialEphemerisTime + 1.0E4 + static_cast< double >( i ) * arcDuration );
+    }
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    std::vector< SystemOfBodies > bodiesPerTestCase;
+    std::vector< std::vector< std::map< double, Eigen::VectorXd > > > statesPerTestCase;
+
+    // Test case 0: serial propagation in a single environment; test case 1: serial propagation in arc-wise environments
+    // Test case 2: parallel propagation in arc-wise environments; test case 3: parallel propagation in a single environment
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
+    {
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+        // Create arc-wise environments, if required
+        std::vector< SystemOfBodies > arcWiseBodies;
+        if( testCase == 1 || testCase == 2 )
+        {
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                arcWiseBodies.push_back( createSystemOfBodies( bodySettings ) );
+            }
+        }
+
+        // Create propagator settings for each arc, with acceleration models created in the arc's environment
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            SystemOfBodies& currentArcBodies = ( arcWiseBodies.size( ) > 0 ) ? arcWiseBodies.at( i ) : bodies;
+            AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        currentArcBodies, accelerationMap, bodiesToIntegrate, centralBodies );
+            arcPropagationSettingsList.push_back(
+                        translationalStatePropagatorSettings< double >(
+                            centralBodies, accelerationModelMap, bodiesToIntegrate,
+                            spice_interface::getBodyCartesianStateAtEpoch(
+                                "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) ),
+                            integrationArcStarts.at( i ),
+                            rungeKuttaVariableStepSettingsScalarTolerances(
+                                600.0, rungeKuttaFehlberg78, 1.0E-3, 1.0E5, 1.0E-12, 1.0E-12 ),
+                            propagationTimeTerminationSettings( integrationArcStarts.at( i ) + arcDuration ) ) );
+        }
+
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList );
+        multiArcPropagatorSettings->getOutputSettings( )->setIntegratedResult( true );
+        multiArcPropagatorSettings->resetNumberOfThreads( ( testCase < 2 ) ? 1 : 4 );
+
+        // Parallel propagation in a single environment is not allowed
+        if( testCase == 3 )
+        {
+            bool isExceptionCaught = false;
+            try
+            {
+                MultiArcDynamicsSimulator< > dynamicsSimulator( bodies, multiArcPropagatorSettings );
+            }
+            catch( const std::runtime_error& )
+            {
+                isExceptionCaught = true;
+            }
+            BOOST_CHECK_EQUAL( isExceptionCaught, true );
+        }
+        else
+        {
+            MultiArcDynamicsSimulator< > dynamicsSimulator(
+                        bodies, multiArcPropagatorSettings, true, arcWiseBodies );
+            statesPerTestCase.push_back( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ) );
+            bodiesPerTestCase.push_back( bodies );
+        }
+    }
+
+    // Check that propagated states are identical for all propagation modes
+    for( unsigned int testCase = 1; testCase < statesPerTestCase.size( ); testCase++ )
+    {
+        BOOST_CHECK_EQUAL( statesPerTestCase.at( testCase ).size( ), numberOfIntegrationArcs );
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            BOOST_CHECK_EQUAL( statesPerTestCase.at( testCase ).at( i ).size( ), statesPerTestCase.at( 0 ).at( i ).size( ) );
+
+            auto referenceIterator = statesPerTestCase.at( 0 ).at( i ).begin( );
+            for( auto stateIterator : statesPerTestCase.at( testCase ).at( i ) )
+            {
+                BOOST_CHECK_EQUAL( stateIterator.first, referenceIterator->first );
+                for( int j = 0; j < 6; j++ )
+                {
+                    BOOST_CHECK_EQUAL( stateIterator.second( j ), referenceIterator->second( j ) );
+                }
+                referenceIterator++;
+            }
+        }
+
+        // Check that results are set in full environment
+        double testTime = integrationArcStarts.at( 3 ) + arcDuration / 2.0;
+        Eigen::Vector6d stateDifference =
+                bodiesPerTestCase.at( testCase ).at( "Moon" )->getEphemeris( )->getCartesianState( testTime ) -
+                bodiesPerTestCase.at( 0 ).at( "Moon" )->getEphemeris( )->getCartesianState( testTime );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( stateDifference( j ), 0.0 );
+        }
+    }
+}
+
+//! Test whether sharing of Body objects and stateful environment models between arc environments is detected
+BOOST_AUTO_TEST_CASE( testArcEnvironmentIndependence )
+{
+    std::shared_ptr< Ephemeris > constantEphemeris = std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ) );
+    std::shared_ptr< Ephemeris > tabulatedEphemeris = std::make_shared< TabulatedCartesianEphemeris< > >(
+                TabulatedCartesianEphemeris< >::StateInterpolatorPointer( ) );
+    std::shared_ptr< gravitation::GravityFieldModel > gravityField =
+            std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 );
+
+    // Test case 0: independent environments; test case 1: shared Body object; test case 2: shared constant ephemeris;
+    // test case 3: shared tabulated ephemeris; test case 4: shared gravity field
+    for( unsigned int testCase = 0; testCase < 5; testCase++ )
+    {
+        std::vector< SystemOfBodies > arcWiseBodies;
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            SystemOfBodies currentBodies;
+            currentBodies.createEmptyBody( "Earth" );
+            currentBodies.createEmptyBody( "Vehicle" );
+            currentBodies.at( "Earth" )->setEphemeris(
+                        std::make_shared< ConstantEphemeris >( Eigen::Vector6d::Zero( ) ) );
+            currentBodies.at( "Earth" )->setGravityFieldModel(
+                        std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+
+            if( testCase == 1 && i == 1 )
+            {
+                currentBodies.addBody( arcWiseBodies.at( 0 ).at( "Vehicle" ), "Vehicle" );
+            }
+            else if( testCase == 2 )
+            {
+                currentBodies.at( "Earth" )->setEphemeris( constantEphemeris );
+            }
+            else if( testCase == 3 )
+            {
+                currentBodies.at( "Vehicle" )->setEphemeris( tabulatedEphemeris );
+            }
+            else if( testCase == 4 )
+            {
+                currentBodies.at( "Earth" )->setGravityFieldModel( gravityField );
+            }
+            arcWiseBodies.push_back( currentBodies );
+        }
+
+        BOOST_CHECK_EQUAL( areEnvironmentsIndependent( arcWiseBodies ), ( testCase == 0 || testCase == 2 ) );
+
+        // Models may be shared between bodies of a single environment
+        BOOST_CHECK_EQUAL( areEnvironmentsIndependent( { arcWiseBodies.at( 0 ) } ), true );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
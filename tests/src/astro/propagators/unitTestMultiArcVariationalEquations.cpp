@@ -421,6 +421,165 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
 }
 
 
+//! Test whether variational equations of arcs that are propagated concurrently, each in their own environment, yield results
+//! identical to a serial propagation
+BOOST_AUTO_TEST_CASE( testParallelMultiArcVariationalEquationCalculation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Moon" );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 2.0E7;
+    double buffer = 5.0 * 3600.0;
+
+    // Define body settings, from which the full environment and each arc environment are created
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    std::dynamic_pointer_cast< InterpolatedSpiceEphemerisSettings >( bodySettings.at( "Moon" )->ephemerisSettings )->
+            resetFrameOrigin( "Earth" );
+    bodySettings.at( "Moon" )->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon" };
+    std::vector< std::string > centralBodies = { "Earth" };
+
+    // Define arcs
+    std::vector< double > integrationArcStarts;
+    double arcDuration = 1.0E6;
+    for( int i = 0; i < 8; i++ )
+    {
+        integrationArcStarts.push_back( initialEphemerisTime + 1.0E4 + static_cast< double >( i ) * arcDuration );
+    }
+    unsigned int numberOfIntegrationArcs = integrationArcStarts.size( );
+
+    std::vector< std::vector< Eigen::MatrixXd > > matricesPerTestCase;
+
+    // Test case 0: serial propagation in a single environment; test case 1: serial propagation in arc-wise environments
+    // Test case 2: parallel propagation in arc-wise environments; test case 3: parallel propagation in a single environment
+    for( unsigned int testCase = 0; testCase < 4; testCase++ )
+    {
+        SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+        // Create arc-wise environments, if required
+        std::vector< SystemOfBodies > arcWiseBodies;
+        if( testCase == 1 || testCase == 2 )
+        {
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                arcWiseBodies.push_back( createSystemOfBodies( bodySettings ) );
+            }
+        }
+
+        // Create propagator settings for each arc, with acceleration models created in the arc's environment
+        std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > arcPropagationSettingsList;
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            SystemOfBodies& currentArcBodies = ( arcWiseBodies.size( ) > 0 ) ? arcWiseBodies.at( i ) : bodies;
+            AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        currentArcBodies, accelerationMap, bodiesToIntegrate, centralBodies );
+            arcPropagationSettingsList.push_back(
+                        translationalStatePropagatorSettings< double >(
+                            centralBodies, accelerationModelMap, bodiesToIntegrate,
+                            spice_interface::getBodyCartesianStateAtEpoch(
+                                "Moon", "Earth", "ECLIPJ2000", "NONE", integrationArcStarts.at( i ) ),
+                            integrationArcStarts.at( i ),
+                            rungeKuttaVariableStepSettingsScalarTolerances(
+                                600.0, rungeKuttaFehlberg78, 1.0E-3, 1.0E5, 1.0E-12, 1.0E-12 ),
+                            propagationTimeTerminationSettings( integrationArcStarts.at( i ) + arcDuration ) ) );
+        }
+
+        std::shared_ptr< MultiArcPropagatorSettings< double > > multiArcPropagatorSettings =
+                std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList );
+        multiArcPropagatorSettings->getOutputSettings( )->setIntegratedResult( true );
+        multiArcPropagatorSettings->resetNumberOfThreads( ( testCase < 2 ) ? 1 : 4 );
+
+        // Define parameters
+        std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+                getInitialMultiArcParameterSettings< double >( multiArcPropagatorSettings, bodies, integrationArcStarts );
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+                createParametersToEstimate< double, double >( parameterNames, bodies );
+
+        // Estimating environment parameters is not allowed with arc-wise environments
+        if( arcWiseBodies.size( ) > 0 )
+        {
+            std::vector< std::shared_ptr< EstimatableParameterSettings > > extendedParameterNames = parameterNames;
+            extendedParameterNames.push_back(
+                        std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+            bool isExceptionCaught = false;
+            try
+            {
+                MultiArcVariationalEquationsSolver< > variationalEquationsSolver(
+                            bodies, multiArcPropagatorSettings,
+                            createParametersToEstimate< double, double >( extendedParameterNames, bodies ),
+                            false, arcWiseBodies );
+            }
+            catch( const std::runtime_error& )
+            {
+                isExceptionCaught = true;
+            }
+            BOOST_CHECK_EQUAL( isExceptionCaught, true );
+        }
+
+        // Parallel propagation in a single environment is not allowed
+        if( testCase == 3 )
+        {
+            bool isExceptionCaught = false;
+            try
+            {
+                MultiArcVariationalEquationsSolver< > variationalEquationsSolver(
+                            bodies, multiArcPropagatorSettings, parametersToEstimate, true );
+            }
+            catch( const std::runtime_error& )
+            {
+                isExceptionCaught = true;
+            }
+            BOOST_CHECK_EQUAL( isExceptionCaught, true );
+        }
+        else
+        {
+            MultiArcVariationalEquationsSolver< > variationalEquationsSolver(
+                        bodies, multiArcPropagatorSettings, parametersToEstimate, true, arcWiseBodies );
+
+            // Retrieve state transition and sensitivity matrices halfway through each arc
+            std::vector< Eigen::MatrixXd > currentMatrices;
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                currentMatrices.push_back(
+                            variationalEquationsSolver.getStateTransitionMatrixInterface( )->
+                            getCombinedStateTransitionAndSensitivityMatrix( integrationArcStarts.at( i ) + arcDuration / 2.0 ) );
+            }
+            matricesPerTestCase.push_back( currentMatrices );
+        }
+    }
+
+    // Check that state transition and sensitivity matrices are identical for all propagation modes
+    for( unsigned int testCase = 1; testCase < matricesPerTestCase.size( ); testCase++ )
+    {
+        for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+        {
+            BOOST_CHECK_EQUAL( matricesPerTestCase.at( testCase ).at( i ).rows( ), 6 );
+            BOOST_CHECK_EQUAL( matricesPerTestCase.at( testCase ).at( i ).cols( ), 6 );
+
+            for( int j = 0; j < matricesPerTestCase.at( 0 ).at( i ).rows( ); j++ )
+            {
+                for( int k = 0; k < matricesPerTestCase.at( 0 ).at( i ).cols( ); k++ )
+                {
+                    BOOST_CHECK_EQUAL( matricesPerTestCase.at( testCase ).at( i )( j, k ),
+                                       matricesPerTestCase.at( 0 ).at( i )( j, k ) );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include <tudat/basics/contiguousHistory.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_contiguous_history )
+
+//! Test whether the contiguous history is consistent with the equivalent std::map, for forward and backward propagation
+BOOST_AUTO_TEST_CASE( testContiguousHistoryConsistencyWithMap )
+{
+    for( unsigned int directionCase = 0; directionCase < 2; directionCase++ )
+    {
+        const bool isPropagationForward = ( directionCase == 0 );
+        const double timeStep = isPropagationForward ? 10.0 : -10.0;
+
+        utilities::ContiguousHistory< double, double > contiguousHistory;
+        std::map< double, Eigen::VectorXd > mapHistory;
+
+        // Add entries, overwriting each entry once
+        for( unsigned int i = 0; i < 100; i++ )
+        {
+            double currentTime = 1000.0 + static_cast< double >( i ) * timeStep;
+            Eigen::VectorXd currentEntry = Eigen::VectorXd::Constant( 3, -1.0 );
+            utilities::addHistoryEntry( contiguousHistory, currentTime, currentEntry );
+            utilities::addHistoryEntry( mapHistory, currentTime, currentEntry );
+
+            currentEntry << currentTime, 2.0 * currentTime, static_cast< double >( i );
+            utilities::addHistoryEntry( contiguousHistory, currentTime, currentEntry );
+            utilities::addHistoryEntry( mapHistory, currentTime, currentEntry );
+        }
+
+        // Remove and re-add most recent entry
+        BOOST_CHECK_EQUAL( utilities::getMostRecentHistoryIndependentVariable( contiguousHistory, isPropagationForward ),
+                           utilities::getMostRecentHistoryIndependentVariable( mapHistory, isPropagationForward ) );
+        utilities::eraseMostRecentHistoryEntry( contiguousHistory, isPropagationForward );
+        utilities::eraseMostRecentHistoryEntry( mapHistory, isPropagationForward );
+        BOOST_CHECK_EQUAL( utilities::getMostRecentHistoryIndependentVariable( contiguousHistory, isPropagationForward ),
+                           utilities::getMostRecentHistoryIndependentVariable( mapHistory, isPropagationForward ) );
+
+        double finalTime = 1000.0 + 98.5 * timeStep;
+        utilities::addHistoryEntry( contiguousHistory, finalTime, Eigen::VectorXd( Eigen::VectorXd::Ones( 3 ) ) );
+        utilities::addHistoryEntry( mapHistory, finalTime, Eigen::VectorXd( Eigen::VectorXd::Ones( 3 ) ) );
+
+        BOOST_CHECK_EQUAL( contiguousHistory.size( ), mapHistory.size( ) );
+        BOOST_CHECK_EQUAL( contiguousHistory.isIncreasing( ), isPropagationForward );
+
+        // Compare forward iteration
+        std::map< double, Eigen::VectorXd >::const_iterator mapIterator = mapHistory.begin( );
+        for( auto contiguousIterator = contiguousHistory.begin( ); contiguousIterator != contiguousHistory.end( );
+             contiguousIterator++ )
+        {
+            BOOST_CHECK_EQUAL( contiguousIterator->first, mapIterator->first );
+            BOOST_CHECK( contiguousIterator->second == mapIterator->second );
+            mapIterator++;
+        }
+        BOOST_CHECK( mapIterator == mapHistory.end( ) );
+
+        // Compare reverse iteration
+        std::map< double, Eigen::VectorXd >::const_reverse_iterator reverseMapIterator = mapHistory.rbegin( );
+        for( auto contiguousIterator = contiguousHistory.rbegin( ); contiguousIterator != contiguousHistory.rend( );
+             contiguousIterator++ )
+        {
+            BOOST_CHECK_EQUAL( contiguousIterator->first, reverseMapIterator->first );
+            BOOST_CHECK( ( *contiguousIterator ).second == reverseMapIterator->second );
+            reverseMapIterator++;
+        }
+        BOOST_CHECK( reverseMapIterator == mapHistory.rend( ) );
+
+        // Compare look-up functions
+        for( auto mapEntry : mapHistory )
+        {
+            BOOST_CHECK_EQUAL( contiguousHistory.count( mapEntry.first ), 1 );
+            BOOST_CHECK( contiguousHistory.at( mapEntry.first ) == mapEntry.second );
+            BOOST_CHECK_EQUAL( contiguousHistory.find( mapEntry.first )->first, mapEntry.first );
+        }
+        BOOST_CHECK_EQUAL( contiguousHistory.count( 1000.0 + 0.5 * timeStep ), 0 );
+        BOOST_CHECK( contiguousHistory.find( 1000.0 + 0.5 * timeStep ) == contiguousHistory.end( ) );
+        BOOST_CHECK_THROW( contiguousHistory.at( 1000.0 + 0.5 * timeStep ), std::out_of_range );
+
+        // Compare conversion to map
+        std::map< double, Eigen::VectorXd > convertedHistory = contiguousHistory.toMap< Eigen::VectorXd >( );
+        BOOST_CHECK( convertedHistory == mapHistory );
+
+        // Check raw data, which is stored in order of addition
+        auto dataBlock = contiguousHistory.getDataBlock( );
+        BOOST_CHECK_EQUAL( dataBlock.rows( ), 100 );
+        BOOST_CHECK_EQUAL( dataBlock.cols( ), 3 );
+        for( unsigned int i = 0; i < 99; i++ )
+        {
+            double currentTime = 1000.0 + static_cast< double >( i ) * timeStep;
+            BOOST_CHECK_EQUAL( contiguousHistory.getIndependentVariables( ).at( i ), currentTime );
+            BOOST_CHECK_EQUAL( dataBlock( i, 0 ), currentTime );
+            BOOST_CHECK_EQUAL( dataBlock( i, 1 ), 2.0 * currentTime );
+            BOOST_CHECK_EQUAL( dataBlock( i, 2 ), static_cast< double >( i ) );
+        }
+        BOOST_CHECK_EQUAL( contiguousHistory.getIndependentVariables( ).at( 99 ), finalTime );
+
+        // Check that entries can only be added monotonically, and with consistent size
+        BOOST_CHECK_THROW( contiguousHistory.insert( 1000.0, Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+        BOOST_CHECK_THROW( contiguousHistory.insert( finalTime + timeStep, Eigen::VectorXd::Zero( 4 ) ),
+                           std::runtime_error );
+
+        // Check that history can be re-used after clearing
+        contiguousHistory.clear( );
+        BOOST_CHECK( contiguousHistory.empty( ) );
+        contiguousHistory.insert( 1000.0, Eigen::VectorXd::Zero( 4 ) );
+        contiguousHistory.insert( 1000.0 - timeStep, Eigen::VectorXd::Zero( 4 ) );
+        BOOST_CHECK_EQUAL( contiguousHistory.isIncreasing( ), !isPropagationForward );
+    }
+}
+
+//! Test contiguous history with matrix and scalar entries
+BOOST_AUTO_TEST_CASE( testContiguousHistoryEntryTypes )
+{
+    // Check matrix entries
+    utilities::ContiguousHistory< double, double > matrixHistory;
+    matrixHistory.reserve( 10 );
+    Eigen::MatrixXd firstEntry = Eigen::MatrixXd::Random( 3, 2 );
+    Eigen::MatrixXd secondEntry = Eigen::MatrixXd::Random( 3, 2 );
+    matrixHistory.insert( 0.0, firstEntry );
+    matrixHistory.insert( 1.0, secondEntry );
+    BOOST_CHECK( matrixHistory.at( 0.0 ) == firstEntry );
+    BOOST_CHECK( matrixHistory.at( 1.0 ) == secondEntry );
+    BOOST_CHECK( matrixHistory.toMap( ).at( 1.0 ) == secondEntry );
+
+    // Column-major data of each entry is stored in a single row of the data block
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( matrixHistory.getDataBlock( )( 1, i ), secondEntry( i % 3, i / 3 ) );
+    }
+
+    // Check scalar entries
+    utilities::ContiguousHistory< double, double > scalarHistory;
+    std::map< double, double > scalarMapHistory;
+    for( unsigned int i = 0; i < 10; i++ )
+    {
+        utilities::addHistoryEntry( scalarHistory, static_cast< double >( i ), 3.0 * static_cast< double >( i ) );
+        utilities::addHistoryEntry( scalarMapHistory, static_cast< double >( i ), 3.0 * static_cast< double >( i ) );
+    }
+    for( auto mapEntry : scalarMapHistory )
+    {
+        BOOST_CHECK_EQUAL( scalarHistory.at( mapEntry.first )( 0, 0 ), mapEntry.second );
+    }
+    BOOST_CHECK_EQUAL( scalarHistory.getDataBlock( ).sum( ), 135.0 );
+
+    // Check error handling for empty history
+    utilities::ContiguousHistory< double, double > emptyHistory;
+    BOOST_CHECK_THROW( emptyHistory.eraseMostRecentEntry( ), std::runtime_error );
+    BOOST_CHECK_THROW( emptyHistory.getMostRecentIndependentVariable( ), std::runtime_error );
+    BOOST_CHECK( emptyHistory.begin( ) == emptyHistory.end( ) );
+    BOOST_CHECK( emptyHistory.rbegin( ) == emptyHistory.rend( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
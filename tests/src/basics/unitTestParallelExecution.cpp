@@ -0,0 +1,140 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <vector>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tudat/basics/parallelExecution.h>
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallel_execution )
+
+//! Test whether all tasks are executed exactly once, for various numbers of threads
+BOOST_AUTO_TEST_CASE( testParallelTaskExecution )
+{
+    unsigned int numberOfTasks = 1000;
+    for( unsigned int numberOfThreads = 0; numberOfThreads < 6; numberOfThreads++ )
+    {
+        std::vector< int > numberOfTaskExecutions( numberOfTasks, 0 );
+        std::vector< double > taskResults( numberOfTasks, 0.0 );
+
+        utilities::executeInParallel(
+                    numberOfTasks, [ & ]( const unsigned int taskIndex )
+        {
+            numberOfTaskExecutions[ taskIndex ]++;
+            taskResults[ taskIndex ] = static_cast< double >( taskIndex * taskIndex );
+        }, numberOfThreads );
+
+        for( unsigned int i = 0; i < numberOfTasks; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfTaskExecutions.at( i ), 1 );
+            BOOST_CHECK_EQUAL( taskResults.at( i ), static_cast< double >( i * i ) );
+        }
+    }
+
+    // Check that empty task list is handled
+    utilities::executeInParallel( 0, [ & ]( const unsigned int ){ throw std::runtime_error( "Unexpected task" ); }, 4 );
+
+    // Check number of threads
+    BOOST_CHECK_EQUAL( utilities::getNumberOfThreadsToUse( 8, 3 ), 3 );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfThreadsToUse( 2, 3 ), 2 );
+    BOOST_CHECK_EQUAL( utilities::getNumberOfThreadsToUse( 2, 0 ), 1 );
+    BOOST_CHECK( utilities::getNumberOfThreadsToUse( 0, 1000 ) >= 1 );
+}
+
+//! Test whether exceptions thrown in a task are passed to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelTaskExceptions )
+{
+    for( unsigned int numberOfThreads = 1; numberOfThreads < 5; numberOfThreads++ )
+    {
+        bool isExceptionCaught = false;
+        try
+        {
+            utilities::executeInParallel(
+                        100, [ & ]( const unsigned int taskIndex )
+            {
+                if( taskIndex == 42 )
+                {
+                    throw std::runtime_error( "Error in task" );
+                }
+            }, numberOfThreads );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+    }
+}
+
+//! Test whether a persistent task pool executes repeated lists of tasks exactly once, and passes exceptions
+BOOST_AUTO_TEST_CASE( testParallelTaskPool )
+{
+    for( unsigned int numberOfThreads = 0; numberOfThreads < 5; numberOfThreads++ )
+    {
+        utilities::ParallelTaskPool taskPool( numberOfThreads );
+        BOOST_CHECK( taskPool.getNumberOfThreads( ) >= 1 );
+
+        // Reuse worker threads for lists of tasks of different size
+        for( unsigned int numberOfTasks : { 0, 1, 7, 100, 1000, 3 } )
+        {
+            std::vector< int > numberOfTaskExecutions( numberOfTasks, 0 );
+            taskPool.executeTasks( numberOfTasks, [ & ]( const unsigned int taskIndex )
+            {
+                numberOfTaskExecutions[ taskIndex ]++;
+            } );
+
+            for( unsigned int i = 0; i < numberOfTasks; i++ )
+            {
+                BOOST_CHECK_EQUAL( numberOfTaskExecutions.at( i ), 1 );
+            }
+        }
+
+        // Check that exception is passed to calling thread, and that pool is usable afterwards
+        bool isExceptionCaught = false;
+        try
+        {
+            taskPool.executeTasks( 100, [ & ]( const unsigned int taskIndex )
+            {
+                if( taskIndex == 42 )
+                {
+                    throw std::runtime_error( "Error in task" );
+                }
+            } );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+        std::vector< int > numberOfTaskExecutions( 50, 0 );
+        taskPool.executeTasks( 50, [ & ]( const unsigned int taskIndex ){ numberOfTaskExecutions[ taskIndex ]++; } );
+        for( unsigned int i = 0; i < 50; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfTaskExecutions.at( i ), 1 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -37,6 +37,7 @@ using namespace boost::placeholders;
 #include "tudat/basics/testMacros.h"
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/basics/basicTypedefs.h"
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/interface/spice/spiceEphemeris.h"
 #include "tudat/interface/spice/spiceInterface.h"
 #include "tudat/interface/spice/spiceRotationalEphemeris.h"
@@ -489,6 +490,54 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
 }
 
+// Test 8: Concurrent retrieval of states and rotations from Spice.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+    using namespace physical_constants;
+
+    // Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    ephemerides::SpiceEphemeris moonEphemeris( "Moon", "Earth", false, false, false, "ECLIPJ2000" );
+    ephemerides::SpiceRotationalEphemeris earthRotationalEphemeris( "ECLIPJ2000", "IAU_Earth" );
+
+    // Retrieve states and rotations serially.
+    const unsigned int numberOfEvaluations = 1000;
+    std::vector< Eigen::Vector6d > serialStates( numberOfEvaluations );
+    std::vector< Eigen::Quaterniond > serialRotations( numberOfEvaluations );
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        const double currentTime = static_cast< double >( i ) * 3600.0;
+        serialStates[ i ] = moonEphemeris.getCartesianState( currentTime );
+        serialRotations[ i ] = earthRotationalEphemeris.getRotationToTargetFrame( currentTime );
+    }
+
+    // Retrieve same states and rotations from multiple threads.
+    std::vector< Eigen::Vector6d > parallelStates( numberOfEvaluations );
+    std::vector< Eigen::Quaterniond > parallelRotations( numberOfEvaluations );
+    utilities::executeInParallel(
+                numberOfEvaluations, [ & ]( const unsigned int i )
+    {
+        const double currentTime = static_cast< double >( i ) * 3600.0;
+        parallelStates[ i ] = moonEphemeris.getCartesianState( currentTime );
+        parallelRotations[ i ] = earthRotationalEphemeris.getRotationToTargetFrame( currentTime );
+    }, 4 );
+
+    // Results should be identical.
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialStates[ i ]( j ), parallelStates[ i ]( j ) );
+        }
+        BOOST_CHECK_EQUAL( serialRotations[ i ].w( ), parallelRotations[ i ].w( ) );
+        BOOST_CHECK_EQUAL( serialRotations[ i ].x( ), parallelRotations[ i ].x( ) );
+        BOOST_CHECK_EQUAL( serialRotations[ i ].y( ), parallelRotations[ i ].y( ) );
+        BOOST_CHECK_EQUAL( serialRotations[ i ].z( ), parallelRotations[ i ].z( ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
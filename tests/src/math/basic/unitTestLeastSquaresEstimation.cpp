@@ -0,0 +1,133 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Test whether the blocked rank update of the normal matrix is equal to the direct computation of H^T*W*H
+BOOST_AUTO_TEST_CASE( testNormalMatrixRankUpdate )
+{
+    // Create information matrix with more rows than a single block, and weights of different magnitude
+    int numberOfObservations = 1000;
+    int numberOfParameters = 40;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            informationMatrix( i, j ) = std::sin( 0.37 * static_cast< double >( i + 1 ) * static_cast< double >( j + 1 ) );
+        }
+        weights( i ) = 1.0 + 100.0 * static_cast< double >( i % 7 );
+    }
+
+    Eigen::MatrixXd aPrioriMatrix = Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+    aPrioriMatrix( 1, 0 ) = aPrioriMatrix( 0, 1 ) = 0.1;
+
+    Eigen::MatrixXd expectedNormalMatrix =
+            aPrioriMatrix + informationMatrix.transpose( ) * weights.asDiagonal( ) * informationMatrix;
+
+    // Compute normal matrix in one call, and with blocks of observations
+    Eigen::MatrixXd normalMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                informationMatrix, weights, aPrioriMatrix );
+    Eigen::MatrixXd accumulatedNormalMatrix = aPrioriMatrix;
+    Eigen::VectorXd accumulatedRightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i += 300 )
+    {
+        int blockSize = std::min( 300, numberOfObservations - i );
+        addObservationBlockToNormalEquations(
+                    informationMatrix.middleRows( i, blockSize ), Eigen::VectorXd::Ones( blockSize ),
+                    weights.segment( i, blockSize ), accumulatedNormalMatrix, accumulatedRightHandSide );
+    }
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalMatrix, expectedNormalMatrix, 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accumulatedNormalMatrix, expectedNormalMatrix, 1.0E-10 );
+    BOOST_CHECK( normalMatrix == normalMatrix.transpose( ) );
+    BOOST_CHECK( accumulatedNormalMatrix == accumulatedNormalMatrix.transpose( ) );
+
+    // Check update with negative weights
+    Eigen::VectorXd negativeWeights = -weights;
+    normalMatrix = calculateInverseOfUpdatedCovarianceMatrix( informationMatrix, negativeWeights, aPrioriMatrix );
+    expectedNormalMatrix = aPrioriMatrix - informationMatrix.transpose( ) * weights.asDiagonal( ) * informationMatrix;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( normalMatrix, expectedNormalMatrix, 1.0E-10 );
+
+    BOOST_CHECK_THROW( calculateInverseOfUpdatedCovarianceMatrix( informationMatrix, weights.segment( 0, 10 ) ),
+                       std::runtime_error );
+}
+
+//! Test whether the Cholesky solver of the normal equations gives the same solution as the SVD solver
+BOOST_AUTO_TEST_CASE( testCholeskyNormalEquationsSolver )
+{
+    int numberOfObservations = 500;
+    int numberOfParameters = 6;
+    Eigen::VectorXd trueParameters = Eigen::VectorXd::Zero( numberOfParameters );
+    trueParameters << 1.0, -2.0, 0.5, 3.0, -0.1, 0.01;
+
+    // Create polynomial design matrix and (noise-free) observations
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double independentVariable = -1.0 + 2.0 * static_cast< double >( i ) / static_cast< double >( numberOfObservations - 1 );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            informationMatrix( i, j ) = std::pow( independentVariable, j );
+        }
+    }
+    Eigen::VectorXd observations = informationMatrix * trueParameters;
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( numberOfObservations, 4.0 );
+    Eigen::MatrixXd aPrioriMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > svdSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, observations, weights, aPrioriMatrix, true, 1.0E8,
+                Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ), svd_normal_equations_solver );
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > choleskySolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, observations, weights, aPrioriMatrix, true, 1.0E8,
+                Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ), cholesky_normal_equations_solver );
+
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( svdSolution.first, trueParameters, 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( choleskySolution.first, trueParameters, 1.0E-10 );
+    BOOST_CHECK( svdSolution.second == choleskySolution.second );
+
+    // Check that singular matrix is solved with SVD fallback (minimum norm solution)
+    Eigen::MatrixXd singularMatrix = Eigen::MatrixXd::Zero( 2, 2 );
+    singularMatrix << 1.0, 1.0, 1.0, 1.0;
+    Eigen::VectorXd singularRightHandSide = Eigen::Vector2d( 2.0, 2.0 );
+    Eigen::VectorXd fallbackSolution = solveSymmetricSystemOfEquationsWithCholesky(
+                singularMatrix, singularRightHandSide, false );
+    BOOST_CHECK_CLOSE_FRACTION( fallbackSolution( 0 ), 1.0, 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( fallbackSolution( 1 ), 1.0, 1.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -165,6 +165,52 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test dense output (continuous extension) of the integrator
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_DenseOutput )
+{
+    // Define harmonic oscillator
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    AdamsBashforthMoultonIntegratorXd integrator(
+                stateDerivativeFunction, 0.0, initialState, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+    integrator.setDenseOutput( true );
+    BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+
+    // Take steps, and check dense output at a number of points within each step.
+    double stepSize = 0.01;
+    for( int i = 0; i < 100; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+        stepSize = integrator.getNextStepSize( );
+
+        // Check that dense output is only available once the interpolant has its full set of nodes.
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), ( i >= 2 ) );
+        if( i < 2 )
+        {
+            continue;
+        }
+
+        double previousTime = integrator.getPreviousIndependentVariable( );
+        double currentTime = integrator.getCurrentIndependentVariable( );
+        for( int j = 0; j <= 4; j++ )
+        {
+            double time = previousTime + static_cast< double >( j ) / 4.0 * ( currentTime - previousTime );
+            Eigen::VectorXd denseOutputState = integrator.getDenseOutputState( time );
+            BOOST_CHECK_SMALL( std::fabs( denseOutputState( 0 ) - std::cos( time ) ), 1.0E-10 );
+            BOOST_CHECK_SMALL( std::fabs( denseOutputState( 1 ) + std::sin( time ) ), 1.0E-10 );
+        }
+    }
+
+    // Check that dense output is invalidated by rollback
+    integrator.rollbackToPreviousState( );
+    BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -147,6 +147,50 @@ BOOST_AUTO_TEST_CASE( testRungeKutta4IntegratorUsingMatlabData )
     }
 }
 
+//! Test if the state derivative evaluated at the current state is re-used as first stage of the next step.
+BOOST_AUTO_TEST_CASE( testRungeKutta4StateDerivativeReuse )
+{
+    using namespace numerical_integrators;
+
+    // Define state derivative function that counts its number of evaluations, and stores its last input.
+    int numberOfEvaluations = 0;
+    double lastEvaluationTime = TUDAT_NAN;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        lastEvaluationTime = time;
+        return computeNonAutonomousModelStateDerivative( time, state );
+    };
+
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 1 ) << 1.0 ).finished( );
+    RungeKutta4IntegratorXd integrator( stateDerivativeFunction, 0.0, initialState );
+    RungeKutta4IntegratorXd referenceIntegrator( &computeNonAutonomousModelStateDerivative, 0.0, initialState );
+
+    const int numberOfSteps = 10;
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( 0.1 );
+        referenceIntegrator.performIntegrationStep( 0.1 );
+        BOOST_CHECK_EQUAL( integrator.getCurrentState( )( 0 ), referenceIntegrator.getCurrentState( )( 0 ) );
+
+        // Evaluate state derivative at current state (twice, to check that second call has no effect)
+        integrator.evaluateStateDerivativeAtCurrentState( );
+        integrator.evaluateStateDerivativeAtCurrentState( );
+        BOOST_CHECK_EQUAL( lastEvaluationTime, integrator.getCurrentIndependentVariable( ) );
+    }
+
+    // Check that the state derivative at the current state is evaluated only once per step, and used as first stage
+    BOOST_CHECK_EQUAL( numberOfEvaluations, 4 + 4 * ( numberOfSteps - 1 ) + 1 );
+
+    // Check that state derivative is no longer re-used after modifying the state
+    integrator.modifyCurrentState( 2.0 * integrator.getCurrentState( ) );
+    referenceIntegrator.modifyCurrentState( 2.0 * referenceIntegrator.getCurrentState( ) );
+    integrator.performIntegrationStep( 0.1 );
+    referenceIntegrator.performIntegrationStep( 0.1 );
+    BOOST_CHECK_EQUAL( integrator.getCurrentState( )( 0 ), referenceIntegrator.getCurrentState( )( 0 ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -314,6 +314,262 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Test if state derivatives are re-used for first-same-as-last coefficient sets and rejected steps.
+BOOST_AUTO_TEST_CASE( testStateDerivativeReuse )
+{
+    using namespace numerical_integrators;
+    using namespace unit_tests::numerical_integrator_test_functions;
+
+    // Check first-same-as-last property of coefficient sets.
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get( heunEuler ).isFirstSameAsLast, true );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get( rungeKuttaFehlberg12 ).isFirstSameAsLast, true );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get( rungeKuttaFehlberg45 ).isFirstSameAsLast, false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ).isFirstSameAsLast, false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get( rungeKutta87DormandPrince ).isFirstSameAsLast, false );
+
+    // Define state derivative function that counts its number of evaluations.
+    int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return computeVanDerPolStateDerivative( time, state );
+    };
+
+    // Integrate with first-same-as-last coefficients, with and without re-use of last stage derivative.
+    {
+        const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( );
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( rungeKuttaFehlberg12 ), stateDerivativeFunction,
+                    0.0, initialState, 0.0, 10.0, 1.0E-8, 1.0E-8 );
+        integrator.setStepSizeControl( false );
+
+        RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                    RungeKuttaCoefficients::get( rungeKuttaFehlberg12 ), &computeVanDerPolStateDerivative,
+                    0.0, initialState, 0.0, 10.0, 1.0E-8, 1.0E-8 );
+        referenceIntegrator.setStepSizeControl( false );
+
+        const int numberOfSteps = 10;
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( 0.01 );
+
+            // Prevent re-use of state derivative in reference integrator
+            referenceIntegrator.modifyCurrentIntegrationVariables(
+                        referenceIntegrator.getCurrentState( ), referenceIntegrator.getCurrentIndependentVariable( ) );
+            referenceIntegrator.performIntegrationStep( 0.01 );
+
+            for( int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_EQUAL( integrator.getCurrentState( )( j ), referenceIntegrator.getCurrentState( )( j ) );
+            }
+        }
+
+        // Check that the first stage is evaluated only on the first step.
+        BOOST_CHECK_EQUAL( numberOfEvaluations, 3 + 2 * ( numberOfSteps - 1 ) );
+    }
+
+    // Check that the first stage is evaluated only once if steps are rejected.
+    {
+        int numberOfEvaluationsAtInitialTime = 0;
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > initialTimeCountingFunction =
+                [ & ]( const double time, const Eigen::VectorXd& state )
+        {
+            if( time == 0.0 )
+            {
+                numberOfEvaluationsAtInitialTime++;
+            }
+            return computeVanDerPolStateDerivative( time, state );
+        };
+
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( rungeKuttaFehlberg45 ), initialTimeCountingFunction,
+                    0.0, ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( ), 0.0, 10.0, 1.0E-12, 1.0E-12 );
+        integrator.performIntegrationStep( 1.0 );
+
+        // Check that step was rejected at least once
+        BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ) < 1.0, true );
+        BOOST_CHECK_EQUAL( numberOfEvaluationsAtInitialTime, 1 );
+    }
+}
+
+//! Test if evaluating the state derivative at the current state re-uses the stage derivatives of the integrator.
+BOOST_AUTO_TEST_CASE( testStateDerivativeEvaluationAtCurrentState )
+{
+    using namespace numerical_integrators;
+    using namespace unit_tests::numerical_integrator_test_functions;
+
+    // Define state derivative function that counts its number of evaluations, and stores its last input.
+    int numberOfEvaluations = 0;
+    double lastEvaluationTime = TUDAT_NAN;
+    Eigen::VectorXd lastEvaluationState;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        lastEvaluationTime = time;
+        lastEvaluationState = state;
+        return computeVanDerPolStateDerivative( time, state );
+    };
+
+    // Test for coefficient sets with and without first-same-as-last property.
+    std::vector< CoefficientSets > coefficientSets = { rungeKuttaFehlberg12, rungeKuttaFehlberg45 };
+    for( unsigned int test = 0; test < coefficientSets.size( ); test++ )
+    {
+        numberOfEvaluations = 0;
+        const RungeKuttaCoefficients& coefficients = RungeKuttaCoefficients::get( coefficientSets.at( test ) );
+        const int numberOfStages = coefficients.cCoefficients.rows( );
+
+        const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( );
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    coefficients, stateDerivativeFunction, 0.0, initialState, 0.0, 10.0, 1.0E-8, 1.0E-8 );
+        integrator.setStepSizeControl( false );
+        RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                    coefficients, &computeVanDerPolStateDerivative, 0.0, initialState, 0.0, 10.0, 1.0E-8, 1.0E-8 );
+        referenceIntegrator.setStepSizeControl( false );
+
+        const int numberOfSteps = 10;
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( 0.01 );
+            referenceIntegrator.performIntegrationStep( 0.01 );
+            for( int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_EQUAL( integrator.getCurrentState( )( j ), referenceIntegrator.getCurrentState( )( j ) );
+            }
+
+            // Check that last state derivative evaluation is at current state
+            integrator.evaluateStateDerivativeAtCurrentState( );
+            BOOST_CHECK_EQUAL( lastEvaluationTime, integrator.getCurrentIndependentVariable( ) );
+            for( int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_EQUAL( lastEvaluationState( j ), integrator.getCurrentState( )( j ) );
+            }
+        }
+
+        // Check that no additional evaluations are needed for first-same-as-last coefficients, and that the evaluation
+        // is re-used as first stage otherwise.
+        if( coefficients.isFirstSameAsLast )
+        {
+            BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfStages + ( numberOfStages - 1 ) * ( numberOfSteps - 1 ) );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfStages * numberOfSteps + 1 );
+        }
+    }
+}
+
+//! Test dense output (continuous extension) of the integrator
+BOOST_AUTO_TEST_CASE( testDenseOutput )
+{
+    using namespace numerical_integrators;
+
+    // Define harmonic oscillator, with state derivative function that counts its number of evaluations.
+    int numberOfEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double, const Eigen::VectorXd& state )
+    {
+        numberOfEvaluations++;
+        return ( Eigen::VectorXd( 2 ) << state( 1 ), -state( 0 ) ).finished( );
+    };
+    const Eigen::VectorXd initialState = ( Eigen::VectorXd( 2 ) << 1.0, 0.0 ).finished( );
+
+    // Test dense output for coefficient sets with and without first-same-as-last property.
+    std::vector< CoefficientSets > coefficientSets = { rungeKuttaFehlberg78, rungeKutta87DormandPrince, rungeKuttaFehlberg12 };
+    std::vector< double > tolerances = { 1.0E-10, 1.0E-10, 1.0E-4 };
+    for( unsigned int test = 0; test < coefficientSets.size( ); test++ )
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( coefficientSets.at( test ) ), stateDerivativeFunction,
+                    0.0, initialState, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+        integrator.setDenseOutput( true );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+
+        // Take steps, and check dense output at a number of points within each step.
+        double stepSize = 0.1;
+        for( int i = 0; i < 20; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+            stepSize = integrator.getNextStepSize( );
+
+            // Check that dense output is only available once the interpolant has its full set of nodes.
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), ( i >= 2 ) );
+            if( i < 2 )
+            {
+                continue;
+            }
+
+            double previousTime = integrator.getPreviousIndependentVariable( );
+            double currentTime = integrator.getCurrentIndependentVariable( );
+            for( int j = 0; j <= 4; j++ )
+            {
+                double time = previousTime + static_cast< double >( j ) / 4.0 * ( currentTime - previousTime );
+                Eigen::VectorXd denseOutputState = integrator.getDenseOutputState( time );
+                BOOST_CHECK_SMALL( std::fabs( denseOutputState( 0 ) - std::cos( time ) ), tolerances.at( test ) );
+                BOOST_CHECK_SMALL( std::fabs( denseOutputState( 1 ) + std::sin( time ) ), tolerances.at( test ) );
+            }
+
+            // Check that interpolant reproduces state at end of step.
+            BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) - integrator.getCurrentState( ) ).norm( ),
+                               1.0E-15 );
+        }
+
+        // Check that dense output is invalidated by rollback, and state modification
+        integrator.rollbackToPreviousState( );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) ), std::runtime_error );
+        for( int i = 0; i < 3; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+            BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), ( i == 2 ) );
+        }
+        integrator.modifyCurrentState( integrator.getCurrentState( ), true );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+        integrator.modifyCurrentState( 2.0 * integrator.getCurrentState( ), true );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+    }
+
+    // Check that evaluating dense output does not change the integration result, and requires only a single additional
+    // state derivative evaluation (at the end of the final step).
+    {
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ), stateDerivativeFunction,
+                    0.0, initialState, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+        integrator.setDenseOutput( true );
+
+        RungeKuttaVariableStepSizeIntegratorXd referenceIntegrator(
+                    RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ), stateDerivativeFunction,
+                    0.0, initialState, 1.0E-6, 1.0, 1.0E-12, 1.0E-12 );
+
+        const int numberOfSteps = 10;
+        std::vector< Eigen::VectorXd > referenceStates;
+        numberOfEvaluations = 0;
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            referenceStates.push_back( referenceIntegrator.performIntegrationStep(
+                                           ( i == 0 ) ? 0.1 : referenceIntegrator.getNextStepSize( ) ) );
+        }
+        int numberOfReferenceEvaluations = numberOfEvaluations;
+
+        numberOfEvaluations = 0;
+        for( int i = 0; i < numberOfSteps; i++ )
+        {
+            integrator.performIntegrationStep( ( i == 0 ) ? 0.1 : integrator.getNextStepSize( ) );
+            if( integrator.isDenseOutputAvailable( ) )
+            {
+                integrator.getDenseOutputState(
+                            ( integrator.getPreviousIndependentVariable( ) + integrator.getCurrentIndependentVariable( ) ) / 2.0 );
+            }
+            for( int j = 0; j < 2; j++ )
+            {
+                BOOST_CHECK_EQUAL( integrator.getCurrentState( )( j ), referenceStates.at( i )( j ) );
+            }
+        }
+        BOOST_CHECK_EQUAL( numberOfEvaluations, numberOfReferenceEvaluations + 1 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -15,6 +15,7 @@
 #include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/basics/parallelExecution.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
@@ -567,6 +568,55 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
 
 
 
+//! Test whether a single interpolator (with hunting algorithm lookup) can be used from multiple threads concurrently
+BOOST_AUTO_TEST_CASE( test_lagrange_concurrent_interpolation )
+{
+    std::vector< double > independentVariableVector;
+    std::vector< double > dataVector;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        independentVariableVector.push_back( 0.1 * static_cast< double >( i ) );
+        dataVector.push_back( std::sin( independentVariableVector.back( ) ) );
+    }
+
+    std::shared_ptr< interpolators::LagrangeInterpolator< double, double > > interpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, double > >(
+                independentVariableVector, dataVector, 8, interpolators::huntingAlgorithm,
+                interpolators::lagrange_cubic_spline_boundary_interpolation );
+
+    // Compute reference values on single thread
+    unsigned int numberOfEvaluations = 5000;
+    std::vector< double > evaluationTimes;
+    std::vector< double > referenceValues;
+    for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+    {
+        evaluationTimes.push_back( 99.9 * static_cast< double >( ( i * 7919 ) % numberOfEvaluations ) /
+                                   static_cast< double >( numberOfEvaluations ) );
+        referenceValues.push_back( interpolator->interpolate( evaluationTimes.back( ) ) );
+    }
+
+    // Evaluate interpolator concurrently, with each task traversing the evaluation times in a different order
+    unsigned int numberOfTasks = 8;
+    std::vector< std::vector< double > > concurrentValues(
+                numberOfTasks, std::vector< double >( numberOfEvaluations, TUDAT_NAN ) );
+    utilities::executeInParallel( numberOfTasks, [ & ]( const unsigned int taskIndex )
+    {
+        for( unsigned int i = 0; i < numberOfEvaluations; i++ )
+        {
+            unsigned int evaluationIndex = ( taskIndex % 2 == 0 ) ? i : ( numberOfEvaluations - 1 - i );
+            concurrentValues[ taskIndex ][ evaluationIndex ] = interpolator->interpolate( evaluationTimes.at( evaluationIndex ) );
+        }
+    }, 4 );
+
+    for( unsigned int i = 0; i < numberOfTasks; i++ )
+    {
+        for( unsigned int j = 0; j < numberOfEvaluations; j++ )
+        {
+            BOOST_CHECK_EQUAL( concurrentValues[ i ][ j ], referenceValues[ j ] );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
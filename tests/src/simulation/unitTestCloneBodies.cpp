@@ -0,0 +1,273 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/aerodynamics/customAerodynamicCoefficientInterface.h"
+#include "tudat/astro/aerodynamics/exponentialAtmosphere.h"
+#include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/multiArcEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/environment_setup/cloneBodies.h"
+#include "tudat/simulation/environment_setup/createGroundStations.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_clone_bodies )
+
+//! Function to create a simple system of bodies, with all environment models supported by cloneSystemOfBodies
+SystemOfBodies createBodiesToClone( )
+{
+    SystemOfBodies bodies( "Sun", "ECLIPJ2000" );
+
+    // Create Sun
+    bodies.createEmptyBody( "Sun", false );
+    bodies.at( "Sun" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Sun" )->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 1.32712440018E20 ) );
+    bodies.at( "Sun" )->setShapeModel( std::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6.96E8 ) );
+
+    // Create Earth, with spherical harmonic gravity field that updates the inertia tensor
+    bodies.createEmptyBody( "Earth", false );
+    Eigen::Vector6d earthState = Eigen::Vector6d::Zero( );
+    earthState( 0 ) = 1.5E11;
+    earthState( 4 ) = 3.0E4;
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                            earthState, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                      Eigen::Quaterniond::Identity( ), 7.29E-5, 0.0,
+                                                      "ECLIPJ2000", "IAU_Earth" ) );
+    bodies.at( "Earth" )->setShapeModel( std::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6.378E6 ) );
+    bodies.at( "Earth" )->setAtmosphereModel( std::make_shared< aerodynamics::ExponentialAtmosphere >(
+                                                  7.2E3, 290.0, 1.225 ) );
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84E-4;
+    cosineCoefficients( 2, 2 ) = 2.4E-6;
+    bodies.at( "Earth" )->setGravityFieldModel(
+                std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                    3.986004418E14, 6.378E6, cosineCoefficients, Eigen::MatrixXd::Zero( 3, 3 ), "IAU_Earth",
+                    std::bind( &Body::setBodyInertiaTensorFromGravityFieldAndExistingMeanMoment,
+                               bodies.at( "Earth" ), true ) ) );
+    bodies.at( "Earth" )->setBodyInertiaTensorFromGravityField( 0.33 );
+
+    createGroundStation( bodies.at( "Earth" ), "Station", Eigen::Vector3d( 6.378E6, 0.0, 0.0 ),
+                         coordinate_conversions::cartesian_position );
+
+    // Create vehicle, with tabulated ephemeris, aerodynamic coefficients and radiation pressure
+    bodies.createEmptyBody( "Vehicle", false );
+    bodies.at( "Vehicle" )->setEphemeris(
+                ephemerides::createEmptyTabulatedEphemeris< double, double >( "Earth", "ECLIPJ2000" ) );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 400.0 );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
+                    [ ]( const std::vector< double >& independentVariables )
+    {
+        return Eigen::Vector3d( 1.2 + 0.1 * independentVariables.at( 0 ), 0.0, 0.3 );
+    }, [ ]( const std::vector< double >& ){ return Eigen::Vector3d::Zero( ); }, 1.0, 4.0, 1.0,
+    Eigen::Vector3d::Zero( ), std::vector< aerodynamics::AerodynamicCoefficientsIndependentVariables >{
+                        aerodynamics::mach_number_dependent } ) );
+    bodies.at( "Vehicle" )->setRadiationPressureInterface(
+                "Sun", std::make_shared< electromagnetism::RadiationPressureInterface >(
+                    [ ]( ){ return 3.839E26; },
+                    std::bind( &Body::getPosition, bodies.at( "Sun" ) ),
+                    std::bind( &Body::getPosition, bodies.at( "Vehicle" ) ),
+                    1.2, 4.0,
+                    std::vector< std::function< Eigen::Vector3d( ) > >{
+                        std::bind( &Body::getPosition, bodies.at( "Earth" ) ) },
+                    std::vector< double >{ 6.378E6 }, 6.96E8, std::vector< std::string >{ "Earth" } ) );
+
+    bodies.processBodyFrameDefinitions( );
+
+    return bodies;
+}
+
+//! Test whether the models in a cloned system of bodies are correctly shared with, or independent of, the original.
+BOOST_AUTO_TEST_CASE( testSystemOfBodiesClone )
+{
+    SystemOfBodies bodies = createBodiesToClone( );
+    SystemOfBodies clonedBodies = cloneSystemOfBodies( bodies );
+
+    BOOST_CHECK_EQUAL( clonedBodies.getNumberOfBodies( ), 3 );
+    BOOST_CHECK_EQUAL( clonedBodies.getFrameOrigin( ), "Sun" );
+    BOOST_CHECK_EQUAL( clonedBodies.getFrameOrientation( ), "ECLIPJ2000" );
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        BOOST_CHECK( clonedBodies.at( bodyIterator.first ) != bodyIterator.second );
+        BOOST_CHECK_EQUAL( clonedBodies.at( bodyIterator.first )->getBodyName( ), bodyIterator.first );
+    }
+
+    // Check that immutable models are shared
+    BOOST_CHECK( clonedBodies.at( "Sun" )->getEphemeris( ) == bodies.at( "Sun" )->getEphemeris( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getShapeModel( ) == bodies.at( "Earth" )->getShapeModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getAtmosphereModel( ) == bodies.at( "Earth" )->getAtmosphereModel( ) );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getRotationalEphemeris( ) ==
+                 bodies.at( "Earth" )->getRotationalEphemeris( ) );
+
+    // Check that tabulated ephemeris is copied
+    BOOST_CHECK( clonedBodies.at( "Vehicle" )->getEphemeris( ) != bodies.at( "Vehicle" )->getEphemeris( ) );
+    BOOST_CHECK( ephemerides::isTabulatedEphemeris( clonedBodies.at( "Vehicle" )->getEphemeris( ) ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getEphemeris( )->getReferenceFrameOrigin( ), "Earth" );
+
+    // Check that gravity fields are independent, and that the inertia tensor of the cloned body is updated
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > originalEarthGravityField =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                bodies.at( "Earth" )->getGravityFieldModel( ) );
+    std::shared_ptr< gravitation::SphericalHarmonicsGravityField > clonedEarthGravityField =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                clonedBodies.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK( clonedEarthGravityField != nullptr );
+    BOOST_CHECK( clonedEarthGravityField != originalEarthGravityField );
+    BOOST_CHECK( clonedEarthGravityField->getCosineCoefficients( ) == originalEarthGravityField->getCosineCoefficients( ) );
+    BOOST_CHECK( clonedEarthGravityField->getSharedCosineCoefficients( ) ==
+                 originalEarthGravityField->getSharedCosineCoefficients( ) );
+    BOOST_CHECK( clonedEarthGravityField->getSharedSineCoefficients( ) ==
+                 originalEarthGravityField->getSharedSineCoefficients( ) );
+    BOOST_CHECK_EQUAL( clonedEarthGravityField->getFixedReferenceFrame( ), "IAU_Earth" );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getBodyInertiaTensor( ) == bodies.at( "Earth" )->getBodyInertiaTensor( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Earth" )->getScaledMeanMomentOfInertia( ), 0.33 );
+
+    Eigen::Matrix3d originalInertiaTensor = bodies.at( "Earth" )->getBodyInertiaTensor( );
+    Eigen::MatrixXd newCosineCoefficients = clonedEarthGravityField->getCosineCoefficients( );
+    newCosineCoefficients( 2, 0 ) *= 2.0;
+    clonedEarthGravityField->setCosineCoefficients( newCosineCoefficients );
+    clonedEarthGravityField->resetGravitationalParameter( 4.0E14 );
+    BOOST_CHECK( clonedEarthGravityField->getSharedCosineCoefficients( ) !=
+                 originalEarthGravityField->getSharedCosineCoefficients( ) );
+    BOOST_CHECK_EQUAL( clonedEarthGravityField->getCosineCoefficients( )( 2, 0 ), -9.68E-4 );
+    BOOST_CHECK_EQUAL( originalEarthGravityField->getCosineCoefficients( )( 2, 0 ), -4.84E-4 );
+    BOOST_CHECK_EQUAL( originalEarthGravityField->getGravitationalParameter( ), 3.986004418E14 );
+    BOOST_CHECK( bodies.at( "Earth" )->getBodyInertiaTensor( ) == originalInertiaTensor );
+    BOOST_CHECK( clonedBodies.at( "Earth" )->getBodyInertiaTensor( ) != originalInertiaTensor );
+
+    BOOST_CHECK( clonedBodies.at( "Sun" )->getGravityFieldModel( ) != bodies.at( "Sun" )->getGravityFieldModel( ) );
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Sun" )->getGravityFieldModel( )->getGravitationalParameter( ),
+                       1.32712440018E20 );
+
+    // Check mass properties
+    BOOST_CHECK_EQUAL( clonedBodies.at( "Vehicle" )->getBodyMass( ), 400.0 );
+    clonedBodies.at( "Vehicle" )->setConstantBodyMass( 300.0 );
+    BOOST_CHECK_EQUAL( bodies.at( "Vehicle" )->getBodyMass( ), 400.0 );
+    clonedBodies.at( "Earth" )->updateMass( 0.0 );
+    BOOST_CHECK_CLOSE_FRACTION( clonedBodies.at( "Earth" )->getBodyMass( ),
+                                3.986004418E14 / physical_constants::GRAVITATIONAL_CONSTANT, 1.0E-15 );
+
+    // Check that aerodynamic coefficient interfaces are independent
+    std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > originalCoefficientInterface =
+            bodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( );
+    std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > clonedCoefficientInterface =
+            clonedBodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( );
+    BOOST_CHECK( clonedCoefficientInterface != originalCoefficientInterface );
+    originalCoefficientInterface->updateCurrentCoefficients( std::vector< double >{ 2.0 } );
+    clonedCoefficientInterface->updateCurrentCoefficients( std::vector< double >{ 4.0 } );
+    BOOST_CHECK_CLOSE_FRACTION( originalCoefficientInterface->getCurrentForceCoefficients( )( 0 ), 1.4, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( clonedCoefficientInterface->getCurrentForceCoefficients( )( 0 ), 1.6, 1.0E-15 );
+    BOOST_CHECK_EQUAL( clonedCoefficientInterface->getReferenceArea( ), 4.0 );
+
+    // Check that radiation pressure interface uses states of cloned bodies
+    std::shared_ptr< electromagnetism::RadiationPressureInterface > clonedRadiationPressureInterface =
+            clonedBodies.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" );
+    BOOST_CHECK( clonedRadiationPressureInterface != bodies.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" ) );
+    BOOST_CHECK( clonedRadiationPressureInterface->getOccultingBodies( ) == std::vector< std::string >{ "Earth" } );
+    BOOST_CHECK_EQUAL( clonedRadiationPressureInterface->getRadiationPressureCoefficientFunction( )( 0.0 ), 1.2 );
+
+    Eigen::Vector6d vehicleState = Eigen::Vector6d::Zero( );
+    vehicleState( 1 ) = 1.0E11;
+    bodies.at( "Sun" )->setState( Eigen::Vector6d::Zero( ) );
+    bodies.at( "Earth" )->setState( Eigen::Vector6d::Zero( ) );
+    bodies.at( "Vehicle" )->setState( Eigen::Vector6d::Zero( ) );
+    clonedBodies.at( "Sun" )->setState( Eigen::Vector6d::Zero( ) );
+    clonedBodies.at( "Earth" )->setState( Eigen::Vector6d::Constant( 1.0E12 ) );
+    clonedBodies.at( "Vehicle" )->setState( vehicleState );
+    clonedRadiationPressureInterface->updateInterface( 0.0 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( clonedRadiationPressureInterface->getCurrentSolarVector( ),
+                                       ( -vehicleState.segment( 0, 3 ) ), 1.0E-15 );
+    BOOST_CHECK( clonedRadiationPressureInterface->getCurrentRadiationPressure( ) > 0.0 );
+
+    // Check that ground stations are recreated
+    std::shared_ptr< ground_stations::GroundStation > originalStation = bodies.at( "Earth" )->getGroundStation( "Station" );
+    std::shared_ptr< ground_stations::GroundStation > clonedStation = clonedBodies.at( "Earth" )->getGroundStation( "Station" );
+    BOOST_CHECK( clonedStation != originalStation );
+    BOOST_CHECK( clonedStation->getNominalStationState( ) != originalStation->getNominalStationState( ) );
+    BOOST_CHECK( clonedStation->getNominalStationState( )->getNominalCartesianPosition( ) ==
+                 originalStation->getNominalStationState( )->getNominalCartesianPosition( ) );
+
+    // Check that the arcs of a multi-arc ephemeris are copied
+    std::map< double, std::shared_ptr< ephemerides::Ephemeris > > singleArcEphemerides;
+    singleArcEphemerides[ 0.0 ] = ephemerides::createEmptyTabulatedEphemeris< double, double >( "Earth", "ECLIPJ2000" );
+    singleArcEphemerides[ 1.0E4 ] = std::make_shared< ephemerides::ConstantEphemeris >(
+                vehicleState, "Earth", "ECLIPJ2000" );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                              singleArcEphemerides, "Earth", "ECLIPJ2000" ) );
+    std::shared_ptr< ephemerides::MultiArcEphemeris > clonedMultiArcEphemeris =
+            std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >(
+                cloneSystemOfBodies( bodies ).at( "Vehicle" )->getEphemeris( ) );
+    BOOST_CHECK( clonedMultiArcEphemeris != nullptr );
+    BOOST_CHECK( clonedMultiArcEphemeris != bodies.at( "Vehicle" )->getEphemeris( ) );
+    BOOST_CHECK( clonedMultiArcEphemeris->getArcSplitTimes( ) ==
+                 ( std::vector< double >{ 0.0, 1.0E4, std::numeric_limits< double >::max( ) } ) );
+    BOOST_CHECK( clonedMultiArcEphemeris->getSingleArcEphemerides( ).at( 0 ) != singleArcEphemerides.at( 0.0 ) );
+    BOOST_CHECK( clonedMultiArcEphemeris->getSingleArcEphemerides( ).at( 1 ) == singleArcEphemerides.at( 1.0E4 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( clonedMultiArcEphemeris->getCartesianState( 2.0E4 ), vehicleState, 1.0E-15 );
+}
+
+//! Gravity field type that is not supported by cloneSystemOfBodies
+class UnsupportedGravityField: public gravitation::GravityFieldModel
+{
+public:
+    UnsupportedGravityField( const double gravitationalParameter ):
+        gravitation::GravityFieldModel( gravitationalParameter ){ }
+};
+
+//! Test whether unsupported models are rejected when cloning bodies
+BOOST_AUTO_TEST_CASE( testSystemOfBodiesCloneErrors )
+{
+    SystemOfBodies bodies = createBodiesToClone( );
+    bodies.at( "Sun" )->setGravityFieldModel( std::make_shared< UnsupportedGravityField >( 1.32712440018E20 ) );
+    BOOST_CHECK_THROW( cloneSystemOfBodies( bodies ), std::runtime_error );
+
+    bodies = createBodiesToClone( );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                std::make_shared< aerodynamics::ScaledAerodynamicCoefficientInterface >(
+                    bodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( ),
+                    [ ]( const double ){ return Eigen::Vector3d::Constant( 1.1 ); },
+                    [ ]( const double ){ return Eigen::Vector3d::Constant( 1.1 ); } ) );
+    BOOST_CHECK_THROW( cloneSystemOfBodies( bodies ), std::runtime_error );
+
+    // Ephemerides that wrap other models are not supported
+    bodies = createBodiesToClone( );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::ScaledEphemeris >(
+                                            bodies.at( "Earth" )->getEphemeris( ),
+                                            [ ]( const double ){ return Eigen::Vector6d::Zero( ); } ) );
+    BOOST_CHECK_THROW( cloneSystemOfBodies( bodies ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat